@@ -0,0 +1,118 @@
+/*
+ * QuickJS C API test
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "quickjs.h"
+
+static JSValue eval(JSContext *ctx, const char *str)
+{
+    JSValue val;
+
+    val = JS_Eval(ctx, str, strlen(str), "<input>", JS_EVAL_TYPE_GLOBAL);
+    assert(!JS_IsException(val));
+    return val;
+}
+
+/* maximum number of empty slabs kept by the object pools (one per
+   size class) */
+#define JS_POOL_CACHE_MAX 16
+
+static int rejection_count;
+
+static void promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
+                                      JSValueConst reason,
+                                      JS_BOOL is_handled, void *opaque)
+{
+    const char *str;
+    size_t len;
+
+    /* the reason is a concatenated string: it must not be an
+       internal rope */
+    assert(JS_VALUE_GET_TAG(reason) == JS_TAG_STRING);
+    assert(JS_IsString(reason));
+    str = JS_ToCStringLen(ctx, &len, reason);
+    assert(str && len == 1201 && str[600] == 'b');
+    JS_FreeCString(ctx, str);
+    assert(is_handled == (rejection_count == 1));
+    rejection_count++;
+}
+
+static void test_promise_rejection_tracker(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    JS_SetHostPromiseRejectionTracker(rt, promise_rejection_tracker, NULL);
+    /* unhandled rejection, then handled */
+    val = eval(ctx, "var s = 'a'.repeat(600);"
+               "var p = Promise.reject(s + 'b' + s);");
+    JS_FreeValue(ctx, val);
+    assert(rejection_count == 1);
+    val = eval(ctx, "p.catch(() => {});");
+    JS_FreeValue(ctx, val);
+    assert(rejection_count == 2);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+static void test_pool_release(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    JSMemoryUsage m0, m1, m2;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    JS_ComputeMemoryUsage(rt, &m0);
+    /* allocate a burst of small objects, then free them */
+    val = eval(ctx, "var a = [];"
+               "for(var i = 0; i < 100000; i++) a.push({ x: i, y: [i] });");
+    JS_FreeValue(ctx, val);
+    JS_ComputeMemoryUsage(rt, &m1);
+    val = eval(ctx, "a = null;");
+    JS_FreeValue(ctx, val);
+    JS_RunGC(rt);
+    JS_ComputeMemoryUsage(rt, &m2);
+    /* the empty slabs must be returned to malloc (the pools are
+       disabled with the address sanitizer) */
+    if (m1.pool_count != 0) {
+        assert(m1.pool_count > m0.pool_count + 100);
+        assert(m2.pool_count <= m0.pool_count + JS_POOL_CACHE_MAX);
+    }
+    assert(m2.malloc_size < m0.malloc_size + (m1.malloc_size - m0.malloc_size) / 4);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+int main(int argc, char **argv)
+{
+    test_promise_rejection_tracker();
+    test_pool_release();
+    return 0;
+}
@@ -37,10 +37,6 @@
   - Add full unicode canonicalize rules for character ranges (not
     really useful but needed for exact "ignorecase" compatibility).
 
-  - Add a lock step execution mode (=linear time execution guaranteed)
-    when the regular expression is "simple" i.e. no backreference nor
-    complicated lookahead. The opcodes are designed for this execution
-    model.
 */
 
 #if defined(TEST)
@@ -103,8 +99,36 @@ static const REOpCode reopcode_info[REOP_COUNT] = {
 #define RE_HEADER_FLAGS         0
 #define RE_HEADER_CAPTURE_COUNT 1
 #define RE_HEADER_STACK_SIZE    2
+#define RE_HEADER_BYTECODE_LEN  3
+#define RE_HEADER_PREFILTER_LEN 7
+
+#define RE_HEADER_LEN 8
+
+/* size of the implicit '.*?' loop at the start of non sticky regexps */
+#define RE_SEARCH_LOOP_LEN (5 + 1 + 5)
+
+/* Optional search prefilter stored after the bytecode. The first byte
+   is its kind:
+   RE_PREFILTER_PREFIX: u8 len, u8 is_wide, 'len' 8 bit chars (only
+   valid if is_wide = 0), 'len' 16 bit chars. A match always starts
+   with these UTF-16 code units.
+   RE_PREFILTER_CHARSET: u8 high, 256 bit bitmap of the first 8 bit
+   chars of a match. If 'high' is set, any char >= 256 may also start
+   a match. */
+enum {
+    RE_PREFILTER_PREFIX,
+    RE_PREFILTER_CHARSET,
+};
+
+#define RE_PREFIX_LEN_MAX 16
+
+/* number of backtracking failures before switching to the lock step
+   execution */
+#define RE_BACKTRACK_MIN      1024
+#define RE_BACKTRACK_PER_CHAR 16
 
-#define RE_HEADER_LEN 7
+/* number of execution steps between two calls to lre_check_timeout() */
+#define RE_POLL_INTERVAL      1024
 
 static inline int is_digit(int c) {
     return c >= '0' && c <= '9';
@@ -274,19 +298,35 @@ static int cr_canonicalize(CharRange *cr)
 static __maybe_unused void lre_dump_bytecode(const uint8_t *buf,
                                                      int buf_len)
 {
-    int pos, len, opcode, bc_len, re_flags, i;
+    int pos, len, opcode, bc_len, pf_len, re_flags, i;
     uint32_t val;
     
     assert(buf_len >= RE_HEADER_LEN);
 
     re_flags=  buf[0];
-    bc_len = get_u32(buf + 3);
-    assert(bc_len + RE_HEADER_LEN <= buf_len);
+    bc_len = get_u32(buf + RE_HEADER_BYTECODE_LEN);
+    pf_len = buf[RE_HEADER_PREFILTER_LEN];
+    assert(bc_len + pf_len + RE_HEADER_LEN <= buf_len);
     printf("flags: 0x%x capture_count=%d stack_size=%d\n",
            re_flags, buf[1], buf[2]);
+    if (pf_len != 0) {
+        const uint8_t *pf = buf + RE_HEADER_LEN + bc_len;
+        if (pf[0] == RE_PREFILTER_PREFIX) {
+            printf("prefix:");
+            for(i = 0; i < pf[1]; i++)
+                printf(" 0x%04x", get_u16(pf + 3 + pf[1] + i * 2));
+        } else {
+            printf("first chars:%s", pf[1] ? " >=0x100" : "");
+            for(i = 0; i < 256; i++) {
+                if ((pf[2 + (i >> 3)] >> (i & 7)) & 1)
+                    printf(" 0x%02x", i);
+            }
+        }
+        printf("\n");
+    }
     if (re_flags & LRE_FLAG_NAMED_GROUPS) {
         const char *p;
-        p = (char *)buf + RE_HEADER_LEN + bc_len;
+        p = (char *)buf + RE_HEADER_LEN + bc_len + pf_len;
         printf("named groups: ");
         for(i = 1; i < buf[1]; i++) {
             if (i != 1)
@@ -1769,6 +1809,36 @@ static int re_parse_disjunction(REParseState *s, BOOL is_backward_dir)
     return 0;
 }
 
+/* return TRUE if the bytecode can be executed in lock step */
+static BOOL re_can_lock_step(const uint8_t *bc_buf, int bc_buf_len)
+{
+    int pos, opcode, len;
+
+    bc_buf += RE_HEADER_LEN;
+    bc_buf_len -= RE_HEADER_LEN;
+    pos = 0;
+    while (pos < bc_buf_len) {
+        opcode = bc_buf[pos];
+        len = reopcode_info[opcode].size;
+        switch(opcode) {
+        case REOP_back_reference:
+        case REOP_backward_back_reference:
+        case REOP_lookahead:
+        case REOP_negative_lookahead:
+        case REOP_prev:
+            return FALSE;
+        case REOP_range:
+            len += get_u16(bc_buf + pos + 1) * 4;
+            break;
+        case REOP_range32:
+            len += get_u16(bc_buf + pos + 1) * 8;
+            break;
+        }
+        pos += len;
+    }
+    return TRUE;
+}
+
 /* the control flow is recursive so the analysis can be linear */
 static int compute_stack_size(const uint8_t *bc_buf, int bc_buf_len)
 {
@@ -1814,6 +1884,182 @@ static int compute_stack_size(const uint8_t *bc_buf, int bc_buf_len)
     return stack_size_max;
 }
 
+typedef struct {
+    uint8_t bitmap[32]; /* chars < 256 */
+    BOOL high; /* TRUE if chars >= 256 are possible */
+    int op_count;
+} RECharSet;
+
+static void re_charset_add_range(REParseState *s, RECharSet *cs,
+                                 uint32_t low, uint32_t high)
+{
+    uint32_t c;
+    if (s->ignore_case) {
+        /* the input chars are canonicalized before the comparison */
+        for(c = 0; c < 256; c++) {
+            uint32_t c1 = lre_canonicalize(c, s->is_utf16);
+            if (c1 >= low && c1 <= high)
+                cs->bitmap[c >> 3] |= 1 << (c & 7);
+        }
+        cs->high = TRUE;
+    } else {
+        for(c = low; c <= min_uint32(high, 255); c++)
+            cs->bitmap[c >> 3] |= 1 << (c & 7);
+        if (high >= 256)
+            cs->high = TRUE;
+    }
+}
+
+/* Add to 'cs' the chars which can be matched first by the bytecode
+   starting at 'pos'. Return -1 if the first char cannot be
+   predicted (the match may be empty or may look backward). */
+static int re_get_first_chars(REParseState *s, RECharSet *cs,
+                              const uint8_t *bc_buf, int pos)
+{
+    int opcode, n, i;
+    uint32_t val;
+
+    for(;;) {
+        /* bound the analysis of the complicated regexps */
+        if (++cs->op_count > 1000)
+            return -1;
+        opcode = bc_buf[pos];
+        switch(opcode) {
+        case REOP_save_start:
+        case REOP_save_end:
+        case REOP_save_reset:
+            pos += reopcode_info[opcode].size;
+            break;
+        case REOP_goto:
+            pos += 5 + (int)get_u32(bc_buf + pos + 1);
+            break;
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+            if (re_get_first_chars(s, cs, bc_buf, pos + 5))
+                return -1;
+            pos += 5 + (int)get_u32(bc_buf + pos + 1);
+            break;
+        case REOP_simple_greedy_quant:
+            if (re_get_first_chars(s, cs, bc_buf, pos + 17))
+                return -1;
+            if (get_u32(bc_buf + pos + 5) != 0)
+                return 0;
+            pos += 17 + (int)get_u32(bc_buf + pos + 1);
+            break;
+        case REOP_char:
+            val = get_u16(bc_buf + pos + 1);
+            re_charset_add_range(s, cs, val, val);
+            return 0;
+        case REOP_char32:
+            val = get_u32(bc_buf + pos + 1);
+            re_charset_add_range(s, cs, val, val);
+            return 0;
+        case REOP_dot:
+            re_charset_add_range(s, cs, 0, '\n' - 1);
+            re_charset_add_range(s, cs, '\n' + 1, '\r' - 1);
+            re_charset_add_range(s, cs, '\r' + 1, 0x10ffff);
+            return 0;
+        case REOP_range:
+            n = get_u16(bc_buf + pos + 1);
+            for(i = 0; i < n; i++) {
+                uint32_t low, high;
+                low = get_u16(bc_buf + pos + 3 + i * 4);
+                high = get_u16(bc_buf + pos + 3 + i * 4 + 2);
+                /* 0xffff in for last value means +infinity */
+                if (high == 0xffff)
+                    high = 0x10ffff;
+                re_charset_add_range(s, cs, low, high);
+            }
+            return 0;
+        case REOP_range32:
+            n = get_u16(bc_buf + pos + 1);
+            for(i = 0; i < n; i++) {
+                re_charset_add_range(s, cs, get_u32(bc_buf + pos + 3 + i * 8),
+                                     get_u32(bc_buf + pos + 3 + i * 8 + 4));
+            }
+            return 0;
+        default:
+            return -1;
+        }
+    }
+}
+
+/* Compute the search prefilter of a non sticky regexp. 'pos' is the
+   position of the first opcode after 'save_start 0'. Return its
+   length in 'buf' or 0 if none. */
+static int re_compute_prefilter(REParseState *s, uint8_t *buf,
+                                const uint8_t *bc_buf, int pos)
+{
+    uint16_t prefix[RE_PREFIX_LEN_MAX];
+    int len, i, opcode;
+    uint32_t c;
+    BOOL is_wide;
+    RECharSet cs;
+
+    /* literal prefix */
+    len = 0;
+    is_wide = FALSE;
+    if (!s->ignore_case) {
+        for(;;) {
+            opcode = bc_buf[pos];
+            if (opcode == REOP_save_start ||
+                opcode == REOP_save_end ||
+                opcode == REOP_save_reset) {
+                pos += reopcode_info[opcode].size;
+            } else if (opcode == REOP_char || opcode == REOP_char32) {
+                if (opcode == REOP_char)
+                    c = get_u16(bc_buf + pos + 1);
+                else
+                    c = get_u32(bc_buf + pos + 1);
+                if (c >= 0x10000) {
+                    if (len + 2 > RE_PREFIX_LEN_MAX)
+                        break;
+                    c -= 0x10000;
+                    prefix[len++] = 0xd800 | (c >> 10);
+                    prefix[len++] = 0xdc00 | (c & 0x3ff);
+                    is_wide = TRUE;
+                } else {
+                    if (len + 1 > RE_PREFIX_LEN_MAX)
+                        break;
+                    prefix[len++] = c;
+                    if (c >= 256)
+                        is_wide = TRUE;
+                }
+                pos += reopcode_info[opcode].size;
+            } else {
+                break;
+            }
+        }
+    }
+    if (len > 0) {
+        buf[0] = RE_PREFILTER_PREFIX;
+        buf[1] = len;
+        buf[2] = is_wide;
+        for(i = 0; i < len; i++) {
+            buf[3 + i] = prefix[i];
+            put_u16(buf + 3 + len + i * 2, prefix[i]);
+        }
+        return 3 + 3 * len;
+    }
+
+    /* set of the possible first chars */
+    memset(&cs, 0, sizeof(cs));
+    if (re_get_first_chars(s, &cs, bc_buf, pos))
+        return 0;
+    if (cs.high) {
+        for(i = 0; i < 32; i++) {
+            if (cs.bitmap[i] != 0xff)
+                break;
+        }
+        if (i == 32)
+            return 0; /* useless */
+    }
+    buf[0] = RE_PREFILTER_CHARSET;
+    buf[1] = cs.high;
+    memcpy(buf + 2, cs.bitmap, 32);
+    return 2 + 32;
+}
+
 /* 'buf' must be a zero terminated UTF-8 string of length buf_len.
    Return NULL if error and allocate an error message in *perror_msg,
    otherwise the compiled bytecode and its length in plen.
@@ -1847,6 +2093,7 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
     dbuf_putc(&s->byte_code, 0); /* second element is the number of captures */
     dbuf_putc(&s->byte_code, 0); /* stack size */
     dbuf_put_u32(&s->byte_code, 0); /* bytecode length */
+    dbuf_putc(&s->byte_code, 0); /* prefilter length */
     
     if (!is_sticky) {
         /* iterate thru all positions (about the same as .*?( ... ) )
@@ -1888,9 +2135,25 @@ uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
         goto error;
     }
     
+    if (re_can_lock_step(s->byte_code.buf, s->byte_code.size))
+        s->byte_code.buf[RE_HEADER_FLAGS] |= LRE_FLAG_LOCK_STEP;
     s->byte_code.buf[RE_HEADER_CAPTURE_COUNT] = s->capture_count;
     s->byte_code.buf[RE_HEADER_STACK_SIZE] = stack_size;
-    put_u32(s->byte_code.buf + 3, s->byte_code.size - RE_HEADER_LEN);
+    put_u32(s->byte_code.buf + RE_HEADER_BYTECODE_LEN,
+            s->byte_code.size - RE_HEADER_LEN);
+
+    if (!is_sticky) {
+        uint8_t pf_buf[3 + 3 * RE_PREFIX_LEN_MAX];
+        int pf_len;
+        /* skip the search loop and 'save_start 0' */
+        pf_len = re_compute_prefilter(s, pf_buf, s->byte_code.buf + RE_HEADER_LEN,
+                                      RE_SEARCH_LOOP_LEN + 2);
+        if (dbuf_put(&s->byte_code, pf_buf, pf_len)) {
+            re_parse_out_of_memory(s);
+            goto error;
+        }
+        s->byte_code.buf[RE_HEADER_PREFILTER_LEN] = pf_len;
+    }
 
     /* add the named groups if needed */
     if (s->group_names.size > (s->capture_count - 1)) {
@@ -2045,6 +2308,16 @@ typedef struct {
     uint8_t *state_stack;
     size_t state_stack_size;
     size_t state_stack_len;
+
+    /* a step is a backtracking failure or a thread transition in
+       the lock step execution. The backtracking execution is stopped
+       after 'backtrack_max' steps if the regexp can be executed in
+       lock step. lre_check_timeout() is called when 'step_count'
+       reaches 'poll_count'. */
+    uint64_t step_count;
+    uint64_t step_check; /* min(backtrack_max, poll_count) */
+    uint64_t backtrack_max;
+    uint64_t poll_count;
 } REExecContext;
 
 static int push_state(REExecContext *s,
@@ -2085,7 +2358,82 @@ static int push_state(REExecContext *s,
     return 0;
 }
 
-/* return 1 if match, 0 if not match or -1 if error. */
+/* 'pc' points to a REOP_range or REOP_range32 opcode. Return TRUE if
+   'c' is in the range. */
+static BOOL re_range_match(const uint8_t *pc, uint32_t c)
+{
+    int n;
+    uint32_t low, high, idx_min, idx_max, idx;
+    
+    n = get_u16(pc + 1); /* n must be >= 1 */
+    pc += 3;
+    if (pc[-3] == REOP_range) {
+        low = get_u16(pc + 0 * 4);
+        if (c < low)
+            return FALSE;
+        idx_max = n - 1;
+        high = get_u16(pc + idx_max * 4 + 2);
+        /* 0xffff in for last value means +infinity */
+        if (unlikely(c >= 0xffff) && high == 0xffff)
+            return TRUE;
+        if (c > high)
+            return FALSE;
+        idx_min = 0;
+        while (idx_min <= idx_max) {
+            idx = (idx_min + idx_max) / 2;
+            low = get_u16(pc + idx * 4);
+            high = get_u16(pc + idx * 4 + 2);
+            if (c < low)
+                idx_max = idx - 1;
+            else if (c > high)
+                idx_min = idx + 1;
+            else
+                return TRUE;
+        }
+    } else {
+        low = get_u32(pc + 0 * 8);
+        if (c < low)
+            return FALSE;
+        idx_max = n - 1;
+        high = get_u32(pc + idx_max * 8 + 4);
+        if (c > high)
+            return FALSE;
+        idx_min = 0;
+        while (idx_min <= idx_max) {
+            idx = (idx_min + idx_max) / 2;
+            low = get_u32(pc + idx * 8);
+            high = get_u32(pc + idx * 8 + 4);
+            if (c < low)
+                idx_max = idx - 1;
+            else if (c > high)
+                idx_min = idx + 1;
+            else
+                return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* called when 'step_count' reaches 'step_check'. Return 0 if the
+   execution can continue, -2 if it must be stopped or -3 if it must
+   continue in lock step. */
+static int re_check_steps(REExecContext *s)
+{
+    if (s->step_count >= s->backtrack_max)
+        return -3;
+    if (s->step_count >= s->poll_count) {
+        if (lre_check_timeout(s->opaque, s->step_count))
+            return -2;
+        s->poll_count = s->step_count + RE_POLL_INTERVAL;
+    }
+    s->step_check = s->poll_count;
+    if (s->backtrack_max < s->step_check)
+        s->step_check = s->backtrack_max;
+    return 0;
+}
+
+/* return 1 if match, 0 if not match, -1 if error, -2 if interrupted
+   or -3 if too many backtracking steps were done. */
 static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                                    StackInt *stack, int stack_len,
                                    const uint8_t *pc, const uint8_t *cptr,
@@ -2113,6 +2461,11 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
             no_match:
                 if (no_recurse)
                     return 0;
+                if (unlikely(++s->step_count >= s->step_check)) {
+                    ret = re_check_steps(s);
+                    if (ret < 0)
+                        return ret;
+                }
                 ret = 0;
             recurse:
                 for(;;) {
@@ -2365,81 +2718,16 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
             }
             break;
         case REOP_range:
-            {
-                int n;
-                uint32_t low, high, idx_min, idx_max, idx;
-                
-                n = get_u16(pc); /* n must be >= 1 */
-                pc += 2;
-                if (cptr >= cbuf_end)
-                    goto no_match;
-                GET_CHAR(c, cptr, cbuf_end);
-                if (s->ignore_case) {
-                    c = lre_canonicalize(c, s->is_utf16);
-                }
-                idx_min = 0;
-                low = get_u16(pc + 0 * 4);
-                if (c < low)
-                    goto no_match;
-                idx_max = n - 1;
-                high = get_u16(pc + idx_max * 4 + 2);
-                /* 0xffff in for last value means +infinity */
-                if (unlikely(c >= 0xffff) && high == 0xffff)
-                    goto range_match;
-                if (c > high)
-                    goto no_match;
-                while (idx_min <= idx_max) {
-                    idx = (idx_min + idx_max) / 2;
-                    low = get_u16(pc + idx * 4);
-                    high = get_u16(pc + idx * 4 + 2);
-                    if (c < low)
-                        idx_max = idx - 1;
-                    else if (c > high)
-                        idx_min = idx + 1;
-                    else
-                        goto range_match;
-                }
-                goto no_match;
-            range_match:
-                pc += 4 * n;
-            }
-            break;
         case REOP_range32:
-            {
-                int n;
-                uint32_t low, high, idx_min, idx_max, idx;
-                
-                n = get_u16(pc); /* n must be >= 1 */
-                pc += 2;
-                if (cptr >= cbuf_end)
-                    goto no_match;
-                GET_CHAR(c, cptr, cbuf_end);
-                if (s->ignore_case) {
-                    c = lre_canonicalize(c, s->is_utf16);
-                }
-                idx_min = 0;
-                low = get_u32(pc + 0 * 8);
-                if (c < low)
-                    goto no_match;
-                idx_max = n - 1;
-                high = get_u32(pc + idx_max * 8 + 4);
-                if (c > high)
-                    goto no_match;
-                while (idx_min <= idx_max) {
-                    idx = (idx_min + idx_max) / 2;
-                    low = get_u32(pc + idx * 8);
-                    high = get_u32(pc + idx * 8 + 4);
-                    if (c < low)
-                        idx_max = idx - 1;
-                    else if (c > high)
-                        idx_min = idx + 1;
-                    else
-                        goto range32_match;
-                }
+            if (cptr >= cbuf_end)
                 goto no_match;
-            range32_match:
-                pc += 8 * n;
+            GET_CHAR(c, cptr, cbuf_end);
+            if (s->ignore_case) {
+                c = lre_canonicalize(c, s->is_utf16);
             }
+            if (!re_range_match(pc - 1, c))
+                goto no_match;
+            pc += get_u16(pc) * (4 << (opcode - REOP_range)) + 2;
             break;
         case REOP_prev:
             /* go to the previous char */
@@ -2465,7 +2753,7 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                 for(;;) {
                     res = lre_exec_backtrack(s, capture, stack, stack_len,
                                              pc1, cptr, TRUE);
-                    if (res == -1)
+                    if (res < 0)
                         return res;
                     if (!res)
                         break;
@@ -2493,7 +2781,573 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
     }
 }
 
-/* Return 1 if match, 0 if not match or -1 if error. cindex is the
+static inline BOOL re_charset_test(const uint8_t *pf, uint32_t c)
+{
+    if (c < 256)
+        return (pf[2 + (c >> 3)] >> (c & 7)) & 1;
+    else
+        return pf[1];
+}
+
+/* Return the first position >= cptr where a match may start according
+   to the prefilter 'pf' or NULL if there is none. */
+static const uint8_t *re_prefilter_next(REExecContext *s, const uint8_t *pf,
+                                        const uint8_t *cptr,
+                                        const uint8_t *cptr_start)
+{
+    const uint8_t *cbuf_end = s->cbuf_end;
+    int len, i;
+
+    if (s->cbuf_type == 0) {
+        if (pf[0] == RE_PREFILTER_PREFIX) {
+            const uint8_t *prefix = pf + 3;
+            len = pf[1];
+            if (pf[2])
+                return NULL; /* not representable with 8 bit chars */
+            while ((cbuf_end - cptr) >= len) {
+                cptr = memchr(cptr, prefix[0], (cbuf_end - cptr) - len + 1);
+                if (!cptr)
+                    return NULL;
+                if (!memcmp(cptr + 1, prefix + 1, len - 1))
+                    return cptr;
+                cptr++;
+            }
+            return NULL;
+        } else {
+            for(; cptr < cbuf_end; cptr++) {
+                if (re_charset_test(pf, *cptr))
+                    return cptr;
+            }
+            return NULL;
+        }
+    } else {
+        const uint16_t *p, *p_end;
+        p = (const uint16_t *)cptr;
+        p_end = (const uint16_t *)cbuf_end;
+        if (pf[0] == RE_PREFILTER_PREFIX) {
+            const uint8_t *prefix = pf + 3 + pf[1];
+            uint16_t c0;
+            len = pf[1];
+            c0 = get_u16(prefix);
+            for(; (p_end - p) >= len; p++) {
+                if (*p != c0)
+                    continue;
+                for(i = 1; i < len; i++) {
+                    if (p[i] != get_u16(prefix + 2 * i))
+                        break;
+                }
+                if (i == len)
+                    goto found;
+                continue;
+            found:
+                /* the match cannot start inside a surrogate pair */
+                if (s->cbuf_type == 2 && (const uint8_t *)p > cptr_start &&
+                    p[0] >= 0xdc00 && p[0] < 0xe000 &&
+                    p[-1] >= 0xd800 && p[-1] < 0xdc00)
+                    continue;
+                return (const uint8_t *)p;
+            }
+            return NULL;
+        } else {
+            for(; p < p_end; p++) {
+                if (!re_charset_test(pf, *p))
+                    continue;
+                if (s->cbuf_type == 2 && (const uint8_t *)p > cptr_start &&
+                    p[0] >= 0xdc00 && p[0] < 0xe000 &&
+                    p[-1] >= 0xd800 && p[-1] < 0xdc00)
+                    continue;
+                return (const uint8_t *)p;
+            }
+            return NULL;
+        }
+    }
+}
+
+/* Lock step execution: all the threads advance by one char at the
+   same time and a thread is dropped when a higher priority thread
+   reached the same state at the same position. The result is the same
+   as the backtracking execution if there is no back reference nor
+   lookaround. The number of states at each position only depends on
+   the regexp, hence the execution time is linear in the input
+   length. */
+
+typedef struct REThread {
+    const uint8_t *pc;
+    /* simple_greedy_quant opcode if inside its atom */
+    const uint8_t *quant_pc;
+    uint32_t quant_count;
+    int stack_len;
+    void *buf[0]; /* captures followed by the stack */
+} REThread;
+
+typedef struct {
+    uint8_t *threads;
+    int count;
+    int size;
+} REThreadList;
+
+typedef struct {
+    int next;
+    uint32_t quant_count;
+    int stack_len;
+    StackInt stack[0];
+} REVisitedState;
+
+typedef struct {
+    const uint8_t *bc_start;
+    size_t thread_size;
+    REThreadList lists[2];
+    /* set of the states of the thread list being built */
+    uint32_t gen;
+    uint32_t *visited_gen; /* indexed by pc */
+    int *visited_head; /* indexed by pc */
+    uint8_t *visited;
+    int visited_count;
+    int visited_size;
+    size_t visited_state_size;
+    /* value pushed by push_char_pos at the current position. The
+       values pushed at a previous position are replaced by
+       RE_CHAR_POS_TAG so that they do not create new states. */
+    StackInt char_pos;
+} RELockStep;
+
+#define RE_CHAR_POS_TAG ((StackInt)1 << (sizeof(StackInt) * 8 - 1))
+
+static inline uint8_t **re_thread_capture(REThread *t)
+{
+    return (uint8_t **)t->buf;
+}
+
+static inline StackInt *re_thread_stack(REExecContext *s, REThread *t)
+{
+    return (StackInt *)(t->buf + 2 * s->capture_count);
+}
+
+/* return 1 if the state of 't' was already visited, 0 if not (it is
+   then added to the set) or -1 if memory error */
+static int re_lock_step_visited(REExecContext *s, RELockStep *ls, REThread *t)
+{
+    REVisitedState *vs;
+    StackInt *stack;
+    int pos, idx;
+
+    pos = t->pc - ls->bc_start;
+    stack = re_thread_stack(s, t);
+    if (ls->visited_gen[pos] != ls->gen) {
+        ls->visited_gen[pos] = ls->gen;
+        ls->visited_head[pos] = -1;
+    } else {
+        for(idx = ls->visited_head[pos]; idx >= 0; idx = vs->next) {
+            vs = (REVisitedState *)(ls->visited + idx * ls->visited_state_size);
+            if (vs->quant_count == t->quant_count &&
+                vs->stack_len == t->stack_len &&
+                !memcmp(vs->stack, stack, t->stack_len * sizeof(stack[0])))
+                return 1;
+        }
+    }
+    if (ls->visited_count >= ls->visited_size) {
+        int new_size;
+        uint8_t *new_visited;
+        new_size = max_int(ls->visited_size * 3 / 2, 16);
+        new_visited = lre_realloc(s->opaque, ls->visited,
+                                  new_size * ls->visited_state_size);
+        if (!new_visited)
+            return -1;
+        ls->visited = new_visited;
+        ls->visited_size = new_size;
+    }
+    idx = ls->visited_count++;
+    vs = (REVisitedState *)(ls->visited + idx * ls->visited_state_size);
+    vs->next = ls->visited_head[pos];
+    vs->quant_count = t->quant_count;
+    vs->stack_len = t->stack_len;
+    memcpy(vs->stack, stack, t->stack_len * sizeof(stack[0]));
+    ls->visited_head[pos] = idx;
+    return 0;
+}
+
+static int re_lock_step_push(REExecContext *s, RELockStep *ls,
+                             REThreadList *l, REThread *t)
+{
+    if (l->count >= l->size) {
+        int new_size;
+        uint8_t *new_threads;
+        new_size = max_int(l->size * 3 / 2, 8);
+        new_threads = lre_realloc(s->opaque, l->threads,
+                                  new_size * ls->thread_size);
+        if (!new_threads)
+            return -1;
+        l->threads = new_threads;
+        l->size = new_size;
+    }
+    memcpy(l->threads + l->count * ls->thread_size, t, ls->thread_size);
+    l->count++;
+    return 0;
+}
+
+/* follow the non consuming opcodes of the thread 't' at position
+   'cptr' and add the resulting threads to 'l' by priority
+   order. 't' is modified. Return -1 if error. */
+static int re_lock_step_add(REExecContext *s, RELockStep *ls,
+                            REThreadList *l, REThread *t,
+                            const uint8_t *cptr)
+{
+    int cbuf_type, ret, opcode;
+    uint32_t val, c, quant_min, quant_max;
+    const uint8_t *pc, *pc1;
+    uint8_t **capture;
+    StackInt *stack;
+    REThread *t1;
+
+    cbuf_type = s->cbuf_type;
+    capture = re_thread_capture(t);
+    stack = re_thread_stack(s, t);
+    for(;;) {
+        ret = re_lock_step_visited(s, ls, t);
+        if (ret < 0)
+            return -1;
+        if (ret)
+            return 0;
+        pc = t->pc;
+        opcode = *pc;
+        switch(opcode) {
+        case REOP_char:
+        case REOP_char32:
+        case REOP_dot:
+        case REOP_any:
+        case REOP_range:
+        case REOP_range32:
+            return re_lock_step_push(s, ls, l, t);
+        case REOP_match:
+            if (!t->quant_pc)
+                return re_lock_step_push(s, ls, l, t);
+            /* end of one iteration of a simple greedy quantifier */
+            t->quant_count++;
+            goto quant;
+        case REOP_simple_greedy_quant:
+            t->quant_pc = pc;
+            t->quant_count = 0;
+        quant:
+            pc = t->quant_pc;
+            quant_min = get_u32(pc + 5);
+            quant_max = get_u32(pc + 9);
+            /* the following iterations are identical */
+            if (quant_max == INT32_MAX && t->quant_count > quant_min)
+                t->quant_count = quant_min;
+            if (t->quant_count < quant_max) {
+                if (t->quant_count >= quant_min) {
+                    if (lre_check_stack_overflow(s->opaque, ls->thread_size))
+                        return -1;
+                    t1 = alloca(ls->thread_size);
+                    memcpy(t1, t, ls->thread_size);
+                    t1->pc = pc + 17;
+                    if (re_lock_step_add(s, ls, l, t1, cptr))
+                        return -1;
+                } else {
+                    t->pc = pc + 17;
+                    break;
+                }
+            }
+            t->pc = pc + 17 + get_u32(pc + 1);
+            t->quant_pc = NULL;
+            t->quant_count = 0;
+            break;
+        case REOP_goto:
+            t->pc = pc + 5 + (int)get_u32(pc + 1);
+            break;
+        case REOP_split_goto_first:
+        case REOP_split_next_first:
+            pc1 = pc + 5 + (int)get_u32(pc + 1);
+            if (lre_check_stack_overflow(s->opaque, ls->thread_size))
+                return -1;
+            t1 = alloca(ls->thread_size);
+            memcpy(t1, t, ls->thread_size);
+            if (opcode == REOP_split_next_first) {
+                t1->pc = pc + 5;
+                t->pc = pc1;
+            } else {
+                t1->pc = pc1;
+                t->pc = pc + 5;
+            }
+            if (re_lock_step_add(s, ls, l, t1, cptr))
+                return -1;
+            break;
+        case REOP_save_start:
+        case REOP_save_end:
+            val = pc[1];
+            capture[2 * val + opcode - REOP_save_start] = (uint8_t *)cptr;
+            t->pc = pc + 2;
+            break;
+        case REOP_save_reset:
+            for(val = pc[1]; val <= pc[2]; val++) {
+                capture[2 * val] = NULL;
+                capture[2 * val + 1] = NULL;
+            }
+            t->pc = pc + 3;
+            break;
+        case REOP_line_start:
+            if (cptr != s->cbuf) {
+                if (!s->multi_line)
+                    return 0;
+                PEEK_PREV_CHAR(c, cptr, s->cbuf);
+                if (!is_line_terminator(c))
+                    return 0;
+            }
+            t->pc = pc + 1;
+            break;
+        case REOP_line_end:
+            if (cptr != s->cbuf_end) {
+                if (!s->multi_line)
+                    return 0;
+                PEEK_CHAR(c, cptr, s->cbuf_end);
+                if (!is_line_terminator(c))
+                    return 0;
+            }
+            t->pc = pc + 1;
+            break;
+        case REOP_word_boundary:
+        case REOP_not_word_boundary:
+            {
+                BOOL v1, v2;
+                if (cptr == s->cbuf) {
+                    v1 = FALSE;
+                } else {
+                    PEEK_PREV_CHAR(c, cptr, s->cbuf);
+                    v1 = is_word_char(c);
+                }
+                if (cptr >= s->cbuf_end) {
+                    v2 = FALSE;
+                } else {
+                    PEEK_CHAR(c, cptr, s->cbuf_end);
+                    v2 = is_word_char(c);
+                }
+                if (v1 ^ v2 ^ (REOP_not_word_boundary - opcode))
+                    return 0;
+            }
+            t->pc = pc + 1;
+            break;
+        case REOP_push_i32:
+            stack[t->stack_len++] = get_u32(pc + 1);
+            t->pc = pc + 5;
+            break;
+        case REOP_drop:
+            t->stack_len--;
+            t->pc = pc + 1;
+            break;
+        case REOP_loop:
+            t->pc = pc + 5;
+            if (--stack[t->stack_len - 1] != 0)
+                t->pc += (int)get_u32(pc + 1);
+            break;
+        case REOP_push_char_pos:
+            stack[t->stack_len++] = ls->char_pos;
+            t->pc = pc + 1;
+            break;
+        case REOP_bne_char_pos:
+            t->pc = pc + 5;
+            if (stack[--t->stack_len] != ls->char_pos)
+                t->pc += (int)get_u32(pc + 1);
+            break;
+        default:
+            abort();
+        }
+    }
+}
+
+/* start a new set of states for the position 'cptr' */
+static void re_lock_step_next_pos(RELockStep *ls)
+{
+    ls->gen++;
+    ls->visited_count = 0;
+    ls->char_pos = (ls->char_pos + 1) | RE_CHAR_POS_TAG;
+}
+
+/* add a thread starting a match at 'cptr' */
+static int re_lock_step_start(REExecContext *s, RELockStep *ls,
+                              REThreadList *l, const uint8_t *pc,
+                              const uint8_t *cptr)
+{
+    REThread *t;
+    int i;
+    
+    t = alloca(ls->thread_size);
+    t->pc = pc;
+    t->quant_pc = NULL;
+    t->quant_count = 0;
+    t->stack_len = 0;
+    for(i = 0; i < 2 * s->capture_count; i++)
+        re_thread_capture(t)[i] = NULL;
+    return re_lock_step_add(s, ls, l, t, cptr);
+}
+
+/* return 1 if match, 0 if not match, -1 if error or -2 if
+   interrupted. The search starts at 'cptr'. */
+static int lre_exec_lock_step(REExecContext *s, uint8_t **capture,
+                              const uint8_t *bc_buf, const uint8_t *cptr,
+                              const uint8_t *cptr_start)
+{
+    RELockStep ls_s, *ls = &ls_s;
+    REThreadList *cl, *nl, *tmp;
+    REThread *t, *t1;
+    const uint8_t *pc_start, *pf, *next_cptr, *start_cptr, *pc;
+    int cbuf_type, ret, opcode, bc_len, i, j;
+    uint32_t c, c1;
+    BOOL is_sticky, matched;
+    StackInt *stack;
+
+    cbuf_type = s->cbuf_type;
+    bc_len = get_u32(bc_buf + RE_HEADER_BYTECODE_LEN);
+    is_sticky = (bc_buf[RE_HEADER_FLAGS] & LRE_FLAG_STICKY) != 0;
+    pc_start = bc_buf + RE_HEADER_LEN;
+    if (!is_sticky)
+        pc_start += RE_SEARCH_LOOP_LEN;
+    pf = NULL;
+    if (bc_buf[RE_HEADER_PREFILTER_LEN] != 0)
+        pf = bc_buf + RE_HEADER_LEN + bc_len;
+
+    memset(ls, 0, sizeof(*ls));
+    ls->bc_start = bc_buf + RE_HEADER_LEN;
+    ls->thread_size = sizeof(REThread) +
+        s->capture_count * sizeof(capture[0]) * 2 +
+        s->stack_size_max * sizeof(StackInt);
+    ls->visited_state_size = sizeof(REVisitedState) +
+        s->stack_size_max * sizeof(StackInt);
+    ls->visited_state_size = (ls->visited_state_size + sizeof(StackInt) - 1) &
+        ~(sizeof(StackInt) - 1);
+    ls->char_pos = RE_CHAR_POS_TAG;
+    ls->visited_gen = lre_realloc(s->opaque, NULL, bc_len * sizeof(uint32_t));
+    ls->visited_head = lre_realloc(s->opaque, NULL, bc_len * sizeof(int));
+    t1 = lre_realloc(s->opaque, NULL, ls->thread_size);
+    ret = -1;
+    if (!ls->visited_gen || !ls->visited_head || !t1)
+        goto done;
+    memset(ls->visited_gen, 0, bc_len * sizeof(uint32_t));
+
+    cl = &ls->lists[0];
+    nl = &ls->lists[1];
+    matched = FALSE;
+    /* next position where a match may start */
+    start_cptr = cptr;
+    if (pf) {
+        start_cptr = re_prefilter_next(s, pf, cptr, cptr_start);
+        if (!start_cptr) {
+            ret = 0;
+            goto done;
+        }
+        cptr = start_cptr;
+    }
+    re_lock_step_next_pos(ls);
+    if (re_lock_step_start(s, ls, cl, pc_start, cptr))
+        goto done;
+    for(;;) {
+        next_cptr = cptr;
+        c = c1 = 0;
+        if (cptr < s->cbuf_end) {
+            GET_CHAR(c, next_cptr, s->cbuf_end);
+            c1 = c;
+            if (s->ignore_case)
+                c1 = lre_canonicalize(c, s->is_utf16);
+        }
+        re_lock_step_next_pos(ls);
+        s->step_count += cl->count;
+        if (unlikely(s->step_count >= s->step_check)) {
+            ret = re_check_steps(s);
+            if (ret < 0)
+                goto done;
+        }
+        nl->count = 0;
+        for(i = 0; i < cl->count; i++) {
+            t = (REThread *)(cl->threads + i * ls->thread_size);
+            pc = t->pc;
+            opcode = *pc;
+            if (opcode == REOP_match) {
+                /* the lower priority threads are discarded */
+                memcpy(capture, re_thread_capture(t),
+                       sizeof(capture[0]) * 2 * s->capture_count);
+                matched = TRUE;
+                break;
+            }
+            if (cptr >= s->cbuf_end)
+                continue;
+            switch(opcode) {
+            case REOP_char:
+                if (get_u16(pc + 1) != c1)
+                    continue;
+                pc += 3;
+                break;
+            case REOP_char32:
+                if (get_u32(pc + 1) != c1)
+                    continue;
+                pc += 5;
+                break;
+            case REOP_dot:
+                if (is_line_terminator(c))
+                    continue;
+                pc += 1;
+                break;
+            case REOP_any:
+                pc += 1;
+                break;
+            case REOP_range:
+            case REOP_range32:
+                if (!re_range_match(pc, c1))
+                    continue;
+                pc += 3 + get_u16(pc + 1) * (4 << (opcode - REOP_range));
+                break;
+            default:
+                abort();
+            }
+            memcpy(t1, t, ls->thread_size);
+            t1->pc = pc;
+            /* forget the positions pushed before this char */
+            stack = re_thread_stack(s, t1);
+            for(j = 0; j < t1->stack_len; j++) {
+                if (stack[j] & RE_CHAR_POS_TAG)
+                    stack[j] = RE_CHAR_POS_TAG;
+            }
+            if (re_lock_step_add(s, ls, nl, t1, next_cptr))
+                goto done;
+        }
+        if (cptr >= s->cbuf_end)
+            break;
+        cptr = next_cptr;
+        if (!matched && !is_sticky && start_cptr) {
+            if (!pf)
+                start_cptr = cptr;
+            else if (start_cptr < cptr)
+                start_cptr = re_prefilter_next(s, pf, cptr, cptr_start);
+            if (start_cptr == cptr) {
+                if (re_lock_step_start(s, ls, nl, pc_start, cptr))
+                    goto done;
+            } else if (nl->count == 0 && start_cptr) {
+                /* no thread left: go to the next possible match start */
+                cptr = start_cptr;
+                re_lock_step_next_pos(ls);
+                if (re_lock_step_start(s, ls, nl, pc_start, cptr))
+                    goto done;
+            }
+        }
+        /* if no thread is left, the search continues at the next
+           possible match start */
+        if (nl->count == 0 && (matched || is_sticky || !start_cptr))
+            break;
+        tmp = cl;
+        cl = nl;
+        nl = tmp;
+    }
+    ret = matched;
+ done:
+    lre_realloc(s->opaque, t1, 0);
+    lre_realloc(s->opaque, ls->lists[0].threads, 0);
+    lre_realloc(s->opaque, ls->lists[1].threads, 0);
+    lre_realloc(s->opaque, ls->visited, 0);
+    lre_realloc(s->opaque, ls->visited_gen, 0);
+    lre_realloc(s->opaque, ls->visited_head, 0);
+    return ret;
+}
+
+/* Return 1 if match, 0 if not match, -1 if error or -2 if the
+   execution was stopped by lre_check_timeout(). cindex is the
    starting position of the match and must be such as 0 <= cindex <=
    clen. */
 int lre_exec(uint8_t **capture,
@@ -2503,6 +3357,7 @@ int lre_exec(uint8_t **capture,
     REExecContext s_s, *s = &s_s;
     int re_flags, i, alloca_size, ret;
     StackInt *stack_buf;
+    const uint8_t *cptr, *cptr_start;
     
     re_flags = bc_buf[RE_HEADER_FLAGS];
     s->multi_line = (re_flags & LRE_FLAG_MULTILINE) != 0;
@@ -2528,8 +3383,55 @@ int lre_exec(uint8_t **capture,
         capture[i] = NULL;
     alloca_size = s->stack_size_max * sizeof(stack_buf[0]);
     stack_buf = alloca(alloca_size);
-    ret = lre_exec_backtrack(s, capture, stack_buf, 0, bc_buf + RE_HEADER_LEN,
-                             cbuf + (cindex << cbuf_type), FALSE);
+    cptr = cbuf + (cindex << cbuf_type);
+    cptr_start = cptr;
+    s->step_count = 0;
+    s->backtrack_max = UINT64_MAX;
+    if (re_flags & LRE_FLAG_LOCK_STEP) {
+        /* the lock step execution is slower but has no exponential
+           behavior: use it only if backtracking takes too long */
+        s->backtrack_max = RE_BACKTRACK_MIN +
+            (uint64_t)(clen - cindex) * RE_BACKTRACK_PER_CHAR;
+    }
+    s->poll_count = RE_POLL_INTERVAL;
+    s->step_check = s->poll_count;
+    if (s->backtrack_max < s->step_check)
+        s->step_check = s->backtrack_max;
+    if (bc_buf[RE_HEADER_PREFILTER_LEN] == 0) {
+        ret = lre_exec_backtrack(s, capture, stack_buf, 0, bc_buf + RE_HEADER_LEN,
+                                 cptr, FALSE);
+    } else {
+        const uint8_t *pf;
+        uint32_t c;
+
+        /* instead of running the search loop of the bytecode, try
+           to match only at the positions accepted by the prefilter */
+        pf = bc_buf + RE_HEADER_LEN + get_u32(bc_buf + RE_HEADER_BYTECODE_LEN);
+        cbuf_type = s->cbuf_type;
+        for(;;) {
+            cptr = re_prefilter_next(s, pf, cptr, cptr_start);
+            if (!cptr) {
+                ret = 0;
+                break;
+            }
+            ret = lre_exec_backtrack(s, capture, stack_buf, 0,
+                                     bc_buf + RE_HEADER_LEN + RE_SEARCH_LOOP_LEN,
+                                     cptr, FALSE);
+            if (ret != 0)
+                break;
+            for(i = 0; i < s->capture_count * 2; i++)
+                capture[i] = NULL;
+            /* a match consumes at least one char */
+            GET_CHAR(c, cptr, s->cbuf_end);
+        }
+    }
+    if (ret == -3) {
+        /* restart from the last tried position */
+        s->state_stack_len = 0;
+        s->backtrack_max = UINT64_MAX;
+        s->step_check = s->poll_count;
+        ret = lre_exec_lock_step(s, capture, bc_buf, cptr, cptr_start);
+    }
     lre_realloc(s->opaque, s->state_stack, 0);
     return ret;
 }
@@ -2551,8 +3453,9 @@ const char *lre_get_groupnames(const uint8_t *bc_buf)
     uint32_t re_bytecode_len;
     if ((lre_get_flags(bc_buf) & LRE_FLAG_NAMED_GROUPS) == 0)
         return NULL;
-    re_bytecode_len = get_u32(bc_buf + 3);
-    return (const char *)(bc_buf + 7 + re_bytecode_len);
+    re_bytecode_len = get_u32(bc_buf + RE_HEADER_BYTECODE_LEN);
+    return (const char *)(bc_buf + RE_HEADER_LEN + re_bytecode_len +
+                          bc_buf[RE_HEADER_PREFILTER_LEN]);
 }
 
 #ifdef TEST
@@ -2567,6 +3470,11 @@ void *lre_realloc(void *opaque, void *ptr, size_t size)
     return realloc(ptr, size);
 }
 
+BOOL lre_check_timeout(void *opaque, uint64_t step_count)
+{
+    return FALSE;
+}
+
 int main(int argc, char **argv)
 {
     int len, ret, i;
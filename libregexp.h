@@ -37,6 +37,7 @@
 #define LRE_FLAG_UTF16      (1 << 4)
 #define LRE_FLAG_STICKY     (1 << 5)
 
+#define LRE_FLAG_LOCK_STEP  (1 << 6) /* the regexp has no back reference nor lookaround */
 #define LRE_FLAG_NAMED_GROUPS (1 << 7) /* named groups are present in the regexp */
 
 uint8_t *lre_compile(int *plen, char *error_msg, int error_msg_size,
@@ -55,6 +56,9 @@ LRE_BOOL lre_is_space(int c);
 /* must be provided by the user */
 LRE_BOOL lre_check_stack_overflow(void *opaque, size_t alloca_size); 
 void *lre_realloc(void *opaque, void *ptr, size_t size);
+/* called periodically during lre_exec(). 'step_count' is the number
+   of execution steps done so far. Return TRUE to stop the execution. */
+LRE_BOOL lre_check_timeout(void *opaque, uint64_t step_count);
 
 /* JS identifier test */
 extern uint32_t const lre_id_start_table_ascii[4];
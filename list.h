@@ -83,6 +83,21 @@ static inline int list_empty(struct list_head *el)
     return el->next == el;
 }
 
+/* move all the elements of 'list' at the end of the list 'head'. 'list'
+   is empty after the call. */
+static inline void list_splice_tail(struct list_head *list,
+                                    struct list_head *head)
+{
+    if (!list_empty(list)) {
+        struct list_head *first = list->next, *last = list->prev;
+        first->prev = head->prev;
+        head->prev->next = first;
+        last->next = head;
+        head->prev = last;
+        init_list_head(list);
+    }
+}
+
 #define list_for_each(el, head) \
   for(el = (head)->next; el != (head); el = el->next)
 
@@ -89,6 +89,15 @@ static int eval_file(JSContext *ctx, const char *filename, int module)
         exit(1);
     }
 
+    if (js_std_is_snapshot(buf, buf_len)) {
+        /* precompiled with 'qjsc -b' */
+        ret = js_std_eval_snapshot(ctx, buf, buf_len);
+        if (ret < 0)
+            fprintf(stderr, "%s: invalid snapshot\n", filename);
+        js_free(ctx, buf);
+        return ret;
+    }
+
     if (module < 0) {
         module = (has_suffix(filename, ".mjs") ||
                   JS_DetectModule((const char *)buf, buf_len));
@@ -299,7 +308,14 @@ void help(void)
            "-d  --dump         dump the memory usage stats\n"
            "    --memory-limit n       limit the memory usage to 'n' bytes\n"
            "    --stack-size n         limit the stack size to 'n' bytes\n"
+           "    --regexp-step-limit n  limit the execution of a regexp to 'n' steps\n"
            "    --unhandled-rejection  dump unhandled promise rejections\n"
+#ifdef CONFIG_JIT
+           "    --perf-map     write the JIT symbols to /tmp/perf-<pid>.map\n"
+#else
+           "    --perf-map     write the JIT symbols to /tmp/perf-<pid>.map\n"
+           "                   (not available: built without CONFIG_JIT)\n"
+#endif
            "-q  --quit         just instantiate the interpreter and quit\n");
     exit(1);
 }
@@ -318,6 +334,7 @@ int main(int argc, char **argv)
     int module = -1;
     int load_std = 0;
     int dump_unhandled_promise_rejection = 0;
+    int perf_map = 0;
     size_t memory_limit = 0;
     char *include_list[32];
     int i, include_count = 0;
@@ -325,6 +342,7 @@ int main(int argc, char **argv)
     int load_jscalc;
 #endif
     size_t stack_size = 0;
+    uint64_t regexp_step_limit = 0;
     
 #ifdef CONFIG_BIGNUM
     /* load jscalc runtime if invoked as 'qjscalc' */
@@ -415,6 +433,10 @@ int main(int argc, char **argv)
                 dump_unhandled_promise_rejection = 1;
                 continue;
             }
+            if (!strcmp(longopt, "perf-map")) {
+                perf_map = 1;
+                continue;
+            }
 #ifdef CONFIG_BIGNUM
             if (!strcmp(longopt, "bignum")) {
                 bignum_ext = 1;
@@ -445,6 +467,14 @@ int main(int argc, char **argv)
                 stack_size = (size_t)strtod(argv[optind++], NULL);
                 continue;
             }
+            if (!strcmp(longopt, "regexp-step-limit")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting regexp step limit");
+                    exit(1);
+                }
+                regexp_step_limit = (uint64_t)strtod(argv[optind++], NULL);
+                continue;
+            }
             if (opt) {
                 fprintf(stderr, "qjs: unknown option '-%c'\n", opt);
             } else {
@@ -471,6 +501,16 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (regexp_step_limit != 0)
+        JS_SetRegExpStepLimit(rt, regexp_step_limit);
+    if (perf_map && JS_SetPerfMapFile(rt, NULL) < 0) {
+#ifdef CONFIG_JIT
+        fprintf(stderr, "qjs: cannot open the perf map file\n");
+#else
+        fprintf(stderr, "qjs: --perf-map requires a build with CONFIG_JIT\n");
+#endif
+        exit(2);
+    }
     js_std_set_worker_new_context_func(JS_NewCustomContext);
     js_std_init_handlers(rt);
     ctx = JS_NewCustomContext(rt);
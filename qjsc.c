@@ -60,6 +60,9 @@ static uint64_t feature_bitmap;
 static FILE *outfile;
 static BOOL byte_swap;
 static BOOL dynamic_export;
+static BOOL output_snapshot;
+static DynBuf snapshot_buf;
+static uint32_t snapshot_count;
 static const char *c_ident_prefix = "qjsc_";
 
 #define FE_ALL (-1)
@@ -189,6 +192,17 @@ static void output_object_code(JSContext *ctx,
     }
 
     namelist_add(&cname_list, c_name, NULL, load_only);
+
+    if (output_snapshot) {
+        uint32_t len = out_buf_len;
+        /* see js_std_eval_snapshot() for the format */
+        dbuf_putc(&snapshot_buf, load_only);
+        dbuf_put(&snapshot_buf, (uint8_t *)&len, 4);
+        dbuf_put(&snapshot_buf, out_buf, out_buf_len);
+        snapshot_count++;
+        js_free(ctx, out_buf);
+        return;
+    }
     
     fprintf(fo, "const uint32_t %s_size = %u;\n\n", 
             c_name, (unsigned int)out_buf_len);
@@ -347,6 +361,7 @@ void help(void)
            "options are:\n"
            "-c          only output bytecode in a C file\n"
            "-e          output main() and bytecode in a C file (default = executable output)\n"
+           "-b          output a bytecode snapshot file which can be run by qjs\n"
            "-o output   set the output filename\n"
            "-N cname    set the C name of the generated data\n"
            "-m          compile as Javascript module (default=autodetect)\n"
@@ -479,6 +494,7 @@ typedef enum {
     OUTPUT_C,
     OUTPUT_C_MAIN,
     OUTPUT_EXECUTABLE,
+    OUTPUT_SNAPSHOT,
 } OutputTypeEnum;
 
 int main(int argc, char **argv)
@@ -514,7 +530,7 @@ int main(int argc, char **argv)
     namelist_add(&cmodule_list, "os", "os", 0);
 
     for(;;) {
-        c = getopt(argc, argv, "ho:cN:f:mxevM:p:S:D:");
+        c = getopt(argc, argv, "ho:cbN:f:mxevM:p:S:D:");
         if (c == -1)
             break;
         switch(c) {
@@ -529,6 +545,9 @@ int main(int argc, char **argv)
         case 'e':
             output_type = OUTPUT_C_MAIN;
             break;
+        case 'b':
+            output_type = OUTPUT_SNAPSHOT;
+            break;
         case 'N':
             cname = optarg;
             break;
@@ -606,6 +625,8 @@ int main(int argc, char **argv)
     if (!out_filename) {
         if (output_type == OUTPUT_EXECUTABLE) {
             out_filename = "a.out";
+        } else if (output_type == OUTPUT_SNAPSHOT) {
+            out_filename = "out.qjss";
         } else {
             out_filename = "out.c";
         }
@@ -622,7 +643,15 @@ int main(int argc, char **argv)
         pstrcpy(cfilename, sizeof(cfilename), out_filename);
     }
     
-    fo = fopen(cfilename, "w");
+    output_snapshot = (output_type == OUTPUT_SNAPSHOT);
+    if (output_snapshot) {
+        dbuf_init(&snapshot_buf);
+        dbuf_put(&snapshot_buf, (const uint8_t *)"QJSS", 4);
+        /* entry count, set at the end */
+        dbuf_put(&snapshot_buf, (uint8_t *)&snapshot_count, 4);
+    }
+
+    fo = fopen(cfilename, output_snapshot ? "wb" : "w");
     if (!fo) {
         perror(cfilename);
         exit(1);
@@ -643,18 +672,20 @@ int main(int argc, char **argv)
     /* loader for ES6 modules */
     JS_SetModuleLoaderFunc(rt, NULL, jsc_module_loader, NULL);
 
-    fprintf(fo, "/* File generated automatically by the QuickJS compiler. */\n"
-            "\n"
-            );
-    
-    if (output_type != OUTPUT_C) {
-        fprintf(fo, "#include \"quickjs-libc.h\"\n"
-                "\n"
-                );
-    } else {
-        fprintf(fo, "#include <inttypes.h>\n"
+    if (!output_snapshot) {
+        fprintf(fo, "/* File generated automatically by the QuickJS compiler. */\n"
                 "\n"
                 );
+    
+        if (output_type != OUTPUT_C) {
+            fprintf(fo, "#include \"quickjs-libc.h\"\n"
+                    "\n"
+                    );
+        } else {
+            fprintf(fo, "#include <inttypes.h>\n"
+                    "\n"
+                    );
+        }
     }
 
     for(i = optind; i < argc; i++) {
@@ -671,7 +702,15 @@ int main(int argc, char **argv)
         }
     }
     
-    if (output_type != OUTPUT_C) {
+    if (output_snapshot) {
+        memcpy(snapshot_buf.buf + 4, &snapshot_count, 4);
+        if (snapshot_buf.error ||
+            fwrite(snapshot_buf.buf, 1, snapshot_buf.size, fo) != snapshot_buf.size) {
+            perror(cfilename);
+            exit(1);
+        }
+        dbuf_free(&snapshot_buf);
+    } else if (output_type != OUTPUT_C) {
         fprintf(fo,
                 "static JSContext *JS_NewCustomContext(JSRuntime *rt)\n"
                 "{\n"
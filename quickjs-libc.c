@@ -46,6 +46,11 @@
 #include <termios.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
 
 #if defined(__APPLE__)
 typedef sig_t sighandler_t;
@@ -62,23 +67,48 @@ typedef sig_t sighandler_t;
 #define USE_WORKER
 #endif
 
+#if defined(__linux__)
+/* use epoll() instead of select() in the event loop */
+#define USE_EPOLL
+#endif
+
 #ifdef USE_WORKER
 #include <pthread.h>
 #include <stdatomic.h>
 #endif
 
+#ifdef USE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#if defined(__linux__) && defined(USE_WORKER)
+/* use eventfd() instead of a pipe to signal the worker messages */
+#define USE_EVENTFD
+#include <sys/eventfd.h>
+#endif
+
+#if defined(__linux__) && defined(USE_WORKER) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+/* use io_uring for the asynchronous I/O if the kernel supports it */
+#define USE_IO_URING
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+#endif
+
 #include "cutils.h"
 #include "list.h"
 #include "quickjs-libc.h"
 
-/* TODO:
-   - add socket calls
-*/
-
 typedef struct {
     struct list_head link;
     int fd;
     JSValue rw_func[2];
+#ifdef USE_EPOLL
+    uint32_t events; /* events registered in the epoll set */
+    BOOL no_epoll; /* fd not supported by epoll: always ready */
+#endif
 } JSOSRWHandler;
 
 typedef struct {
@@ -88,9 +118,11 @@ typedef struct {
 } JSOSSignalHandler;
 
 typedef struct {
-    struct list_head link;
+    int heap_index; /* index in JSThreadState.timers, -1 if inactive */
     BOOL has_object;
     int64_t timeout;
+    int64_t interval; /* > 0 for the timers created by setInterval() */
+    uint64_t order; /* order between the timers with the same timeout */
     JSValue func;
 } JSOSTimer;
 
@@ -101,16 +133,41 @@ typedef struct {
     /* list of SharedArrayBuffers, necessary to free the message */
     uint8_t **sab_tab;
     size_t sab_tab_len;
+    /* data of the transferred ArrayBuffers */
+    JSTransferredArrayBuffer *transfer_tab;
+    int transfer_tab_len;
 } JSWorkerMessage;
 
+/* must be a power of two */
+#define JS_WORKER_QUEUE_SIZE 1024
+
+#ifdef USE_WORKER
+typedef struct {
+    atomic_size_t seq;
+    JSWorkerMessage *msg;
+} JSWorkerQueueSlot;
+#endif
+
 typedef struct {
     int ref_count;
 #ifdef USE_WORKER
+    /* bounded lock-free queue with multiple producers and a single
+       consumer. A slot can be written when seq = position and read
+       when seq = position + 1. */
+    JSWorkerQueueSlot slots[JS_WORKER_QUEUE_SIZE];
+    atomic_size_t head; /* next position to write */
+    size_t tail; /* next position to read, only used by the consumer */
+    /* the messages are added to 'msg_queue' instead of 'slots' when
+       the queue is full and until the consumer empties 'msg_queue' */
     pthread_mutex_t mutex;
+    atomic_int overflow_count;
+    /* TRUE if the consumer was signaled and has not yet read the
+       messages */
+    atomic_int notified;
 #endif
     struct list_head msg_queue; /* list of JSWorkerMessage.link */
     int read_fd;
-    int write_fd;
+    int write_fd; /* same as read_fd if eventfd() is used */
 } JSWorkerMessagePipe;
 
 typedef struct {
@@ -122,15 +179,45 @@ typedef struct {
 typedef struct JSThreadState {
     struct list_head os_rw_handlers; /* list of JSOSRWHandler.link */
     struct list_head os_signal_handlers; /* list JSOSSignalHandler.link */
-    struct list_head os_timers; /* list of JSOSTimer.link */
+    /* binary heap of the active timers, the first one expires first */
+    JSOSTimer **timers;
+    int timer_count;
+    int timer_size;
+    uint64_t timer_order;
     struct list_head port_list; /* list of JSWorkerMessageHandler.link */
     int eval_script_recurse; /* only used in the main thread */
+    BOOL is_worker; /* TRUE in the Worker and WorkerPool threads */
     /* not used in the main thread */
     JSWorkerMessagePipe *recv_pipe, *send_pipe;
+#ifdef USE_EPOLL
+    int epoll_fd;
+    /* read/write handlers indexed by fd */
+    JSOSRWHandler **rw_handler_tab;
+    int rw_handler_tab_size;
+    int no_epoll_count; /* number of handlers with no_epoll = TRUE */
+#endif
+#ifdef USE_WORKER
+    /* asynchronous I/O requests executed by the thread pool */
+    pthread_mutex_t async_mutex;
+    pthread_cond_t async_cond; /* signaled when a request is completed */
+    struct list_head async_done_list; /* list of JSOSAsyncReq.link */
+    int async_pending; /* requests not yet completed by the thread pool */
+    int async_count; /* requests whose promise is not yet resolved */
+    /* a byte is written to async_fds[1] when async_done_list becomes
+       non empty */
+    int async_fds[2];
+#endif
+#ifdef USE_IO_URING
+    struct JSOSURing *uring; /* created on the first request */
+    BOOL uring_disabled; /* TRUE if io_uring is not supported */
+#endif
 } JSThreadState;
 
 static uint64_t os_pending_signals;
 static int (*os_poll_func)(JSContext *ctx);
+static void js_std_execute_pending_jobs(JSContext *ctx);
+static JSValue js_std_loadFileAsync(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv);
 
 static void js_std_dbuf_init(JSContext *ctx, DynBuf *s)
 {
@@ -392,7 +479,7 @@ uint8_t *js_load_file(JSContext *ctx, size_t *pbuf_len, const char *filename)
         if (ctx)
             js_free(ctx, buf);
         else
-            pal_free(buf);
+            free(buf);
     fail:
         fclose(f);
         return NULL;
@@ -721,6 +808,44 @@ static JSValue js_std_gc(JSContext *ctx, JSValueConst this_val,
     return JS_UNDEFINED;
 }
 
+static JSValue js_std_gcStats(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    static const char * const names[] = {
+        "youngCount", "fullCount", "youngTime", "fullTime", "maxTime",
+        "scanned", "freed", "promoted", "youngObjects", "oldObjects",
+    };
+    JSGCStats st;
+    JSValue obj;
+    int64_t vals[countof(names)];
+    int i;
+
+    JS_GetGCStats(JS_GetRuntime(ctx), &st);
+    vals[0] = st.young_gc_count;
+    vals[1] = st.full_gc_count;
+    vals[2] = st.young_gc_time;
+    vals[3] = st.full_gc_time;
+    vals[4] = st.max_gc_time;
+    vals[5] = st.scanned_count;
+    vals[6] = st.freed_count;
+    vals[7] = st.promoted_count;
+    vals[8] = st.young_obj_count;
+    vals[9] = st.old_obj_count;
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    for(i = 0; i < countof(names); i++) {
+        if (JS_DefinePropertyValueStr(ctx, obj, names[i],
+                                      JS_NewInt64(ctx, vals[i]),
+                                      JS_PROP_C_W_E) < 0) {
+            JS_FreeValue(ctx, obj);
+            return JS_EXCEPTION;
+        }
+    }
+    return obj;
+}
+
 static int interrupt_handler(JSRuntime *rt, void *opaque)
 {
     return (os_pending_signals >> SIGINT) & 1;
@@ -763,7 +888,7 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
     str = JS_ToCStringLen(ctx, &len, argv[0]);
     if (!str)
         return JS_EXCEPTION;
-    if (!ts->recv_pipe && ++ts->eval_script_recurse == 1) {
+    if (!ts->is_worker && ++ts->eval_script_recurse == 1) {
         /* install the interrupt handler */
         JS_SetInterruptHandler(JS_GetRuntime(ctx), interrupt_handler, NULL);
     }
@@ -772,7 +897,7 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
         flags |= JS_EVAL_FLAG_BACKTRACE_BARRIER;
     ret = JS_Eval(ctx, str, len, "<evalScript>", flags);
     JS_FreeCString(ctx, str);
-    if (!ts->recv_pipe && --ts->eval_script_recurse == 0) {
+    if (!ts->is_worker && --ts->eval_script_recurse == 0) {
         /* remove the interrupt handler */
         JS_SetInterruptHandler(JS_GetRuntime(ctx), NULL, NULL);
         os_pending_signals &= ~((uint64_t)1 << SIGINT);
@@ -1477,12 +1602,22 @@ static const JSCFunctionListEntry js_std_error_props[] = {
     DEF(EPERM),
     DEF(EPIPE),
     DEF(EBADF),
+#if !defined(_WIN32)
+    DEF(EINTR),
+    DEF(EAGAIN),
+    DEF(EINPROGRESS),
+    DEF(EADDRINUSE),
+    DEF(ECONNREFUSED),
+    DEF(ECONNRESET),
+    DEF(ENOTCONN),
+#endif
 #undef DEF
 };
 
 static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("exit", 1, js_std_exit ),
     JS_CFUNC_DEF("gc", 0, js_std_gc ),
+    JS_CFUNC_DEF("gcStats", 0, js_std_gcStats ),
     JS_CFUNC_DEF("evalScript", 1, js_evalScript ),
     JS_CFUNC_DEF("loadScript", 1, js_loadScript ),
     JS_CFUNC_DEF("getenv", 1, js_std_getenv ),
@@ -1491,6 +1626,7 @@ static const JSCFunctionListEntry js_std_funcs[] = {
     JS_CFUNC_DEF("getenviron", 1, js_std_getenviron ),
     JS_CFUNC_DEF("urlGet", 1, js_std_urlGet ),
     JS_CFUNC_DEF("loadFile", 1, js_std_loadFile ),
+    JS_CFUNC_DEF("loadFileAsync", 1, js_std_loadFileAsync ),
     JS_CFUNC_DEF("strerror", 1, js_std_strerror ),
     JS_CFUNC_DEF("parseExtJSON", 1, js_std_parseExtJSON ),
 
@@ -1820,9 +1956,110 @@ static JSValue js_os_rename(JSContext *ctx, JSValueConst this_val,
 static BOOL is_main_thread(JSRuntime *rt)
 {
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    return !ts->recv_pipe;
+    return !ts->is_worker;
+}
+
+#ifdef USE_EPOLL
+
+static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
+{
+    if (fd < 0 || fd >= ts->rw_handler_tab_size)
+        return NULL;
+    return ts->rw_handler_tab[fd];
+}
+
+/* change the events of 'fd' in the epoll set from 'old_events' to
+   'events'. 0 means not registered. */
+static int os_epoll_ctl(JSThreadState *ts, int fd, uint32_t old_events,
+                        uint32_t events)
+{
+    struct epoll_event ev;
+    int op, ret;
+
+    if (events == old_events)
+        return 0;
+    if (!events)
+        op = EPOLL_CTL_DEL;
+    else if (!old_events)
+        op = EPOLL_CTL_ADD;
+    else
+        op = EPOLL_CTL_MOD;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.fd = fd;
+    ret = epoll_ctl(ts->epoll_fd, op, fd, &ev);
+    if (ret < 0 && events) {
+        /* the fd may have been closed and reopened since it was
+           registered */
+        if (errno == ENOENT)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+        else if (errno == EEXIST)
+            ret = epoll_ctl(ts->epoll_fd, EPOLL_CTL_MOD, fd, &ev);
+    }
+    return ret;
+}
+
+/* update the epoll registration of 'rh' after a change of its
+   functions. Return -1 with errno set and leave the registration
+   unchanged if the fd cannot be added. */
+static int rw_handler_update(JSThreadState *ts, JSOSRWHandler *rh)
+{
+    uint32_t events;
+
+    events = 0;
+    if (!JS_IsNull(rh->rw_func[0]))
+        events |= EPOLLIN;
+    if (!JS_IsNull(rh->rw_func[1]))
+        events |= EPOLLOUT;
+    if (rh->no_epoll) {
+        if (!events)
+            ts->no_epoll_count--;
+    } else if (os_epoll_ctl(ts, rh->fd, rh->events, events) < 0 && events) {
+        /* regular files are not supported by epoll. As with
+           select(), they are considered as always ready. */
+        if (errno != EPERM)
+            return -1;
+        rh->no_epoll = TRUE;
+        ts->no_epoll_count++;
+        events = 0;
+    }
+    rh->events = events;
+    return 0;
+}
+
+static JSOSRWHandler *new_rh(JSContext *ctx, JSThreadState *ts, int fd)
+{
+    JSOSRWHandler *rh;
+
+    if (fd < 0) {
+        JS_ThrowRangeError(ctx, "invalid file descriptor");
+        return NULL;
+    }
+    if (fd >= ts->rw_handler_tab_size) {
+        JSOSRWHandler **tab;
+        int new_size;
+        new_size = max_int(fd + 1, ts->rw_handler_tab_size * 3 / 2);
+        tab = js_realloc(ctx, ts->rw_handler_tab, sizeof(tab[0]) * new_size);
+        if (!tab)
+            return NULL;
+        memset(tab + ts->rw_handler_tab_size, 0,
+               sizeof(tab[0]) * (new_size - ts->rw_handler_tab_size));
+        ts->rw_handler_tab = tab;
+        ts->rw_handler_tab_size = new_size;
+    }
+    rh = js_mallocz(ctx, sizeof(*rh));
+    if (!rh)
+        return NULL;
+    rh->fd = fd;
+    rh->rw_func[0] = JS_NULL;
+    rh->rw_func[1] = JS_NULL;
+    list_add_tail(&rh->link, &ts->os_rw_handlers);
+    ts->rw_handler_tab[fd] = rh;
+    return rh;
 }
 
+#else
+
 static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
 {
     JSOSRWHandler *rh;
@@ -1836,28 +2073,50 @@ static JSOSRWHandler *find_rh(JSThreadState *ts, int fd)
     return NULL;
 }
 
+static JSOSRWHandler *new_rh(JSContext *ctx, JSThreadState *ts, int fd)
+{
+    JSOSRWHandler *rh;
+
+    rh = js_mallocz(ctx, sizeof(*rh));
+    if (!rh)
+        return NULL;
+    rh->fd = fd;
+    rh->rw_func[0] = JS_NULL;
+    rh->rw_func[1] = JS_NULL;
+    list_add_tail(&rh->link, &ts->os_rw_handlers);
+    return rh;
+}
+
+#endif /* !USE_EPOLL */
+
 static void free_rw_handler(JSRuntime *rt, JSOSRWHandler *rh)
 {
     int i;
     list_del(&rh->link);
     for(i = 0; i < 2; i++) {
         JS_FreeValueRT(rt, rh->rw_func[i]);
+        rh->rw_func[i] = JS_NULL;
+    }
+#ifdef USE_EPOLL
+    {
+        JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+        rw_handler_update(ts, rh);
+        ts->rw_handler_tab[rh->fd] = NULL;
     }
+#endif
     js_free_rt(rt, rh);
 }
 
-static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
-                                    int argc, JSValueConst *argv, int magic)
+/* set the read (magic = 0) or write (magic = 1) handler of 'fd'. The
+   handler is removed if 'func' is null. */
+static int os_set_rw_handler(JSContext *ctx, int fd, int magic,
+                             JSValueConst func)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     JSOSRWHandler *rh;
-    int fd;
-    JSValueConst func;
+    JSValue old_func;
 
-    if (JS_ToInt32(ctx, &fd, argv[0]))
-        return JS_EXCEPTION;
-    func = argv[1];
     if (JS_IsNull(func)) {
         rh = find_rh(ts, fd);
         if (rh) {
@@ -1866,1415 +2125,3759 @@ static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
             if (JS_IsNull(rh->rw_func[0]) &&
                 JS_IsNull(rh->rw_func[1])) {
                 /* remove the entry */
-                free_rw_handler(JS_GetRuntime(ctx), rh);
+                free_rw_handler(rt, rh);
+            }
+#ifdef USE_EPOLL
+            else {
+                rw_handler_update(ts, rh);
             }
+#endif
         }
     } else {
-        if (!JS_IsFunction(ctx, func))
-            return JS_ThrowTypeError(ctx, "not a function");
         rh = find_rh(ts, fd);
         if (!rh) {
-            rh = js_mallocz(ctx, sizeof(*rh));
+            rh = new_rh(ctx, ts, fd);
             if (!rh)
-                return JS_EXCEPTION;
-            rh->fd = fd;
-            rh->rw_func[0] = JS_NULL;
-            rh->rw_func[1] = JS_NULL;
-            list_add_tail(&rh->link, &ts->os_rw_handlers);
+                return -1;
         }
-        JS_FreeValue(ctx, rh->rw_func[magic]);
+        old_func = rh->rw_func[magic];
         rh->rw_func[magic] = JS_DupValue(ctx, func);
+#ifdef USE_EPOLL
+        if (rw_handler_update(ts, rh)) {
+            int err = errno;
+            /* restore the previous handler */
+            JS_FreeValue(ctx, rh->rw_func[magic]);
+            rh->rw_func[magic] = old_func;
+            if (JS_IsNull(rh->rw_func[0]) &&
+                JS_IsNull(rh->rw_func[1])) {
+                free_rw_handler(rt, rh);
+            }
+            JS_ThrowTypeError(ctx, "could not watch the file descriptor: %s",
+                              strerror(err));
+            return -1;
+        }
+#endif
+        JS_FreeValue(ctx, old_func);
     }
+    return 0;
+}
+
+static JSValue js_os_setReadHandler(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv, int magic)
+{
+    int fd;
+    JSValueConst func;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    func = argv[1];
+    if (!JS_IsNull(func) && !JS_IsFunction(ctx, func))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (os_set_rw_handler(ctx, fd, magic, func))
+        return JS_EXCEPTION;
     return JS_UNDEFINED;
 }
 
-static JSOSSignalHandler *find_sh(JSThreadState *ts, int sig_num)
+/* resolve (or reject if 'val' is an exception) a promise. 'val' is
+   freed. */
+static void os_promise_settle(JSContext *ctx, JSValueConst *resolving_funcs,
+                              JSValue val)
 {
-    JSOSSignalHandler *sh;
-    struct list_head *el;
-    list_for_each(el, &ts->os_signal_handlers) {
-        sh = list_entry(el, JSOSSignalHandler, link);
-        if (sh->sig_num == sig_num)
-            return sh;
+    JSValue ret;
+    int is_reject;
+
+    is_reject = JS_IsException(val);
+    if (is_reject)
+        val = JS_GetException(ctx);
+    ret = JS_Call(ctx, resolving_funcs[is_reject], JS_UNDEFINED, 1,
+                  (JSValueConst *)&val);
+    JS_FreeValue(ctx, val);
+    if (JS_IsException(ret))
+        js_std_dump_error(ctx);
+    JS_FreeValue(ctx, ret);
+}
+
+/* Asynchronous I/O: pipes, sockets and terminals are read or written
+   by a read/write handler when they are ready. Regular files are
+   always ready for select() and epoll(), so their I/O is done by a
+   small pool of threads whose results are sent back to the event
+   loop. */
+
+#ifdef USE_WORKER
+
+#define OS_ASYNC_THREAD_COUNT 4
+
+typedef enum {
+    OS_ASYNC_READ,
+    OS_ASYNC_WRITE,
+    OS_ASYNC_LOAD_FILE,
+    OS_ASYNC_ACCEPT, /* only with io_uring */
+} OSAsyncOpEnum;
+
+typedef struct {
+    struct list_head link;
+    JSThreadState *ts;
+    OSAsyncOpEnum op;
+    int fd;
+    char *filename; /* OS_ASYNC_LOAD_FILE */
+    uint8_t *buf; /* allocated with malloc() for OS_ASYNC_LOAD_FILE */
+    size_t len;
+    ssize_t ret; /* result or -errno */
+    BOOL cancelled; /* io_uring: a cancel request was queued */
+    JSValue buffer_obj; /* pinned ArrayBuffer containing 'buf' */
+    JSValue resolving_funcs[2];
+} JSOSAsyncReq;
+
+/* the thread pool is shared by all the runtimes. Its threads are
+   joined when the last runtime using it is freed. */
+static pthread_mutex_t os_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t os_async_cond = PTHREAD_COND_INITIALIZER;
+static struct list_head os_async_queue = LIST_HEAD_INIT(os_async_queue);
+static pthread_t os_async_threads[OS_ASYNC_THREAD_COUNT];
+static int os_async_thread_count;
+static int os_async_idle_count;
+static int os_async_user_count; /* number of runtimes using the pool */
+static BOOL os_async_quit; /* the threads exit when the queue is empty */
+
+static void os_async_exec(JSOSAsyncReq *req)
+{
+    JSThreadState *ts = req->ts;
+    uint8_t ch;
+
+    switch(req->op) {
+    case OS_ASYNC_READ:
+        req->ret = js_get_errno(read(req->fd, req->buf, req->len));
+        break;
+    case OS_ASYNC_WRITE:
+        req->ret = js_get_errno(write(req->fd, req->buf, req->len));
+        break;
+    case OS_ASYNC_LOAD_FILE:
+        req->buf = js_load_file(NULL, &req->len, req->filename);
+        req->ret = req->buf ? 0 : -errno;
+        break;
+    default:
+        abort();
     }
-    return NULL;
+
+    /* 'ts' may be freed as soon as async_mutex is released */
+    pthread_mutex_lock(&ts->async_mutex);
+    if (list_empty(&ts->async_done_list)) {
+        ch = 0;
+        while (write(ts->async_fds[1], &ch, 1) < 0 && errno == EINTR)
+            continue;
+    }
+    list_add_tail(&req->link, &ts->async_done_list);
+    ts->async_pending--;
+    pthread_cond_signal(&ts->async_cond);
+    pthread_mutex_unlock(&ts->async_mutex);
 }
 
-static void free_sh(JSRuntime *rt, JSOSSignalHandler *sh)
+static void *os_async_thread_func(void *opaque)
 {
-    list_del(&sh->link);
-    JS_FreeValueRT(rt, sh->func);
-    js_free_rt(rt, sh);
+    JSOSAsyncReq *req;
+
+    for(;;) {
+        pthread_mutex_lock(&os_async_mutex);
+        while (list_empty(&os_async_queue)) {
+            if (os_async_quit) {
+                pthread_mutex_unlock(&os_async_mutex);
+                return NULL;
+            }
+            os_async_idle_count++;
+            pthread_cond_wait(&os_async_cond, &os_async_mutex);
+            os_async_idle_count--;
+        }
+        req = list_entry(os_async_queue.next, JSOSAsyncReq, link);
+        list_del(&req->link);
+        pthread_mutex_unlock(&os_async_mutex);
+        os_async_exec(req);
+    }
+    return NULL;
 }
 
-static void os_signal_handler(int sig_num)
+/* start a new thread if no thread is idle. Must be called with
+   os_async_mutex locked. Return FALSE if there is no thread to execute
+   the queued requests. */
+static BOOL os_async_start_thread(void)
 {
-    os_pending_signals |= ((uint64_t)1 << sig_num);
+    if (os_async_idle_count == 0 && !os_async_quit &&
+        os_async_thread_count < OS_ASYNC_THREAD_COUNT) {
+        if (pthread_create(&os_async_threads[os_async_thread_count], NULL,
+                           os_async_thread_func, NULL) == 0) {
+            os_async_thread_count++;
+        }
+    }
+    return os_async_thread_count != 0;
+}
+
+static void os_async_pool_release(void)
+{
+    pthread_t threads[OS_ASYNC_THREAD_COUNT];
+    int i, n;
+
+    pthread_mutex_lock(&os_async_mutex);
+    if (--os_async_user_count == 0) {
+        /* wait until all the threads are stopped */
+        n = os_async_thread_count;
+        memcpy(threads, os_async_threads, sizeof(threads[0]) * n);
+        os_async_quit = TRUE;
+        pthread_cond_broadcast(&os_async_cond);
+        pthread_mutex_unlock(&os_async_mutex);
+        for(i = 0; i < n; i++)
+            pthread_join(threads[i], NULL);
+        pthread_mutex_lock(&os_async_mutex);
+        os_async_thread_count = 0;
+        os_async_quit = FALSE;
+        /* a new runtime may have queued requests in the meantime */
+        if (!list_empty(&os_async_queue)) {
+            os_async_start_thread();
+            pthread_cond_signal(&os_async_cond);
+        }
+    }
+    pthread_mutex_unlock(&os_async_mutex);
 }
 
-#if defined(_WIN32)
-typedef void (*sighandler_t)(int sig_num);
-#endif
+static void os_async_free_req(JSRuntime *rt, JSOSAsyncReq *req)
+{
+    if (req->op == OS_ASYNC_LOAD_FILE) {
+        js_free_rt(rt, req->filename);
+        free(req->buf);
+    }
+    if (!JS_IsUndefined(req->buffer_obj)) {
+        JS_UnpinArrayBuffer(rt, req->buffer_obj);
+        JS_FreeValueRT(rt, req->buffer_obj);
+    }
+    JS_FreeValueRT(rt, req->resolving_funcs[0]);
+    JS_FreeValueRT(rt, req->resolving_funcs[1]);
+    js_free_rt(rt, req);
+}
 
-static JSValue js_os_signal(JSContext *ctx, JSValueConst this_val,
-                            int argc, JSValueConst *argv)
+/* read/write handler of async_fds[0]: resolve the promises of the
+   completed requests */
+static JSValue js_os_async_complete(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    JSOSSignalHandler *sh;
-    uint32_t sig_num;
-    JSValueConst func;
-    sighandler_t handler;
-
-    if (!is_main_thread(rt))
-        return JS_ThrowTypeError(ctx, "signal handler can only be set in the main thread");
-
-    if (JS_ToUint32(ctx, &sig_num, argv[0]))
-        return JS_EXCEPTION;
-    if (sig_num >= 64)
-        return JS_ThrowRangeError(ctx, "invalid signal number");
-    func = argv[1];
-    /* func = null: SIG_DFL, func = undefined, SIG_IGN */
-    if (JS_IsNull(func) || JS_IsUndefined(func)) {
-        sh = find_sh(ts, sig_num);
-        if (sh) {
-            free_sh(JS_GetRuntime(ctx), sh);
-        }
-        if (JS_IsNull(func))
-            handler = SIG_DFL;
-        else
-            handler = SIG_IGN;
-        signal(sig_num, handler);
-    } else {
-        if (!JS_IsFunction(ctx, func))
-            return JS_ThrowTypeError(ctx, "not a function");
-        sh = find_sh(ts, sig_num);
-        if (!sh) {
-            sh = js_mallocz(ctx, sizeof(*sh));
-            if (!sh)
-                return JS_EXCEPTION;
-            sh->sig_num = sig_num;
-            list_add_tail(&sh->link, &ts->os_signal_handlers);
+    struct list_head done_list, *el, *el1;
+    JSOSAsyncReq *req;
+    JSValue val;
+    uint8_t ch;
+
+    while (read(ts->async_fds[0], &ch, 1) < 0 && errno == EINTR)
+        continue;
+    init_list_head(&done_list);
+    pthread_mutex_lock(&ts->async_mutex);
+    list_splice_tail(&ts->async_done_list, &done_list);
+    pthread_mutex_unlock(&ts->async_mutex);
+
+    list_for_each_safe(el, el1, &done_list) {
+        req = list_entry(el, JSOSAsyncReq, link);
+        list_del(&req->link);
+        if (req->op == OS_ASYNC_LOAD_FILE) {
+            if (req->buf)
+                val = JS_NewStringLen(ctx, (char *)req->buf, req->len);
+            else
+                val = JS_NULL;
+        } else {
+            val = JS_NewInt64(ctx, req->ret);
         }
-        JS_FreeValue(ctx, sh->func);
-        sh->func = JS_DupValue(ctx, func);
-        signal(sig_num, os_signal_handler);
+        os_promise_settle(ctx, (JSValueConst *)req->resolving_funcs, val);
+        os_async_free_req(rt, req);
+        ts->async_count--;
     }
+    /* the event loop no longer needs to wait for the thread pool */
+    if (ts->async_count == 0)
+        os_set_rw_handler(ctx, ts->async_fds[0], 0, JS_NULL);
     return JS_UNDEFINED;
 }
 
-#if defined(__linux__) || defined(__APPLE__)
-static int64_t get_time_ms(void)
+/* queue 'req' to the thread pool. Return -1 if error. */
+static int os_async_submit(JSContext *ctx, JSOSAsyncReq *req)
 {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    BOOL run_now;
+
+    if (ts->async_fds[0] < 0) {
+        if (pipe(ts->async_fds) < 0) {
+            ts->async_fds[0] = -1;
+            JS_ThrowInternalError(ctx, "could not create the async I/O pipe");
+            return -1;
+        }
+        fcntl(ts->async_fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(ts->async_fds[1], F_SETFD, FD_CLOEXEC);
+        pthread_mutex_lock(&os_async_mutex);
+        os_async_user_count++;
+        pthread_mutex_unlock(&os_async_mutex);
+    }
+    if (ts->async_count == 0) {
+        JSValue func;
+        int ret;
+        func = JS_NewCFunction(ctx, js_os_async_complete, "", 0);
+        if (JS_IsException(func))
+            return -1;
+        ret = os_set_rw_handler(ctx, ts->async_fds[0], 0, func);
+        JS_FreeValue(ctx, func);
+        if (ret)
+            return -1;
+    }
+    ts->async_count++;
+    req->ts = ts;
+
+    pthread_mutex_lock(&ts->async_mutex);
+    ts->async_pending++;
+    pthread_mutex_unlock(&ts->async_mutex);
+
+    run_now = FALSE;
+    pthread_mutex_lock(&os_async_mutex);
+    list_add_tail(&req->link, &os_async_queue);
+    if (!os_async_start_thread() && !os_async_quit) {
+        /* no thread: do the I/O synchronously */
+        list_del(&req->link);
+        run_now = TRUE;
+    }
+    if (!run_now)
+        pthread_cond_signal(&os_async_cond);
+    pthread_mutex_unlock(&os_async_mutex);
+    if (run_now)
+        os_async_exec(req);
+    return 0;
 }
-#else
-/* more portable, but does not work if the date is updated */
-static int64_t get_time_ms(void)
+
+#ifdef USE_IO_URING
+
+/* io_uring backend: the requests are queued in the submission ring
+   while the JS code runs and are submitted with a single system call
+   before waiting for events. The ring file descriptor is registered as
+   a read handler, so the completions are dispatched by the usual event
+   loop. */
+
+#define OS_URING_ENTRIES 256
+
+typedef struct JSOSURing {
+    int fd;
+    unsigned int sq_entries;
+    unsigned int *sq_head, *sq_tail, *sq_mask, *sq_flags, *sq_array;
+    struct io_uring_sqe *sqes;
+    unsigned int *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+    void *sq_ring, *cq_ring; /* cq_ring = sq_ring if single mmap */
+    size_t sq_ring_size, cq_ring_size, sqes_size;
+    unsigned int sq_queued; /* queued entries not yet submitted */
+    struct list_head req_list; /* in-flight requests, JSOSAsyncReq.link */
+    int req_count;
+} JSOSURing;
+
+static int os_uring_enter(JSOSURing *r, unsigned int to_submit,
+                          unsigned int min_complete, unsigned int flags)
 {
-    struct timeval tv;
-    gettimeofday(&tv, NULL);
-    return (int64_t)tv.tv_sec * 1000 + (tv.tv_usec / 1000);
+    int ret;
+    do {
+        ret = syscall(__NR_io_uring_enter, r->fd, to_submit, min_complete,
+                      flags, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+    return ret;
 }
-#endif
 
-static void unlink_timer(JSRuntime *rt, JSOSTimer *th)
+static void os_uring_unmap(JSRuntime *rt, JSOSURing *r)
 {
-    if (th->link.prev) {
-        list_del(&th->link);
-        th->link.prev = th->link.next = NULL;
-    }
+    if (r->sqes)
+        munmap(r->sqes, r->sqes_size);
+    if (r->cq_ring && r->cq_ring != r->sq_ring)
+        munmap(r->cq_ring, r->cq_ring_size);
+    if (r->sq_ring)
+        munmap(r->sq_ring, r->sq_ring_size);
+    close(r->fd);
+    js_free_rt(rt, r);
 }
 
-static void free_timer(JSRuntime *rt, JSOSTimer *th)
+static void *os_uring_mmap(JSOSURing *r, size_t size, off_t offset)
 {
-    JS_FreeValueRT(rt, th->func);
-    js_free_rt(rt, th);
+    void *ptr;
+    ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+               r->fd, offset);
+    if (ptr == MAP_FAILED)
+        return NULL;
+    return ptr;
 }
 
-static JSClassID js_os_timer_class_id;
-
-static void js_os_timer_finalizer(JSRuntime *rt, JSValue val)
+/* return NULL if io_uring is not supported */
+static JSOSURing *os_uring_new(JSRuntime *rt)
 {
-    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
-    if (th) {
-        th->has_object = FALSE;
-        if (!th->link.prev)
-            free_timer(rt, th);
-    }
-}
+    struct io_uring_params p;
+    JSOSURing *r;
+    uint8_t *sq, *cq;
 
-static void js_os_timer_mark(JSRuntime *rt, JSValueConst val,
-                             JS_MarkFunc *mark_func)
-{
-    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
-    if (th) {
-        JS_MarkValue(rt, th->func, mark_func);
+    r = js_mallocz_rt(rt, sizeof(*r));
+    if (!r)
+        return NULL;
+    init_list_head(&r->req_list);
+    memset(&p, 0, sizeof(p));
+    r->fd = syscall(__NR_io_uring_setup, OS_URING_ENTRIES, &p);
+    if (r->fd < 0) {
+        js_free_rt(rt, r);
+        return NULL;
     }
+    /* with fast poll, the kernel does not use a thread to wait for
+       the pollable file descriptors. No completion is lost with
+       nodrop. */
+    if (!(p.features & IORING_FEAT_FAST_POLL) ||
+        !(p.features & IORING_FEAT_NODROP))
+        goto fail;
+    r->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+    r->cq_ring_size = p.cq_off.cqes +
+        p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (r->cq_ring_size > r->sq_ring_size)
+            r->sq_ring_size = r->cq_ring_size;
+        r->cq_ring_size = r->sq_ring_size;
+    }
+    r->sq_ring = os_uring_mmap(r, r->sq_ring_size, IORING_OFF_SQ_RING);
+    if (!r->sq_ring)
+        goto fail;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        r->cq_ring = r->sq_ring;
+    else
+        r->cq_ring = os_uring_mmap(r, r->cq_ring_size, IORING_OFF_CQ_RING);
+    if (!r->cq_ring)
+        goto fail;
+    r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = os_uring_mmap(r, r->sqes_size, IORING_OFF_SQES);
+    if (!r->sqes)
+        goto fail;
+
+    sq = r->sq_ring;
+    r->sq_entries = p.sq_entries;
+    r->sq_head = (unsigned int *)(sq + p.sq_off.head);
+    r->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+    r->sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+    r->sq_flags = (unsigned int *)(sq + p.sq_off.flags);
+    r->sq_array = (unsigned int *)(sq + p.sq_off.array);
+    cq = r->cq_ring;
+    r->cq_head = (unsigned int *)(cq + p.cq_off.head);
+    r->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+    r->cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+    r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    return r;
+ fail:
+    os_uring_unmap(rt, r);
+    return NULL;
 }
 
-static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
-                                int argc, JSValueConst *argv)
+/* submit the queued entries. Return -1 with errno set if error. */
+static int os_uring_submit(JSOSURing *r)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int64_t delay;
-    JSValueConst func;
-    JSOSTimer *th;
-    JSValue obj;
+    int ret;
 
-    func = argv[0];
-    if (!JS_IsFunction(ctx, func))
-        return JS_ThrowTypeError(ctx, "not a function");
-    if (JS_ToInt64(ctx, &delay, argv[1]))
-        return JS_EXCEPTION;
-    obj = JS_NewObjectClass(ctx, js_os_timer_class_id);
-    if (JS_IsException(obj))
-        return obj;
-    th = js_mallocz(ctx, sizeof(*th));
-    if (!th) {
-        JS_FreeValue(ctx, obj);
-        return JS_EXCEPTION;
-    }
-    th->has_object = TRUE;
-    th->timeout = get_time_ms() + delay;
-    th->func = JS_DupValue(ctx, func);
-    list_add_tail(&th->link, &ts->os_timers);
-    JS_SetOpaque(obj, th);
-    return obj;
+    if (r->sq_queued == 0)
+        return 0;
+    ret = os_uring_enter(r, r->sq_queued, 0, 0);
+    if (ret < 0)
+        return -1;
+    r->sq_queued -= ret;
+    return 0;
 }
 
-static JSValue js_os_clearTimeout(JSContext *ctx, JSValueConst this_val,
-                                  int argc, JSValueConst *argv)
+/* return NULL if the submission ring is full */
+static struct io_uring_sqe *os_uring_get_sqe(JSOSURing *r)
 {
-    JSOSTimer *th = JS_GetOpaque2(ctx, argv[0], js_os_timer_class_id);
-    if (!th)
-        return JS_EXCEPTION;
-    unlink_timer(JS_GetRuntime(ctx), th);
-    return JS_UNDEFINED;
+    struct io_uring_sqe *sqe;
+    unsigned int tail, idx;
+
+    tail = *r->sq_tail;
+    if (tail - __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE) >=
+        r->sq_entries) {
+        if (os_uring_submit(r) < 0 ||
+            tail - __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE) >=
+            r->sq_entries)
+            return NULL;
+    }
+    idx = tail & *r->sq_mask;
+    sqe = &r->sqes[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    r->sq_array[idx] = idx;
+    return sqe;
 }
 
-static JSClassDef js_os_timer_class = {
-    "OSTimer",
-    .finalizer = js_os_timer_finalizer,
-    .gc_mark = js_os_timer_mark,
-};
+static void os_uring_queue_sqe(JSOSURing *r)
+{
+    __atomic_store_n(r->sq_tail, *r->sq_tail + 1, __ATOMIC_RELEASE);
+    r->sq_queued++;
+}
 
-static void call_handler(JSContext *ctx, JSValueConst func)
+/* handle the available completions. The promises are resolved if
+   'ctx' is not NULL. */
+static void os_uring_reap(JSRuntime *rt, JSContext *ctx, JSOSURing *r)
 {
-    JSValue ret, func1;
-    /* 'func' might be destroyed when calling itself (if it frees the
-       handler), so must take extra care */
-    func1 = JS_DupValue(ctx, func);
-    ret = JS_Call(ctx, func1, JS_UNDEFINED, 0, NULL);
-    JS_FreeValue(ctx, func1);
-    if (JS_IsException(ret))
-        js_std_dump_error(ctx);
-    JS_FreeValue(ctx, ret);
+    struct io_uring_cqe *cqe;
+    JSOSAsyncReq *req;
+    unsigned int head;
+    BOOL flushed;
+    int res;
+
+    flushed = FALSE;
+    for(;;) {
+        head = *r->cq_head;
+        if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE)) {
+            /* the completions which did not fit in the ring are
+               copied to it by io_uring_enter() */
+            if (flushed ||
+                !(__atomic_load_n(r->sq_flags, __ATOMIC_ACQUIRE) &
+                  IORING_SQ_CQ_OVERFLOW))
+                break;
+            os_uring_enter(r, 0, 0, IORING_ENTER_GETEVENTS);
+            flushed = TRUE;
+            continue;
+        }
+        cqe = &r->cqes[head & *r->cq_mask];
+        req = (JSOSAsyncReq *)(uintptr_t)cqe->user_data;
+        res = cqe->res;
+        __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+        if (!req)
+            continue; /* cancel request */
+        list_del(&req->link);
+        r->req_count--;
+        if (ctx)
+            os_promise_settle(ctx, (JSValueConst *)req->resolving_funcs,
+                              JS_NewInt32(ctx, res));
+        os_async_free_req(rt, req);
+    }
 }
 
-#if defined(_WIN32)
+/* complete the queued entries, which were not seen by the kernel,
+   with the error 'err'. The promises are resolved if 'ctx' is not
+   NULL. */
+static void os_uring_fail_queued(JSRuntime *rt, JSContext *ctx,
+                                 JSOSURing *r, int err)
+{
+    struct list_head failed_list, *el, *el1;
+    struct io_uring_sqe *sqe;
+    JSOSAsyncReq *req;
+    unsigned int tail, i;
+
+    /* the ring is updated before resolving the promises because they
+       may queue new entries */
+    init_list_head(&failed_list);
+    tail = *r->sq_tail - r->sq_queued;
+    for(i = tail; i != *r->sq_tail; i++) {
+        sqe = &r->sqes[i & *r->sq_mask];
+        req = (JSOSAsyncReq *)(uintptr_t)sqe->user_data;
+        if (!req)
+            continue; /* cancel request */
+        list_del(&req->link);
+        list_add_tail(&req->link, &failed_list);
+        r->req_count--;
+    }
+    __atomic_store_n(r->sq_tail, tail, __ATOMIC_RELEASE);
+    r->sq_queued = 0;
 
-static int js_os_poll(JSContext *ctx)
+    list_for_each_safe(el, el1, &failed_list) {
+        req = list_entry(el, JSOSAsyncReq, link);
+        list_del(&req->link);
+        if (ctx)
+            os_promise_settle(ctx, (JSValueConst *)req->resolving_funcs,
+                              JS_NewInt32(ctx, err));
+        os_async_free_req(rt, req);
+    }
+    if (ctx && r->req_count == 0)
+        os_set_rw_handler(ctx, r->fd, 0, JS_NULL);
+}
+
+/* read handler of the ring file descriptor */
+static JSValue js_os_uring_complete(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int min_delay, console_fd;
-    int64_t cur_time, delay;
-    JSOSRWHandler *rh;
-    struct list_head *el;
-
-    /* XXX: handle signals if useful */
+    JSOSURing *r = ts->uring;
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers))
-        return -1; /* no more events */
+    os_uring_reap(rt, ctx, r);
+    if (r->req_count == 0)
+        os_set_rw_handler(ctx, r->fd, 0, JS_NULL);
+    return JS_UNDEFINED;
+}
 
-    /* XXX: only timers and basic console input are supported */
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
+/* start 'req' with io_uring. Return 1 if OK, 0 if io_uring cannot be
+   used and -1 if exception. */
+static int os_uring_start(JSContext *ctx, JSOSAsyncReq *req)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSURing *r;
+    struct io_uring_sqe *sqe;
+
+    r = ts->uring;
+    if (!r) {
+        if (ts->uring_disabled)
+            return 0;
+        r = os_uring_new(rt);
+        if (!r) {
+            ts->uring_disabled = TRUE;
+            return 0;
         }
-    } else {
-        min_delay = -1;
+        ts->uring = r;
     }
-
-    console_fd = -1;
-    list_for_each(el, &ts->os_rw_handlers) {
-        rh = list_entry(el, JSOSRWHandler, link);
-        if (rh->fd == 0 && !JS_IsNull(rh->rw_func[0])) {
-            console_fd = rh->fd;
-            break;
-        }
+    if (r->req_count == 0) {
+        JSValue func;
+        int ret;
+        func = JS_NewCFunction(ctx, js_os_uring_complete, "", 0);
+        if (JS_IsException(func))
+            return -1;
+        ret = os_set_rw_handler(ctx, r->fd, 0, func);
+        JS_FreeValue(ctx, func);
+        if (ret)
+            return -1;
+    }
+    sqe = os_uring_get_sqe(r);
+    if (!sqe) {
+        if (r->req_count == 0)
+            os_set_rw_handler(ctx, r->fd, 0, JS_NULL);
+        return 0;
     }
+    sqe->fd = req->fd;
+    switch(req->op) {
+    case OS_ASYNC_READ:
+    case OS_ASYNC_WRITE:
+        sqe->opcode = (req->op == OS_ASYNC_READ) ?
+            IORING_OP_READ : IORING_OP_WRITE;
+        sqe->addr = (uintptr_t)req->buf;
+        sqe->len = req->len;
+        sqe->off = (uint64_t)-1; /* current file position */
+        break;
+    case OS_ASYNC_ACCEPT:
+        sqe->opcode = IORING_OP_ACCEPT;
+        sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+        break;
+    default:
+        abort();
+    }
+    sqe->user_data = (uintptr_t)req;
+    os_uring_queue_sqe(r);
+    req->ts = ts;
+    list_add_tail(&req->link, &r->req_list);
+    r->req_count++;
+    return 1;
+}
 
-    if (console_fd >= 0) {
-        DWORD ti, ret;
-        HANDLE handle;
-        if (min_delay == -1)
-            ti = INFINITE;
-        else
-            ti = min_delay;
-        handle = (HANDLE)_get_osfhandle(console_fd);
-        ret = WaitForSingleObject(handle, ti);
-        if (ret == WAIT_OBJECT_0) {
-            list_for_each(el, &ts->os_rw_handlers) {
-                rh = list_entry(el, JSOSRWHandler, link);
-                if (rh->fd == console_fd && !JS_IsNull(rh->rw_func[0])) {
-                    call_handler(ctx, rh->rw_func[0]);
-                    /* must stop because the list may have been modified */
-                    break;
-                }
-            }
+static void os_uring_free(JSRuntime *rt, JSOSURing *r)
+{
+    struct io_uring_sqe *sqe;
+    struct list_head *el;
+    int ret;
+
+    os_uring_fail_queued(rt, NULL, r, -ECANCELED);
+    /* the in-flight requests reference memory which is about to be
+       freed, so they are cancelled and their completion is waited
+       before unmapping the rings */
+    for(;;) {
+        list_for_each(el, &r->req_list) {
+            JSOSAsyncReq *req = list_entry(el, JSOSAsyncReq, link);
+            if (req->cancelled)
+                continue;
+            sqe = os_uring_get_sqe(r);
+            if (!sqe)
+                break; /* retried once completions are reaped */
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->addr = (uintptr_t)req;
+            os_uring_queue_sqe(r);
+            req->cancelled = TRUE;
+        }
+        os_uring_reap(rt, NULL, r);
+        if (r->req_count == 0)
+            break;
+        ret = os_uring_enter(r, r->sq_queued, 1, IORING_ENTER_GETEVENTS);
+        if (ret >= 0) {
+            r->sq_queued -= ret;
+        } else if (errno != EAGAIN && errno != EBUSY) {
+            /* the memory of the requests cannot be safely freed */
+            abort();
         }
-    } else {
-        Sleep(min_delay);
     }
-    return 0;
+    os_uring_unmap(rt, r);
 }
-#else
 
-#ifdef USE_WORKER
-
-static void js_free_message(JSWorkerMessage *msg);
+#endif /* USE_IO_URING */
 
-/* return 1 if a message was handled, 0 if no message */
-static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
-                                 JSWorkerMessageHandler *port)
+/* start 'req' with io_uring or, if 'use_threads' is true, with the
+   thread pool. Return 1 if OK, 0 if the caller must use a read/write
+   handler and -1 if exception. */
+static int os_async_start(JSContext *ctx, JSOSAsyncReq *req,
+                          BOOL use_threads)
 {
-    JSWorkerMessagePipe *ps = port->recv_pipe;
+#ifdef USE_IO_URING
     int ret;
-    struct list_head *el;
-    JSWorkerMessage *msg;
-    JSValue obj, data_obj, func, retval;
+    ret = os_uring_start(ctx, req);
+    if (ret != 0)
+        return ret;
+#endif
+    if (!use_threads)
+        return 0;
+    if (os_async_submit(ctx, req))
+        return -1;
+    return 1;
+}
 
-    pthread_mutex_lock(&ps->mutex);
-    if (!list_empty(&ps->msg_queue)) {
-        el = ps->msg_queue.next;
-        msg = list_entry(el, JSWorkerMessage, link);
+static JSOSAsyncReq *os_async_new_req(JSContext *ctx, OSAsyncOpEnum op,
+                                      int fd, JSValueConst *resolving_funcs)
+{
+    JSOSAsyncReq *req;
 
-        /* remove the message from the queue */
-        list_del(&msg->link);
+    req = js_mallocz(ctx, sizeof(*req));
+    if (!req)
+        return NULL;
+    req->op = op;
+    req->fd = fd;
+    req->buffer_obj = JS_UNDEFINED;
+    req->resolving_funcs[0] = JS_DupValue(ctx, resolving_funcs[0]);
+    req->resolving_funcs[1] = JS_DupValue(ctx, resolving_funcs[1]);
+    return req;
+}
 
-        if (list_empty(&ps->msg_queue)) {
-            uint8_t buf[16];
-            int ret;
-            for(;;) {
-                ret = read(ps->read_fd, buf, sizeof(buf));
-                if (ret >= 0)
-                    break;
-                if (errno != EAGAIN && errno != EINTR)
-                    break;
-            }
-        }
+static BOOL os_async_use_threads(int fd)
+{
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+        return FALSE;
+    return S_ISREG(st.st_mode) || S_ISBLK(st.st_mode);
+}
 
-        pthread_mutex_unlock(&ps->mutex);
+/* TRUE if a readAsync() or acceptAsync() (magic = 0) or a writeAsync()
+   (magic = 1) is pending on the pollable file descriptor 'fd' */
+static BOOL os_async_is_pending(JSThreadState *ts, int fd, int magic)
+{
+    JSOSRWHandler *rh;
 
-        data_obj = JS_ReadObject(ctx, msg->data, msg->data_len,
-                                 JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE);
+    rh = find_rh(ts, fd);
+    if (rh && !JS_IsNull(rh->rw_func[magic]))
+        return TRUE;
+#ifdef USE_IO_URING
+    if (ts->uring) {
+        struct list_head *el;
+        list_for_each(el, &ts->uring->req_list) {
+            JSOSAsyncReq *req = list_entry(el, JSOSAsyncReq, link);
+            if (req->fd == fd && (req->op == OS_ASYNC_WRITE) == magic)
+                return TRUE;
+        }
+    }
+#endif
+    return FALSE;
+}
 
-        js_free_message(msg);
+static int js_os_set_nonblock(int fd);
 
-        if (JS_IsException(data_obj))
-            goto fail;
-        obj = JS_NewObject(ctx);
-        if (JS_IsException(obj)) {
-            JS_FreeValue(ctx, data_obj);
-            goto fail;
-        }
-        JS_DefinePropertyValueStr(ctx, obj, "data", data_obj, JS_PROP_C_W_E);
+/* read/write handler of a pending readAsync() (magic = 0),
+   writeAsync() (magic = 1) or acceptAsync() (magic = 2) on a pollable
+   file descriptor */
+static JSValue js_os_rw_async_ready(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv,
+                                    int magic, JSValue *func_data)
+{
+    int fd;
+    uint64_t pos, len;
+    size_t size;
+    ssize_t ret;
+    uint8_t *buf;
+    JSValue val;
 
-        /* 'func' might be destroyed when calling itself (if it frees the
-           handler), so must take extra care */
-        func = JS_DupValue(ctx, port->on_message_func);
-        retval = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst *)&obj);
-        JS_FreeValue(ctx, obj);
-        JS_FreeValue(ctx, func);
-        if (JS_IsException(retval)) {
-        fail:
-            js_std_dump_error(ctx);
-        } else {
-            JS_FreeValue(ctx, retval);
-        }
-        ret = 1;
+    if (JS_ToInt32(ctx, &fd, func_data[0]))
+        return JS_EXCEPTION;
+    if (magic == 2) {
+        ret = accept(fd, NULL, NULL);
+        if (ret >= 0)
+            ret = js_os_set_nonblock(ret);
+        ret = js_get_errno(ret);
     } else {
-        pthread_mutex_unlock(&ps->mutex);
-        ret = 0;
+        if (JS_ToIndex(ctx, &pos, func_data[2]) ||
+            JS_ToIndex(ctx, &len, func_data[3]))
+            return JS_EXCEPTION;
+        buf = JS_GetArrayBuffer(ctx, &size, func_data[1]);
+        if (!buf) {
+            val = JS_EXCEPTION;
+            goto done;
+        }
+        if (pos + len > size) {
+            val = JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+            goto done;
+        }
+        if (magic)
+            ret = js_get_errno(write(fd, buf + pos, len));
+        else
+            ret = js_get_errno(read(fd, buf + pos, len));
     }
-    return ret;
+    if (ret == -EAGAIN || ret == -EWOULDBLOCK || ret == -EINTR)
+        return JS_UNDEFINED; /* wait for the next event */
+    val = JS_NewInt64(ctx, ret);
+ done:
+    /* 'func_data' stays valid because call_handler() holds a
+       reference to the function */
+    os_set_rw_handler(ctx, fd, magic == 1, JS_NULL);
+    os_promise_settle(ctx, (JSValueConst *)func_data + 4, val);
+    return JS_UNDEFINED;
 }
-#else
-static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
-                                 JSWorkerMessageHandler *port)
+
+/* wait until 'fd' is ready with a read/write handler. Return -1 if
+   exception. */
+static int os_async_wait_ready(JSContext *ctx, int fd, int magic,
+                               JSValueConst buffer, uint64_t pos,
+                               uint64_t len, JSValueConst *resolving_funcs)
 {
-    return 0;
+    JSValue func;
+    JSValueConst data[6];
+    int ret;
+
+    data[0] = JS_NewInt32(ctx, fd);
+    data[1] = buffer;
+    data[2] = JS_NewInt64(ctx, pos);
+    data[3] = JS_NewInt64(ctx, len);
+    data[4] = resolving_funcs[0];
+    data[5] = resolving_funcs[1];
+    func = JS_NewCFunctionData(ctx, js_os_rw_async_ready, 0, magic,
+                               countof(data), data);
+    if (JS_IsException(func))
+        return -1;
+    ret = os_set_rw_handler(ctx, fd, magic == 1, func);
+    JS_FreeValue(ctx, func);
+    return ret;
 }
-#endif
 
-static int js_os_poll(JSContext *ctx)
+#endif /* USE_WORKER */
+
+static JSValue js_os_read_write_async(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv, int magic)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int ret, fd_max, min_delay;
-    int64_t cur_time, delay;
-    fd_set rfds, wfds;
-    JSOSRWHandler *rh;
-    struct list_head *el;
-    struct timeval tv, *tvp;
+    int fd;
+    uint64_t pos, len;
+    size_t size;
+    uint8_t *buf;
+    JSValue promise, resolving_funcs[2];
+#ifdef USE_WORKER
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSOSAsyncReq *req;
+    BOOL use_threads;
+    int ret;
+#endif
 
-    /* only check signals in the main thread */
-    if (!ts->recv_pipe &&
-        unlikely(os_pending_signals != 0)) {
-        JSOSSignalHandler *sh;
-        uint64_t mask;
-
-        list_for_each(el, &ts->os_signal_handlers) {
-            sh = list_entry(el, JSOSSignalHandler, link);
-            mask = (uint64_t)1 << sh->sig_num;
-            if (os_pending_signals & mask) {
-                os_pending_signals &= ~mask;
-                call_handler(ctx, sh->func);
-                return 0;
-            }
-        }
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &pos, argv[2]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &len, argv[3]))
+        return JS_EXCEPTION;
+    buf = JS_GetArrayBuffer(ctx, &size, argv[1]);
+    if (!buf)
+        return JS_EXCEPTION;
+    if (pos + len > size)
+        return JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+#ifdef USE_WORKER
+    use_threads = os_async_use_threads(fd);
+    if (!use_threads && os_async_is_pending(ts, fd, magic))
+        return JS_ThrowTypeError(ctx, "a %s is already pending on this file descriptor",
+                                 magic ? "write" : "read");
+#endif
+    promise = JS_NewPromiseCapability(ctx, resolving_funcs);
+    if (JS_IsException(promise))
+        return JS_EXCEPTION;
+#ifdef USE_WORKER
+    req = os_async_new_req(ctx, magic ? OS_ASYNC_WRITE : OS_ASYNC_READ, fd,
+                           (JSValueConst *)resolving_funcs);
+    if (!req)
+        goto fail;
+    req->buf = buf + pos;
+    req->len = len;
+    /* the ArrayBuffer cannot be detached while the I/O is in flight */
+    if (JS_PinArrayBuffer(ctx, argv[1])) {
+        os_async_free_req(JS_GetRuntime(ctx), req);
+        goto fail;
+    }
+    req->buffer_obj = JS_DupValue(ctx, argv[1]);
+    ret = os_async_start(ctx, req, use_threads);
+    if (ret <= 0)
+        os_async_free_req(JS_GetRuntime(ctx), req);
+    if (ret == 0)
+        ret = os_async_wait_ready(ctx, fd, magic, argv[1], pos, len,
+                                  (JSValueConst *)resolving_funcs);
+    if (ret < 0)
+        goto fail;
+#else
+    /* no event loop support: the I/O is done synchronously */
+    {
+        ssize_t ret;
+        if (magic)
+            ret = js_get_errno(write(fd, buf + pos, len));
+        else
+            ret = js_get_errno(read(fd, buf + pos, len));
+        os_promise_settle(ctx, (JSValueConst *)resolving_funcs,
+                          JS_NewInt64(ctx, ret));
     }
+#endif
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    return promise;
+#ifdef USE_WORKER
+ fail:
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    JS_FreeValue(ctx, promise);
+    return JS_EXCEPTION;
+#endif
+}
 
-    if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
-        list_empty(&ts->port_list))
-        return -1; /* no more events */
+#ifdef USE_WORKER
+static JSValue js_os_accept_async(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(ctx));
+    JSValue promise, resolving_funcs[2];
+    JSOSAsyncReq *req;
+    int fd, ret;
 
-    if (!list_empty(&ts->os_timers)) {
-        cur_time = get_time_ms();
-        min_delay = 10000;
-        list_for_each(el, &ts->os_timers) {
-            JSOSTimer *th = list_entry(el, JSOSTimer, link);
-            delay = th->timeout - cur_time;
-            if (delay <= 0) {
-                JSValue func;
-                /* the timer expired */
-                func = th->func;
-                th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
-                call_handler(ctx, func);
-                JS_FreeValue(ctx, func);
-                return 0;
-            } else if (delay < min_delay) {
-                min_delay = delay;
-            }
-        }
-        tv.tv_sec = min_delay / 1000;
-        tv.tv_usec = (min_delay % 1000) * 1000;
-        tvp = &tv;
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (os_async_is_pending(ts, fd, 0))
+        return JS_ThrowTypeError(ctx, "a read is already pending on this file descriptor");
+    promise = JS_NewPromiseCapability(ctx, resolving_funcs);
+    if (JS_IsException(promise))
+        return JS_EXCEPTION;
+    req = os_async_new_req(ctx, OS_ASYNC_ACCEPT, fd,
+                           (JSValueConst *)resolving_funcs);
+    if (!req) {
+        ret = -1;
     } else {
-        tvp = NULL;
+        ret = os_async_start(ctx, req, FALSE);
+        if (ret <= 0)
+            os_async_free_req(JS_GetRuntime(ctx), req);
+        if (ret == 0)
+            ret = os_async_wait_ready(ctx, fd, 2, JS_UNDEFINED, 0, 0,
+                                      (JSValueConst *)resolving_funcs);
     }
-
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
-    fd_max = -1;
-    list_for_each(el, &ts->os_rw_handlers) {
-        rh = list_entry(el, JSOSRWHandler, link);
-        fd_max = max_int(fd_max, rh->fd);
-        if (!JS_IsNull(rh->rw_func[0]))
-            FD_SET(rh->fd, &rfds);
-        if (!JS_IsNull(rh->rw_func[1]))
-            FD_SET(rh->fd, &wfds);
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    if (ret < 0) {
+        JS_FreeValue(ctx, promise);
+        return JS_EXCEPTION;
     }
+    return promise;
+}
+#endif
 
-    list_for_each(el, &ts->port_list) {
-        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-        if (!JS_IsNull(port->on_message_func)) {
-            JSWorkerMessagePipe *ps = port->recv_pipe;
-            fd_max = max_int(fd_max, ps->read_fd);
-            FD_SET(ps->read_fd, &rfds);
-        }
-    }
+static JSValue js_std_loadFileAsync(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSValue promise, resolving_funcs[2];
 
-    ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
-    if (ret > 0) {
-        list_for_each(el, &ts->os_rw_handlers) {
-            rh = list_entry(el, JSOSRWHandler, link);
-            if (!JS_IsNull(rh->rw_func[0]) &&
-                FD_ISSET(rh->fd, &rfds)) {
-                call_handler(ctx, rh->rw_func[0]);
-                /* must stop because the list may have been modified */
-                goto done;
-            }
-            if (!JS_IsNull(rh->rw_func[1]) &&
-                FD_ISSET(rh->fd, &wfds)) {
-                call_handler(ctx, rh->rw_func[1]);
-                /* must stop because the list may have been modified */
-                goto done;
-            }
-        }
+    promise = JS_NewPromiseCapability(ctx, resolving_funcs);
+    if (JS_IsException(promise))
+        return JS_EXCEPTION;
+#ifdef USE_WORKER
+    {
+        JSOSAsyncReq *req;
+        const char *filename;
+        int ret;
 
-        list_for_each(el, &ts->port_list) {
-            JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-            if (!JS_IsNull(port->on_message_func)) {
-                JSWorkerMessagePipe *ps = port->recv_pipe;
-                if (FD_ISSET(ps->read_fd, &rfds)) {
-                    if (handle_posted_message(rt, ctx, port))
-                        goto done;
-                }
-            }
+        filename = JS_ToCString(ctx, argv[0]);
+        if (!filename)
+            goto fail;
+        req = os_async_new_req(ctx, OS_ASYNC_LOAD_FILE, -1,
+                               (JSValueConst *)resolving_funcs);
+        if (!req) {
+            JS_FreeCString(ctx, filename);
+            goto fail;
+        }
+        req->filename = js_strdup(ctx, filename);
+        JS_FreeCString(ctx, filename);
+        ret = -1;
+        if (req->filename)
+            ret = os_async_submit(ctx, req);
+        if (ret) {
+            os_async_free_req(JS_GetRuntime(ctx), req);
+            goto fail;
         }
     }
-    done:
-    return 0;
+#else
+    os_promise_settle(ctx, (JSValueConst *)resolving_funcs,
+                      js_std_loadFile(ctx, JS_UNDEFINED, 1, argv));
+#endif
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    return promise;
+#ifdef USE_WORKER
+ fail:
+    JS_FreeValue(ctx, resolving_funcs[0]);
+    JS_FreeValue(ctx, resolving_funcs[1]);
+    JS_FreeValue(ctx, promise);
+    return JS_EXCEPTION;
+#endif
 }
-#endif /* !_WIN32 */
 
-static JSValue make_obj_error(JSContext *ctx,
-                              JSValue obj,
-                              int err)
+static JSOSSignalHandler *find_sh(JSThreadState *ts, int sig_num)
 {
-    JSValue arr;
-    if (JS_IsException(obj))
-        return obj;
-    arr = JS_NewArray(ctx);
-    if (JS_IsException(arr))
-        return JS_EXCEPTION;
-    JS_DefinePropertyValueUint32(ctx, arr, 0, obj,
-                                 JS_PROP_C_W_E);
-    JS_DefinePropertyValueUint32(ctx, arr, 1, JS_NewInt32(ctx, err),
-                                 JS_PROP_C_W_E);
-    return arr;
+    JSOSSignalHandler *sh;
+    struct list_head *el;
+    list_for_each(el, &ts->os_signal_handlers) {
+        sh = list_entry(el, JSOSSignalHandler, link);
+        if (sh->sig_num == sig_num)
+            return sh;
+    }
+    return NULL;
 }
 
-static JSValue make_string_error(JSContext *ctx,
-                                 const char *buf,
-                                 int err)
+static void free_sh(JSRuntime *rt, JSOSSignalHandler *sh)
 {
-    return make_obj_error(ctx, JS_NewString(ctx, buf), err);
+    list_del(&sh->link);
+    JS_FreeValueRT(rt, sh->func);
+    js_free_rt(rt, sh);
 }
 
-/* return [cwd, errorcode] */
-static JSValue js_os_getcwd(JSContext *ctx, JSValueConst this_val,
+static void os_signal_handler(int sig_num)
+{
+    os_pending_signals |= ((uint64_t)1 << sig_num);
+}
+
+#if defined(_WIN32)
+typedef void (*sighandler_t)(int sig_num);
+#endif
+
+static JSValue js_os_signal(JSContext *ctx, JSValueConst this_val,
                             int argc, JSValueConst *argv)
 {
-    char buf[PATH_MAX];
-    int err;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSSignalHandler *sh;
+    uint32_t sig_num;
+    JSValueConst func;
+    sighandler_t handler;
 
-    if (!getcwd(buf, sizeof(buf))) {
-        buf[0] = '\0';
-        err = errno;
+    if (!is_main_thread(rt))
+        return JS_ThrowTypeError(ctx, "signal handler can only be set in the main thread");
+
+    if (JS_ToUint32(ctx, &sig_num, argv[0]))
+        return JS_EXCEPTION;
+    if (sig_num >= 64)
+        return JS_ThrowRangeError(ctx, "invalid signal number");
+    func = argv[1];
+    /* func = null: SIG_DFL, func = undefined, SIG_IGN */
+    if (JS_IsNull(func) || JS_IsUndefined(func)) {
+        sh = find_sh(ts, sig_num);
+        if (sh) {
+            free_sh(JS_GetRuntime(ctx), sh);
+        }
+        if (JS_IsNull(func))
+            handler = SIG_DFL;
+        else
+            handler = SIG_IGN;
+        signal(sig_num, handler);
     } else {
-        err = 0;
+        if (!JS_IsFunction(ctx, func))
+            return JS_ThrowTypeError(ctx, "not a function");
+        sh = find_sh(ts, sig_num);
+        if (!sh) {
+            sh = js_mallocz(ctx, sizeof(*sh));
+            if (!sh)
+                return JS_EXCEPTION;
+            sh->sig_num = sig_num;
+            list_add_tail(&sh->link, &ts->os_signal_handlers);
+        }
+        JS_FreeValue(ctx, sh->func);
+        sh->func = JS_DupValue(ctx, func);
+        signal(sig_num, os_signal_handler);
     }
-    return make_string_error(ctx, buf, err);
+    return JS_UNDEFINED;
 }
 
-static JSValue js_os_chdir(JSContext *ctx, JSValueConst this_val,
-                           int argc, JSValueConst *argv)
+#if defined(__linux__) || defined(__APPLE__)
+static int64_t get_time_ms(void)
 {
-    const char *target;
-    int err;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (ts.tv_nsec / 1000000);
+}
+#else
+/* more portable, but does not work if the date is updated */
+static int64_t get_time_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000 + (tv.tv_usec / 1000);
+}
+#endif
 
-    target = JS_ToCString(ctx, argv[0]);
-    if (!target)
-        return JS_EXCEPTION;
-    err = js_get_errno(chdir(target));
-    JS_FreeCString(ctx, target);
-    return JS_NewInt32(ctx, err);
+static inline BOOL timer_lt(const JSOSTimer *a, const JSOSTimer *b)
+{
+    return a->timeout < b->timeout ||
+        (a->timeout == b->timeout && a->order < b->order);
 }
 
-static JSValue js_os_mkdir(JSContext *ctx, JSValueConst this_val,
-                           int argc, JSValueConst *argv)
+static inline void timer_heap_set(JSThreadState *ts, int i, JSOSTimer *th)
 {
-    int mode, ret;
-    const char *path;
+    ts->timers[i] = th;
+    th->heap_index = i;
+}
 
-    if (argc >= 2) {
-        if (JS_ToInt32(ctx, &mode, argv[1]))
-            return JS_EXCEPTION;
-    } else {
-        mode = 0777;
-    }
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-#if defined(_WIN32)
-    (void)mode;
-    ret = js_get_errno(mkdir(path));
-#else
-    ret = js_get_errno(mkdir(path, mode));
-#endif
-    JS_FreeCString(ctx, path);
-    return JS_NewInt32(ctx, ret);
-}
-
-/* return [array, errorcode] */
-static JSValue js_os_readdir(JSContext *ctx, JSValueConst this_val,
-                             int argc, JSValueConst *argv)
+/* restore the heap order after the timer at index 'i' was modified */
+static void timer_heap_update(JSThreadState *ts, int i)
 {
-    const char *path;
-    DIR *f;
-    struct dirent *d;
-    JSValue obj;
-    int err;
-    uint32_t len;
+    JSOSTimer *th = ts->timers[i];
+    int parent, child;
 
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    obj = JS_NewArray(ctx);
-    if (JS_IsException(obj)) {
-        JS_FreeCString(ctx, path);
-        return JS_EXCEPTION;
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (!timer_lt(th, ts->timers[parent]))
+            break;
+        timer_heap_set(ts, i, ts->timers[parent]);
+        i = parent;
     }
-    f = opendir(path);
-    if (!f)
-        err = errno;
-    else
-        err = 0;
-    JS_FreeCString(ctx, path);
-    if (!f)
-        goto done;
-    len = 0;
     for(;;) {
-        errno = 0;
-        d = readdir(f);
-        if (!d) {
-            err = errno;
+        child = 2 * i + 1;
+        if (child >= ts->timer_count)
             break;
-        }
-        JS_DefinePropertyValueUint32(ctx, obj, len++,
-                                     JS_NewString(ctx, d->d_name),
-                                     JS_PROP_C_W_E);
+        if (child + 1 < ts->timer_count &&
+            timer_lt(ts->timers[child + 1], ts->timers[child]))
+            child++;
+        if (!timer_lt(ts->timers[child], th))
+            break;
+        timer_heap_set(ts, i, ts->timers[child]);
+        i = child;
     }
-    closedir(f);
- done:
-    return make_obj_error(ctx, obj, err);
+    timer_heap_set(ts, i, th);
 }
 
-#if !defined(_WIN32)
-static int64_t timespec_to_ms(const struct timespec *tv)
+static int link_timer(JSContext *ctx, JSThreadState *ts, JSOSTimer *th)
 {
-    return (int64_t)tv->tv_sec * 1000 + (tv->tv_nsec / 1000000);
+    if (ts->timer_count >= ts->timer_size) {
+        JSOSTimer **tab;
+        int new_size;
+        new_size = max_int(16, ts->timer_size * 3 / 2);
+        tab = js_realloc(ctx, ts->timers, sizeof(tab[0]) * new_size);
+        if (!tab)
+            return -1;
+        ts->timers = tab;
+        ts->timer_size = new_size;
+    }
+    th->order = ts->timer_order++;
+    timer_heap_set(ts, ts->timer_count++, th);
+    timer_heap_update(ts, th->heap_index);
+    return 0;
 }
-#endif
 
-/* return [obj, errcode] */
-static JSValue js_os_stat(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv, int is_lstat)
+static void unlink_timer(JSRuntime *rt, JSOSTimer *th)
 {
-    const char *path;
-    int err, res;
-    struct stat st;
-    JSValue obj;
+    JSThreadState *ts;
+    int i;
 
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-#if defined(_WIN32)
-    res = stat(path, &st);
-#else
-    if (is_lstat)
-        res = lstat(path, &st);
-    else
-        res = stat(path, &st);
-#endif
-    JS_FreeCString(ctx, path);
-    if (res < 0) {
-        err = errno;
-        obj = JS_NULL;
-    } else {
-        err = 0;
-        obj = JS_NewObject(ctx);
-        if (JS_IsException(obj))
-            return JS_EXCEPTION;
-        JS_DefinePropertyValueStr(ctx, obj, "dev",
-                                  JS_NewInt64(ctx, st.st_dev),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ino",
-                                  JS_NewInt64(ctx, st.st_ino),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mode",
-                                  JS_NewInt32(ctx, st.st_mode),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "nlink",
-                                  JS_NewInt64(ctx, st.st_nlink),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "uid",
-                                  JS_NewInt64(ctx, st.st_uid),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "gid",
-                                  JS_NewInt64(ctx, st.st_gid),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "rdev",
-                                  JS_NewInt64(ctx, st.st_rdev),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "size",
-                                  JS_NewInt64(ctx, st.st_size),
-                                  JS_PROP_C_W_E);
-#if !defined(_WIN32)
-        JS_DefinePropertyValueStr(ctx, obj, "blocks",
-                                  JS_NewInt64(ctx, st.st_blocks),
-                                  JS_PROP_C_W_E);
-#endif
-#if defined(_WIN32)
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_atime * 1000),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_mtime * 1000),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, (int64_t)st.st_ctime * 1000),
-                                  JS_PROP_C_W_E);
-#elif defined(__APPLE__)
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atimespec)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtimespec)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctimespec)),
-                                  JS_PROP_C_W_E);
-#else
-        JS_DefinePropertyValueStr(ctx, obj, "atime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atim)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "mtime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtim)),
-                                  JS_PROP_C_W_E);
-        JS_DefinePropertyValueStr(ctx, obj, "ctime",
-                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctim)),
-                                  JS_PROP_C_W_E);
-#endif
+    if (th->heap_index >= 0) {
+        ts = JS_GetRuntimeOpaque(rt);
+        i = th->heap_index;
+        th->heap_index = -1;
+        if (i != --ts->timer_count) {
+            timer_heap_set(ts, i, ts->timers[ts->timer_count]);
+            timer_heap_update(ts, i);
+        }
     }
-    return make_obj_error(ctx, obj, err);
 }
 
-#if !defined(_WIN32)
-static void ms_to_timeval(struct timeval *tv, uint64_t v)
+static void free_timer(JSRuntime *rt, JSOSTimer *th)
 {
-    tv->tv_sec = v / 1000;
-    tv->tv_usec = (v % 1000) * 1000;
+    JS_FreeValueRT(rt, th->func);
+    js_free_rt(rt, th);
 }
-#endif
 
-static JSValue js_os_utimes(JSContext *ctx, JSValueConst this_val,
-                            int argc, JSValueConst *argv)
-{
-    const char *path;
-    int64_t atime, mtime;
-    int ret;
+static JSClassID js_os_timer_class_id;
 
-    if (JS_ToInt64(ctx, &atime, argv[1]))
-        return JS_EXCEPTION;
-    if (JS_ToInt64(ctx, &mtime, argv[2]))
-        return JS_EXCEPTION;
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-#if defined(_WIN32)
-    {
-        struct _utimbuf times;
-        times.actime = atime / 1000;
-        times.modtime = mtime / 1000;
-        ret = js_get_errno(_utime(path, &times));
+static void js_os_timer_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
+    if (th) {
+        th->has_object = FALSE;
+        if (th->heap_index < 0)
+            free_timer(rt, th);
     }
-#else
-    {
-        struct timeval times[2];
-        ms_to_timeval(&times[0], atime);
-        ms_to_timeval(&times[1], mtime);
-        ret = js_get_errno(utimes(path, times));
+}
+
+static void js_os_timer_mark(JSRuntime *rt, JSValueConst val,
+                             JS_MarkFunc *mark_func)
+{
+    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
+    /* an active timer is a root for its function */
+    if (th && th->heap_index < 0) {
+        JS_MarkValue(rt, th->func, mark_func);
     }
-#endif
-    JS_FreeCString(ctx, path);
-    return JS_NewInt32(ctx, ret);
 }
 
-/* sleep(delay_ms) */
-static JSValue js_os_sleep(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv)
+/* magic = 1 for setInterval() */
+static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv, int magic)
 {
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
     int64_t delay;
-    int ret;
+    JSValueConst func;
+    JSOSTimer *th;
+    JSValue obj;
 
-    if (JS_ToInt64(ctx, &delay, argv[0]))
+    func = argv[0];
+    if (!JS_IsFunction(ctx, func))
+        return JS_ThrowTypeError(ctx, "not a function");
+    if (JS_ToInt64(ctx, &delay, argv[1]))
+        return JS_EXCEPTION;
+    obj = JS_NewObjectClass(ctx, js_os_timer_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    th = js_mallocz(ctx, sizeof(*th));
+    if (!th) {
+        JS_FreeValue(ctx, obj);
         return JS_EXCEPTION;
-    if (delay < 0)
-        delay = 0;
-#if defined(_WIN32)
-    {
-        if (delay > INT32_MAX)
-            delay = INT32_MAX;
-        Sleep(delay);
-        ret = 0;
     }
-#else
-    {
-        struct timespec ts;
-
-        ts.tv_sec = delay / 1000;
-        ts.tv_nsec = (delay % 1000) * 1000000;
-        ret = js_get_errno(nanosleep(&ts, NULL));
+    th->heap_index = -1;
+    th->has_object = TRUE;
+    th->timeout = get_time_ms() + delay;
+    if (magic)
+        th->interval = max_int64(delay, 1);
+    th->func = JS_DupValue(ctx, func);
+    if (link_timer(ctx, ts, th)) {
+        free_timer(rt, th);
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
     }
-#endif
-    return JS_NewInt32(ctx, ret);
+    JS_SetOpaque(obj, th);
+    return obj;
 }
 
-#if defined(_WIN32)
-static char *realpath(const char *path, char *buf)
+static JSValue js_os_clearTimeout(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
 {
-    if (!_fullpath(buf, path, PATH_MAX)) {
-        errno = ENOENT;
-        return NULL;
-    } else {
-        return buf;
-    }
+    JSOSTimer *th = JS_GetOpaque2(ctx, argv[0], js_os_timer_class_id);
+    if (!th)
+        return JS_EXCEPTION;
+    unlink_timer(JS_GetRuntime(ctx), th);
+    return JS_UNDEFINED;
 }
-#endif
 
-/* return [path, errorcode] */
-static JSValue js_os_realpath(JSContext *ctx, JSValueConst this_val,
-                              int argc, JSValueConst *argv)
+static JSClassDef js_os_timer_class = {
+    "OSTimer",
+    .finalizer = js_os_timer_finalizer,
+    .gc_mark = js_os_timer_mark,
+};
+
+static void call_handler(JSContext *ctx, JSValueConst func)
 {
-    const char *path;
-    char buf[PATH_MAX], *res;
-    int err;
+    JSValue ret, func1;
+    /* 'func' might be destroyed when calling itself (if it frees the
+       handler), so must take extra care */
+    func1 = JS_DupValue(ctx, func);
+    ret = JS_Call(ctx, func1, JS_UNDEFINED, 0, NULL);
+    JS_FreeValue(ctx, func1);
+    if (JS_IsException(ret))
+        js_std_dump_error(ctx);
+    JS_FreeValue(ctx, ret);
+}
 
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    res = realpath(path, buf);
-    JS_FreeCString(ctx, path);
-    if (!res) {
-        buf[0] = '\0';
-        err = errno;
+/* If a timer expired, call it and return TRUE. Otherwise return FALSE
+   and set '*pmin_delay' to the delay in ms before the next check (-1
+   if there is no timer). */
+static BOOL handle_timers(JSContext *ctx, int *pmin_delay)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *th;
+    int64_t cur_time, delay;
+    JSValue func;
+
+    if (ts->timer_count == 0) {
+        *pmin_delay = -1;
+        return FALSE;
+    }
+    th = ts->timers[0];
+    cur_time = get_time_ms();
+    delay = th->timeout - cur_time;
+    if (delay > 0) {
+        *pmin_delay = min_int64(delay, 10000);
+        return FALSE;
+    }
+    /* the timer expired */
+    if (th->interval > 0) {
+        /* rearm it before the call so that it can be cleared by 'func' */
+        th->timeout += th->interval;
+        if (th->timeout <= cur_time)
+            th->timeout = cur_time + th->interval;
+        th->order = ts->timer_order++;
+        timer_heap_update(ts, 0);
+        func = JS_DupValue(ctx, th->func);
     } else {
-        err = 0;
+        func = th->func;
+        th->func = JS_UNDEFINED;
+        unlink_timer(rt, th);
+        if (!th->has_object)
+            free_timer(rt, th);
     }
-    return make_string_error(ctx, buf, err);
+    call_handler(ctx, func);
+    JS_FreeValue(ctx, func);
+    return TRUE;
 }
 
-#if !defined(_WIN32)
-static JSValue js_os_symlink(JSContext *ctx, JSValueConst this_val,
-                              int argc, JSValueConst *argv)
+#if defined(_WIN32)
+
+static int js_os_poll(JSContext *ctx)
 {
-    const char *target, *linkpath;
-    int err;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    int min_delay, console_fd;
+    JSOSRWHandler *rh;
+    struct list_head *el;
 
-    target = JS_ToCString(ctx, argv[0]);
-    if (!target)
-        return JS_EXCEPTION;
-    linkpath = JS_ToCString(ctx, argv[1]);
-    if (!linkpath) {
-        JS_FreeCString(ctx, target);
-        return JS_EXCEPTION;
+    /* XXX: handle signals if useful */
+
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0)
+        return -1; /* no more events */
+
+    /* XXX: only timers and basic console input are supported */
+    if (handle_timers(ctx, &min_delay))
+        return 0;
+
+    console_fd = -1;
+    list_for_each(el, &ts->os_rw_handlers) {
+        rh = list_entry(el, JSOSRWHandler, link);
+        if (rh->fd == 0 && !JS_IsNull(rh->rw_func[0])) {
+            console_fd = rh->fd;
+            break;
+        }
     }
-    err = js_get_errno(symlink(target, linkpath));
-    JS_FreeCString(ctx, target);
-    JS_FreeCString(ctx, linkpath);
-    return JS_NewInt32(ctx, err);
+
+    if (console_fd >= 0) {
+        DWORD ti, ret;
+        HANDLE handle;
+        if (min_delay == -1)
+            ti = INFINITE;
+        else
+            ti = min_delay;
+        handle = (HANDLE)_get_osfhandle(console_fd);
+        ret = WaitForSingleObject(handle, ti);
+        if (ret == WAIT_OBJECT_0) {
+            list_for_each(el, &ts->os_rw_handlers) {
+                rh = list_entry(el, JSOSRWHandler, link);
+                if (rh->fd == console_fd && !JS_IsNull(rh->rw_func[0])) {
+                    call_handler(ctx, rh->rw_func[0]);
+                    /* must stop because the list may have been modified */
+                    break;
+                }
+            }
+        }
+    } else {
+        Sleep(min_delay);
+    }
+    return 0;
 }
+#else
 
-/* return [path, errorcode] */
-static JSValue js_os_readlink(JSContext *ctx, JSValueConst this_val,
-                              int argc, JSValueConst *argv)
-{
-    const char *path;
-    char buf[PATH_MAX];
-    int err;
-    ssize_t res;
+#ifdef USE_WORKER
 
-    path = JS_ToCString(ctx, argv[0]);
-    if (!path)
-        return JS_EXCEPTION;
-    res = readlink(path, buf, sizeof(buf) - 1);
-    if (res < 0) {
-        buf[0] = '\0';
-        err = errno;
-    } else {
-        buf[res] = '\0';
-        err = 0;
+static void js_free_message(JSWorkerMessage *msg);
+static JSWorkerMessagePipe *js_dup_message_pipe(JSWorkerMessagePipe *ps);
+static void js_free_message_pipe(JSWorkerMessagePipe *ps);
+static JSWorkerMessage *js_message_queue_pop(JSWorkerMessagePipe *ps);
+static BOOL js_message_queue_is_empty(JSWorkerMessagePipe *ps);
+static void js_message_pipe_signal(JSWorkerMessagePipe *ps);
+static void js_message_pipe_clear(JSWorkerMessagePipe *ps);
+
+/* maximum number of messages handled before returning to the event loop */
+#define JS_WORKER_MAX_BATCH 64
+
+static BOOL is_port_alive(JSThreadState *ts, JSWorkerMessageHandler *port1,
+                          JSWorkerMessagePipe *ps)
+{
+    struct list_head *el;
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (port == port1)
+            return port->recv_pipe == ps && !JS_IsNull(port->on_message_func);
     }
-    JS_FreeCString(ctx, path);
-    return make_string_error(ctx, buf, err);
+    return FALSE;
 }
 
-static char **build_envp(JSContext *ctx, JSValueConst obj)
+/* return 1 if a message was handled, 0 if no message */
+static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
+                                 JSWorkerMessageHandler *port)
 {
-    uint32_t len, i;
-    JSPropertyEnum *tab;
-    char **envp, *pair;
-    const char *key, *str;
-    JSValue val;
-    size_t key_len, str_len;
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSWorkerMessagePipe *ps = port->recv_pipe;
+    int ret, n;
+    JSWorkerMessage *msg;
+    JSValue obj, data_obj, func, retval;
 
-    if (JS_GetOwnPropertyNames(ctx, &tab, &len, obj,
-                               JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0)
-        return NULL;
-    envp = js_mallocz(ctx, sizeof(envp[0]) * ((size_t)len + 1));
-    if (!envp)
-        goto fail;
-    for(i = 0; i < len; i++) {
-        val = JS_GetProperty(ctx, obj, tab[i].atom);
-        if (JS_IsException(val))
-            goto fail;
-        str = JS_ToCString(ctx, val);
-        JS_FreeValue(ctx, val);
-        if (!str)
+    /* the notification is cleared before reading the queue so that
+       a message posted meanwhile signals the pipe again */
+    js_message_pipe_clear(ps);
+
+    /* the handler may close the port */
+    js_dup_message_pipe(ps);
+    ret = 0;
+    for(n = 0; n < JS_WORKER_MAX_BATCH; n++) {
+        msg = js_message_queue_pop(ps);
+        if (!msg)
+            break;
+        data_obj = JS_ReadObject2(ctx, msg->data, msg->data_len,
+                                  JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                                  msg->transfer_tab, msg->transfer_tab_len);
+
+        js_free_message(msg);
+
+        if (JS_IsException(data_obj))
             goto fail;
-        key = JS_AtomToCString(ctx, tab[i].atom);
-        if (!key) {
-            JS_FreeCString(ctx, str);
+        obj = JS_NewObject(ctx);
+        if (JS_IsException(obj)) {
+            JS_FreeValue(ctx, data_obj);
             goto fail;
         }
-        key_len = strlen(key);
-        str_len = strlen(str);
-        pair = js_malloc(ctx, key_len + str_len + 2);
-        if (!pair) {
-            JS_FreeCString(ctx, key);
-            JS_FreeCString(ctx, str);
-            goto fail;
+        JS_DefinePropertyValueStr(ctx, obj, "data", data_obj, JS_PROP_C_W_E);
+
+        /* 'func' might be destroyed when calling itself (if it frees the
+           handler), so must take extra care */
+        func = JS_DupValue(ctx, port->on_message_func);
+        retval = JS_Call(ctx, func, JS_UNDEFINED, 1, (JSValueConst *)&obj);
+        JS_FreeValue(ctx, obj);
+        JS_FreeValue(ctx, func);
+        if (JS_IsException(retval)) {
+        fail:
+            js_std_dump_error(ctx);
+        } else {
+            JS_FreeValue(ctx, retval);
         }
-        memcpy(pair, key, key_len);
-        pair[key_len] = '=';
-        memcpy(pair + key_len + 1, str, str_len);
-        pair[key_len + 1 + str_len] = '\0';
-        envp[i] = pair;
-        JS_FreeCString(ctx, key);
-        JS_FreeCString(ctx, str);
+        ret = 1;
+        js_std_execute_pending_jobs(ctx);
+        if (!is_port_alive(ts, port, ps))
+            goto done;
     }
+    /* let the event loop run before handling the remaining messages */
+    if (!js_message_queue_is_empty(ps))
+        js_message_pipe_signal(ps);
  done:
-    for(i = 0; i < len; i++)
-        JS_FreeAtom(ctx, tab[i].atom);
-    js_free(ctx, tab);
-    return envp;
- fail:
-    if (envp) {
-        for(i = 0; i < len; i++)
-            js_free(ctx, envp[i]);
-        js_free(ctx, envp);
-        envp = NULL;
-    }
-    goto done;
+    js_free_message_pipe(ps);
+    return ret;
 }
+#else
+static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
+                                 JSWorkerMessageHandler *port)
+{
+    return 0;
+}
+#endif
 
-/* execvpe is not available on non GNU systems */
-static int my_execvpe(const char *filename, char **argv, char **envp)
+#ifdef USE_EPOLL
+
+/* maximum number of events handled per epoll_wait() call */
+#define OS_EPOLL_MAX_EVENTS 64
+
+static void os_handle_rw_event(JSContext *ctx, JSThreadState *ts, int fd,
+                               uint32_t events)
 {
-    char *path, *p, *p_next, *p1;
-    char buf[PATH_MAX];
-    size_t filename_len, path_len;
-    BOOL eacces_error;
+    JSOSRWHandler *rh;
 
-    filename_len = strlen(filename);
-    if (filename_len == 0) {
-        errno = ENOENT;
-        return -1;
+    rh = find_rh(ts, fd);
+    if (rh && !JS_IsNull(rh->rw_func[0]) &&
+        (events & (EPOLLIN | EPOLLERR | EPOLLHUP))) {
+        call_handler(ctx, rh->rw_func[0]);
+        js_std_execute_pending_jobs(ctx);
+        /* the handler may have been modified */
+        rh = find_rh(ts, fd);
     }
-    if (strchr(filename, '/'))
-        return execve(filename, argv, envp);
+    if (rh && !JS_IsNull(rh->rw_func[1]) &&
+        (events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) {
+        call_handler(ctx, rh->rw_func[1]);
+        js_std_execute_pending_jobs(ctx);
+    }
+}
 
-    path = getenv("PATH");
-    if (!path)
-        path = (char *)"/bin:/usr/bin";
-    eacces_error = FALSE;
-    p = path;
-    for(p = path; p != NULL; p = p_next) {
-        p1 = strchr(p, ':');
-        if (!p1) {
-            p_next = NULL;
-            path_len = strlen(p);
+/* wait at most 'timeout' ms (-1 = infinite) and call the handlers of
+   all the ready file descriptors */
+static void os_epoll_wait(JSContext *ctx, JSThreadState *ts, int timeout)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    struct epoll_event events[OS_EPOLL_MAX_EVENTS];
+    struct list_head *el;
+    int n, i, fd;
+
+    if (ts->no_epoll_count != 0)
+        timeout = 0;
+    n = epoll_wait(ts->epoll_fd, events, countof(events), timeout);
+    for(i = 0; i < n; i++) {
+        fd = events[i].data.fd;
+        if (find_rh(ts, fd)) {
+            os_handle_rw_event(ctx, ts, fd, events[i].events);
         } else {
-            p_next = p1 + 1;
-            path_len = p1 - p;
+            list_for_each(el, &ts->port_list) {
+                JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+                if (port->recv_pipe->read_fd == fd) {
+                    handle_posted_message(rt, ctx, port);
+                    break;
+                }
+            }
         }
-        /* path too long */
-        if ((path_len + 1 + filename_len + 1) > PATH_MAX)
-            continue;
-        memcpy(buf, p, path_len);
-        buf[path_len] = '/';
-        memcpy(buf + path_len + 1, filename, filename_len);
-        buf[path_len + 1 + filename_len] = '\0';
-
-        execve(buf, argv, envp);
+    }
 
-        switch(errno) {
-        case EACCES:
-            eacces_error = TRUE;
-            break;
-        case ENOENT:
-        case ENOTDIR:
-            break;
-        default:
-            return -1;
+    if (ts->no_epoll_count != 0) {
+        /* the table is scanned because the handlers may be modified */
+        for(fd = 0; fd < ts->rw_handler_tab_size; fd++) {
+            JSOSRWHandler *rh = ts->rw_handler_tab[fd];
+            if (rh && rh->no_epoll)
+                os_handle_rw_event(ctx, ts, fd, EPOLLIN | EPOLLOUT);
         }
     }
-    if (eacces_error)
-        errno = EACCES;
-    return -1;
 }
 
-/* exec(args[, options]) -> exitcode */
-static JSValue js_os_exec(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv)
+#endif /* USE_EPOLL */
+
+static int js_os_poll(JSContext *ctx)
 {
-    JSValueConst options, args = argv[0];
-    JSValue val, ret_val;
-    const char **exec_argv, *file = NULL, *str, *cwd = NULL;
-    char **envp = environ;
-    uint32_t exec_argc, i;
-    int ret, pid, status;
-    BOOL block_flag = TRUE, use_path = TRUE;
-    static const char *std_name[3] = { "stdin", "stdout", "stderr" };
-    int std_fds[3];
-    uint32_t uid = -1, gid = -1;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    int min_delay;
+    struct list_head *el;
+#ifndef USE_EPOLL
+    int ret, fd_max;
+    fd_set rfds, wfds;
+    JSOSRWHandler *rh;
+    struct timeval tv, *tvp;
+#endif
 
-    val = JS_GetPropertyStr(ctx, args, "length");
-    if (JS_IsException(val))
-        return JS_EXCEPTION;
-    ret = JS_ToUint32(ctx, &exec_argc, val);
-    JS_FreeValue(ctx, val);
-    if (ret)
-        return JS_EXCEPTION;
-    /* arbitrary limit to avoid overflow */
-    if (exec_argc < 1 || exec_argc > 65535) {
-        return JS_ThrowTypeError(ctx, "invalid number of arguments");
-    }
-    exec_argv = js_mallocz(ctx, sizeof(exec_argv[0]) * (exec_argc + 1));
-    if (!exec_argv)
-        return JS_EXCEPTION;
-    for(i = 0; i < exec_argc; i++) {
-        val = JS_GetPropertyUint32(ctx, args, i);
-        if (JS_IsException(val))
-            goto exception;
-        str = JS_ToCString(ctx, val);
-        JS_FreeValue(ctx, val);
-        if (!str)
-            goto exception;
-        exec_argv[i] = str;
+    /* only check signals in the main thread */
+    if (!ts->is_worker &&
+        unlikely(os_pending_signals != 0)) {
+        JSOSSignalHandler *sh;
+        uint64_t mask;
+
+        list_for_each(el, &ts->os_signal_handlers) {
+            sh = list_entry(el, JSOSSignalHandler, link);
+            mask = (uint64_t)1 << sh->sig_num;
+            if (os_pending_signals & mask) {
+                os_pending_signals &= ~mask;
+                call_handler(ctx, sh->func);
+                return 0;
+            }
+        }
     }
-    exec_argv[exec_argc] = NULL;
 
-    for(i = 0; i < 3; i++)
-        std_fds[i] = i;
+    if (list_empty(&ts->os_rw_handlers) && ts->timer_count == 0 &&
+        list_empty(&ts->port_list))
+        return -1; /* no more events */
 
-    /* get the options, if any */
-    if (argc >= 2) {
-        options = argv[1];
+    if (handle_timers(ctx, &min_delay))
+        return 0;
 
-        if (get_bool_option(ctx, &block_flag, options, "block"))
-            goto exception;
-        if (get_bool_option(ctx, &use_path, options, "usePath"))
-            goto exception;
+#ifdef USE_IO_URING
+    /* submit the requests queued since the last wait. If the
+       completion queue is full (EBUSY), they are submitted once the
+       ring file descriptor handler has reaped the completions.
+       Otherwise the requests fail. */
+    if (ts->uring && os_uring_submit(ts->uring) < 0 && errno != EBUSY) {
+        os_uring_fail_queued(rt, ctx, ts->uring, -errno);
+        return 0;
+    }
+#endif
 
-        val = JS_GetPropertyStr(ctx, options, "file");
-        if (JS_IsException(val))
-            goto exception;
-        if (!JS_IsUndefined(val)) {
-            file = JS_ToCString(ctx, val);
-            JS_FreeValue(ctx, val);
-            if (!file)
-                goto exception;
-        }
+#ifdef USE_EPOLL
+    os_epoll_wait(ctx, ts, min_delay);
+#else
+    if (min_delay >= 0) {
+        tv.tv_sec = min_delay / 1000;
+        tv.tv_usec = (min_delay % 1000) * 1000;
+        tvp = &tv;
+    } else {
+        tvp = NULL;
+    }
 
-        val = JS_GetPropertyStr(ctx, options, "cwd");
-        if (JS_IsException(val))
-            goto exception;
-        if (!JS_IsUndefined(val)) {
-            cwd = JS_ToCString(ctx, val);
-            JS_FreeValue(ctx, val);
-            if (!cwd)
-                goto exception;
+    FD_ZERO(&rfds);
+    FD_ZERO(&wfds);
+    fd_max = -1;
+    list_for_each(el, &ts->os_rw_handlers) {
+        rh = list_entry(el, JSOSRWHandler, link);
+        fd_max = max_int(fd_max, rh->fd);
+        if (!JS_IsNull(rh->rw_func[0]))
+            FD_SET(rh->fd, &rfds);
+        if (!JS_IsNull(rh->rw_func[1]))
+            FD_SET(rh->fd, &wfds);
+    }
+
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (!JS_IsNull(port->on_message_func)) {
+            JSWorkerMessagePipe *ps = port->recv_pipe;
+            fd_max = max_int(fd_max, ps->read_fd);
+            FD_SET(ps->read_fd, &rfds);
         }
+    }
 
-        /* stdin/stdout/stderr handles */
-        for(i = 0; i < 3; i++) {
-            val = JS_GetPropertyStr(ctx, options, std_name[i]);
-            if (JS_IsException(val))
-                goto exception;
-            if (!JS_IsUndefined(val)) {
-                int fd;
-                ret = JS_ToInt32(ctx, &fd, val);
-                JS_FreeValue(ctx, val);
-                if (ret)
-                    goto exception;
-                std_fds[i] = fd;
+    ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
+    if (ret > 0) {
+        list_for_each(el, &ts->os_rw_handlers) {
+            rh = list_entry(el, JSOSRWHandler, link);
+            if (!JS_IsNull(rh->rw_func[0]) &&
+                FD_ISSET(rh->fd, &rfds)) {
+                call_handler(ctx, rh->rw_func[0]);
+                /* must stop because the list may have been modified */
+                goto done;
+            }
+            if (!JS_IsNull(rh->rw_func[1]) &&
+                FD_ISSET(rh->fd, &wfds)) {
+                call_handler(ctx, rh->rw_func[1]);
+                /* must stop because the list may have been modified */
+                goto done;
             }
         }
 
-        val = JS_GetPropertyStr(ctx, options, "env");
-        if (JS_IsException(val))
-            goto exception;
-        if (!JS_IsUndefined(val)) {
-            envp = build_envp(ctx, val);
-            JS_FreeValue(ctx, val);
-            if (!envp)
-                goto exception;
+        list_for_each(el, &ts->port_list) {
+            JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+            if (!JS_IsNull(port->on_message_func)) {
+                JSWorkerMessagePipe *ps = port->recv_pipe;
+                if (FD_ISSET(ps->read_fd, &rfds)) {
+                    if (handle_posted_message(rt, ctx, port))
+                        goto done;
+                }
+            }
         }
+    }
+    done:
+#endif /* !USE_EPOLL */
+    return 0;
+}
+#endif /* !_WIN32 */
+
+static JSValue make_obj_error(JSContext *ctx,
+                              JSValue obj,
+                              int err)
+{
+    JSValue arr;
+    if (JS_IsException(obj))
+        return obj;
+    arr = JS_NewArray(ctx);
+    if (JS_IsException(arr))
+        return JS_EXCEPTION;
+    JS_DefinePropertyValueUint32(ctx, arr, 0, obj,
+                                 JS_PROP_C_W_E);
+    JS_DefinePropertyValueUint32(ctx, arr, 1, JS_NewInt32(ctx, err),
+                                 JS_PROP_C_W_E);
+    return arr;
+}
+
+static JSValue make_string_error(JSContext *ctx,
+                                 const char *buf,
+                                 int err)
+{
+    return make_obj_error(ctx, JS_NewString(ctx, buf), err);
+}
+
+/* return [cwd, errorcode] */
+static JSValue js_os_getcwd(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    char buf[PATH_MAX];
+    int err;
+
+    if (!getcwd(buf, sizeof(buf))) {
+        buf[0] = '\0';
+        err = errno;
+    } else {
+        err = 0;
+    }
+    return make_string_error(ctx, buf, err);
+}
+
+static JSValue js_os_chdir(JSContext *ctx, JSValueConst this_val,
+                           int argc, JSValueConst *argv)
+{
+    const char *target;
+    int err;
+
+    target = JS_ToCString(ctx, argv[0]);
+    if (!target)
+        return JS_EXCEPTION;
+    err = js_get_errno(chdir(target));
+    JS_FreeCString(ctx, target);
+    return JS_NewInt32(ctx, err);
+}
+
+static JSValue js_os_mkdir(JSContext *ctx, JSValueConst this_val,
+                           int argc, JSValueConst *argv)
+{
+    int mode, ret;
+    const char *path;
+
+    if (argc >= 2) {
+        if (JS_ToInt32(ctx, &mode, argv[1]))
+            return JS_EXCEPTION;
+    } else {
+        mode = 0777;
+    }
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+#if defined(_WIN32)
+    (void)mode;
+    ret = js_get_errno(mkdir(path));
+#else
+    ret = js_get_errno(mkdir(path, mode));
+#endif
+    JS_FreeCString(ctx, path);
+    return JS_NewInt32(ctx, ret);
+}
+
+/* return [array, errorcode] */
+static JSValue js_os_readdir(JSContext *ctx, JSValueConst this_val,
+                             int argc, JSValueConst *argv)
+{
+    const char *path;
+    DIR *f;
+    struct dirent *d;
+    JSValue obj;
+    int err;
+    uint32_t len;
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    obj = JS_NewArray(ctx);
+    if (JS_IsException(obj)) {
+        JS_FreeCString(ctx, path);
+        return JS_EXCEPTION;
+    }
+    f = opendir(path);
+    if (!f)
+        err = errno;
+    else
+        err = 0;
+    JS_FreeCString(ctx, path);
+    if (!f)
+        goto done;
+    len = 0;
+    for(;;) {
+        errno = 0;
+        d = readdir(f);
+        if (!d) {
+            err = errno;
+            break;
+        }
+        JS_DefinePropertyValueUint32(ctx, obj, len++,
+                                     JS_NewString(ctx, d->d_name),
+                                     JS_PROP_C_W_E);
+    }
+    closedir(f);
+ done:
+    return make_obj_error(ctx, obj, err);
+}
+
+#if !defined(_WIN32)
+static int64_t timespec_to_ms(const struct timespec *tv)
+{
+    return (int64_t)tv->tv_sec * 1000 + (tv->tv_nsec / 1000000);
+}
+#endif
+
+/* return [obj, errcode] */
+static JSValue js_os_stat(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv, int is_lstat)
+{
+    const char *path;
+    int err, res;
+    struct stat st;
+    JSValue obj;
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+#if defined(_WIN32)
+    res = stat(path, &st);
+#else
+    if (is_lstat)
+        res = lstat(path, &st);
+    else
+        res = stat(path, &st);
+#endif
+    JS_FreeCString(ctx, path);
+    if (res < 0) {
+        err = errno;
+        obj = JS_NULL;
+    } else {
+        err = 0;
+        obj = JS_NewObject(ctx);
+        if (JS_IsException(obj))
+            return JS_EXCEPTION;
+        JS_DefinePropertyValueStr(ctx, obj, "dev",
+                                  JS_NewInt64(ctx, st.st_dev),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "ino",
+                                  JS_NewInt64(ctx, st.st_ino),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "mode",
+                                  JS_NewInt32(ctx, st.st_mode),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "nlink",
+                                  JS_NewInt64(ctx, st.st_nlink),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "uid",
+                                  JS_NewInt64(ctx, st.st_uid),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "gid",
+                                  JS_NewInt64(ctx, st.st_gid),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "rdev",
+                                  JS_NewInt64(ctx, st.st_rdev),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "size",
+                                  JS_NewInt64(ctx, st.st_size),
+                                  JS_PROP_C_W_E);
+#if !defined(_WIN32)
+        JS_DefinePropertyValueStr(ctx, obj, "blocks",
+                                  JS_NewInt64(ctx, st.st_blocks),
+                                  JS_PROP_C_W_E);
+#endif
+#if defined(_WIN32)
+        JS_DefinePropertyValueStr(ctx, obj, "atime",
+                                  JS_NewInt64(ctx, (int64_t)st.st_atime * 1000),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                                  JS_NewInt64(ctx, (int64_t)st.st_mtime * 1000),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                                  JS_NewInt64(ctx, (int64_t)st.st_ctime * 1000),
+                                  JS_PROP_C_W_E);
+#elif defined(__APPLE__)
+        JS_DefinePropertyValueStr(ctx, obj, "atime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atimespec)),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtimespec)),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctimespec)),
+                                  JS_PROP_C_W_E);
+#else
+        JS_DefinePropertyValueStr(ctx, obj, "atime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_atim)),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "mtime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_mtim)),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "ctime",
+                                  JS_NewInt64(ctx, timespec_to_ms(&st.st_ctim)),
+                                  JS_PROP_C_W_E);
+#endif
+    }
+    return make_obj_error(ctx, obj, err);
+}
+
+#if !defined(_WIN32)
+static void ms_to_timeval(struct timeval *tv, uint64_t v)
+{
+    tv->tv_sec = v / 1000;
+    tv->tv_usec = (v % 1000) * 1000;
+}
+#endif
+
+static JSValue js_os_utimes(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    const char *path;
+    int64_t atime, mtime;
+    int ret;
+
+    if (JS_ToInt64(ctx, &atime, argv[1]))
+        return JS_EXCEPTION;
+    if (JS_ToInt64(ctx, &mtime, argv[2]))
+        return JS_EXCEPTION;
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+#if defined(_WIN32)
+    {
+        struct _utimbuf times;
+        times.actime = atime / 1000;
+        times.modtime = mtime / 1000;
+        ret = js_get_errno(_utime(path, &times));
+    }
+#else
+    {
+        struct timeval times[2];
+        ms_to_timeval(&times[0], atime);
+        ms_to_timeval(&times[1], mtime);
+        ret = js_get_errno(utimes(path, times));
+    }
+#endif
+    JS_FreeCString(ctx, path);
+    return JS_NewInt32(ctx, ret);
+}
+
+/* sleep(delay_ms) */
+static JSValue js_os_sleep(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv)
+{
+    int64_t delay;
+    int ret;
+
+    if (JS_ToInt64(ctx, &delay, argv[0]))
+        return JS_EXCEPTION;
+    if (delay < 0)
+        delay = 0;
+#if defined(_WIN32)
+    {
+        if (delay > INT32_MAX)
+            delay = INT32_MAX;
+        Sleep(delay);
+        ret = 0;
+    }
+#else
+    {
+        struct timespec ts;
+
+        ts.tv_sec = delay / 1000;
+        ts.tv_nsec = (delay % 1000) * 1000000;
+        ret = js_get_errno(nanosleep(&ts, NULL));
+    }
+#endif
+    return JS_NewInt32(ctx, ret);
+}
+
+/* setProfileSampling(enable) */
+static JSValue js_os_setProfileSampling(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv)
+{
+    JS_SetProfileSampling(JS_GetRuntime(ctx), JS_ToBool(ctx, argv[0]));
+    return JS_UNDEFINED;
+}
+
+/* getProfile(reset = false) */
+static JSValue js_os_getProfile(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv)
+{
+    BOOL reset = FALSE;
+    if (argc >= 1)
+        reset = JS_ToBool(ctx, argv[0]);
+    return JS_GetProfile(ctx, reset);
+}
+
+#if defined(_WIN32)
+static char *realpath(const char *path, char *buf)
+{
+    if (!_fullpath(buf, path, PATH_MAX)) {
+        errno = ENOENT;
+        return NULL;
+    } else {
+        return buf;
+    }
+}
+#endif
+
+/* return [path, errorcode] */
+static JSValue js_os_realpath(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    const char *path;
+    char buf[PATH_MAX], *res;
+    int err;
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    res = realpath(path, buf);
+    JS_FreeCString(ctx, path);
+    if (!res) {
+        buf[0] = '\0';
+        err = errno;
+    } else {
+        err = 0;
+    }
+    return make_string_error(ctx, buf, err);
+}
+
+#if !defined(_WIN32)
+static JSValue js_os_symlink(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    const char *target, *linkpath;
+    int err;
+
+    target = JS_ToCString(ctx, argv[0]);
+    if (!target)
+        return JS_EXCEPTION;
+    linkpath = JS_ToCString(ctx, argv[1]);
+    if (!linkpath) {
+        JS_FreeCString(ctx, target);
+        return JS_EXCEPTION;
+    }
+    err = js_get_errno(symlink(target, linkpath));
+    JS_FreeCString(ctx, target);
+    JS_FreeCString(ctx, linkpath);
+    return JS_NewInt32(ctx, err);
+}
+
+/* return [path, errorcode] */
+static JSValue js_os_readlink(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    const char *path;
+    char buf[PATH_MAX];
+    int err;
+    ssize_t res;
+
+    path = JS_ToCString(ctx, argv[0]);
+    if (!path)
+        return JS_EXCEPTION;
+    res = readlink(path, buf, sizeof(buf) - 1);
+    if (res < 0) {
+        buf[0] = '\0';
+        err = errno;
+    } else {
+        buf[res] = '\0';
+        err = 0;
+    }
+    JS_FreeCString(ctx, path);
+    return make_string_error(ctx, buf, err);
+}
+
+static char **build_envp(JSContext *ctx, JSValueConst obj)
+{
+    uint32_t len, i;
+    JSPropertyEnum *tab;
+    char **envp, *pair;
+    const char *key, *str;
+    JSValue val;
+    size_t key_len, str_len;
+
+    if (JS_GetOwnPropertyNames(ctx, &tab, &len, obj,
+                               JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0)
+        return NULL;
+    envp = js_mallocz(ctx, sizeof(envp[0]) * ((size_t)len + 1));
+    if (!envp)
+        goto fail;
+    for(i = 0; i < len; i++) {
+        val = JS_GetProperty(ctx, obj, tab[i].atom);
+        if (JS_IsException(val))
+            goto fail;
+        str = JS_ToCString(ctx, val);
+        JS_FreeValue(ctx, val);
+        if (!str)
+            goto fail;
+        key = JS_AtomToCString(ctx, tab[i].atom);
+        if (!key) {
+            JS_FreeCString(ctx, str);
+            goto fail;
+        }
+        key_len = strlen(key);
+        str_len = strlen(str);
+        pair = js_malloc(ctx, key_len + str_len + 2);
+        if (!pair) {
+            JS_FreeCString(ctx, key);
+            JS_FreeCString(ctx, str);
+            goto fail;
+        }
+        memcpy(pair, key, key_len);
+        pair[key_len] = '=';
+        memcpy(pair + key_len + 1, str, str_len);
+        pair[key_len + 1 + str_len] = '\0';
+        envp[i] = pair;
+        JS_FreeCString(ctx, key);
+        JS_FreeCString(ctx, str);
+    }
+ done:
+    for(i = 0; i < len; i++)
+        JS_FreeAtom(ctx, tab[i].atom);
+    js_free(ctx, tab);
+    return envp;
+ fail:
+    if (envp) {
+        for(i = 0; i < len; i++)
+            js_free(ctx, envp[i]);
+        js_free(ctx, envp);
+        envp = NULL;
+    }
+    goto done;
+}
+
+/* execvpe is not available on non GNU systems */
+static int my_execvpe(const char *filename, char **argv, char **envp)
+{
+    char *path, *p, *p_next, *p1;
+    char buf[PATH_MAX];
+    size_t filename_len, path_len;
+    BOOL eacces_error;
+
+    filename_len = strlen(filename);
+    if (filename_len == 0) {
+        errno = ENOENT;
+        return -1;
+    }
+    if (strchr(filename, '/'))
+        return execve(filename, argv, envp);
+
+    path = getenv("PATH");
+    if (!path)
+        path = (char *)"/bin:/usr/bin";
+    eacces_error = FALSE;
+    p = path;
+    for(p = path; p != NULL; p = p_next) {
+        p1 = strchr(p, ':');
+        if (!p1) {
+            p_next = NULL;
+            path_len = strlen(p);
+        } else {
+            p_next = p1 + 1;
+            path_len = p1 - p;
+        }
+        /* path too long */
+        if ((path_len + 1 + filename_len + 1) > PATH_MAX)
+            continue;
+        memcpy(buf, p, path_len);
+        buf[path_len] = '/';
+        memcpy(buf + path_len + 1, filename, filename_len);
+        buf[path_len + 1 + filename_len] = '\0';
+
+        execve(buf, argv, envp);
+
+        switch(errno) {
+        case EACCES:
+            eacces_error = TRUE;
+            break;
+        case ENOENT:
+        case ENOTDIR:
+            break;
+        default:
+            return -1;
+        }
+    }
+    if (eacces_error)
+        errno = EACCES;
+    return -1;
+}
+
+/* exec(args[, options]) -> exitcode */
+static JSValue js_os_exec(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv)
+{
+    JSValueConst options, args = argv[0];
+    JSValue val, ret_val;
+    const char **exec_argv, *file = NULL, *str, *cwd = NULL;
+    char **envp = environ;
+    uint32_t exec_argc, i;
+    int ret, pid, status;
+    BOOL block_flag = TRUE, use_path = TRUE;
+    static const char *std_name[3] = { "stdin", "stdout", "stderr" };
+    int std_fds[3];
+    uint32_t uid = -1, gid = -1;
+
+    val = JS_GetPropertyStr(ctx, args, "length");
+    if (JS_IsException(val))
+        return JS_EXCEPTION;
+    ret = JS_ToUint32(ctx, &exec_argc, val);
+    JS_FreeValue(ctx, val);
+    if (ret)
+        return JS_EXCEPTION;
+    /* arbitrary limit to avoid overflow */
+    if (exec_argc < 1 || exec_argc > 65535) {
+        return JS_ThrowTypeError(ctx, "invalid number of arguments");
+    }
+    exec_argv = js_mallocz(ctx, sizeof(exec_argv[0]) * (exec_argc + 1));
+    if (!exec_argv)
+        return JS_EXCEPTION;
+    for(i = 0; i < exec_argc; i++) {
+        val = JS_GetPropertyUint32(ctx, args, i);
+        if (JS_IsException(val))
+            goto exception;
+        str = JS_ToCString(ctx, val);
+        JS_FreeValue(ctx, val);
+        if (!str)
+            goto exception;
+        exec_argv[i] = str;
+    }
+    exec_argv[exec_argc] = NULL;
+
+    for(i = 0; i < 3; i++)
+        std_fds[i] = i;
+
+    /* get the options, if any */
+    if (argc >= 2) {
+        options = argv[1];
+
+        if (get_bool_option(ctx, &block_flag, options, "block"))
+            goto exception;
+        if (get_bool_option(ctx, &use_path, options, "usePath"))
+            goto exception;
+
+        val = JS_GetPropertyStr(ctx, options, "file");
+        if (JS_IsException(val))
+            goto exception;
+        if (!JS_IsUndefined(val)) {
+            file = JS_ToCString(ctx, val);
+            JS_FreeValue(ctx, val);
+            if (!file)
+                goto exception;
+        }
+
+        val = JS_GetPropertyStr(ctx, options, "cwd");
+        if (JS_IsException(val))
+            goto exception;
+        if (!JS_IsUndefined(val)) {
+            cwd = JS_ToCString(ctx, val);
+            JS_FreeValue(ctx, val);
+            if (!cwd)
+                goto exception;
+        }
+
+        /* stdin/stdout/stderr handles */
+        for(i = 0; i < 3; i++) {
+            val = JS_GetPropertyStr(ctx, options, std_name[i]);
+            if (JS_IsException(val))
+                goto exception;
+            if (!JS_IsUndefined(val)) {
+                int fd;
+                ret = JS_ToInt32(ctx, &fd, val);
+                JS_FreeValue(ctx, val);
+                if (ret)
+                    goto exception;
+                std_fds[i] = fd;
+            }
+        }
+
+        val = JS_GetPropertyStr(ctx, options, "env");
+        if (JS_IsException(val))
+            goto exception;
+        if (!JS_IsUndefined(val)) {
+            envp = build_envp(ctx, val);
+            JS_FreeValue(ctx, val);
+            if (!envp)
+                goto exception;
+        }
+
+        val = JS_GetPropertyStr(ctx, options, "uid");
+        if (JS_IsException(val))
+            goto exception;
+        if (!JS_IsUndefined(val)) {
+            ret = JS_ToUint32(ctx, &uid, val);
+            JS_FreeValue(ctx, val);
+            if (ret)
+                goto exception;
+        }
+
+        val = JS_GetPropertyStr(ctx, options, "gid");
+        if (JS_IsException(val))
+            goto exception;
+        if (!JS_IsUndefined(val)) {
+            ret = JS_ToUint32(ctx, &gid, val);
+            JS_FreeValue(ctx, val);
+            if (ret)
+                goto exception;
+        }
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        JS_ThrowTypeError(ctx, "fork error");
+        goto exception;
+    }
+    if (pid == 0) {
+        /* child */
+        int fd_max = sysconf(_SC_OPEN_MAX);
+
+        /* remap the stdin/stdout/stderr handles if necessary */
+        for(i = 0; i < 3; i++) {
+            if (std_fds[i] != i) {
+                if (dup2(std_fds[i], i) < 0)
+                    _exit(127);
+            }
+        }
+
+        for(i = 3; i < fd_max; i++)
+            close(i);
+        if (cwd) {
+            if (chdir(cwd) < 0)
+                _exit(127);
+        }
+        if (uid != -1) {
+            if (setuid(uid) < 0)
+                _exit(127);
+        }
+        if (gid != -1) {
+            if (setgid(gid) < 0)
+                _exit(127);
+        }
+
+        if (!file)
+            file = exec_argv[0];
+        if (use_path)
+            ret = my_execvpe(file, (char **)exec_argv, envp);
+        else
+            ret = execve(file, (char **)exec_argv, envp);
+        _exit(127);
+    }
+    /* parent */
+    if (block_flag) {
+        for(;;) {
+            ret = waitpid(pid, &status, 0);
+            if (ret == pid) {
+                if (WIFEXITED(status)) {
+                    ret = WEXITSTATUS(status);
+                    break;
+                } else if (WIFSIGNALED(status)) {
+                    ret = -WTERMSIG(status);
+                    break;
+                }
+            }
+        }
+    } else {
+        ret = pid;
+    }
+    ret_val = JS_NewInt32(ctx, ret);
+ done:
+    JS_FreeCString(ctx, file);
+    JS_FreeCString(ctx, cwd);
+    for(i = 0; i < exec_argc; i++)
+        JS_FreeCString(ctx, exec_argv[i]);
+    js_free(ctx, exec_argv);
+    if (envp != environ) {
+        char **p;
+        p = envp;
+        while (*p != NULL) {
+            js_free(ctx, *p);
+            p++;
+        }
+        js_free(ctx, envp);
+    }
+    return ret_val;
+ exception:
+    ret_val = JS_EXCEPTION;
+    goto done;
+}
+
+/* waitpid(pid, block) -> [pid, status] */
+static JSValue js_os_waitpid(JSContext *ctx, JSValueConst this_val,
+                             int argc, JSValueConst *argv)
+{
+    int pid, status, options, ret;
+    JSValue obj;
+
+    if (JS_ToInt32(ctx, &pid, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &options, argv[1]))
+        return JS_EXCEPTION;
+
+    ret = waitpid(pid, &status, options);
+    if (ret < 0) {
+        ret = -errno;
+        status = 0;
+    }
+
+    obj = JS_NewArray(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_DefinePropertyValueUint32(ctx, obj, 0, JS_NewInt32(ctx, ret),
+                                 JS_PROP_C_W_E);
+    JS_DefinePropertyValueUint32(ctx, obj, 1, JS_NewInt32(ctx, status),
+                                 JS_PROP_C_W_E);
+    return obj;
+}
+
+/* pipe() -> [read_fd, write_fd] or null if error */
+static JSValue js_os_pipe(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv)
+{
+    int pipe_fds[2], ret;
+    JSValue obj;
+
+    ret = pipe(pipe_fds);
+    if (ret < 0)
+        return JS_NULL;
+    obj = JS_NewArray(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_DefinePropertyValueUint32(ctx, obj, 0, JS_NewInt32(ctx, pipe_fds[0]),
+                                 JS_PROP_C_W_E);
+    JS_DefinePropertyValueUint32(ctx, obj, 1, JS_NewInt32(ctx, pipe_fds[1]),
+                                 JS_PROP_C_W_E);
+    return obj;
+}
+
+/* kill(pid, sig) */
+static JSValue js_os_kill(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv)
+{
+    int pid, sig, ret;
+
+    if (JS_ToInt32(ctx, &pid, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &sig, argv[1]))
+        return JS_EXCEPTION;
+    ret = js_get_errno(kill(pid, sig));
+    return JS_NewInt32(ctx, ret);
+}
+
+/* dup(fd) */
+static JSValue js_os_dup(JSContext *ctx, JSValueConst this_val,
+                         int argc, JSValueConst *argv)
+{
+    int fd, ret;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    ret = js_get_errno(dup(fd));
+    return JS_NewInt32(ctx, ret);
+}
+
+/* dup2(fd) */
+static JSValue js_os_dup2(JSContext *ctx, JSValueConst this_val,
+                         int argc, JSValueConst *argv)
+{
+    int fd, fd2, ret;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &fd2, argv[1]))
+        return JS_EXCEPTION;
+    ret = js_get_errno(dup2(fd, fd2));
+    return JS_NewInt32(ctx, ret);
+}
+
+/* sockets */
+
+/* the sockets are non-blocking so that they can be used with
+   setReadHandler() and setWriteHandler() */
+static int js_os_set_nonblock(int fd)
+{
+    int flags;
+    flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0 ||
+        fcntl(fd, F_SETFD, FD_CLOEXEC) < 0) {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
+    return fd;
+}
+
+/* convert { address, port, family } or { path } to a socket address */
+static int js_os_get_sockaddr(JSContext *ctx, struct sockaddr_storage *sa,
+                              socklen_t *psa_len, JSValueConst obj)
+{
+    JSValue val;
+    const char *str;
+    int family, port, ret;
+
+    if (!JS_IsObject(obj)) {
+        JS_ThrowTypeError(ctx, "socket address object expected");
+        return -1;
+    }
+    memset(sa, 0, sizeof(*sa));
+    val = JS_GetPropertyStr(ctx, obj, "path");
+    if (JS_IsException(val))
+        return -1;
+    if (!JS_IsUndefined(val)) {
+        struct sockaddr_un *sun = (struct sockaddr_un *)sa;
+        str = JS_ToCString(ctx, val);
+        JS_FreeValue(ctx, val);
+        if (!str)
+            return -1;
+        if (strlen(str) >= sizeof(sun->sun_path)) {
+            JS_FreeCString(ctx, str);
+            JS_ThrowRangeError(ctx, "socket path too long");
+            return -1;
+        }
+        sun->sun_family = AF_UNIX;
+        pstrcpy(sun->sun_path, sizeof(sun->sun_path), str);
+        JS_FreeCString(ctx, str);
+        *psa_len = sizeof(*sun);
+        return 0;
+    }
+
+    val = JS_GetPropertyStr(ctx, obj, "port");
+    if (JS_IsException(val))
+        return -1;
+    ret = JS_ToInt32(ctx, &port, val);
+    JS_FreeValue(ctx, val);
+    if (ret)
+        return -1;
+    if (port < 0 || port > 65535) {
+        JS_ThrowRangeError(ctx, "invalid port");
+        return -1;
+    }
+
+    val = JS_GetPropertyStr(ctx, obj, "family");
+    if (JS_IsException(val))
+        return -1;
+    if (JS_IsUndefined(val)) {
+        family = -1;
+    } else {
+        ret = JS_ToInt32(ctx, &family, val);
+        JS_FreeValue(ctx, val);
+        if (ret)
+            return -1;
+    }
+
+    val = JS_GetPropertyStr(ctx, obj, "address");
+    if (JS_IsException(val))
+        return -1;
+    if (JS_IsUndefined(val)) {
+        str = NULL;
+    } else {
+        str = JS_ToCString(ctx, val);
+        JS_FreeValue(ctx, val);
+        if (!str)
+            return -1;
+    }
+    /* the family is deduced from the address if not present */
+    if (family < 0)
+        family = (str && strchr(str, ':')) ? AF_INET6 : AF_INET;
+
+    if (family == AF_INET) {
+        struct sockaddr_in *sin = (struct sockaddr_in *)sa;
+        sin->sin_family = AF_INET;
+        sin->sin_port = htons(port);
+        if (!str)
+            sin->sin_addr.s_addr = htonl(INADDR_ANY);
+        else if (inet_pton(AF_INET, str, &sin->sin_addr) != 1)
+            goto invalid_address;
+        *psa_len = sizeof(*sin);
+    } else if (family == AF_INET6) {
+        struct sockaddr_in6 *sin6 = (struct sockaddr_in6 *)sa;
+        sin6->sin6_family = AF_INET6;
+        sin6->sin6_port = htons(port);
+        if (!str)
+            sin6->sin6_addr = in6addr_any;
+        else if (inet_pton(AF_INET6, str, &sin6->sin6_addr) != 1)
+            goto invalid_address;
+        *psa_len = sizeof(*sin6);
+    } else {
+        JS_FreeCString(ctx, str);
+        JS_ThrowRangeError(ctx, "unsupported address family");
+        return -1;
+    }
+    JS_FreeCString(ctx, str);
+    return 0;
+ invalid_address:
+    JS_ThrowTypeError(ctx, "invalid address: %s", str);
+    JS_FreeCString(ctx, str);
+    return -1;
+}
+
+/* convert a socket address to { family, address, port } or { family, path } */
+static JSValue js_os_new_sockaddr(JSContext *ctx, const struct sockaddr *sa,
+                                  socklen_t sa_len)
+{
+    JSValue obj;
+    char buf[INET6_ADDRSTRLEN];
+    int port;
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_DefinePropertyValueStr(ctx, obj, "family",
+                              JS_NewInt32(ctx, sa->sa_family),
+                              JS_PROP_C_W_E);
+    switch(sa->sa_family) {
+    case AF_INET:
+        {
+            const struct sockaddr_in *sin = (const struct sockaddr_in *)sa;
+            inet_ntop(AF_INET, &sin->sin_addr, buf, sizeof(buf));
+            port = ntohs(sin->sin_port);
+        }
+        goto inet;
+    case AF_INET6:
+        {
+            const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)sa;
+            inet_ntop(AF_INET6, &sin6->sin6_addr, buf, sizeof(buf));
+            port = ntohs(sin6->sin6_port);
+        }
+    inet:
+        JS_DefinePropertyValueStr(ctx, obj, "address",
+                                  JS_NewString(ctx, buf),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "port",
+                                  JS_NewInt32(ctx, port),
+                                  JS_PROP_C_W_E);
+        break;
+    case AF_UNIX:
+        {
+            const struct sockaddr_un *sun = (const struct sockaddr_un *)sa;
+            size_t len;
+            /* unnamed sockets have no path */
+            if (sa_len <= offsetof(struct sockaddr_un, sun_path))
+                len = 0;
+            else
+                len = strnlen(sun->sun_path, sa_len - offsetof(struct sockaddr_un, sun_path));
+            JS_DefinePropertyValueStr(ctx, obj, "path",
+                                      JS_NewStringLen(ctx, sun->sun_path, len),
+                                      JS_PROP_C_W_E);
+        }
+        break;
+    default:
+        break;
+    }
+    return obj;
+}
+
+/* socket(domain, type, protocol = 0) -> fd or -errno */
+static JSValue js_os_socket(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    int domain, type, protocol, fd;
+
+    if (JS_ToInt32(ctx, &domain, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &type, argv[1]))
+        return JS_EXCEPTION;
+    protocol = 0;
+    if (argc >= 3 && JS_ToInt32(ctx, &protocol, argv[2]))
+        return JS_EXCEPTION;
+    fd = socket(domain, type, protocol);
+    if (fd >= 0)
+        fd = js_os_set_nonblock(fd);
+    return JS_NewInt32(ctx, js_get_errno(fd));
+}
+
+/* bind(fd, addr) (magic = 0) or connect(fd, addr) (magic = 1) */
+static JSValue js_os_bind_connect(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv, int magic)
+{
+    struct sockaddr_storage sa;
+    socklen_t sa_len;
+    int fd, ret;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (js_os_get_sockaddr(ctx, &sa, &sa_len, argv[1]))
+        return JS_EXCEPTION;
+    if (magic)
+        ret = connect(fd, (struct sockaddr *)&sa, sa_len);
+    else
+        ret = bind(fd, (struct sockaddr *)&sa, sa_len);
+    return JS_NewInt32(ctx, js_get_errno(ret));
+}
+
+/* listen(fd, backlog = SOMAXCONN) */
+static JSValue js_os_listen(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    int fd, backlog;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    backlog = SOMAXCONN;
+    if (argc >= 2 && !JS_IsUndefined(argv[1]) &&
+        JS_ToInt32(ctx, &backlog, argv[1]))
+        return JS_EXCEPTION;
+    return JS_NewInt32(ctx, js_get_errno(listen(fd, backlog)));
+}
+
+/* accept(fd) -> fd or -errno */
+static JSValue js_os_accept(JSContext *ctx, JSValueConst this_val,
+                            int argc, JSValueConst *argv)
+{
+    int fd, ret;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    ret = accept(fd, NULL, NULL);
+    if (ret >= 0)
+        ret = js_os_set_nonblock(ret);
+    return JS_NewInt32(ctx, js_get_errno(ret));
+}
+
+static JSValue js_os_shutdown(JSContext *ctx, JSValueConst this_val,
+                              int argc, JSValueConst *argv)
+{
+    int fd, how;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &how, argv[1]))
+        return JS_EXCEPTION;
+    return JS_NewInt32(ctx, js_get_errno(shutdown(fd, how)));
+}
+
+/* recv(fd, buffer, offset, length, flags = 0) (magic = 0),
+   send(fd, buffer, offset, length, flags = 0) (magic = 1),
+   recvfrom(fd, buffer, offset, length, flags = 0) (magic = 2),
+   sendto(fd, buffer, offset, length, addr, flags = 0) (magic = 3). The
+   data is directly read from or written to the array buffer. */
+static JSValue js_os_recv_send(JSContext *ctx, JSValueConst this_val,
+                               int argc, JSValueConst *argv, int magic)
+{
+    struct sockaddr_storage sa;
+    socklen_t sa_len;
+    int fd, flags, flags_idx;
+    uint64_t pos, len;
+    size_t size;
+    ssize_t ret;
+    uint8_t *buf;
+    JSValue obj;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &pos, argv[2]))
+        return JS_EXCEPTION;
+    if (JS_ToIndex(ctx, &len, argv[3]))
+        return JS_EXCEPTION;
+    flags = 0;
+    flags_idx = (magic == 3) ? 5 : 4;
+    if (argc > flags_idx && JS_ToInt32(ctx, &flags, argv[flags_idx]))
+        return JS_EXCEPTION;
+    if (magic == 3 && js_os_get_sockaddr(ctx, &sa, &sa_len, argv[4]))
+        return JS_EXCEPTION;
+    buf = JS_GetArrayBuffer(ctx, &size, argv[1]);
+    if (!buf)
+        return JS_EXCEPTION;
+    if (pos + len > size)
+        return JS_ThrowRangeError(ctx, "read/write array buffer overflow");
+#ifdef MSG_NOSIGNAL
+    /* return EPIPE instead of raising SIGPIPE */
+    if (magic & 1)
+        flags |= MSG_NOSIGNAL;
+#endif
+    switch(magic) {
+    case 0:
+        ret = js_get_errno(recv(fd, buf + pos, len, flags));
+        break;
+    case 1:
+        ret = js_get_errno(send(fd, buf + pos, len, flags));
+        break;
+    case 2:
+        sa_len = sizeof(sa);
+        ret = js_get_errno(recvfrom(fd, buf + pos, len, flags,
+                                    (struct sockaddr *)&sa, &sa_len));
+        /* return [length, addr] */
+        obj = JS_NewArray(ctx);
+        if (JS_IsException(obj))
+            return obj;
+        JS_DefinePropertyValueUint32(ctx, obj, 0, JS_NewInt64(ctx, ret),
+                                     JS_PROP_C_W_E);
+        JS_DefinePropertyValueUint32(ctx, obj, 1,
+                                     ret >= 0 ? js_os_new_sockaddr(ctx, (struct sockaddr *)&sa, sa_len) : JS_NULL,
+                                     JS_PROP_C_W_E);
+        return obj;
+    default:
+        ret = js_get_errno(sendto(fd, buf + pos, len, flags,
+                                  (struct sockaddr *)&sa, sa_len));
+        break;
+    }
+    return JS_NewInt64(ctx, ret);
+}
+
+/* getsockname(fd) (magic = 0) or getpeername(fd) (magic = 1) -> [addr, err] */
+static JSValue js_os_getsockname(JSContext *ctx, JSValueConst this_val,
+                                 int argc, JSValueConst *argv, int magic)
+{
+    struct sockaddr_storage sa;
+    socklen_t sa_len;
+    int fd, ret;
+    JSValue obj;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    sa_len = sizeof(sa);
+    if (magic)
+        ret = getpeername(fd, (struct sockaddr *)&sa, &sa_len);
+    else
+        ret = getsockname(fd, (struct sockaddr *)&sa, &sa_len);
+    if (ret < 0)
+        return make_obj_error(ctx, JS_NULL, errno);
+    obj = js_os_new_sockaddr(ctx, (struct sockaddr *)&sa, sa_len);
+    return make_obj_error(ctx, obj, 0);
+}
+
+/* setsockopt(fd, level, name, value) with an integer value */
+static JSValue js_os_setsockopt(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv)
+{
+    int fd, level, name, val;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &level, argv[1]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &name, argv[2]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &val, argv[3]))
+        return JS_EXCEPTION;
+    return JS_NewInt32(ctx, js_get_errno(setsockopt(fd, level, name,
+                                                    &val, sizeof(val))));
+}
+
+/* getsockopt(fd, level, name) -> [value, err] with an integer value */
+static JSValue js_os_getsockopt(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv)
+{
+    int fd, level, name, val, err;
+    socklen_t len;
+
+    if (JS_ToInt32(ctx, &fd, argv[0]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &level, argv[1]))
+        return JS_EXCEPTION;
+    if (JS_ToInt32(ctx, &name, argv[2]))
+        return JS_EXCEPTION;
+    val = 0;
+    len = sizeof(val);
+    err = 0;
+    if (getsockopt(fd, level, name, &val, &len) < 0)
+        err = errno;
+    return make_obj_error(ctx, JS_NewInt32(ctx, val), err);
+}
+
+#endif /* !_WIN32 */
+
+#ifdef USE_WORKER
+
+/* Worker */
+
+typedef struct {
+    JSWorkerMessagePipe *recv_pipe;
+    JSWorkerMessagePipe *send_pipe;
+    JSWorkerMessageHandler *msg_handler;
+} JSWorkerData;
+
+typedef struct {
+    char *filename; /* module filename */
+    char *basename; /* module base name */
+    JSWorkerMessagePipe *recv_pipe, *send_pipe;
+} WorkerFuncArgs;
+
+typedef struct {
+    int ref_count;
+    uint64_t buf[0];
+} JSSABHeader;
+
+static JSClassID js_worker_class_id;
+static JSContext *(*js_worker_new_context_func)(JSRuntime *rt);
+
+static int atomic_add_int(int *ptr, int v)
+{
+    return atomic_fetch_add((_Atomic(uint32_t) *)ptr, v) + v;
+}
+
+/* shared array buffer allocator */
+static void *js_sab_alloc(void *opaque, size_t size)
+{
+    JSSABHeader *sab;
+    sab = malloc(sizeof(JSSABHeader) + size);
+    if (!sab)
+        return NULL;
+    sab->ref_count = 1;
+    return sab->buf;
+}
+
+static void js_sab_free(void *opaque, void *ptr)
+{
+    JSSABHeader *sab;
+    int ref_count;
+    sab = (JSSABHeader *)((uint8_t *)ptr - sizeof(JSSABHeader));
+    ref_count = atomic_add_int(&sab->ref_count, -1);
+    assert(ref_count >= 0);
+    if (ref_count == 0) {
+        free(sab);
+    }
+}
+
+static void js_sab_dup(void *opaque, void *ptr)
+{
+    JSSABHeader *sab;
+    sab = (JSSABHeader *)((uint8_t *)ptr - sizeof(JSSABHeader));
+    atomic_add_int(&sab->ref_count, 1);
+}
+
+static JSWorkerMessagePipe *js_new_message_pipe(void)
+{
+    JSWorkerMessagePipe *ps;
+    int fds[2], i;
+
+#ifdef USE_EVENTFD
+    fds[0] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fds[0] < 0)
+        return NULL;
+    fds[1] = fds[0];
+#else
+    if (pipe(fds) < 0)
+        return NULL;
+    /* the reads and writes must never block */
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+#endif
+
+    ps = malloc(sizeof(*ps));
+    if (!ps) {
+        close(fds[0]);
+        if (fds[1] != fds[0])
+            close(fds[1]);
+        return NULL;
+    }
+    ps->ref_count = 1;
+    for(i = 0; i < JS_WORKER_QUEUE_SIZE; i++) {
+        atomic_init(&ps->slots[i].seq, i);
+        ps->slots[i].msg = NULL;
+    }
+    atomic_init(&ps->head, 0);
+    ps->tail = 0;
+    atomic_init(&ps->overflow_count, 0);
+    atomic_init(&ps->notified, FALSE);
+    init_list_head(&ps->msg_queue);
+    pthread_mutex_init(&ps->mutex, NULL);
+    ps->read_fd = fds[0];
+    ps->write_fd = fds[1];
+    return ps;
+}
+
+static JSWorkerMessagePipe *js_dup_message_pipe(JSWorkerMessagePipe *ps)
+{
+    atomic_add_int(&ps->ref_count, 1);
+    return ps;
+}
+
+/* return FALSE if the queue is full */
+static BOOL js_message_queue_push(JSWorkerMessagePipe *ps,
+                                  JSWorkerMessage *msg)
+{
+    JSWorkerQueueSlot *slot;
+    size_t pos, seq;
+
+    pos = atomic_load_explicit(&ps->head, memory_order_relaxed);
+    for(;;) {
+        slot = &ps->slots[pos & (JS_WORKER_QUEUE_SIZE - 1)];
+        seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq == pos) {
+            if (atomic_compare_exchange_weak_explicit(&ps->head, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
+            /* 'pos' was updated by the failed exchange */
+        } else if ((intptr_t)(seq - pos) < 0) {
+            return FALSE;
+        } else {
+            /* another producer took the slot */
+            pos = atomic_load_explicit(&ps->head, memory_order_relaxed);
+        }
+    }
+    slot->msg = msg;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    return TRUE;
+}
+
+/* only called by the consumer. Return NULL if no message. */
+static JSWorkerMessage *js_message_queue_pop(JSWorkerMessagePipe *ps)
+{
+    JSWorkerQueueSlot *slot;
+    JSWorkerMessage *msg;
+    size_t pos;
+
+    pos = ps->tail;
+    slot = &ps->slots[pos & (JS_WORKER_QUEUE_SIZE - 1)];
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) == pos + 1) {
+        msg = slot->msg;
+        slot->msg = NULL;
+        atomic_store_explicit(&slot->seq, pos + JS_WORKER_QUEUE_SIZE,
+                              memory_order_release);
+        ps->tail = pos + 1;
+        return msg;
+    }
+    /* the overflow list is read once the queue is empty so that the
+       messages of a given producer stay ordered */
+    msg = NULL;
+    if (atomic_load(&ps->overflow_count) != 0) {
+        pthread_mutex_lock(&ps->mutex);
+        if (!list_empty(&ps->msg_queue)) {
+            msg = list_entry(ps->msg_queue.next, JSWorkerMessage, link);
+            list_del(&msg->link);
+            atomic_fetch_sub(&ps->overflow_count, 1);
+        }
+        pthread_mutex_unlock(&ps->mutex);
+    }
+    return msg;
+}
+
+static BOOL js_message_queue_is_empty(JSWorkerMessagePipe *ps)
+{
+    JSWorkerQueueSlot *slot;
+    slot = &ps->slots[ps->tail & (JS_WORKER_QUEUE_SIZE - 1)];
+    return atomic_load_explicit(&slot->seq, memory_order_acquire) !=
+        ps->tail + 1 && atomic_load(&ps->overflow_count) == 0;
+}
+
+/* wake up the consumer unless it was already signaled */
+static void js_message_pipe_signal(JSWorkerMessagePipe *ps)
+{
+    int ret;
+
+    if (atomic_exchange(&ps->notified, TRUE))
+        return;
+    for(;;) {
+#ifdef USE_EVENTFD
+        uint64_t v = 1;
+        ret = write(ps->write_fd, &v, sizeof(v));
+#else
+        uint8_t ch = '\0';
+        ret = write(ps->write_fd, &ch, 1);
+#endif
+        if (ret >= 0 || errno != EINTR)
+            break;
+    }
+}
+
+/* called by the consumer before reading the messages */
+static void js_message_pipe_clear(JSWorkerMessagePipe *ps)
+{
+    uint8_t buf[16];
+    int ret;
+
+    for(;;) {
+        ret = read(ps->read_fd, buf, sizeof(buf));
+        if (ret < 0 && errno == EINTR)
+            continue;
+#ifndef USE_EVENTFD
+        if (ret == sizeof(buf))
+            continue;
+#endif
+        break;
+    }
+    atomic_store(&ps->notified, FALSE);
+}
+
+static void js_free_message(JSWorkerMessage *msg)
+{
+    size_t i;
+    /* free the SAB */
+    for(i = 0; i < msg->sab_tab_len; i++) {
+        js_sab_free(NULL, msg->sab_tab[i]);
+    }
+    free(msg->sab_tab);
+    /* free the transferred ArrayBuffers which were not read */
+    for(i = 0; i < msg->transfer_tab_len; i++) {
+        JSTransferredArrayBuffer *tb = &msg->transfer_tab[i];
+        if (tb->free_func)
+            tb->free_func(NULL, tb->opaque, tb->data);
+    }
+    free(msg->transfer_tab);
+    free(msg->data);
+    free(msg);
+}
+
+static void js_free_message_pipe(JSWorkerMessagePipe *ps)
+{
+    JSWorkerMessage *msg;
+    int ref_count;
+
+    if (!ps)
+        return;
+
+    ref_count = atomic_add_int(&ps->ref_count, -1);
+    assert(ref_count >= 0);
+    if (ref_count == 0) {
+        while ((msg = js_message_queue_pop(ps)) != NULL)
+            js_free_message(msg);
+        pthread_mutex_destroy(&ps->mutex);
+        close(ps->read_fd);
+        if (ps->write_fd != ps->read_fd)
+            close(ps->write_fd);
+        free(ps);
+    }
+}
+
+static void js_free_port(JSRuntime *rt, JSWorkerMessageHandler *port)
+{
+    if (port) {
+#ifdef USE_EPOLL
+        JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+        if (ts)
+            os_epoll_ctl(ts, port->recv_pipe->read_fd, EPOLLIN, 0);
+#endif
+        js_free_message_pipe(port->recv_pipe);
+        JS_FreeValueRT(rt, port->on_message_func);
+        list_del(&port->link);
+        js_free_rt(rt, port);
+    }
+}
+
+static void js_worker_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSWorkerData *worker = JS_GetOpaque(val, js_worker_class_id);
+    if (worker) {
+        js_free_message_pipe(worker->recv_pipe);
+        js_free_message_pipe(worker->send_pipe);
+        js_free_port(rt, worker->msg_handler);
+        js_free_rt(rt, worker);
+    }
+}
+
+static JSClassDef js_worker_class = {
+    "Worker",
+    .finalizer = js_worker_finalizer,
+};
+
+static void *worker_func(void *opaque)
+{
+    WorkerFuncArgs *args = opaque;
+    JSRuntime *rt;
+    JSThreadState *ts;
+    JSContext *ctx;
+
+    rt = JS_NewRuntime();
+    if (rt == NULL) {
+        fprintf(stderr, "JS_NewRuntime failure");
+        exit(1);
+    }
+    js_std_init_handlers(rt);
+
+    JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
+
+    /* set the pipe to communicate with the parent */
+    ts = JS_GetRuntimeOpaque(rt);
+    ts->is_worker = TRUE;
+    ts->recv_pipe = args->recv_pipe;
+    ts->send_pipe = args->send_pipe;
+
+    /* function pointer to avoid linking the whole JS_NewContext() if
+       not needed */
+    ctx = js_worker_new_context_func(rt);
+    if (ctx == NULL) {
+        fprintf(stderr, "JS_NewContext failure");
+    }
+
+    JS_SetCanBlock(rt, TRUE);
+
+    js_std_add_helpers(ctx, -1, NULL);
+
+    if (!JS_RunModule(ctx, args->basename, args->filename))
+        js_std_dump_error(ctx);
+    free(args->filename);
+    free(args->basename);
+    free(args);
+
+    js_std_loop(ctx);
+
+    JS_FreeContext(ctx);
+    js_std_free_handlers(rt);
+    JS_FreeRuntime(rt);
+    return NULL;
+}
+
+static JSValue js_worker_ctor_internal(JSContext *ctx, JSValueConst new_target,
+                                       JSWorkerMessagePipe *recv_pipe,
+                                       JSWorkerMessagePipe *send_pipe)
+{
+    JSValue obj = JS_UNDEFINED, proto;
+    JSWorkerData *s;
+
+    /* create the object */
+    if (JS_IsUndefined(new_target)) {
+        proto = JS_GetClassProto(ctx, js_worker_class_id);
+    } else {
+        proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+        if (JS_IsException(proto))
+            goto fail;
+    }
+    obj = JS_NewObjectProtoClass(ctx, proto, js_worker_class_id);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj))
+        goto fail;
+    s = js_mallocz(ctx, sizeof(*s));
+    if (!s)
+        goto fail;
+    s->recv_pipe = js_dup_message_pipe(recv_pipe);
+    s->send_pipe = js_dup_message_pipe(send_pipe);
+
+    JS_SetOpaque(obj, s);
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
+                              int argc, JSValueConst *argv)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    WorkerFuncArgs *args = NULL;
+    pthread_t tid;
+    pthread_attr_t attr;
+    JSValue obj = JS_UNDEFINED;
+    int ret;
+    const char *filename = NULL, *basename;
+    JSAtom basename_atom;
+
+    /* XXX: in order to avoid problems with resource liberation, we
+       don't support creating workers inside workers */
+    if (!is_main_thread(rt))
+        return JS_ThrowTypeError(ctx, "cannot create a worker inside a worker");
+
+    /* base name, assuming the calling function is a normal JS
+       function */
+    basename_atom = JS_GetScriptOrModuleName(ctx, 1);
+    if (basename_atom == JS_ATOM_NULL) {
+        return JS_ThrowTypeError(ctx, "could not determine calling script or module name");
+    }
+    basename = JS_AtomToCString(ctx, basename_atom);
+    JS_FreeAtom(ctx, basename_atom);
+    if (!basename)
+        goto fail;
+
+    /* module name */
+    filename = JS_ToCString(ctx, argv[0]);
+    if (!filename)
+        goto fail;
+
+    args = malloc(sizeof(*args));
+    if (!args)
+        goto oom_fail;
+    memset(args, 0, sizeof(*args));
+    args->filename = strdup(filename);
+    args->basename = strdup(basename);
 
-        val = JS_GetPropertyStr(ctx, options, "uid");
-        if (JS_IsException(val))
-            goto exception;
-        if (!JS_IsUndefined(val)) {
-            ret = JS_ToUint32(ctx, &uid, val);
-            JS_FreeValue(ctx, val);
-            if (ret)
-                goto exception;
-        }
+    /* ports */
+    args->recv_pipe = js_new_message_pipe();
+    if (!args->recv_pipe)
+        goto oom_fail;
+    args->send_pipe = js_new_message_pipe();
+    if (!args->send_pipe)
+        goto oom_fail;
 
-        val = JS_GetPropertyStr(ctx, options, "gid");
-        if (JS_IsException(val))
-            goto exception;
-        if (!JS_IsUndefined(val)) {
-            ret = JS_ToUint32(ctx, &gid, val);
-            JS_FreeValue(ctx, val);
-            if (ret)
-                goto exception;
-        }
-    }
+    obj = js_worker_ctor_internal(ctx, new_target,
+                                  args->send_pipe, args->recv_pipe);
+    if (JS_IsException(obj))
+        goto fail;
 
-    pid = fork();
-    if (pid < 0) {
-        JS_ThrowTypeError(ctx, "fork error");
-        goto exception;
+    pthread_attr_init(&attr);
+    /* no join at the end */
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    ret = pthread_create(&tid, &attr, worker_func, args);
+    pthread_attr_destroy(&attr);
+    if (ret != 0) {
+        JS_ThrowTypeError(ctx, "could not create worker");
+        goto fail;
     }
-    if (pid == 0) {
-        /* child */
-        int fd_max = sysconf(_SC_OPEN_MAX);
-
-        /* remap the stdin/stdout/stderr handles if necessary */
-        for(i = 0; i < 3; i++) {
-            if (std_fds[i] != i) {
-                if (dup2(std_fds[i], i) < 0)
-                    _exit(127);
-            }
-        }
+    JS_FreeCString(ctx, basename);
+    JS_FreeCString(ctx, filename);
+    return obj;
+ oom_fail:
+    JS_ThrowOutOfMemory(ctx);
+ fail:
+    JS_FreeCString(ctx, basename);
+    JS_FreeCString(ctx, filename);
+    if (args) {
+        free(args->filename);
+        free(args->basename);
+        js_free_message_pipe(args->recv_pipe);
+        js_free_message_pipe(args->send_pipe);
+        free(args);
+    }
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
 
-        for(i = 3; i < fd_max; i++)
-            close(i);
-        if (cwd) {
-            if (chdir(cwd) < 0)
-                _exit(127);
-        }
-        if (uid != -1) {
-            if (setuid(uid) < 0)
-                _exit(127);
-        }
-        if (gid != -1) {
-            if (setgid(gid) < 0)
-                _exit(127);
-        }
+/* get the ArrayBuffers of the transfer list 'val'. Return -1 if
+   exception. */
+static int js_worker_get_transfer_list(JSContext *ctx, JSValue **ptab,
+                                       int *plen, JSValueConst val)
+{
+    JSValue *tab, len_val;
+    uint32_t len;
+    int i, ret;
 
-        if (!file)
-            file = exec_argv[0];
-        if (use_path)
-            ret = my_execvpe(file, (char **)exec_argv, envp);
-        else
-            ret = execve(file, (char **)exec_argv, envp);
-        _exit(127);
+    *ptab = NULL;
+    *plen = 0;
+    if (JS_IsUndefined(val))
+        return 0;
+    if (!JS_IsArray(ctx, val)) {
+        JS_ThrowTypeError(ctx, "the transfer list must be an array");
+        return -1;
     }
-    /* parent */
-    if (block_flag) {
-        for(;;) {
-            ret = waitpid(pid, &status, 0);
-            if (ret == pid) {
-                if (WIFEXITED(status)) {
-                    ret = WEXITSTATUS(status);
-                    break;
-                } else if (WIFSIGNALED(status)) {
-                    ret = -WTERMSIG(status);
-                    break;
-                }
-            }
-        }
-    } else {
-        ret = pid;
+    len_val = JS_GetPropertyStr(ctx, val, "length");
+    if (JS_IsException(len_val))
+        return -1;
+    ret = JS_ToUint32(ctx, &len, len_val);
+    JS_FreeValue(ctx, len_val);
+    if (ret)
+        return -1;
+    if (len > INT32_MAX) {
+        JS_ThrowRangeError(ctx, "invalid transfer list length");
+        return -1;
     }
-    ret_val = JS_NewInt32(ctx, ret);
- done:
-    JS_FreeCString(ctx, file);
-    JS_FreeCString(ctx, cwd);
-    for(i = 0; i < exec_argc; i++)
-        JS_FreeCString(ctx, exec_argv[i]);
-    js_free(ctx, exec_argv);
-    if (envp != environ) {
-        char **p;
-        p = envp;
-        while (*p != NULL) {
-            js_free(ctx, *p);
-            p++;
+    if (len == 0)
+        return 0;
+    tab = js_mallocz(ctx, sizeof(tab[0]) * len);
+    if (!tab)
+        return -1;
+    for(i = 0; i < len; i++) {
+        tab[i] = JS_GetPropertyUint32(ctx, val, i);
+        if (JS_IsException(tab[i])) {
+            while (--i >= 0)
+                JS_FreeValue(ctx, tab[i]);
+            js_free(ctx, tab);
+            return -1;
         }
-        js_free(ctx, envp);
     }
-    return ret_val;
- exception:
-    ret_val = JS_EXCEPTION;
-    goto done;
+    *ptab = tab;
+    *plen = len;
+    return 0;
 }
 
-/* waitpid(pid, block) -> [pid, status] */
-static JSValue js_os_waitpid(JSContext *ctx, JSValueConst this_val,
-                             int argc, JSValueConst *argv)
+/* serialize 'val' in a message which can be read by another
+   runtime. Return NULL if exception. */
+static JSWorkerMessage *js_new_message(JSContext *ctx, JSValueConst val,
+                                       JSValueConst transfer_val)
 {
-    int pid, status, options, ret;
-    JSValue obj;
+    size_t data_len, sab_tab_len, i;
+    uint8_t *data;
+    JSWorkerMessage *msg;
+    uint8_t **sab_tab;
+    JSValue *transfer_list;
+    int transfer_len;
 
-    if (JS_ToInt32(ctx, &pid, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &options, argv[1]))
-        return JS_EXCEPTION;
+    if (js_worker_get_transfer_list(ctx, &transfer_list, &transfer_len,
+                                    transfer_val))
+        return NULL;
 
-    ret = waitpid(pid, &status, options);
-    if (ret < 0) {
-        ret = -errno;
-        status = 0;
-    }
+    data = NULL;
+    sab_tab = NULL;
+    msg = malloc(sizeof(*msg));
+    if (!msg)
+        goto fail;
+    msg->data = NULL;
+    msg->sab_tab = NULL;
+    msg->transfer_tab_len = 0;
+    /* allocated with malloc() because the message may be freed by
+       another runtime */
+    msg->transfer_tab = malloc(sizeof(msg->transfer_tab[0]) *
+                               max_int(transfer_len, 1));
+    if (!msg->transfer_tab)
+        goto fail;
 
-    obj = JS_NewArray(ctx);
-    if (JS_IsException(obj))
-        return obj;
-    JS_DefinePropertyValueUint32(ctx, obj, 0, JS_NewInt32(ctx, ret),
-                                 JS_PROP_C_W_E);
-    JS_DefinePropertyValueUint32(ctx, obj, 1, JS_NewInt32(ctx, status),
-                                 JS_PROP_C_W_E);
-    return obj;
+    data = JS_WriteObject3(ctx, &data_len, val,
+                           JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE,
+                           &sab_tab, &sab_tab_len,
+                           (JSValueConst *)transfer_list, msg->transfer_tab,
+                           transfer_len);
+    if (!data)
+        goto fail;
+    msg->transfer_tab_len = transfer_len;
+
+    /* must reallocate because the allocator may be different */
+    msg->data = malloc(data_len);
+    if (!msg->data)
+        goto fail;
+    memcpy(msg->data, data, data_len);
+    msg->data_len = data_len;
+
+    msg->sab_tab = malloc(sizeof(msg->sab_tab[0]) * sab_tab_len);
+    if (!msg->sab_tab)
+        goto fail;
+    memcpy(msg->sab_tab, sab_tab, sizeof(msg->sab_tab[0]) * sab_tab_len);
+    msg->sab_tab_len = sab_tab_len;
+
+    js_free(ctx, data);
+    js_free(ctx, sab_tab);
+    for(i = 0; i < transfer_len; i++)
+        JS_FreeValue(ctx, transfer_list[i]);
+    js_free(ctx, transfer_list);
+
+    /* increment the SAB reference counts */
+    for(i = 0; i < msg->sab_tab_len; i++) {
+        js_sab_dup(NULL, msg->sab_tab[i]);
+    }
+    return msg;
+ fail:
+    if (msg) {
+        free(msg->data);
+        free(msg->sab_tab);
+        msg->sab_tab_len = 0;
+        msg->sab_tab = NULL;
+        msg->data = NULL;
+        /* free the transferred data */
+        js_free_message(msg);
+    }
+    js_free(ctx, data);
+    js_free(ctx, sab_tab);
+    for(i = 0; i < transfer_len; i++)
+        JS_FreeValue(ctx, transfer_list[i]);
+    js_free(ctx, transfer_list);
+    return NULL;
 }
 
-/* pipe() -> [read_fd, write_fd] or null if error */
-static JSValue js_os_pipe(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv)
+/* can be called from any thread */
+static void js_post_message(JSWorkerMessagePipe *ps, JSWorkerMessage *msg)
 {
-    int pipe_fds[2], ret;
-    JSValue obj;
-
-    ret = pipe(pipe_fds);
-    if (ret < 0)
-        return JS_NULL;
-    obj = JS_NewArray(ctx);
-    if (JS_IsException(obj))
-        return obj;
-    JS_DefinePropertyValueUint32(ctx, obj, 0, JS_NewInt32(ctx, pipe_fds[0]),
-                                 JS_PROP_C_W_E);
-    JS_DefinePropertyValueUint32(ctx, obj, 1, JS_NewInt32(ctx, pipe_fds[1]),
-                                 JS_PROP_C_W_E);
-    return obj;
+    /* once a message is in the overflow list, the next ones must
+       follow it to keep the order */
+    if (atomic_load(&ps->overflow_count) != 0 ||
+        !js_message_queue_push(ps, msg)) {
+        pthread_mutex_lock(&ps->mutex);
+        list_add_tail(&msg->link, &ps->msg_queue);
+        atomic_fetch_add(&ps->overflow_count, 1);
+        pthread_mutex_unlock(&ps->mutex);
+    }
+    /* indicate that data is present */
+    js_message_pipe_signal(ps);
 }
 
-/* kill(pid, sig) */
-static JSValue js_os_kill(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv)
+static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
+                                     int argc, JSValueConst *argv)
 {
-    int pid, sig, ret;
+    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
+    JSWorkerMessage *msg;
 
-    if (JS_ToInt32(ctx, &pid, argv[0]))
+    if (!worker)
         return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &sig, argv[1]))
+    msg = js_new_message(ctx, argv[0], argc > 1 ? argv[1] : JS_UNDEFINED);
+    if (!msg)
         return JS_EXCEPTION;
-    ret = js_get_errno(kill(pid, sig));
-    return JS_NewInt32(ctx, ret);
+    js_post_message(worker->send_pipe, msg);
+    return JS_UNDEFINED;
 }
 
-/* dup(fd) */
-static JSValue js_os_dup(JSContext *ctx, JSValueConst this_val,
-                         int argc, JSValueConst *argv)
+static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
+                                   JSValueConst func)
 {
-    int fd, ret;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
+    JSWorkerMessageHandler *port;
 
-    if (JS_ToInt32(ctx, &fd, argv[0]))
+    if (!worker)
         return JS_EXCEPTION;
-    ret = js_get_errno(dup(fd));
-    return JS_NewInt32(ctx, ret);
+
+    port = worker->msg_handler;
+    if (JS_IsNull(func)) {
+        if (port) {
+            js_free_port(rt, port);
+            worker->msg_handler = NULL;
+        }
+    } else {
+        if (!JS_IsFunction(ctx, func))
+            return JS_ThrowTypeError(ctx, "not a function");
+        if (!port) {
+            port = js_mallocz(ctx, sizeof(*port));
+            if (!port)
+                return JS_EXCEPTION;
+            port->recv_pipe = js_dup_message_pipe(worker->recv_pipe);
+            port->on_message_func = JS_NULL;
+            list_add_tail(&port->link, &ts->port_list);
+#ifdef USE_EPOLL
+            os_epoll_ctl(ts, port->recv_pipe->read_fd, 0, EPOLLIN);
+#endif
+            worker->msg_handler = port;
+        }
+        JS_FreeValue(ctx, port->on_message_func);
+        port->on_message_func = JS_DupValue(ctx, func);
+    }
+    return JS_UNDEFINED;
 }
 
-/* dup2(fd) */
-static JSValue js_os_dup2(JSContext *ctx, JSValueConst this_val,
-                         int argc, JSValueConst *argv)
+static JSValue js_worker_get_onmessage(JSContext *ctx, JSValueConst this_val)
 {
-    int fd, fd2, ret;
-
-    if (JS_ToInt32(ctx, &fd, argv[0]))
-        return JS_EXCEPTION;
-    if (JS_ToInt32(ctx, &fd2, argv[1]))
+    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
+    JSWorkerMessageHandler *port;
+    if (!worker)
         return JS_EXCEPTION;
-    ret = js_get_errno(dup2(fd, fd2));
-    return JS_NewInt32(ctx, ret);
+    port = worker->msg_handler;
+    if (port) {
+        return JS_DupValue(ctx, port->on_message_func);
+    } else {
+        return JS_NULL;
+    }
 }
 
-#endif /* !_WIN32 */
+static const JSCFunctionListEntry js_worker_proto_funcs[] = {
+    JS_CFUNC_DEF("postMessage", 2, js_worker_postMessage ),
+    JS_CGETSET_DEF("onmessage", js_worker_get_onmessage, js_worker_set_onmessage ),
+};
 
-#ifdef USE_WORKER
+/* Worker pool */
 
-/* Worker */
+typedef struct {
+    struct list_head link;
+    JSWorkerMessage *msg; /* [func_name, id, ...args] */
+} JSWorkerPoolTask;
 
 typedef struct {
-    JSWorkerMessagePipe *recv_pipe;
-    JSWorkerMessagePipe *send_pipe;
-    JSWorkerMessageHandler *msg_handler;
-} JSWorkerData;
+    pthread_mutex_t mutex;
+    struct list_head task_list; /* list of JSWorkerPoolTask.link */
+} JSWorkerPoolQueue;
 
+/* shared by the owner thread and the pool threads */
 typedef struct {
+    int ref_count;
     char *filename; /* module filename */
     char *basename; /* module base name */
-    JSWorkerMessagePipe *recv_pipe, *send_pipe;
-} WorkerFuncArgs;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond; /* signaled when a task is queued or on stop */
+    BOOL stopped;
+    atomic_int task_count; /* number of queued tasks */
+    JSWorkerMessagePipe *result_pipe;
+    int thread_count;
+    /* a thread takes its tasks from the head of its queue and steals
+       from the tail of the other queues when it is empty */
+    JSWorkerPoolQueue queues[0];
+} JSWorkerPool;
 
 typedef struct {
-    int ref_count;
-    uint64_t buf[0];
-} JSSABHeader;
-
-static JSClassID js_worker_class_id;
-static JSContext *(*js_worker_new_context_func)(JSRuntime *rt);
+    JSWorkerPool *pool;
+    int index;
+} JSWorkerPoolThreadArgs;
 
-static int atomic_add_int(int *ptr, int v)
-{
-    return atomic_fetch_add((_Atomic(uint32_t) *)ptr, v) + v;
-}
+typedef struct {
+    struct list_head link;
+    int64_t id;
+    JSValue resolving_funcs[2];
+} JSWorkerPoolPromise;
 
-/* shared array buffer allocator */
-static void *js_sab_alloc(void *opaque, size_t size)
-{
-    JSSABHeader *sab;
-    sab = malloc(sizeof(JSSABHeader) + size);
-    if (!sab)
-        return NULL;
-    sab->ref_count = 1;
-    return sab->buf;
-}
+/* owner thread side */
+typedef struct {
+    JSWorkerPool *pool;
+    /* only present when tasks are pending so that the event loop waits
+       for them */
+    JSWorkerMessageHandler *port;
+    struct list_head promise_list; /* list of JSWorkerPoolPromise.link */
+    int64_t next_id;
+    int next_queue;
+} JSWorkerPoolData;
 
-static void js_sab_free(void *opaque, void *ptr)
-{
-    JSSABHeader *sab;
-    int ref_count;
-    sab = (JSSABHeader *)((uint8_t *)ptr - sizeof(JSSABHeader));
-    ref_count = atomic_add_int(&sab->ref_count, -1);
-    assert(ref_count >= 0);
-    if (ref_count == 0) {
-        free(sab);
-    }
-}
+static JSClassID js_worker_pool_class_id;
 
-static void js_sab_dup(void *opaque, void *ptr)
+static void js_worker_pool_free_task(JSWorkerPoolTask *task)
 {
-    JSSABHeader *sab;
-    sab = (JSSABHeader *)((uint8_t *)ptr - sizeof(JSSABHeader));
-    atomic_add_int(&sab->ref_count, 1);
+    js_free_message(task->msg);
+    free(task);
 }
 
-static JSWorkerMessagePipe *js_new_message_pipe(void)
+static void js_worker_pool_unref(JSWorkerPool *pool)
 {
-    JSWorkerMessagePipe *ps;
-    int pipe_fds[2];
-
-    if (pipe(pipe_fds) < 0)
-        return NULL;
+    JSWorkerPoolTask *task;
+    struct list_head *el, *el1;
+    int i;
 
-    ps = malloc(sizeof(*ps));
-    if (!ps) {
-        close(pipe_fds[0]);
-        close(pipe_fds[1]);
-        return NULL;
+    if (atomic_add_int(&pool->ref_count, -1) != 0)
+        return;
+    for(i = 0; i < pool->thread_count; i++) {
+        JSWorkerPoolQueue *q = &pool->queues[i];
+        list_for_each_safe(el, el1, &q->task_list) {
+            task = list_entry(el, JSWorkerPoolTask, link);
+            js_worker_pool_free_task(task);
+        }
+        pthread_mutex_destroy(&q->mutex);
     }
-    ps->ref_count = 1;
-    init_list_head(&ps->msg_queue);
-    pthread_mutex_init(&ps->mutex, NULL);
-    ps->read_fd = pipe_fds[0];
-    ps->write_fd = pipe_fds[1];
-    return ps;
+    js_free_message_pipe(pool->result_pipe);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->cond);
+    free(pool->filename);
+    free(pool->basename);
+    free(pool);
 }
 
-static JSWorkerMessagePipe *js_dup_message_pipe(JSWorkerMessagePipe *ps)
+/* return NULL if the pool is stopped */
+static JSWorkerPoolTask *js_worker_pool_get_task(JSWorkerPool *pool, int index)
 {
-    atomic_add_int(&ps->ref_count, 1);
-    return ps;
+    JSWorkerPoolQueue *q;
+    JSWorkerPoolTask *task;
+    int i;
+
+    for(;;) {
+        task = NULL;
+        for(i = 0; i < pool->thread_count && !task; i++) {
+            q = &pool->queues[(index + i) % pool->thread_count];
+            pthread_mutex_lock(&q->mutex);
+            if (!list_empty(&q->task_list)) {
+                if (i == 0)
+                    task = list_entry(q->task_list.next, JSWorkerPoolTask, link);
+                else
+                    task = list_entry(q->task_list.prev, JSWorkerPoolTask, link);
+                list_del(&task->link);
+            }
+            pthread_mutex_unlock(&q->mutex);
+        }
+        if (task) {
+            atomic_fetch_sub(&pool->task_count, 1);
+            return task;
+        }
+        pthread_mutex_lock(&pool->mutex);
+        if (pool->stopped) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        if (atomic_load(&pool->task_count) == 0)
+            pthread_cond_wait(&pool->cond, &pool->mutex);
+        pthread_mutex_unlock(&pool->mutex);
+    }
 }
 
-static void js_free_message(JSWorkerMessage *msg)
+static JSValue js_worker_pool_settle(JSContext *ctx, JSValueConst this_val,
+                                     int argc, JSValueConst *argv,
+                                     int magic, JSValue *func_data)
 {
-    size_t i;
-    /* free the SAB */
-    for(i = 0; i < msg->sab_tab_len; i++) {
-        js_sab_free(NULL, msg->sab_tab[i]);
-    }
-    free(msg->sab_tab);
-    free(msg->data);
-    free(msg);
+    JSValueConst state = func_data[0];
+    JS_SetPropertyStr(ctx, state, "ok", JS_NewBool(ctx, magic == 0));
+    JS_SetPropertyStr(ctx, state, "value",
+                      JS_DupValue(ctx, argc > 0 ? argv[0] : JS_UNDEFINED));
+    return JS_UNDEFINED;
 }
 
-static void js_free_message_pipe(JSWorkerMessagePipe *ps)
+/* wait until the promise or thenable 'val' is settled by running the
+   event loop of the pool thread. Return JS_EXCEPTION if it is
+   rejected. 'val' is freed. */
+static JSValue js_worker_pool_await(JSContext *ctx, JSValue val)
 {
-    struct list_head *el, *el1;
-    JSWorkerMessage *msg;
-    int ref_count;
+    JSValue then, state, funcs[2], ret, ok;
+    int i;
 
-    if (!ps)
-        return;
+    if (!JS_IsObject(val))
+        return val;
+    then = JS_GetPropertyStr(ctx, val, "then");
+    if (JS_IsException(then))
+        goto fail;
+    if (!JS_IsFunction(ctx, then)) {
+        JS_FreeValue(ctx, then);
+        return val;
+    }
+    state = JS_NewObject(ctx);
+    if (JS_IsException(state)) {
+        JS_FreeValue(ctx, then);
+        goto fail;
+    }
+    for(i = 0; i < 2; i++) {
+        funcs[i] = JS_NewCFunctionData(ctx, js_worker_pool_settle, 1, i,
+                                       1, (JSValueConst *)&state);
+    }
+    ret = JS_Call(ctx, then, val, 2, (JSValueConst *)funcs);
+    JS_FreeValue(ctx, funcs[0]);
+    JS_FreeValue(ctx, funcs[1]);
+    JS_FreeValue(ctx, then);
+    JS_FreeValue(ctx, val);
+    if (JS_IsException(ret)) {
+        JS_FreeValue(ctx, state);
+        return JS_EXCEPTION;
+    }
+    JS_FreeValue(ctx, ret);
 
-    ref_count = atomic_add_int(&ps->ref_count, -1);
-    assert(ref_count >= 0);
-    if (ref_count == 0) {
-        list_for_each_safe(el, el1, &ps->msg_queue) {
-            msg = list_entry(el, JSWorkerMessage, link);
-            js_free_message(msg);
+    for(;;) {
+        js_std_execute_pending_jobs(ctx);
+        ok = JS_GetPropertyStr(ctx, state, "ok");
+        if (!JS_IsUndefined(ok))
+            break;
+        if (!os_poll_func || os_poll_func(ctx)) {
+            JS_FreeValue(ctx, state);
+            return JS_ThrowTypeError(ctx, "the task promise is never settled");
         }
-        pthread_mutex_destroy(&ps->mutex);
-        close(ps->read_fd);
-        close(ps->write_fd);
-        free(ps);
     }
+    ret = JS_GetPropertyStr(ctx, state, "value");
+    JS_FreeValue(ctx, state);
+    if (!JS_ToBool(ctx, ok))
+        return JS_Throw(ctx, ret);
+    return ret;
+ fail:
+    JS_FreeValue(ctx, val);
+    return JS_EXCEPTION;
 }
 
-static void js_free_port(JSRuntime *rt, JSWorkerMessageHandler *port)
+/* run a task and return the result message [id, ok, value] */
+static JSWorkerMessage *js_worker_pool_run_task(JSContext *ctx, JSValueConst ns,
+                                                JSWorkerPoolTask *task)
 {
-    if (port) {
-        js_free_message_pipe(port->recv_pipe);
-        JS_FreeValueRT(rt, port->on_message_func);
-        list_del(&port->link);
-        js_free_rt(rt, port);
-    }
-}
+    JSWorkerMessage *msg;
+    JSValue args, id, func, ret, res, *argv;
+    uint32_t len, i;
+    BOOL ok;
 
-static void js_worker_finalizer(JSRuntime *rt, JSValue val)
-{
-    JSWorkerData *worker = JS_GetOpaque(val, js_worker_class_id);
-    if (worker) {
-        js_free_message_pipe(worker->recv_pipe);
-        js_free_message_pipe(worker->send_pipe);
-        js_free_port(rt, worker->msg_handler);
-        js_free_rt(rt, worker);
+    argv = NULL;
+    len = 0;
+    id = JS_UNDEFINED;
+    func = JS_UNDEFINED;
+    args = JS_ReadObject2(ctx, task->msg->data, task->msg->data_len,
+                          JS_READ_OBJ_SAB | JS_READ_OBJ_REFERENCE,
+                          task->msg->transfer_tab, task->msg->transfer_tab_len);
+    if (JS_IsException(args))
+        goto exception;
+    id = JS_GetPropertyUint32(ctx, args, 1);
+    if (JS_IsException(id))
+        goto exception;
+    if (JS_IsUndefined(ns)) {
+        JS_ThrowTypeError(ctx, "could not load the pool module");
+        goto exception;
     }
+    func = JS_GetPropertyUint32(ctx, args, 0);
+    if (JS_IsException(func))
+        goto exception;
+    {
+        JSAtom atom = JS_ValueToAtom(ctx, func);
+        JS_FreeValue(ctx, func);
+        if (atom == JS_ATOM_NULL)
+            goto exception;
+        func = JS_GetProperty(ctx, ns, atom);
+        JS_FreeAtom(ctx, atom);
+    }
+    if (JS_IsException(func))
+        goto exception;
+    if (!JS_IsFunction(ctx, func)) {
+        JS_ThrowTypeError(ctx, "the pool module does not export this function");
+        goto exception;
+    }
+    res = JS_GetPropertyStr(ctx, args, "length");
+    if (JS_ToUint32(ctx, &len, res)) {
+        JS_FreeValue(ctx, res);
+        goto exception;
+    }
+    JS_FreeValue(ctx, res);
+    len = len > 2 ? len - 2 : 0;
+    argv = js_mallocz(ctx, sizeof(argv[0]) * max_int(len, 1));
+    if (!argv)
+        goto exception;
+    for(i = 0; i < len; i++)
+        argv[i] = JS_GetPropertyUint32(ctx, args, i + 2);
+    ret = JS_Call(ctx, func, JS_UNDEFINED, len, (JSValueConst *)argv);
+    ret = js_worker_pool_await(ctx, ret);
+    if (JS_IsException(ret))
+        goto exception;
+    ok = TRUE;
+    goto done;
+ exception:
+    ok = FALSE;
+    ret = JS_GetException(ctx);
+    if (JS_IsError(ctx, ret)) {
+        /* Error objects cannot be serialized */
+        JSValue err = JS_NewObject(ctx);
+        JS_SetPropertyStr(ctx, err, "name", JS_GetPropertyStr(ctx, ret, "name"));
+        JS_SetPropertyStr(ctx, err, "message", JS_GetPropertyStr(ctx, ret, "message"));
+        JS_SetPropertyStr(ctx, err, "stack", JS_GetPropertyStr(ctx, ret, "stack"));
+        JS_FreeValue(ctx, ret);
+        ret = err;
+    }
+ done:
+    for(i = 0; i < len; i++)
+        JS_FreeValue(ctx, argv[i]);
+    js_free(ctx, argv);
+    JS_FreeValue(ctx, func);
+    JS_FreeValue(ctx, args);
+
+    res = JS_NewArray(ctx);
+    JS_SetPropertyUint32(ctx, res, 0, id);
+    JS_SetPropertyUint32(ctx, res, 1, JS_NewBool(ctx, ok));
+    JS_SetPropertyUint32(ctx, res, 2, ret);
+    msg = js_new_message(ctx, res, JS_UNDEFINED);
+    if (!msg) {
+        /* the result cannot be serialized */
+        js_std_dump_error(ctx);
+        JS_SetPropertyUint32(ctx, res, 1, JS_FALSE);
+        JS_SetPropertyUint32(ctx, res, 2,
+                             JS_NewString(ctx, "could not serialize the task result"));
+        msg = js_new_message(ctx, res, JS_UNDEFINED);
+    }
+    JS_FreeValue(ctx, res);
+    return msg;
 }
 
-static JSClassDef js_worker_class = {
-    "Worker",
-    .finalizer = js_worker_finalizer,
-};
-
-static void *worker_func(void *opaque)
+static void *worker_pool_func(void *opaque)
 {
-    WorkerFuncArgs *args = opaque;
+    JSWorkerPoolThreadArgs *args = opaque;
+    JSWorkerPool *pool = args->pool;
+    int index = args->index;
+    JSWorkerPoolTask *task;
+    JSWorkerMessage *msg;
     JSRuntime *rt;
     JSThreadState *ts;
     JSContext *ctx;
+    JSModuleDef *m;
+    JSValue ns;
 
+    free(args);
     rt = JS_NewRuntime();
     if (rt == NULL) {
         fprintf(stderr, "JS_NewRuntime failure");
@@ -3284,84 +5887,136 @@ static void *worker_func(void *opaque)
 
     JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
 
-    /* set the pipe to communicate with the parent */
+    /* no parent port: the results are sent with pool->result_pipe */
     ts = JS_GetRuntimeOpaque(rt);
-    ts->recv_pipe = args->recv_pipe;
-    ts->send_pipe = args->send_pipe;
+    ts->is_worker = TRUE;
 
-    /* function pointer to avoid linking the whole JS_NewContext() if
-       not needed */
     ctx = js_worker_new_context_func(rt);
     if (ctx == NULL) {
         fprintf(stderr, "JS_NewContext failure");
+        exit(1);
     }
 
     JS_SetCanBlock(rt, TRUE);
 
     js_std_add_helpers(ctx, -1, NULL);
 
-    if (!JS_RunModule(ctx, args->basename, args->filename))
+    ns = JS_UNDEFINED;
+    m = JS_RunModule(ctx, pool->basename, pool->filename);
+    if (m) {
+        /* the event loop is not run here because it would never
+           return if the module arms a timer or a handler. The timers
+           and handlers run while a task waits for a promise. */
+        js_std_execute_pending_jobs(ctx);
+        ns = JS_GetModuleNamespace(ctx, m);
+    }
+    if (JS_IsException(ns) || !m) {
         js_std_dump_error(ctx);
-    free(args->filename);
-    free(args->basename);
-    free(args);
+        ns = JS_UNDEFINED;
+    }
 
-    js_std_loop(ctx);
+    while ((task = js_worker_pool_get_task(pool, index)) != NULL) {
+        msg = js_worker_pool_run_task(ctx, ns, task);
+        js_worker_pool_free_task(task);
+        if (msg)
+            js_post_message(pool->result_pipe, msg);
+    }
 
+    JS_FreeValue(ctx, ns);
     JS_FreeContext(ctx);
     js_std_free_handlers(rt);
     JS_FreeRuntime(rt);
+    js_worker_pool_unref(pool);
     return NULL;
 }
 
-static JSValue js_worker_ctor_internal(JSContext *ctx, JSValueConst new_target,
-                                       JSWorkerMessagePipe *recv_pipe,
-                                       JSWorkerMessagePipe *send_pipe)
+/* stop the pool threads. If 'ctx' is not NULL, the pending promises
+   are rejected. */
+static void js_worker_pool_stop(JSRuntime *rt, JSContext *ctx,
+                                JSWorkerPoolData *s)
 {
-    JSValue obj = JS_UNDEFINED, proto;
-    JSWorkerData *s;
+    JSWorkerPool *pool = s->pool;
+    struct list_head *el, *el1;
+    JSValue err;
 
-    /* create the object */
-    if (JS_IsUndefined(new_target)) {
-        proto = JS_GetClassProto(ctx, js_worker_class_id);
-    } else {
-        proto = JS_GetPropertyStr(ctx, new_target, "prototype");
-        if (JS_IsException(proto))
-            goto fail;
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->mutex);
+    pool->stopped = TRUE;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+    js_worker_pool_unref(pool);
+    s->pool = NULL;
+
+    if (s->port) {
+        js_free_port(rt, s->port);
+        s->port = NULL;
+    }
+    list_for_each_safe(el, el1, &s->promise_list) {
+        JSWorkerPoolPromise *p = list_entry(el, JSWorkerPoolPromise, link);
+        list_del(&p->link);
+        if (ctx) {
+            err = JS_NewError(ctx);
+            JS_DefinePropertyValueStr(ctx, err, "message",
+                                      JS_NewString(ctx, "the worker pool was terminated"),
+                                      JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+            os_promise_settle(ctx, p->resolving_funcs, JS_Throw(ctx, err));
+        }
+        JS_FreeValueRT(rt, p->resolving_funcs[0]);
+        JS_FreeValueRT(rt, p->resolving_funcs[1]);
+        js_free_rt(rt, p);
+    }
+}
+
+static void js_worker_pool_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSWorkerPoolData *s = JS_GetOpaque(val, js_worker_pool_class_id);
+    if (s) {
+        js_worker_pool_stop(rt, NULL, s);
+        js_free_rt(rt, s);
     }
-    obj = JS_NewObjectProtoClass(ctx, proto, js_worker_class_id);
-    JS_FreeValue(ctx, proto);
-    if (JS_IsException(obj))
-        goto fail;
-    s = js_mallocz(ctx, sizeof(*s));
-    if (!s)
-        goto fail;
-    s->recv_pipe = js_dup_message_pipe(recv_pipe);
-    s->send_pipe = js_dup_message_pipe(send_pipe);
+}
 
-    JS_SetOpaque(obj, s);
-    return obj;
- fail:
-    JS_FreeValue(ctx, obj);
-    return JS_EXCEPTION;
+static void js_worker_pool_mark(JSRuntime *rt, JSValueConst val,
+                                JS_MarkFunc *mark_func)
+{
+    JSWorkerPoolData *s = JS_GetOpaque(val, js_worker_pool_class_id);
+    struct list_head *el;
+    if (s) {
+        list_for_each(el, &s->promise_list) {
+            JSWorkerPoolPromise *p = list_entry(el, JSWorkerPoolPromise, link);
+            JS_MarkValue(rt, p->resolving_funcs[0], mark_func);
+            JS_MarkValue(rt, p->resolving_funcs[1], mark_func);
+        }
+    }
 }
 
-static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
-                              int argc, JSValueConst *argv)
+static JSClassDef js_worker_pool_class = {
+    "WorkerPool",
+    .finalizer = js_worker_pool_finalizer,
+    .gc_mark = js_worker_pool_mark,
+};
+
+static JSValue js_worker_pool_ctor(JSContext *ctx, JSValueConst new_target,
+                                   int argc, JSValueConst *argv)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
-    WorkerFuncArgs *args = NULL;
+    JSWorkerPool *pool = NULL;
+    JSWorkerPoolData *s;
+    JSWorkerPoolThreadArgs *args;
+    JSValue obj = JS_UNDEFINED, proto;
     pthread_t tid;
     pthread_attr_t attr;
-    JSValue obj = JS_UNDEFINED;
-    int ret;
-    const char *filename = NULL, *basename;
+    const char *filename = NULL, *basename = NULL;
     JSAtom basename_atom;
+    int n, i, ret;
 
-    /* XXX: in order to avoid problems with resource liberation, we
-       don't support creating workers inside workers */
     if (!is_main_thread(rt))
-        return JS_ThrowTypeError(ctx, "cannot create a worker inside a worker");
+        return JS_ThrowTypeError(ctx, "cannot create a worker pool inside a worker");
+    if (JS_ToInt32(ctx, &n, argv[0]))
+        return JS_EXCEPTION;
+    if (n < 1 || n > 1024)
+        return JS_ThrowRangeError(ctx, "invalid number of threads");
 
     /* base name, assuming the calling function is a normal JS
        function */
@@ -3375,39 +6030,70 @@ static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
         goto fail;
 
     /* module name */
-    filename = JS_ToCString(ctx, argv[0]);
+    filename = JS_ToCString(ctx, argv[1]);
     if (!filename)
         goto fail;
 
-    args = malloc(sizeof(*args));
-    if (!args)
-        goto oom_fail;
-    memset(args, 0, sizeof(*args));
-    args->filename = strdup(filename);
-    args->basename = strdup(basename);
+    if (JS_IsUndefined(new_target)) {
+        proto = JS_GetClassProto(ctx, js_worker_pool_class_id);
+    } else {
+        proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+        if (JS_IsException(proto))
+            goto fail;
+    }
+    obj = JS_NewObjectProtoClass(ctx, proto, js_worker_pool_class_id);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj))
+        goto fail;
+    s = js_mallocz(ctx, sizeof(*s));
+    if (!s)
+        goto fail;
+    init_list_head(&s->promise_list);
+    JS_SetOpaque(obj, s);
 
-    /* ports */
-    args->recv_pipe = js_new_message_pipe();
-    if (!args->recv_pipe)
+    pool = malloc(sizeof(*pool) + sizeof(pool->queues[0]) * n);
+    if (!pool)
         goto oom_fail;
-    args->send_pipe = js_new_message_pipe();
-    if (!args->send_pipe)
+    memset(pool, 0, sizeof(*pool));
+    /* one reference for the owner */
+    pool->ref_count = 1;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    atomic_init(&pool->task_count, 0);
+    pool->thread_count = n;
+    for(i = 0; i < n; i++) {
+        pthread_mutex_init(&pool->queues[i].mutex, NULL);
+        init_list_head(&pool->queues[i].task_list);
+    }
+    s->pool = pool;
+    pool->filename = strdup(filename);
+    pool->basename = strdup(basename);
+    pool->result_pipe = js_new_message_pipe();
+    if (!pool->filename || !pool->basename || !pool->result_pipe)
         goto oom_fail;
 
-    obj = js_worker_ctor_internal(ctx, new_target,
-                                  args->send_pipe, args->recv_pipe);
-    if (JS_IsException(obj))
-        goto fail;
-
     pthread_attr_init(&attr);
     /* no join at the end */
     pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
-    ret = pthread_create(&tid, &attr, worker_func, args);
-    pthread_attr_destroy(&attr);
-    if (ret != 0) {
-        JS_ThrowTypeError(ctx, "could not create worker");
-        goto fail;
+    for(i = 0; i < n; i++) {
+        args = malloc(sizeof(*args));
+        if (!args) {
+            pthread_attr_destroy(&attr);
+            goto oom_fail;
+        }
+        args->pool = pool;
+        args->index = i;
+        atomic_add_int(&pool->ref_count, 1);
+        ret = pthread_create(&tid, &attr, worker_pool_func, args);
+        if (ret != 0) {
+            atomic_add_int(&pool->ref_count, -1);
+            free(args);
+            pthread_attr_destroy(&attr);
+            JS_ThrowTypeError(ctx, "could not create worker pool thread");
+            goto fail;
+        }
     }
+    pthread_attr_destroy(&attr);
     JS_FreeCString(ctx, basename);
     JS_FreeCString(ctx, filename);
     return obj;
@@ -3416,144 +6102,199 @@ static JSValue js_worker_ctor(JSContext *ctx, JSValueConst new_target,
  fail:
     JS_FreeCString(ctx, basename);
     JS_FreeCString(ctx, filename);
-    if (args) {
-        free(args->filename);
-        free(args->basename);
-        js_free_message_pipe(args->recv_pipe);
-        js_free_message_pipe(args->send_pipe);
-        free(args);
-    }
+    /* the started threads are stopped by the finalizer */
     JS_FreeValue(ctx, obj);
     return JS_EXCEPTION;
 }
 
-static JSValue js_worker_postMessage(JSContext *ctx, JSValueConst this_val,
-                                     int argc, JSValueConst *argv)
+static JSValue js_worker_pool_on_result(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv,
+                                        int magic, JSValue *func_data)
 {
-    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
-    JSWorkerMessagePipe *ps;
-    size_t data_len, sab_tab_len, i;
-    uint8_t *data;
-    JSWorkerMessage *msg;
-    uint8_t **sab_tab;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSWorkerPoolData *s = JS_GetOpaque(func_data[0], js_worker_pool_class_id);
+    JSWorkerPoolPromise *p;
+    struct list_head *el;
+    JSValue data, val, ok;
+    int64_t id;
 
-    if (!worker)
+    if (!s)
+        return JS_UNDEFINED;
+    data = JS_GetPropertyStr(ctx, argv[0], "data");
+    if (JS_IsException(data))
+        return JS_EXCEPTION;
+    val = JS_GetPropertyUint32(ctx, data, 0);
+    if (JS_ToInt64(ctx, &id, val)) {
+        JS_FreeValue(ctx, data);
         return JS_EXCEPTION;
+    }
+    p = NULL;
+    list_for_each(el, &s->promise_list) {
+        p = list_entry(el, JSWorkerPoolPromise, link);
+        if (p->id == id)
+            break;
+        p = NULL;
+    }
+    if (p) {
+        ok = JS_GetPropertyUint32(ctx, data, 1);
+        val = JS_GetPropertyUint32(ctx, data, 2);
+        if (!JS_ToBool(ctx, ok)) {
+            JSValue msg = JS_UNDEFINED;
+            if (JS_IsObject(val))
+                msg = JS_GetPropertyStr(ctx, val, "message");
+            if (JS_IsString(msg)) {
+                /* rebuild the Error object */
+                JSValue err = JS_NewError(ctx);
+                JS_DefinePropertyValueStr(ctx, err, "message", msg,
+                                          JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+                JS_DefinePropertyValueStr(ctx, err, "name",
+                                          JS_GetPropertyStr(ctx, val, "name"),
+                                          JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+                JS_DefinePropertyValueStr(ctx, err, "stack",
+                                          JS_GetPropertyStr(ctx, val, "stack"),
+                                          JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+                JS_FreeValue(ctx, val);
+                val = err;
+            } else {
+                JS_FreeValue(ctx, msg);
+            }
+            val = JS_Throw(ctx, val);
+        }
+        JS_FreeValue(ctx, ok);
+        list_del(&p->link);
+        os_promise_settle(ctx, p->resolving_funcs, val);
+        JS_FreeValue(ctx, p->resolving_funcs[0]);
+        JS_FreeValue(ctx, p->resolving_funcs[1]);
+        js_free(ctx, p);
+        /* let the event loop terminate when no task is pending */
+        if (list_empty(&s->promise_list) && s->port) {
+            js_free_port(rt, s->port);
+            s->port = NULL;
+        }
+    }
+    JS_FreeValue(ctx, data);
+    return JS_UNDEFINED;
+}
 
-    data = JS_WriteObject2(ctx, &data_len, argv[0],
-                           JS_WRITE_OBJ_SAB | JS_WRITE_OBJ_REFERENCE,
-                           &sab_tab, &sab_tab_len);
-    if (!data)
+/* run(func_name, ...args): run the function 'func_name' exported by
+   the pool module in one of the pool threads and return a promise of
+   its result */
+static JSValue js_worker_pool_run(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSWorkerPoolData *s = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    JSWorkerPool *pool;
+    JSWorkerPoolQueue *q;
+    JSWorkerPoolTask *task;
+    JSWorkerPoolPromise *p;
+    JSWorkerMessageHandler *port;
+    JSWorkerMessage *msg;
+    JSValue args, promise, func;
+    int i;
+
+    if (!s)
         return JS_EXCEPTION;
+    pool = s->pool;
+    if (!pool)
+        return JS_ThrowTypeError(ctx, "the worker pool was terminated");
 
-    msg = malloc(sizeof(*msg));
+    /* [func_name, id, ...args] */
+    args = JS_NewArray(ctx);
+    if (JS_IsException(args))
+        return JS_EXCEPTION;
+    JS_SetPropertyUint32(ctx, args, 0, JS_DupValue(ctx, argv[0]));
+    JS_SetPropertyUint32(ctx, args, 1, JS_NewInt64(ctx, s->next_id));
+    for(i = 1; i < argc; i++)
+        JS_SetPropertyUint32(ctx, args, i + 1, JS_DupValue(ctx, argv[i]));
+    msg = js_new_message(ctx, args, JS_UNDEFINED);
+    JS_FreeValue(ctx, args);
     if (!msg)
-        goto fail;
-    msg->data = NULL;
-    msg->sab_tab = NULL;
+        return JS_EXCEPTION;
 
-    /* must reallocate because the allocator may be different */
-    msg->data = malloc(data_len);
-    if (!msg->data)
-        goto fail;
-    memcpy(msg->data, data, data_len);
-    msg->data_len = data_len;
+    task = malloc(sizeof(*task));
+    if (!task) {
+        js_free_message(msg);
+        return JS_ThrowOutOfMemory(ctx);
+    }
+    task->msg = msg;
 
-    msg->sab_tab = malloc(sizeof(msg->sab_tab[0]) * sab_tab_len);
-    if (!msg->sab_tab)
+    p = js_mallocz(ctx, sizeof(*p));
+    if (!p)
+        goto fail;
+    promise = JS_NewPromiseCapability(ctx, p->resolving_funcs);
+    if (JS_IsException(promise)) {
+        js_free(ctx, p);
         goto fail;
-    memcpy(msg->sab_tab, sab_tab, sizeof(msg->sab_tab[0]) * sab_tab_len);
-    msg->sab_tab_len = sab_tab_len;
-
-    js_free(ctx, data);
-    js_free(ctx, sab_tab);
-
-    /* increment the SAB reference counts */
-    for(i = 0; i < msg->sab_tab_len; i++) {
-        js_sab_dup(NULL, msg->sab_tab[i]);
     }
 
-    ps = worker->send_pipe;
-    pthread_mutex_lock(&ps->mutex);
-    /* indicate that data is present */
-    if (list_empty(&ps->msg_queue)) {
-        uint8_t ch = '\0';
-        int ret;
-        for(;;) {
-            ret = write(ps->write_fd, &ch, 1);
-            if (ret == 1)
-                break;
-            if (ret < 0 && (errno != EAGAIN || errno != EINTR))
-                break;
+    port = s->port;
+    if (!port) {
+        port = js_mallocz(ctx, sizeof(*port));
+        if (!port)
+            goto fail1;
+        func = JS_NewCFunctionData(ctx, js_worker_pool_on_result, 1, 0,
+                                   1, &this_val);
+        if (JS_IsException(func)) {
+            js_free(ctx, port);
+            goto fail1;
         }
+        port->recv_pipe = js_dup_message_pipe(pool->result_pipe);
+        port->on_message_func = func;
+        list_add_tail(&port->link, &ts->port_list);
+#ifdef USE_EPOLL
+        os_epoll_ctl(ts, port->recv_pipe->read_fd, 0, EPOLLIN);
+#endif
+        s->port = port;
     }
-    list_add_tail(&msg->link, &ps->msg_queue);
-    pthread_mutex_unlock(&ps->mutex);
-    return JS_UNDEFINED;
+    p->id = s->next_id++;
+    list_add_tail(&p->link, &s->promise_list);
+
+    /* the tasks are distributed in round robin order. An idle thread
+       steals the tasks of the other threads. */
+    q = &pool->queues[s->next_queue];
+    s->next_queue = (s->next_queue + 1) % pool->thread_count;
+    pthread_mutex_lock(&q->mutex);
+    list_add_tail(&task->link, &q->task_list);
+    pthread_mutex_unlock(&q->mutex);
+    atomic_fetch_add(&pool->task_count, 1);
+    pthread_mutex_lock(&pool->mutex);
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+    return promise;
+ fail1:
+    JS_FreeValue(ctx, p->resolving_funcs[0]);
+    JS_FreeValue(ctx, p->resolving_funcs[1]);
+    JS_FreeValue(ctx, promise);
+    js_free(ctx, p);
  fail:
-    if (msg) {
-        free(msg->data);
-        free(msg->sab_tab);
-        free(msg);
-    }
-    js_free(ctx, data);
-    js_free(ctx, sab_tab);
+    js_worker_pool_free_task(task);
     return JS_EXCEPTION;
-
 }
 
-static JSValue js_worker_set_onmessage(JSContext *ctx, JSValueConst this_val,
-                                   JSValueConst func)
+static JSValue js_worker_pool_terminate(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv)
 {
-    JSRuntime *rt = JS_GetRuntime(ctx);
-    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
-    JSWorkerMessageHandler *port;
-
-    if (!worker)
+    JSWorkerPoolData *s = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    if (!s)
         return JS_EXCEPTION;
-
-    port = worker->msg_handler;
-    if (JS_IsNull(func)) {
-        if (port) {
-            js_free_port(rt, port);
-            worker->msg_handler = NULL;
-        }
-    } else {
-        if (!JS_IsFunction(ctx, func))
-            return JS_ThrowTypeError(ctx, "not a function");
-        if (!port) {
-            port = js_mallocz(ctx, sizeof(*port));
-            if (!port)
-                return JS_EXCEPTION;
-            port->recv_pipe = js_dup_message_pipe(worker->recv_pipe);
-            port->on_message_func = JS_NULL;
-            list_add_tail(&port->link, &ts->port_list);
-            worker->msg_handler = port;
-        }
-        JS_FreeValue(ctx, port->on_message_func);
-        port->on_message_func = JS_DupValue(ctx, func);
-    }
+    js_worker_pool_stop(JS_GetRuntime(ctx), ctx, s);
     return JS_UNDEFINED;
 }
 
-static JSValue js_worker_get_onmessage(JSContext *ctx, JSValueConst this_val)
+static JSValue js_worker_pool_get_size(JSContext *ctx, JSValueConst this_val)
 {
-    JSWorkerData *worker = JS_GetOpaque2(ctx, this_val, js_worker_class_id);
-    JSWorkerMessageHandler *port;
-    if (!worker)
+    JSWorkerPoolData *s = JS_GetOpaque2(ctx, this_val, js_worker_pool_class_id);
+    if (!s)
         return JS_EXCEPTION;
-    port = worker->msg_handler;
-    if (port) {
-        return JS_DupValue(ctx, port->on_message_func);
-    } else {
-        return JS_NULL;
-    }
+    return JS_NewInt32(ctx, s->pool ? s->pool->thread_count : 0);
 }
 
-static const JSCFunctionListEntry js_worker_proto_funcs[] = {
-    JS_CFUNC_DEF("postMessage", 1, js_worker_postMessage ),
-    JS_CGETSET_DEF("onmessage", js_worker_get_onmessage, js_worker_set_onmessage ),
+static const JSCFunctionListEntry js_worker_pool_proto_funcs[] = {
+    JS_CFUNC_DEF("run", 1, js_worker_pool_run ),
+    JS_CFUNC_DEF("terminate", 0, js_worker_pool_terminate ),
+    JS_CGETSET_DEF("size", js_worker_pool_get_size, NULL ),
 };
 
 #endif /* USE_WORKER */
@@ -3594,6 +6335,8 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     JS_CFUNC_DEF("seek", 3, js_os_seek ),
     JS_CFUNC_MAGIC_DEF("read", 4, js_os_read_write, 0 ),
     JS_CFUNC_MAGIC_DEF("write", 4, js_os_read_write, 1 ),
+    JS_CFUNC_MAGIC_DEF("readAsync", 4, js_os_read_write_async, 0 ),
+    JS_CFUNC_MAGIC_DEF("writeAsync", 4, js_os_read_write_async, 1 ),
     JS_CFUNC_DEF("isatty", 1, js_os_isatty ),
     JS_CFUNC_DEF("ttyGetWinSize", 1, js_os_ttyGetWinSize ),
     JS_CFUNC_DEF("ttySetRaw", 1, js_os_ttySetRaw ),
@@ -3621,8 +6364,10 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     OS_FLAG(SIGTTIN),
     OS_FLAG(SIGTTOU),
 #endif
-    JS_CFUNC_DEF("setTimeout", 2, js_os_setTimeout ),
+    JS_CFUNC_MAGIC_DEF("setTimeout", 2, js_os_setTimeout, 0 ),
     JS_CFUNC_DEF("clearTimeout", 1, js_os_clearTimeout ),
+    JS_CFUNC_MAGIC_DEF("setInterval", 2, js_os_setTimeout, 1 ),
+    JS_CFUNC_DEF("clearInterval", 1, js_os_clearTimeout ),
     JS_PROP_STRING_DEF("platform", OS_PLATFORM, 0 ),
     JS_CFUNC_DEF("getcwd", 0, js_os_getcwd ),
     JS_CFUNC_DEF("chdir", 0, js_os_chdir ),
@@ -3644,6 +6389,8 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     JS_CFUNC_MAGIC_DEF("stat", 1, js_os_stat, 0 ),
     JS_CFUNC_DEF("utimes", 3, js_os_utimes ),
     JS_CFUNC_DEF("sleep", 1, js_os_sleep ),
+    JS_CFUNC_DEF("setProfileSampling", 1, js_os_setProfileSampling ),
+    JS_CFUNC_DEF("getProfile", 0, js_os_getProfile ),
     JS_CFUNC_DEF("realpath", 1, js_os_realpath ),
 #if !defined(_WIN32)
     JS_CFUNC_MAGIC_DEF("lstat", 1, js_os_stat, 1 ),
@@ -3656,6 +6403,45 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     JS_CFUNC_DEF("kill", 2, js_os_kill ),
     JS_CFUNC_DEF("dup", 1, js_os_dup ),
     JS_CFUNC_DEF("dup2", 2, js_os_dup2 ),
+    JS_CFUNC_DEF("socket", 2, js_os_socket ),
+    JS_CFUNC_MAGIC_DEF("bind", 2, js_os_bind_connect, 0 ),
+    JS_CFUNC_MAGIC_DEF("connect", 2, js_os_bind_connect, 1 ),
+    JS_CFUNC_DEF("listen", 1, js_os_listen ),
+    JS_CFUNC_DEF("accept", 1, js_os_accept ),
+#ifdef USE_WORKER
+    JS_CFUNC_DEF("acceptAsync", 1, js_os_accept_async ),
+#endif
+    JS_CFUNC_DEF("shutdown", 2, js_os_shutdown ),
+    JS_CFUNC_MAGIC_DEF("recv", 4, js_os_recv_send, 0 ),
+    JS_CFUNC_MAGIC_DEF("send", 4, js_os_recv_send, 1 ),
+    JS_CFUNC_MAGIC_DEF("recvfrom", 4, js_os_recv_send, 2 ),
+    JS_CFUNC_MAGIC_DEF("sendto", 5, js_os_recv_send, 3 ),
+    JS_CFUNC_MAGIC_DEF("getsockname", 1, js_os_getsockname, 0 ),
+    JS_CFUNC_MAGIC_DEF("getpeername", 1, js_os_getsockname, 1 ),
+    JS_CFUNC_DEF("setsockopt", 4, js_os_setsockopt ),
+    JS_CFUNC_DEF("getsockopt", 3, js_os_getsockopt ),
+    OS_FLAG(AF_INET),
+    OS_FLAG(AF_INET6),
+    OS_FLAG(AF_UNIX),
+    OS_FLAG(SOCK_STREAM),
+    OS_FLAG(SOCK_DGRAM),
+    OS_FLAG(SOL_SOCKET),
+    OS_FLAG(SO_REUSEADDR),
+#ifdef SO_REUSEPORT
+    OS_FLAG(SO_REUSEPORT),
+#endif
+    OS_FLAG(SO_KEEPALIVE),
+    OS_FLAG(SO_BROADCAST),
+    OS_FLAG(SO_ERROR),
+    OS_FLAG(SO_RCVBUF),
+    OS_FLAG(SO_SNDBUF),
+    OS_FLAG(IPPROTO_TCP),
+    OS_FLAG(IPPROTO_UDP),
+    OS_FLAG(TCP_NODELAY),
+    OS_FLAG(SHUT_RD),
+    OS_FLAG(SHUT_WR),
+    OS_FLAG(SHUT_RDWR),
+    OS_FLAG(MSG_PEEK),
 #endif
 };
 
@@ -3692,6 +6478,19 @@ static int js_os_init(JSContext *ctx, JSModuleDef *m)
         }
 
         JS_SetModuleExport(ctx, m, "Worker", obj);
+
+        /* WorkerPool class */
+        JS_NewClassID(&js_worker_pool_class_id);
+        JS_NewClass(JS_GetRuntime(ctx), js_worker_pool_class_id, &js_worker_pool_class);
+        proto = JS_NewObject(ctx);
+        JS_SetPropertyFunctionList(ctx, proto, js_worker_pool_proto_funcs, countof(js_worker_pool_proto_funcs));
+
+        obj = JS_NewCFunction2(ctx, js_worker_pool_ctor, "WorkerPool", 2,
+                               JS_CFUNC_constructor, 0);
+        JS_SetConstructor(ctx, obj, proto);
+
+        JS_SetClassProto(ctx, js_worker_pool_class_id, proto);
+        JS_SetModuleExport(ctx, m, "WorkerPool", obj);
     }
 #endif /* USE_WORKER */
 
@@ -3708,6 +6507,7 @@ JSModuleDef *js_init_module_os(JSContext *ctx, const char *module_name)
     JS_AddModuleExportList(ctx, m, js_os_funcs, countof(js_os_funcs));
 #ifdef USE_WORKER
     JS_AddModuleExport(ctx, m, "Worker");
+    JS_AddModuleExport(ctx, m, "WorkerPool");
 #endif
     return m;
 }
@@ -3776,8 +6576,21 @@ void js_std_init_handlers(JSRuntime *rt)
     memset(ts, 0, sizeof(*ts));
     init_list_head(&ts->os_rw_handlers);
     init_list_head(&ts->os_signal_handlers);
-    init_list_head(&ts->os_timers);
     init_list_head(&ts->port_list);
+#ifdef USE_WORKER
+    pthread_mutex_init(&ts->async_mutex, NULL);
+    pthread_cond_init(&ts->async_cond, NULL);
+    init_list_head(&ts->async_done_list);
+    ts->async_fds[0] = -1;
+    ts->async_fds[1] = -1;
+#endif
+#ifdef USE_EPOLL
+    ts->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (ts->epoll_fd < 0) {
+        fprintf(stderr, "Could not create the epoll file descriptor");
+        exit(1);
+    }
+#endif
 
     JS_SetRuntimeOpaque(rt, ts);
 
@@ -3809,19 +6622,46 @@ void js_std_free_handlers(JSRuntime *rt)
         free_sh(rt, sh);
     }
 
-    list_for_each_safe(el, el1, &ts->os_timers) {
-        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+    while (ts->timer_count > 0) {
+        JSOSTimer *th = ts->timers[ts->timer_count - 1];
         unlink_timer(rt, th);
         if (!th->has_object)
             free_timer(rt, th);
     }
+    js_free_rt(rt, ts->timers);
 
+#ifdef USE_IO_URING
+    if (ts->uring)
+        os_uring_free(rt, ts->uring);
+#endif
 #ifdef USE_WORKER
+    /* wait until the thread pool no longer uses the pending requests */
+    pthread_mutex_lock(&ts->async_mutex);
+    while (ts->async_pending > 0)
+        pthread_cond_wait(&ts->async_cond, &ts->async_mutex);
+    pthread_mutex_unlock(&ts->async_mutex);
+    list_for_each_safe(el, el1, &ts->async_done_list) {
+        JSOSAsyncReq *req = list_entry(el, JSOSAsyncReq, link);
+        list_del(&req->link);
+        os_async_free_req(rt, req);
+    }
+    if (ts->async_fds[0] >= 0) {
+        close(ts->async_fds[0]);
+        close(ts->async_fds[1]);
+        os_async_pool_release();
+    }
+    pthread_mutex_destroy(&ts->async_mutex);
+    pthread_cond_destroy(&ts->async_cond);
+
     /* XXX: free port_list ? */
     js_free_message_pipe(ts->recv_pipe);
     js_free_message_pipe(ts->send_pipe);
 #endif
 
+#ifdef USE_EPOLL
+    js_free_rt(rt, ts->rw_handler_tab);
+    close(ts->epoll_fd);
+#endif
     free(ts);
     JS_SetRuntimeOpaque(rt, NULL); /* fail safe */
 }
@@ -3875,22 +6715,27 @@ void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
 }
 
 /* main loop which calls the user JS callbacks */
-void js_std_loop(JSContext *ctx)
+static void js_std_execute_pending_jobs(JSContext *ctx)
 {
     JSContext *ctx1;
     int err;
 
     for(;;) {
-        /* execute the pending jobs */
-        for(;;) {
-            err = JS_ExecutePendingJob(JS_GetRuntime(ctx), &ctx1);
-            if (err <= 0) {
-                if (err < 0) {
-                    js_std_dump_error(ctx1);
-                }
-                break;
+        err = JS_ExecutePendingJob(JS_GetRuntime(ctx), &ctx1);
+        if (err <= 0) {
+            if (err < 0) {
+                js_std_dump_error(ctx1);
             }
+            break;
         }
+    }
+}
+
+void js_std_loop(JSContext *ctx)
+{
+    for(;;) {
+        /* execute the pending jobs */
+        js_std_execute_pending_jobs(ctx);
 
         if (!os_poll_func || os_poll_func(ctx))
             break;
@@ -3925,3 +6770,53 @@ void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
         JS_FreeValue(ctx, val);
     }
 }
+
+/* A snapshot contains the bytecode of a script or module and of all
+   the modules it imports:
+
+   magic "QJSS"
+   u32 entry_count
+   for each entry:
+     u8 load_only
+     u32 data_len
+     data_len bytes: output of JS_WriteObject()
+
+   The integers are in host byte order. */
+
+JS_BOOL js_std_is_snapshot(const uint8_t *buf, size_t buf_len)
+{
+    return buf_len >= 8 && !memcmp(buf, "QJSS", 4);
+}
+
+/* Load the modules of the snapshot and evaluate its main scripts and
+   modules. Return -1 if the snapshot is invalid. Exit if an exception
+   is raised as js_std_eval_binary(). */
+int js_std_eval_snapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len)
+{
+    const uint8_t *p, *buf_end;
+    uint32_t count, i, len;
+    int pass, load_only;
+
+    if (!js_std_is_snapshot(buf, buf_len))
+        return -1;
+    buf_end = buf + buf_len;
+    memcpy(&count, buf + 4, 4);
+    /* the imported modules must be loaded before the main ones are
+       evaluated */
+    for(pass = 0; pass < 2; pass++) {
+        p = buf + 8;
+        for(i = 0; i < count; i++) {
+            if (buf_end - p < 5)
+                return -1;
+            load_only = p[0];
+            memcpy(&len, p + 1, 4);
+            p += 5;
+            if (len > buf_end - p)
+                return -1;
+            if (load_only == (pass == 0))
+                js_std_eval_binary(ctx, p, len, load_only);
+            p += len;
+        }
+    }
+    return 0;
+}
@@ -47,6 +47,9 @@ JSModuleDef *js_module_loader(JSContext *ctx,
                               const char *module_name, void *opaque);
 void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                         int flags);
+/* snapshot of precompiled scripts and modules generated by 'qjsc -b' */
+JS_BOOL js_std_is_snapshot(const uint8_t *buf, size_t buf_len);
+int js_std_eval_snapshot(JSContext *ctx, const uint8_t *buf, size_t buf_len);
 void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
                                       JSValueConst reason,
                                       JS_BOOL is_handled, void *opaque);
@@ -53,6 +53,7 @@ FMT(atom_u16)
 FMT(atom_label_u8)
 FMT(atom_label_u16)
 FMT(label_u16)
+FMT(atom_u16_loc)
 #undef FMT
 #endif /* FMT */
 
@@ -135,9 +136,9 @@ DEF(  put_ref_value, 1, 3, 0, none)
 DEF(     define_var, 6, 0, 0, atom_u8)
 DEF(check_define_var, 6, 0, 0, atom_u8)
 DEF(    define_func, 6, 1, 0, atom_u8)
-DEF(      get_field, 5, 1, 1, atom)
-DEF(     get_field2, 5, 1, 2, atom)
-DEF(      put_field, 5, 2, 0, atom)
+DEF(      get_field, 7, 1, 1, atom_u16) /* u16: inline cache index */
+DEF(     get_field2, 7, 1, 2, atom_u16)
+DEF(      put_field, 7, 2, 0, atom_u16)
 DEF( get_private_field, 1, 2, 1, none) /* obj prop -> value */
 DEF( put_private_field, 1, 3, 0, none) /* obj value prop -> */
 DEF(define_private_field, 1, 3, 1, none) /* obj prop value -> obj */
@@ -360,6 +361,16 @@ DEF(typeof_is_undefined, 1, 1, 1, none)
 DEF( typeof_is_function, 1, 1, 1, none)
 #endif
 
+/* superinstructions generated by resolve_labels() */
+DEF(get_loc_get_field, 9, 0, 1, atom_u16_loc) /* get_loc(n) get_field(a) */
+DEF(get_loc_get_field2, 9, 0, 2, atom_u16_loc) /* must come after get_loc_get_field */
+DEF(get_loc_check_get_field, 9, 0, 1, atom_u16_loc) /* must come after get_loc_get_field2 */
+DEF(get_loc_check_get_field2, 9, 0, 2, atom_u16_loc) /* must come after get_loc_check_get_field */
+DEF(    lt_if_false, 5, 2, 0, label) /* lt if_false(l) */
+DEF(   lte_if_false, 5, 2, 0, label) /* must be in the same order as lt, lte, gt, gte */
+DEF(    gt_if_false, 5, 2, 0, label)
+DEF(   gte_if_false, 5, 2, 0, label)
+
 #undef DEF
 #undef def
 #endif  /* DEF */
@@ -78,6 +78,22 @@
 #define CONFIG_STACK_CHECK
 #endif
 
+#if !defined(__SANITIZE_ADDRESS__)
+/* allocate the small fixed size objects from per-runtime pools (the
+   pools are disabled with the address sanitizer so that it can check
+   the object accesses) */
+#define CONFIG_POOL_ALLOC
+#endif
+
+/* the baseline JIT only generates x86-64 code */
+#if defined(CONFIG_JIT) && !(defined(__x86_64__) && defined(__linux__))
+#undef CONFIG_JIT
+#endif
+#ifdef CONFIG_JIT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 
 /* dump object free */
 //#define DUMP_FREE
@@ -216,6 +232,11 @@ typedef enum {
     JS_GC_PHASE_REMOVE_CYCLES,
 } JSGCPhaseEnum;
 
+/* a full collection is done when the heap size after a collection
+   reaches JS_GC_FULL_GROWTH times its size after the last full
+   collection */
+#define JS_GC_FULL_GROWTH 2
+
 typedef enum OPCodeEnum OPCodeEnum;
 
 #ifdef CONFIG_BIGNUM
@@ -238,9 +259,50 @@ typedef struct {
 } JSNumericOperations;
 #endif
 
+/* object pools: the blocks are allocated by slabs of
+   JS_POOL_SLAB_SIZE bytes and the sizes are rounded up to a multiple
+   of JS_POOL_ALIGN. A slab is freed when all its blocks are free. */
+#define JS_POOL_ALIGN       16
+#define JS_POOL_MAX_SIZE    256
+#define JS_POOL_CLASS_COUNT (JS_POOL_MAX_SIZE / JS_POOL_ALIGN)
+#define JS_POOL_SLAB_BITS   14
+#define JS_POOL_SLAB_SIZE   (1 << JS_POOL_SLAB_BITS)
+
+typedef struct JSPoolBlock {
+    struct JSPoolBlock *next;
+} JSPoolBlock;
+
+/* The slabs are not aligned, so each slab is registered in a hash
+   table for the (at most two) JS_POOL_SLAB_SIZE aligned windows it
+   overlaps. */
+typedef struct JSPoolSlab {
+    struct list_head link; /* in rt->pool_slab_list */
+    struct list_head free_link; /* in pool->free_slab_list if free_list != NULL */
+    struct JSPoolSlab *hash_next[2]; /* for the first and last window */
+    JSPoolBlock *free_list;
+    uint32_t used_count; /* number of allocated blocks */
+    /* followed by the blocks */
+} JSPoolSlab;
+
+#define JS_POOL_SLAB_HEADER_SIZE \
+    ((sizeof(JSPoolSlab) + JS_POOL_ALIGN - 1) & ~(JS_POOL_ALIGN - 1))
+
+typedef struct JSPool {
+    struct list_head free_slab_list; /* slabs having free blocks */
+    uint32_t used_count; /* number of allocated blocks */
+    uint32_t slab_count;
+} JSPool;
+
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
+#ifdef CONFIG_POOL_ALLOC
+    JSPool pools[JS_POOL_CLASS_COUNT];
+    struct list_head pool_slab_list; /* list of all the slabs */
+    int pool_slab_count;
+    int pool_slab_hash_bits;
+    JSPoolSlab **pool_slab_hash; /* size: 1 << pool_slab_hash_bits */
+#endif
     const char *rt_info;
 
     int atom_hash_size; /* power of two */
@@ -256,13 +318,22 @@ struct JSRuntime {
 
     struct list_head context_list; /* list of JSContext.link */
     /* list of JSGCObjectHeader.link. List of allocated GC objects (used
-       by the garbage collector) */
+       by the garbage collector). Only contains the old generation,
+       i.e. the objects which survived at least one collection. */
     struct list_head gc_obj_list;
+    /* list of JSGCObjectHeader.link. GC objects allocated since the
+       last collection (young generation) */
+    struct list_head gc_young_list;
     /* list of JSGCObjectHeader.link. Used during JS_FreeValueRT() */
     struct list_head gc_zero_ref_count_list; 
     struct list_head tmp_obj_list; /* used during GC */
     JSGCPhaseEnum gc_phase : 8;
+    BOOL gc_young_pass : 8; /* TRUE if only collecting gc_young_list */
     size_t malloc_gc_threshold;
+    /* a full collection is done instead of a young one when
+       malloc_gc_threshold is above this value */
+    size_t malloc_gc_full_threshold;
+    JSGCStats gc_stats;
 #ifdef DUMP_LEAKS
     struct list_head string_list; /* list of JSString.link */
 #endif
@@ -279,6 +350,13 @@ struct JSRuntime {
 
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
+    BOOL profile_sampling; /* record the call stack at each interrupt poll */
+    int profile_sample_count;
+    DynBuf profile_samples; /* one '\0' terminated stack per sample */
+#ifdef CONFIG_JIT
+    FILE *perf_map_file; /* symbols of the generated code or NULL */
+    struct JSJitChunk *jit_chunk; /* current code chunk or NULL */
+#endif
 
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
@@ -293,11 +371,23 @@ struct JSRuntime {
     /* used to allocate, free and clone SharedArrayBuffers */
     JSSharedArrayBufferFunctions sab_funcs;
     
+    /* compiled regexp cache. list of JSRegExpCacheEntry.link, the
+       most recently used first */
+    struct list_head regexp_cache_list;
+    struct JSRegExpCacheEntry **regexp_cache_hash; /* allocated on first use */
+    int regexp_cache_count;
+    size_t regexp_cache_size; /* sum of JSRegExpCacheEntry.size */
+    int64_t regexp_cache_hits;
+    int64_t regexp_cache_misses;
+    /* maximum number of steps of a regexp execution, 0 if no limit */
+    uint64_t regexp_step_limit;
+
     /* Shape hash table */
     int shape_hash_bits;
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    uint32_t shape_last_id; /* last allocated JSShape.id */
 #ifdef CONFIG_BIGNUM
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
@@ -337,6 +427,42 @@ typedef struct JSStackFrame {
     JSValue *cur_sp;
 } JSStackFrame;
 
+#ifdef CONFIG_JIT
+/* a function is compiled when it is entered after
+   JS_JIT_CALL_THRESHOLD calls or JS_JIT_LOOP_THRESHOLD backward
+   jumps, so that the code which runs only once is not compiled */
+#define JS_JIT_CALL_THRESHOLD 100
+#define JS_JIT_LOOP_THRESHOLD 1000
+
+/* state shared between JS_CallInternal() and the native code */
+typedef struct JSJitFrame {
+    JSContext *ctx;
+    struct JSFunctionBytecode *b;
+    JSStackFrame *sf;
+    struct JSVarRef **var_refs;
+    JSValue *var_buf;
+    JSValue *arg_buf;
+    JSValue *sp; /* stack pointer when leaving the native code */
+    const uint8_t *pc; /* interpreter pc when leaving the native code */
+    JSValueConst this_obj;
+    JSValue ret_val; /* return value of the function */
+} JSJitFrame;
+
+/* executable memory. The native code of the functions is appended to
+   the current chunk of the runtime until it is full. The other chunks
+   are unmapped when all their functions are freed. */
+typedef struct JSJitChunk {
+    uint8_t *buf;
+    size_t size;
+    size_t used;
+    int func_count; /* number of functions with code in the chunk */
+} JSJitChunk;
+
+/* return 0 to resume the interpreter at f->pc, 1 if the function
+   returned f->ret_val or -1 if exception */
+typedef int JSJitFunc(JSJitFrame *f);
+#endif
+
 typedef enum {
     JS_GC_OBJ_TYPE_JS_OBJECT,
     JS_GC_OBJ_TYPE_FUNCTION_BYTECODE,
@@ -352,12 +478,26 @@ typedef enum {
 struct JSGCObjectHeader {
     int ref_count; /* must come first, 32-bit */
     JSGCObjectTypeEnum gc_obj_type : 4;
-    uint8_t mark : 4; /* used by the GC */
+    uint8_t mark : 1; /* used by the GC */
+    uint8_t gc_old : 1; /* TRUE if the object is in the old generation */
     uint8_t dummy1; /* not used by the GC */
     uint16_t dummy2; /* not used by the GC */
     struct list_head link;
 };
 
+/* return the list containing the GC object 'h' */
+static inline struct list_head *get_gc_obj_list(JSRuntime *rt,
+                                                JSGCObjectHeader *h)
+{
+    return h->gc_old ? &rt->gc_obj_list : &rt->gc_young_list;
+}
+
+/* iterate over the GC objects of both generations. 'gen' is an int
+   used as loop counter. */
+#define list_for_each_gc_obj(el, gen, rt)                               \
+    for(gen = 0; gen < 2; gen++)                                        \
+        list_for_each(el, gen ? &(rt)->gc_young_list : &(rt)->gc_obj_list)
+
 typedef struct JSVarRef {
     union {
         JSGCObjectHeader header; /* must come first */
@@ -404,8 +544,20 @@ typedef enum {
     JS_AUTOINIT_ID_PROTOTYPE,
     JS_AUTOINIT_ID_MODULE_NS,
     JS_AUTOINIT_ID_PROP,
+    JS_AUTOINIT_ID_INTRINSIC,
 } JSAutoInitIDEnum;
 
+/* intrinsic objects which are created on first use */
+typedef enum {
+    JS_LAZY_INTRINSIC_DATE,
+    JS_LAZY_INTRINSIC_TYPED_ARRAYS,
+#ifdef CONFIG_BIGNUM
+    JS_LAZY_INTRINSIC_BIG_FLOAT,
+    JS_LAZY_INTRINSIC_BIG_DECIMAL,
+#endif
+    JS_LAZY_INTRINSIC_COUNT,
+} JSLazyIntrinsicEnum;
+
 /* must be large enough to have a negligible runtime cost and small
    enough to call the interrupt callback often. */
 #define JS_INTERRUPT_COUNTER_INIT 10000
@@ -421,6 +573,9 @@ struct JSContext {
     JSShape *array_shape;   /* initial shape for Array objects */
 
     JSValue *class_proto;
+    /* mask of the intrinsics whose initialization is deferred
+       (1 << JS_LAZY_INTRINSIC_x) */
+    uint32_t lazy_intrinsics;
     JSValue function_proto;
     JSValue function_ctor;
     JSValue array_ctor;
@@ -504,6 +659,23 @@ struct JSString {
     } u;
 };
 
+/* tag of the ropes. They are internal: the C functions and the public
+   API only see linearized strings. */
+#define JS_TAG_STRING_ROPE (-6)
+
+/* strings built by concatenation are represented as a binary tree
+   which is linearized when the characters are accessed */
+typedef struct JSStringRope {
+    JSRefCountHeader header; /* must come first, 32-bit */
+    uint32_t len : 31;
+    uint8_t is_wide_char : 1; /* 0 = 8 bits, 1 = 16 bits characters */
+    /* depth of the tree. 0 if linearized: 'left' contains the whole
+       string and 'right' is the empty string */
+    uint8_t depth;
+    JSValue left; /* JS_TAG_STRING or JS_TAG_STRING_ROPE */
+    JSValue right; /* JS_TAG_STRING or JS_TAG_STRING_ROPE */
+} JSStringRope;
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -582,6 +754,40 @@ typedef enum JSFunctionKindEnum {
     JS_FUNC_ASYNC_GENERATOR = (JS_FUNC_GENERATOR | JS_FUNC_ASYNC),
 } JSFunctionKindEnum;
 
+/* number of entries of a polymorphic inline cache */
+#define JS_IC_ENTRY_COUNT 4
+/* inline cache index used when there are too many property accesses
+   in the function */
+#define JS_IC_NONE 0xffff
+
+typedef struct JSInlineCacheEntry {
+    uint32_t shape_id; /* 0 if the entry is free */
+    /* 0 if the property is an own property, otherwise shape id of
+       the prototype holding the property */
+    uint32_t proto_shape_id;
+    uint32_t prop_idx;
+} JSInlineCacheEntry;
+
+typedef struct JSInlineCache {
+    JSInlineCacheEntry entries[JS_IC_ENTRY_COUNT];
+} JSInlineCache;
+
+#define JS_GLOBAL_IC_SIZE_INIT 8
+#define JS_GLOBAL_IC_SIZE_MAX  256 /* must be a power of two */
+
+/* cache of the global variable accesses. The global objects are the
+   same for all the accesses of a function, so the cache is indexed
+   by the variable name. */
+typedef struct JSGlobalCacheEntry {
+    JSAtom atom; /* JS_ATOM_NULL if the entry is free */
+    uint32_t var_shape_id; /* shape id of global_var_obj */
+    /* 0 if the variable is in global_var_obj, otherwise shape id of
+       global_obj */
+    uint32_t global_shape_id;
+    uint32_t prop_idx : 31;
+    uint32_t is_writable : 1;
+} JSGlobalCacheEntry;
+
 typedef struct JSFunctionBytecode {
     JSGCObjectHeader header; /* must come first */
     uint8_t js_mode;
@@ -612,6 +818,21 @@ typedef struct JSFunctionBytecode {
     JSValue *cpool; /* constant pool (self pointer) */
     int cpool_count;
     int closure_var_count;
+    int ic_count; /* number of inline caches */
+    JSInlineCache *ic; /* allocated on first use, NULL otherwise */
+    uint32_t global_ic_mask; /* size of global_ic - 1 */
+    JSGlobalCacheEntry *global_ic; /* allocated on first use */
+    /* execution profile */
+    uint32_t call_count;
+    uint32_t loop_count; /* number of backward jumps */
+    uint32_t sample_count;
+#ifdef CONFIG_JIT
+    BOOL jit_failed : 8; /* TRUE if no native code can be generated */
+    JSJitFunc *jit_func; /* entry point of the native code or NULL */
+    JSJitChunk *jit_chunk;
+    uint8_t *jit_code;
+    uint32_t jit_code_size;
+#endif
     struct {
         /* debug info, move to separate structure to save memory? */
         JSAtom filename;
@@ -659,6 +880,7 @@ typedef struct JSArrayBuffer {
     int byte_length; /* 0 if detached */
     uint8_t detached;
     uint8_t shared; /* if shared, the array buffer cannot be detached */
+    int pin_count; /* if > 0, the array buffer cannot be detached */
     uint8_t *data; /* NULL if detached */
     struct list_head array_list;
     void *opaque;
@@ -806,6 +1028,23 @@ struct JSModuleDef {
     JSValue meta_obj; /* for import.meta */
 };
 
+/* maximum number of compiled regexps kept in the runtime cache */
+#define JS_REGEXP_CACHE_SIZE      512
+#define JS_REGEXP_CACHE_HASH_SIZE 512 /* power of two */
+/* maximum total size in bytes of the cached regexps */
+#define JS_REGEXP_CACHE_MAX_BYTES (1024 * 1024)
+/* longer patterns are not cached */
+#define JS_REGEXP_CACHE_PATTERN_MAX 1024
+
+typedef struct JSRegExpCacheEntry {
+    struct list_head link; /* JSRuntime.regexp_cache_list */
+    struct JSRegExpCacheEntry *hash_next;
+    JSAtom pattern;
+    int flags; /* LRE_FLAG_x */
+    JSString *bytecode;
+    size_t size; /* memory used by the entry, pattern and bytecode */
+} JSRegExpCacheEntry;
+
 typedef struct JSJobEntry {
     struct list_head link;
     JSContext *ctx;
@@ -854,6 +1093,9 @@ struct JSShape {
        small array index properties */
     uint8_t has_small_array_index;
     uint32_t hash; /* current hash value */
+    /* unique identifier, changed each time the shape is modified in
+       place. Used to validate the inline caches. */
+    uint32_t id;
     uint32_t prop_hash_mask;
     int prop_size; /* allocated properties */
     int prop_count; /* include deleted properties */
@@ -1000,6 +1242,10 @@ static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
+#ifdef CONFIG_JIT
+static JSJitFunc *js_jit_compile(JSContext *ctx, JSFunctionBytecode *b);
+static void js_jit_free_chunk(JSRuntime *rt, JSJitChunk *c);
+#endif
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
                                   int argc, JSValueConst *argv, int flags);
@@ -1096,9 +1342,11 @@ static int JS_ToFloat64Free(JSContext *ctx, double *pres, JSValue val);
 static int JS_ToUint8ClampFree(JSContext *ctx, int32_t *pres, JSValue val);
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags);
+static void js_regexp_cache_free(JSRuntime *rt);
 static JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
                                               JSValue pattern, JSValue bc);
 static void gc_decref(JSRuntime *rt);
+static void js_run_gc(JSRuntime *rt, BOOL full);
 static int JS_NewClass1(JSRuntime *rt, JSClassID class_id,
                         const JSClassDef *class_def, JSAtom name);
 
@@ -1176,6 +1424,7 @@ static JSValue js_typed_array_constructor(JSContext *ctx,
 static BOOL typed_array_is_detached(JSContext *ctx, JSObject *p);
 static uint32_t typed_array_get_length(JSContext *ctx, JSObject *p);
 static JSValue JS_ThrowTypeErrorDetachedArrayBuffer(JSContext *ctx);
+static JSValue JS_ThrowTypeErrorPinnedArrayBuffer(JSContext *ctx);
 static JSVarRef *get_var_ref(JSContext *ctx, JSStackFrame *sf, int var_idx,
                              BOOL is_arg);
 static JSValue js_generator_function_call(JSContext *ctx, JSValueConst func_obj,
@@ -1249,8 +1498,22 @@ static JSValue js_module_ns_autoinit(JSContext *ctx, JSObject *p, JSAtom atom,
                                  void *opaque);
 static JSValue JS_InstantiateFunctionListItem2(JSContext *ctx, JSObject *p,
                                                JSAtom atom, void *opaque);
+static void js_add_lazy_intrinsic(JSContext *ctx, int idx);
+static int js_init_lazy_intrinsic(JSContext *ctx, int idx);
+static void js_init_lazy_class_proto(JSContext *ctx, JSClassID class_id);
 void JS_SetUncatchableError(JSContext *ctx, JSValueConst val, BOOL flag);
 
+/* the prototypes of the lazy intrinsics are JS_NULL until they are
+   created */
+static inline JSValueConst js_get_class_proto(JSContext *ctx,
+                                              JSClassID class_id)
+{
+    if (unlikely(JS_IsNull(ctx->class_proto[class_id])) &&
+        ctx->lazy_intrinsics != 0)
+        js_init_lazy_class_proto(ctx, class_id);
+    return ctx->class_proto[class_id];
+}
+
 static const JSClassExoticMethods js_arguments_exotic_methods;
 static const JSClassExoticMethods js_string_exotic_methods;
 static const JSClassExoticMethods js_proxy_exotic_methods;
@@ -1271,7 +1534,11 @@ static void js_trigger_gc(JSRuntime *rt, size_t size)
         printf("GC: size=%" PRIu64 "\n",
                (uint64_t)rt->malloc_state.malloc_size);
 #endif
-        JS_RunGC(rt);
+        /* the young generation is collected at each threshold
+           crossing. The cycles involving old objects are only
+           collected once the heap has grown enough since the last
+           full collection. */
+        js_run_gc(rt, rt->malloc_gc_threshold > rt->malloc_gc_full_threshold);
         rt->malloc_gc_threshold = rt->malloc_state.malloc_size +
             (rt->malloc_state.malloc_size >> 1);
     }
@@ -1311,6 +1578,215 @@ void *js_mallocz_rt(JSRuntime *rt, size_t size)
     return memset(ptr, 0, size);
 }
 
+#ifdef CONFIG_POOL_ALLOC
+static void js_pool_init(JSRuntime *rt)
+{
+    int i;
+    for(i = 0; i < JS_POOL_CLASS_COUNT; i++) {
+        init_list_head(&rt->pools[i].free_slab_list);
+        rt->pools[i].used_count = 0;
+        rt->pools[i].slab_count = 0;
+    }
+    init_list_head(&rt->pool_slab_list);
+    rt->pool_slab_count = 0;
+    rt->pool_slab_hash_bits = 0;
+    rt->pool_slab_hash = NULL;
+}
+
+static inline uint32_t js_pool_slab_hash(JSRuntime *rt, uintptr_t w)
+{
+    return ((uint32_t)w * 0x9e3779b1) >> (32 - rt->pool_slab_hash_bits);
+}
+
+/* return the hash_next index of 'slab' in the hash bucket 'h' */
+static inline int js_pool_slab_link(JSRuntime *rt, JSPoolSlab *slab, uint32_t h)
+{
+    return js_pool_slab_hash(rt, (uintptr_t)slab >> JS_POOL_SLAB_BITS) != h;
+}
+
+static void js_pool_slab_hash_add(JSRuntime *rt, JSPoolSlab *slab)
+{
+    uint32_t h0, h1;
+    h0 = js_pool_slab_hash(rt, (uintptr_t)slab >> JS_POOL_SLAB_BITS);
+    h1 = js_pool_slab_hash(rt, ((uintptr_t)slab + JS_POOL_SLAB_SIZE - 1) >>
+                           JS_POOL_SLAB_BITS);
+    slab->hash_next[0] = rt->pool_slab_hash[h0];
+    rt->pool_slab_hash[h0] = slab;
+    if (h1 != h0) {
+        slab->hash_next[1] = rt->pool_slab_hash[h1];
+        rt->pool_slab_hash[h1] = slab;
+    }
+}
+
+static void js_pool_slab_hash_remove(JSRuntime *rt, JSPoolSlab *slab)
+{
+    JSPoolSlab **pslab;
+    uint32_t h[2];
+    int k;
+
+    h[0] = js_pool_slab_hash(rt, (uintptr_t)slab >> JS_POOL_SLAB_BITS);
+    h[1] = js_pool_slab_hash(rt, ((uintptr_t)slab + JS_POOL_SLAB_SIZE - 1) >>
+                             JS_POOL_SLAB_BITS);
+    for(k = 0; k < 1 + (h[1] != h[0]); k++) {
+        pslab = &rt->pool_slab_hash[h[k]];
+        while (*pslab != slab)
+            pslab = &(*pslab)->hash_next[js_pool_slab_link(rt, *pslab, h[k])];
+        *pslab = slab->hash_next[k];
+    }
+}
+
+static int js_pool_slab_hash_resize(JSRuntime *rt, int hash_bits)
+{
+    JSPoolSlab **hash;
+    struct list_head *el;
+
+    hash = js_mallocz_rt(rt, sizeof(hash[0]) << hash_bits);
+    if (!hash)
+        return -1;
+    js_free_rt(rt, rt->pool_slab_hash);
+    rt->pool_slab_hash = hash;
+    rt->pool_slab_hash_bits = hash_bits;
+    list_for_each(el, &rt->pool_slab_list) {
+        js_pool_slab_hash_add(rt, list_entry(el, JSPoolSlab, link));
+    }
+    return 0;
+}
+
+/* return the slab containing the block 'ptr' */
+static inline JSPoolSlab *js_pool_find_slab(JSRuntime *rt, void *ptr)
+{
+    JSPoolSlab *slab;
+    uint32_t h;
+
+    h = js_pool_slab_hash(rt, (uintptr_t)ptr >> JS_POOL_SLAB_BITS);
+    slab = rt->pool_slab_hash[h];
+    for(;;) {
+        assert(slab != NULL);
+        if ((uintptr_t)ptr - (uintptr_t)slab < JS_POOL_SLAB_SIZE)
+            return slab;
+        slab = slab->hash_next[js_pool_slab_link(rt, slab, h)];
+    }
+}
+
+static JSPoolSlab *js_pool_new_slab(JSRuntime *rt, JSPool *pool)
+{
+    JSPoolSlab *slab;
+    JSPoolBlock *b;
+    size_t block_size, n, i;
+    uint8_t *ptr;
+
+    if (!rt->pool_slab_hash ||
+        rt->pool_slab_count >= (1 << rt->pool_slab_hash_bits)) {
+        /* keep the previous table if the resize fails */
+        if (js_pool_slab_hash_resize(rt, max_int(rt->pool_slab_hash_bits + 1, 4)) &&
+            !rt->pool_slab_hash)
+            return NULL;
+    }
+    slab = js_malloc_rt(rt, JS_POOL_SLAB_SIZE);
+    if (!slab)
+        return NULL;
+    block_size = (pool - rt->pools + 1) * JS_POOL_ALIGN;
+    ptr = (uint8_t *)slab + JS_POOL_SLAB_HEADER_SIZE;
+    n = (JS_POOL_SLAB_SIZE - JS_POOL_SLAB_HEADER_SIZE) / block_size;
+    slab->free_list = NULL;
+    for(i = 0; i < n; i++) {
+        b = (JSPoolBlock *)(ptr + (n - 1 - i) * block_size);
+        b->next = slab->free_list;
+        slab->free_list = b;
+    }
+    slab->used_count = 0;
+    list_add_tail(&slab->link, &rt->pool_slab_list);
+    list_add(&slab->free_link, &pool->free_slab_list);
+    js_pool_slab_hash_add(rt, slab);
+    rt->pool_slab_count++;
+    pool->slab_count++;
+    return slab;
+}
+
+static void js_pool_free_slab(JSRuntime *rt, JSPool *pool, JSPoolSlab *slab)
+{
+    list_del(&slab->link);
+    list_del(&slab->free_link);
+    js_pool_slab_hash_remove(rt, slab);
+    rt->pool_slab_count--;
+    pool->slab_count--;
+    js_free_rt(rt, slab);
+}
+#endif /* CONFIG_POOL_ALLOC */
+
+/* Allocate a block of 'size' bytes from the object pools. The same
+   size must be given to js_pool_free_rt(). */
+static void *js_pool_alloc_rt(JSRuntime *rt, size_t size)
+{
+#ifdef CONFIG_POOL_ALLOC
+    JSPool *pool;
+    JSPoolSlab *slab;
+    JSPoolBlock *b;
+
+    assert(size != 0 && size <= JS_POOL_MAX_SIZE);
+    pool = &rt->pools[(size - 1) / JS_POOL_ALIGN];
+    if (unlikely(list_empty(&pool->free_slab_list))) {
+        slab = js_pool_new_slab(rt, pool);
+        if (!slab)
+            return NULL;
+    } else {
+        slab = list_entry(pool->free_slab_list.next, JSPoolSlab, free_link);
+    }
+    b = slab->free_list;
+    slab->free_list = b->next;
+    if (!slab->free_list)
+        list_del(&slab->free_link);
+    slab->used_count++;
+    pool->used_count++;
+    return b;
+#else
+    return js_malloc_rt(rt, size);
+#endif
+}
+
+static void js_pool_free_rt(JSRuntime *rt, void *ptr, size_t size)
+{
+#ifdef CONFIG_POOL_ALLOC
+    JSPool *pool;
+    JSPoolSlab *slab;
+    JSPoolBlock *b;
+
+    if (!ptr)
+        return;
+    pool = &rt->pools[(size - 1) / JS_POOL_ALIGN];
+    slab = js_pool_find_slab(rt, ptr);
+    if (!slab->free_list) {
+        /* the full slabs are reused first so that the others can
+           become empty */
+        list_add(&slab->free_link, &pool->free_slab_list);
+    }
+    b = ptr;
+    b->next = slab->free_list;
+    slab->free_list = b;
+    pool->used_count--;
+    /* an empty slab is kept if it is the last one with free blocks */
+    if (--slab->used_count == 0 &&
+        pool->free_slab_list.next != pool->free_slab_list.prev) {
+        js_pool_free_slab(rt, pool, slab);
+    }
+#else
+    js_free_rt(rt, ptr);
+#endif
+}
+
+/* free all the slabs. The pools must be empty. */
+static void js_pool_free_all(JSRuntime *rt)
+{
+#ifdef CONFIG_POOL_ALLOC
+    struct list_head *el, *el1;
+    list_for_each_safe(el, el1, &rt->pool_slab_list) {
+        js_free_rt(rt, list_entry(el, JSPoolSlab, link));
+    }
+    js_free_rt(rt, rt->pool_slab_hash);
+    js_pool_init(rt);
+#endif
+}
+
 #ifdef CONFIG_BIGNUM
 /* called by libbf */
 static void *js_bf_realloc(void *opaque, void *ptr, size_t size)
@@ -1349,6 +1825,18 @@ void js_free(JSContext *ctx, void *ptr)
     js_free_rt(ctx->rt, ptr);
 }
 
+/* Throw out of memory in case of error */
+static void *js_pool_alloc(JSContext *ctx, size_t size)
+{
+    void *ptr;
+    ptr = js_pool_alloc_rt(ctx->rt, size);
+    if (unlikely(!ptr)) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    return ptr;
+}
+
 /* Throw out of memory in case of error */
 void *js_realloc(JSContext *ctx, void *ptr, size_t size)
 {
@@ -1616,6 +2104,7 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     }
     rt->malloc_state = ms;
     rt->malloc_gc_threshold = 256 * 1024;
+    rt->malloc_gc_full_threshold = rt->malloc_gc_threshold * JS_GC_FULL_GROWTH;
 
 #ifdef CONFIG_BIGNUM
     bf_context_init(&rt->bf_ctx, js_bf_realloc, rt);
@@ -1626,13 +2115,19 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
 
     init_list_head(&rt->context_list);
     init_list_head(&rt->gc_obj_list);
+    init_list_head(&rt->gc_young_list);
     init_list_head(&rt->gc_zero_ref_count_list);
     rt->gc_phase = JS_GC_PHASE_NONE;
+#ifdef CONFIG_POOL_ALLOC
+    js_pool_init(rt);
+#endif
     
 #ifdef DUMP_LEAKS
     init_list_head(&rt->string_list);
 #endif
     init_list_head(&rt->job_list);
+    init_list_head(&rt->regexp_cache_list);
+    dbuf_init2(&rt->profile_samples, rt, (DynBufReallocFunc *)js_realloc_rt);
 
     if (JS_InitAtoms(rt))
         goto fail;
@@ -1778,6 +2273,23 @@ void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
 {
     rt->malloc_gc_threshold = gc_threshold;
+    if (gc_threshold > SIZE_MAX / JS_GC_FULL_GROWTH)
+        rt->malloc_gc_full_threshold = SIZE_MAX;
+    else
+        rt->malloc_gc_full_threshold = gc_threshold * JS_GC_FULL_GROWTH;
+}
+
+/* the transferred ArrayBuffers use the libc allocator because they can
+   outlive the runtime */
+static void *js_array_buffer_alloc_transferred(size_t size)
+{
+    return malloc(max_int(size, 1));
+}
+
+static void js_array_buffer_free_transferred(JSRuntime *rt, void *opaque,
+                                             void *ptr)
+{
+    free(ptr);
 }
 
 #define malloc(s) malloc_is_forbidden(s)
@@ -1939,6 +2451,8 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
     init_list_head(&rt->job_list);
 
+    js_regexp_cache_free(rt);
+
     JS_RunGC(rt);
 
 #ifdef DUMP_LEAKS
@@ -1981,6 +2495,7 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
 #endif
     assert(list_empty(&rt->gc_obj_list));
+    assert(list_empty(&rt->gc_young_list));
 
     /* free the classes */
     for(i = 0; i < rt->class_count; i++) {
@@ -1990,6 +2505,27 @@ void JS_FreeRuntime(JSRuntime *rt)
         }
     }
     js_free_rt(rt, rt->class_array);
+    dbuf_free(&rt->profile_samples);
+#ifdef CONFIG_JIT
+    if (rt->jit_chunk) {
+        assert(rt->jit_chunk->func_count == 0);
+        js_jit_free_chunk(rt, rt->jit_chunk);
+    }
+#endif
+
+#if defined(DUMP_LEAKS) && defined(CONFIG_POOL_ALLOC)
+    for(i = 0; i < JS_POOL_CLASS_COUNT; i++) {
+        if (rt->pools[i].used_count != 0) {
+            printf("Pool leak: %u blocks of %d bytes\n",
+                   rt->pools[i].used_count, (i + 1) * JS_POOL_ALIGN);
+        }
+    }
+#endif
+    js_pool_free_all(rt);
+#ifdef CONFIG_JIT
+    if (rt->perf_map_file)
+        fclose(rt->perf_map_file);
+#endif
 
 #ifdef CONFIG_BIGNUM
     bf_context_end(&rt->bf_ctx);
@@ -2202,7 +2738,7 @@ JSValue JS_GetClassProto(JSContext *ctx, JSClassID class_id)
 {
     JSRuntime *rt = ctx->rt;
     assert(class_id < rt->class_count);
-    return JS_DupValue(ctx, ctx->class_proto[class_id]);
+    return JS_DupValue(ctx, js_get_class_proto(ctx, class_id));
 }
 
 typedef enum JSFreeModuleEnum {
@@ -2289,9 +2825,10 @@ void JS_FreeContext(JSContext *ctx)
     {
         struct list_head *el;
         JSGCObjectHeader *p;
+        int gen;
         printf("JSObjects: {\n");
         JS_DumpObjectHeader(ctx->rt);
-        list_for_each(el, &rt->gc_obj_list) {
+        list_for_each_gc_obj(el, gen, rt) {
             p = list_entry(el, JSGCObjectHeader, link);
             JS_DumpGCObject(rt, p);
         }
@@ -2357,6 +2894,11 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     update_stack_limit(rt);
 }
 
+void JS_SetRegExpStepLimit(JSRuntime *rt, uint64_t step_limit)
+{
+    rt->regexp_step_limit = step_limit;
+}
+
 void JS_UpdateStackTop(JSRuntime *rt)
 {
     rt->stack_top = js_get_stack_pointer();
@@ -4174,55 +4716,552 @@ static JSValue JS_ConcatString1(JSContext *ctx,
     return JS_MKPTR(JS_TAG_STRING, p);
 }
 
+/* String ropes */
+
+/* a concatenation shorter than this is done by copying the characters */
+#define JS_STRING_ROPE_SHORT_LEN 512
+/* max depth of a rope before it is rebalanced */
+#define JS_STRING_ROPE_MAX_DEPTH 60
+/* number of slots used when rebalancing a rope (fib(45) > JS_STRING_LEN_MAX) */
+#define JS_STRING_ROPE_SLOTS     44
+
+/* js_rope_fib[i] = fib(i + 2). A rope of depth 'd' is balanced if its
+   length is >= js_rope_fib[d]. */
+static const uint32_t js_rope_fib[JS_STRING_ROPE_SLOTS + 1] = {
+    1, 2, 3, 5, 8, 13, 21, 34, 55, 89,
+    144, 233, 377, 610, 987, 1597, 2584, 4181, 6765, 10946,
+    17711, 28657, 46368, 75025, 121393, 196418, 317811, 514229, 832040,
+    1346269, 2178309, 3524578, 5702887, 9227465, 14930352, 24157817,
+    39088169, 63245986, 102334155, 165580141, 267914296, 433494437,
+    701408733, 1134903170, 1836311903,
+};
+
+typedef struct JSStringRopeIter {
+    int stack_len;
+    JSValueConst stack[JS_STRING_ROPE_MAX_DEPTH + 2];
+} JSStringRopeIter;
+
+/* 'val' must be a string or a rope */
+static inline uint32_t js_string_value_len(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING)
+        return JS_VALUE_GET_STRING(val)->len;
+    else
+        return ((JSStringRope *)JS_VALUE_GET_PTR(val))->len;
+}
+
+static inline BOOL js_string_value_is_wide_char(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING)
+        return JS_VALUE_GET_STRING(val)->is_wide_char;
+    else
+        return ((JSStringRope *)JS_VALUE_GET_PTR(val))->is_wide_char;
+}
+
+static inline int js_string_value_depth(JSValueConst val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING)
+        return 0;
+    else
+        return ((JSStringRope *)JS_VALUE_GET_PTR(val))->depth;
+}
+
+static inline BOOL tag_is_string(uint32_t tag)
+{
+    return tag == JS_TAG_STRING || tag == JS_TAG_STRING_ROPE;
+}
+
+/* same as JS_IsString() but also accept the ropes */
+static inline BOOL js_is_string(JSValueConst v)
+{
+    return tag_is_string(JS_VALUE_GET_TAG(v));
+}
+
+static void string_rope_iter_init(JSStringRopeIter *it, JSValueConst val)
+{
+    it->stack[0] = val;
+    it->stack_len = 1;
+}
+
+/* return the next non empty leaf of the rope or NULL if none */
+static JSString *string_rope_iter_next(JSStringRopeIter *it)
+{
+    JSValueConst val;
+    JSStringRope *r;
+    JSString *p;
+
+    while (it->stack_len > 0) {
+        val = it->stack[--it->stack_len];
+        if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING) {
+            p = JS_VALUE_GET_STRING(val);
+            if (p->len != 0)
+                return p;
+        } else {
+            r = JS_VALUE_GET_PTR(val);
+            it->stack[it->stack_len++] = r->right;
+            it->stack[it->stack_len++] = r->left;
+        }
+    }
+    return NULL;
+}
+
+static void js_free_string_rope(JSRuntime *rt, JSStringRope *r)
+{
+    JS_FreeValueRT(rt, r->left);
+    JS_FreeValueRT(rt, r->right);
+    js_free_rt(rt, r);
+}
+
+/* 'rope' is freed. Return a string containing all the characters of
+   the rope. The result is kept in the rope so that it is linearized
+   only once. */
+static JSValue js_linearize_string_rope(JSContext *ctx, JSValue rope)
+{
+    JSStringRope *r = JS_VALUE_GET_PTR(rope);
+    JSStringRopeIter it;
+    JSString *p, *p1;
+    JSValue ret;
+    uint32_t pos;
+
+    if (r->depth == 0) {
+        ret = JS_DupValue(ctx, r->left);
+        goto done;
+    }
+    p = js_alloc_string(ctx, r->len, r->is_wide_char);
+    if (!p) {
+        ret = JS_EXCEPTION;
+        goto done;
+    }
+    pos = 0;
+    string_rope_iter_init(&it, rope);
+    while ((p1 = string_rope_iter_next(&it)) != NULL) {
+        if (p->is_wide_char) {
+            copy_str16(p->u.str16 + pos, p1, 0, p1->len);
+        } else {
+            memcpy(p->u.str8 + pos, p1->u.str8, p1->len);
+        }
+        pos += p1->len;
+    }
+    if (!p->is_wide_char)
+        p->u.str8[pos] = '\0';
+    ret = JS_MKPTR(JS_TAG_STRING, p);
+    JS_FreeValue(ctx, r->left);
+    JS_FreeValue(ctx, r->right);
+    r->left = JS_DupValue(ctx, ret);
+    r->right = JS_AtomToString(ctx, JS_ATOM_empty_string);
+    r->depth = 0;
+ done:
+    JS_FreeValue(ctx, rope);
+    return ret;
+}
+
+/* 'val' is freed. Return a string value which is not a rope. */
+static inline JSValue js_linearize_string(JSContext *ctx, JSValue val)
+{
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+        return js_linearize_string_rope(ctx, val);
+    else
+        return val;
+}
+
+/* Return a string value which is not a rope and which is valid as long
+   as 'val' is, or JS_EXCEPTION. */
+static JSValueConst js_linearize_string_const(JSContext *ctx,
+                                              JSValueConst val)
+{
+    JSValue ret;
+
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING_ROPE)
+        return val;
+    ret = js_linearize_string_rope(ctx, JS_DupValue(ctx, val));
+    if (JS_IsException(ret))
+        return ret;
+    /* the linearized string is kept in the rope */
+    JS_FreeValue(ctx, ret);
+    return ((JSStringRope *)JS_VALUE_GET_PTR(val))->left;
+}
+
+/* linearize the ropes in '*pop1' and '*pop2'. Both values are freed
+   in case of exception. */
+static int js_linearize_string2(JSContext *ctx, JSValue *pop1, JSValue *pop2)
+{
+    *pop1 = js_linearize_string(ctx, *pop1);
+    if (JS_IsException(*pop1)) {
+        JS_FreeValue(ctx, *pop2);
+        return -1;
+    }
+    *pop2 = js_linearize_string(ctx, *pop2);
+    if (JS_IsException(*pop2)) {
+        JS_FreeValue(ctx, *pop1);
+        return -1;
+    }
+    return 0;
+}
+
+/* return < 0, 0 or > 0. op1 and op2 are strings or ropes. */
+static int js_string_rope_compare(JSValueConst op1, JSValueConst op2,
+                                  BOOL eq_only)
+{
+    JSStringRopeIter it1, it2;
+    JSString *p1, *p2;
+    uint32_t pos1, pos2, len1, len2, l;
+    int c1, c2, res;
+
+    len1 = js_string_value_len(op1);
+    len2 = js_string_value_len(op2);
+    if (eq_only && len1 != len2)
+        return 1;
+    string_rope_iter_init(&it1, op1);
+    string_rope_iter_init(&it2, op2);
+    p1 = string_rope_iter_next(&it1);
+    p2 = string_rope_iter_next(&it2);
+    pos1 = pos2 = 0;
+    while (p1 != NULL && p2 != NULL) {
+        l = min_uint32(p1->len - pos1, p2->len - pos2);
+        if (!p1->is_wide_char && !p2->is_wide_char) {
+            res = memcmp(p1->u.str8 + pos1, p2->u.str8 + pos2, l);
+            if (res != 0)
+                return res;
+        } else {
+            uint32_t i;
+            for(i = 0; i < l; i++) {
+                c1 = string_get(p1, pos1 + i);
+                c2 = string_get(p2, pos2 + i);
+                if (c1 != c2)
+                    return c1 - c2;
+            }
+        }
+        pos1 += l;
+        pos2 += l;
+        if (pos1 == p1->len) {
+            p1 = string_rope_iter_next(&it1);
+            pos1 = 0;
+        }
+        if (pos2 == p2->len) {
+            p2 = string_rope_iter_next(&it2);
+            pos2 = 0;
+        }
+    }
+    return (len1 > len2) - (len1 < len2);
+}
+
+/* same result as hash_string() on the linearized string */
+static uint32_t js_string_rope_hash(JSValueConst val, uint32_t h)
+{
+    JSStringRopeIter it;
+    JSString *p;
+
+    string_rope_iter_init(&it, val);
+    while ((p = string_rope_iter_next(&it)) != NULL)
+        h = hash_string(p, h);
+    return h;
+}
+
+/* 'left' and 'right' are freed. No rebalancing is done. */
+static JSValue js_new_string_rope(JSContext *ctx, JSValue left, JSValue right)
+{
+    JSStringRope *r;
+    uint32_t len;
+
+    len = js_string_value_len(left) + js_string_value_len(right);
+    if (len > JS_STRING_LEN_MAX) {
+        JS_ThrowInternalError(ctx, "string too long");
+        goto fail;
+    }
+    r = js_malloc(ctx, sizeof(*r));
+    if (!r)
+        goto fail;
+    r->header.ref_count = 1;
+    r->len = len;
+    r->is_wide_char = js_string_value_is_wide_char(left) |
+        js_string_value_is_wide_char(right);
+    r->depth = max_int(js_string_value_depth(left),
+                       js_string_value_depth(right)) + 1;
+    r->left = left;
+    r->right = right;
+    return JS_MKPTR(JS_TAG_STRING_ROPE, r);
+ fail:
+    JS_FreeValue(ctx, left);
+    JS_FreeValue(ctx, right);
+    return JS_EXCEPTION;
+}
+
+/* concatenation used when rebalancing: short strings are merged */
+static JSValue js_concat_string_tree(JSContext *ctx, JSValue left,
+                                     JSValue right)
+{
+    JSValue ret;
+
+    if (JS_VALUE_GET_TAG(left) == JS_TAG_STRING &&
+        JS_VALUE_GET_TAG(right) == JS_TAG_STRING &&
+        js_string_value_len(left) + js_string_value_len(right) <=
+        JS_STRING_ROPE_SHORT_LEN) {
+        ret = JS_ConcatString1(ctx, JS_VALUE_GET_STRING(left),
+                               JS_VALUE_GET_STRING(right));
+        JS_FreeValue(ctx, left);
+        JS_FreeValue(ctx, right);
+        return ret;
+    }
+    return js_new_string_rope(ctx, left, right);
+}
+
+/* Add the balanced tree 'val' at the right of the trees stored in
+   'tab'. 'tab[i]' is JS_NULL or contains a balanced tree whose length
+   is in [fib(i + 2), fib(i + 3)[. 'val' is freed. Algorithm from
+   "Ropes: an Alternative to Strings" by H. Boehm, R. Atkinson and
+   M. Plass. */
+static int js_rope_rebalance_insert(JSContext *ctx, JSValue *tab, JSValue val)
+{
+    JSValue acc;
+    uint32_t len;
+    int i;
+
+    len = js_string_value_len(val);
+    /* concatenate the shorter trees which are at the left of 'val' */
+    acc = JS_NULL;
+    for(i = 0; len >= js_rope_fib[i + 1]; i++) {
+        if (!JS_IsNull(tab[i])) {
+            if (JS_IsNull(acc))
+                acc = tab[i];
+            else
+                acc = js_concat_string_tree(ctx, tab[i], acc);
+            tab[i] = JS_NULL;
+            if (JS_IsException(acc))
+                goto fail;
+        }
+    }
+    if (!JS_IsNull(acc)) {
+        val = js_concat_string_tree(ctx, acc, val);
+        if (JS_IsException(val))
+            return -1;
+    }
+    for(;;) {
+        if (!JS_IsNull(tab[i])) {
+            val = js_concat_string_tree(ctx, tab[i], val);
+            tab[i] = JS_NULL;
+            if (JS_IsException(val))
+                return -1;
+        }
+        if (js_string_value_len(val) < js_rope_fib[i + 1] ||
+            i == JS_STRING_ROPE_SLOTS - 1)
+            break;
+        i++;
+    }
+    tab[i] = val;
+    return 0;
+ fail:
+    JS_FreeValue(ctx, val);
+    return -1;
+}
+
+static int js_rope_rebalance_rec(JSContext *ctx, JSValue *tab,
+                                 JSValueConst val)
+{
+    JSStringRope *r;
+
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING) {
+        if (JS_VALUE_GET_STRING(val)->len == 0)
+            return 0;
+    } else {
+        r = JS_VALUE_GET_PTR(val);
+        if (r->depth == 0)
+            return js_rope_rebalance_rec(ctx, tab, r->left);
+        if (r->depth >= JS_STRING_ROPE_SLOTS ||
+            r->len < js_rope_fib[r->depth]) {
+            if (js_rope_rebalance_rec(ctx, tab, r->left))
+                return -1;
+            return js_rope_rebalance_rec(ctx, tab, r->right);
+        }
+    }
+    return js_rope_rebalance_insert(ctx, tab, JS_DupValue(ctx, val));
+}
+
+/* 'rope' is freed */
+static JSValue js_rebalance_string_rope(JSContext *ctx, JSValue rope)
+{
+    JSValue tab[JS_STRING_ROPE_SLOTS], ret;
+    int i;
+
+    for(i = 0; i < JS_STRING_ROPE_SLOTS; i++)
+        tab[i] = JS_NULL;
+    if (js_rope_rebalance_rec(ctx, tab, rope))
+        goto fail;
+    ret = JS_NULL;
+    for(i = 0; i < JS_STRING_ROPE_SLOTS; i++) {
+        if (!JS_IsNull(tab[i])) {
+            if (JS_IsNull(ret))
+                ret = tab[i];
+            else
+                ret = js_concat_string_tree(ctx, tab[i], ret);
+            tab[i] = JS_NULL;
+            if (JS_IsException(ret))
+                goto fail;
+        }
+    }
+    JS_FreeValue(ctx, rope);
+    /* should not happen: linearize to keep the depth bounded */
+    if (js_string_value_depth(ret) > JS_STRING_ROPE_MAX_DEPTH)
+        ret = js_linearize_string_rope(ctx, ret);
+    return ret;
+ fail:
+    for(i = 0; i < JS_STRING_ROPE_SLOTS; i++)
+        JS_FreeValue(ctx, tab[i]);
+    JS_FreeValue(ctx, rope);
+    return JS_EXCEPTION;
+}
+
 /* op1 and op2 are converted to strings. For convience, op1 or op2 =
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
 {
     JSValue ret;
     JSString *p1, *p2;
+    JSStringRope *r;
+    uint32_t len1, len2;
 
-    if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_STRING)) {
+    if (unlikely(!js_is_string(op1))) {
         op1 = JS_ToStringFree(ctx, op1);
         if (JS_IsException(op1)) {
             JS_FreeValue(ctx, op2);
             return JS_EXCEPTION;
         }
     }
-    if (unlikely(JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)) {
+    if (unlikely(!js_is_string(op2))) {
         op2 = JS_ToStringFree(ctx, op2);
         if (JS_IsException(op2)) {
             JS_FreeValue(ctx, op1);
             return JS_EXCEPTION;
         }
     }
-    p1 = JS_VALUE_GET_STRING(op1);
-    p2 = JS_VALUE_GET_STRING(op2);
-
-    /* XXX: could also check if p1 is empty */
-    if (p2->len == 0) {
+    len1 = js_string_value_len(op1);
+    len2 = js_string_value_len(op2);
+    if (len2 == 0) {
         goto ret_op1;
     }
-    if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char
-    &&  js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
-        /* Concatenate in place in available space at the end of p1 */
-        if (p1->is_wide_char) {
-            memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
-            p1->len += p2->len;
-        } else {
-            memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
-            p1->len += p2->len;
-            p1->u.str8[p1->len] = '\0';
+    if (len1 == 0) {
+        JS_FreeValue(ctx, op1);
+        return op2;
+    }
+
+    if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
+        JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
+        p1 = JS_VALUE_GET_STRING(op1);
+        p2 = JS_VALUE_GET_STRING(op2);
+        if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char
+        &&  js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
+            /* Concatenate in place in available space at the end of p1 */
+            if (p1->is_wide_char) {
+                memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
+                p1->len += p2->len;
+            } else {
+                memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+                p1->len += p2->len;
+                p1->u.str8[p1->len] = '\0';
+            }
+        ret_op1:
+            JS_FreeValue(ctx, op2);
+            return op1;
+        }
+        if (len1 + len2 <= JS_STRING_ROPE_SHORT_LEN) {
+            ret = JS_ConcatString1(ctx, p1, p2);
+            goto done;
+        }
+    } else if (JS_VALUE_GET_TAG(op2) == JS_TAG_STRING &&
+               len2 < JS_STRING_ROPE_SHORT_LEN) {
+        /* append a short string: merge it with the right leaf */
+        r = JS_VALUE_GET_PTR(op1);
+        if (r->depth != 0 && JS_VALUE_GET_TAG(r->right) == JS_TAG_STRING &&
+            JS_VALUE_GET_STRING(r->right)->len + len2 <= JS_STRING_ROPE_SHORT_LEN) {
+            ret = JS_ConcatString1(ctx, JS_VALUE_GET_STRING(r->right),
+                                   JS_VALUE_GET_STRING(op2));
+            if (!JS_IsException(ret))
+                ret = js_new_string_rope(ctx, JS_DupValue(ctx, r->left), ret);
+            goto done;
+        }
+    } else if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
+               len1 < JS_STRING_ROPE_SHORT_LEN) {
+        /* prepend a short string: merge it with the left leaf */
+        r = JS_VALUE_GET_PTR(op2);
+        if (r->depth != 0 && JS_VALUE_GET_TAG(r->left) == JS_TAG_STRING &&
+            JS_VALUE_GET_STRING(r->left)->len + len1 <= JS_STRING_ROPE_SHORT_LEN) {
+            ret = JS_ConcatString1(ctx, JS_VALUE_GET_STRING(op1),
+                                   JS_VALUE_GET_STRING(r->left));
+            if (!JS_IsException(ret))
+                ret = js_new_string_rope(ctx, ret, JS_DupValue(ctx, r->right));
+            goto done;
         }
-    ret_op1:
-        JS_FreeValue(ctx, op2);
-        return op1;
     }
-    ret = JS_ConcatString1(ctx, p1, p2);
+    ret = js_new_string_rope(ctx, op1, op2);
+    if (JS_IsException(ret))
+        return ret;
+    if (js_string_value_depth(ret) > JS_STRING_ROPE_MAX_DEPTH)
+        ret = js_rebalance_string_rope(ctx, ret);
+    return ret;
+ done:
     JS_FreeValue(ctx, op1);
     JS_FreeValue(ctx, op2);
     return ret;
 }
 
+/* Append the short string 'op2' to '*pv' by modifying it if it is
+   not shared. Return FALSE if it is not possible. '*pv' is unchanged
+   in this case. */
+static BOOL js_concat_string_in_place(JSContext *ctx, JSValue *pv,
+                                      JSValueConst op2)
+{
+    JSStringRope *r;
+    JSString *p1, *p2, *p;
+    JSValue *pleaf;
+    uint32_t len;
+
+    if (JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)
+        return FALSE;
+    p2 = JS_VALUE_GET_STRING(op2);
+    r = NULL;
+    pleaf = pv;
+    if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING_ROPE) {
+        r = JS_VALUE_GET_PTR(*pv);
+        if (r->header.ref_count != 1 || r->depth == 0 ||
+            JS_VALUE_GET_TAG(r->right) != JS_TAG_STRING ||
+            r->len + p2->len > JS_STRING_LEN_MAX)
+            return FALSE;
+        pleaf = &r->right;
+    }
+    p1 = JS_VALUE_GET_STRING(*pleaf);
+    len = p1->len + p2->len;
+    if (p1->header.ref_count != 1 || p1->atom_type != 0 ||
+        p1->is_wide_char < p2->is_wide_char ||
+        len > JS_STRING_ROPE_SHORT_LEN)
+        return FALSE;
+    if (js_malloc_usable_size(ctx, p1) < sizeof(*p1) +
+        (len << p1->is_wide_char) + 1 - p1->is_wide_char) {
+        /* leave room for the next concatenations */
+        p = js_alloc_string_rt(ctx->rt, JS_STRING_ROPE_SHORT_LEN,
+                               p1->is_wide_char);
+        if (!p)
+            return FALSE;
+        if (p1->is_wide_char)
+            memcpy(p->u.str16, p1->u.str16, p1->len << 1);
+        else
+            memcpy(p->u.str8, p1->u.str8, p1->len);
+        p->len = p1->len;
+        js_free_string(ctx->rt, p1);
+        *pleaf = JS_MKPTR(JS_TAG_STRING, p);
+        p1 = p;
+    }
+    if (p1->is_wide_char) {
+        copy_str16(p1->u.str16 + p1->len, p2, 0, p2->len);
+    } else {
+        memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+        p1->u.str8[len] = '\0';
+    }
+    p1->len = len;
+    if (r) {
+        r->len += p2->len;
+    }
+    return TRUE;
+}
+
 /* Shape support */
 
 static inline size_t get_shape_size(size_t hash_size, size_t prop_size)
@@ -4332,6 +5371,51 @@ static void js_shape_hash_unlink(JSRuntime *rt, JSShape *sh)
     rt->shape_hash_count--;
 }
 
+/* called when the shape identifiers wrap around: all the shapes are
+   renumbered and the inline caches are reset */
+static no_inline void js_reset_shape_ids(JSRuntime *rt)
+{
+    struct list_head *lists[3], *el;
+    JSGCObjectHeader *gp;
+    JSFunctionBytecode *b;
+    uint32_t id;
+    int i;
+
+    lists[0] = &rt->gc_obj_list;
+    lists[1] = &rt->gc_young_list;
+    lists[2] = &rt->tmp_obj_list;
+    id = 0;
+    for(i = 0; i < countof(lists); i++) {
+        list_for_each(el, lists[i]) {
+            gp = list_entry(el, JSGCObjectHeader, link);
+            switch(gp->gc_obj_type) {
+            case JS_GC_OBJ_TYPE_SHAPE:
+                ((JSShape *)gp)->id = ++id;
+                break;
+            case JS_GC_OBJ_TYPE_FUNCTION_BYTECODE:
+                b = (JSFunctionBytecode *)gp;
+                if (b->ic)
+                    memset(b->ic, 0, sizeof(b->ic[0]) * b->ic_count);
+                if (b->global_ic)
+                    memset(b->global_ic, 0, sizeof(b->global_ic[0]) *
+                           (b->global_ic_mask + 1));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    rt->shape_last_id = id;
+}
+
+/* return a new shape identifier. 0 is never returned. */
+static inline uint32_t js_new_shape_id(JSRuntime *rt)
+{
+    if (unlikely(++rt->shape_last_id == 0))
+        js_reset_shape_ids(rt);
+    return ++rt->shape_last_id;
+}
+
 /* create a new empty shape with prototype 'proto' */
 static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
                                         int hash_size, int prop_size)
@@ -4360,6 +5444,7 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
     sh->prop_size = prop_size;
     sh->prop_count = 0;
     sh->deleted_prop_count = 0;
+    sh->id = js_new_shape_id(rt);
     
     /* insert in the hash table */
     sh->hash = shape_initial_hash(proto);
@@ -4396,6 +5481,7 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
     sh->header.ref_count = 1;
     add_gc_object(ctx->rt, &sh->header, JS_GC_OBJ_TYPE_SHAPE);
     sh->is_hashed = FALSE;
+    sh->id = js_new_shape_id(ctx->rt);
     if (sh->proto) {
         JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, sh->proto));
     }
@@ -4480,7 +5566,7 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
         /* copy all the fields and the properties */
         memcpy(sh, old_sh,
                sizeof(JSShape) + sizeof(sh->prop[0]) * old_sh->prop_count);
-        list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+        list_add_tail(&sh->header.link, get_gc_obj_list(ctx->rt, &sh->header));
         new_hash_mask = new_hash_size - 1;
         sh->prop_hash_mask = new_hash_mask;
         memset(prop_hash_end(sh) - new_hash_size, 0,
@@ -4500,11 +5586,11 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
                               get_shape_size(new_hash_size, new_size));
         if (unlikely(!sh_alloc)) {
             /* insert again in the GC list */
-            list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+            list_add_tail(&sh->header.link, get_gc_obj_list(ctx->rt, &sh->header));
             return -1;
         }
         sh = get_shape_from_alloc(sh_alloc, new_hash_size);
-        list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+        list_add_tail(&sh->header.link, get_gc_obj_list(ctx->rt, &sh->header));
     }
     *psh = sh;
     sh->prop_size = new_size;
@@ -4541,7 +5627,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
     list_del(&old_sh->header.link);
     memcpy(sh, old_sh, sizeof(JSShape));
-    list_add_tail(&sh->header.link, &ctx->rt->gc_obj_list);
+    list_add_tail(&sh->header.link, get_gc_obj_list(ctx->rt, &sh->header));
     
     memset(prop_hash_end(sh) - new_hash_size, 0,
            sizeof(prop_hash_end(sh)[0]) * new_hash_size);
@@ -4568,6 +5654,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
     sh->prop_size = new_size;
     sh->deleted_prop_count = 0;
     sh->prop_count = j;
+    sh->id = js_new_shape_id(ctx->rt);
 
     p->shape = sh;
     js_free(ctx, get_alloc_from_shape(old_sh));
@@ -4608,6 +5695,7 @@ static int add_shape_property(JSContext *ctx, JSShape **psh,
         sh->hash = new_shape_hash;
         js_shape_hash_link(rt, sh);
     }
+    sh->id = js_new_shape_id(rt);
     /* Initialize the new shape property.
        The object property at p->prop[sh->prop_count] is uninitialized */
     prop = get_shape_prop(sh);
@@ -4693,7 +5781,7 @@ static __maybe_unused void JS_DumpShape(JSRuntime *rt, int i, JSShape *sh)
 
 static __maybe_unused void JS_DumpShapes(JSRuntime *rt)
 {
-    int i;
+    int i, gen;
     JSShape *sh;
     struct list_head *el;
     JSObject *p;
@@ -4708,7 +5796,7 @@ static __maybe_unused void JS_DumpShapes(JSRuntime *rt)
         }
     }
     /* dump non-hashed shapes */
-    list_for_each(el, &rt->gc_obj_list) {
+    list_for_each_gc_obj(el, gen, rt) {
         gp = list_entry(el, JSGCObjectHeader, link);
         if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
             p = (JSObject *)gp;
@@ -4725,7 +5813,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     JSObject *p;
 
     js_trigger_gc(ctx->rt, sizeof(JSObject));
-    p = js_malloc(ctx, sizeof(JSObject));
+    p = js_pool_alloc(ctx, sizeof(JSObject));
     if (unlikely(!p))
         goto fail;
     p->class_id = class_id;
@@ -4742,7 +5830,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     p->shape = sh;
     p->prop = js_malloc(ctx, sizeof(JSProperty) * sh->prop_size);
     if (unlikely(!p->prop)) {
-        js_free(ctx, p);
+        js_pool_free_rt(ctx->rt, p, sizeof(JSObject));
     fail:
         js_free_shape(ctx->rt, sh);
         return JS_EXCEPTION;
@@ -4907,7 +5995,8 @@ static int JS_SetObjectData(JSContext *ctx, JSValueConst obj, JSValue val)
 
 JSValue JS_NewObjectClass(JSContext *ctx, int class_id)
 {
-    return JS_NewObjectProtoClass(ctx, ctx->class_proto[class_id], class_id);
+    return JS_NewObjectProtoClass(ctx, js_get_class_proto(ctx, class_id),
+                                  class_id);
 }
 
 JSValue JS_NewObjectProto(JSContext *ctx, JSValueConst proto)
@@ -5241,7 +6330,7 @@ static void free_var_ref(JSRuntime *rt, JSVarRef *var_ref)
             } else {
                 list_del(&var_ref->header.link); /* still on the stack */
             }
-            js_free_rt(rt, var_ref);
+            js_pool_free_rt(rt, var_ref, sizeof(JSVarRef));
         }
     }
 }
@@ -5435,7 +6524,7 @@ static void free_object(JSRuntime *rt, JSObject *p)
     if (rt->gc_phase == JS_GC_PHASE_REMOVE_CYCLES && p->header.ref_count != 0) {
         list_add_tail(&p->header.link, &rt->gc_zero_ref_count_list);
     } else {
-        js_free_rt(rt, p);
+        js_pool_free_rt(rt, p, sizeof(JSObject));
     }
 }
 
@@ -5501,6 +6590,9 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
             }
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        js_free_string_rope(rt, JS_VALUE_GET_PTR(v));
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_FUNCTION_BYTECODE:
         {
@@ -5511,6 +6603,12 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
                 if (rt->gc_phase == JS_GC_PHASE_NONE) {
                     free_zero_refcount(rt);
                 }
+            } else if (p->mark == 0) {
+                /* not part of the collected cycles: it can happen
+                   with an old object only referenced by young
+                   cycles. It is freed with the cycles. */
+                list_del(&p->link);
+                list_add_tail(&p->link, &rt->tmp_obj_list);
             }
         }
         break;
@@ -5557,8 +6655,9 @@ static void add_gc_object(JSRuntime *rt, JSGCObjectHeader *h,
                           JSGCObjectTypeEnum type)
 {
     h->mark = 0;
+    h->gc_old = FALSE;
     h->gc_obj_type = type;
-    list_add_tail(&h->link, &rt->gc_obj_list);
+    list_add_tail(&h->link, &rt->gc_young_list);
 }
 
 static void remove_gc_object(JSGCObjectHeader *h)
@@ -5675,8 +6774,35 @@ static void mark_children(JSRuntime *rt, JSGCObjectHeader *gp,
     }
 }
 
+/* return the list of the objects examined by the current collection */
+static inline struct list_head *gc_get_scan_list(JSRuntime *rt)
+{
+    return rt->gc_young_pass ? &rt->gc_young_list : &rt->gc_obj_list;
+}
+
+/* move the young generation to the old generation */
+static void gc_promote_young(JSRuntime *rt)
+{
+    struct list_head *el;
+    JSGCObjectHeader *p;
+    int64_t count;
+
+    count = 0;
+    list_for_each(el, &rt->gc_young_list) {
+        p = list_entry(el, JSGCObjectHeader, link);
+        p->gc_old = TRUE;
+        count++;
+    }
+    list_splice_tail(&rt->gc_young_list, &rt->gc_obj_list);
+    rt->gc_stats.promoted_count += count;
+}
+
 static void gc_decref_child(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    /* in a young collection, the references to old objects are
+       ignored: the old objects are considered as live */
+    if (rt->gc_young_pass && p->gc_old)
+        return;
     assert(p->ref_count > 0);
     p->ref_count--;
     if (p->ref_count == 0 && p->mark == 1) {
@@ -5695,9 +6821,10 @@ static void gc_decref(JSRuntime *rt)
     /* decrement the refcount of all the children of all the GC
        objects and move the GC objects with zero refcount to
        tmp_obj_list */
-    list_for_each_safe(el, el1, &rt->gc_obj_list) {
+    list_for_each_safe(el, el1, gc_get_scan_list(rt)) {
         p = list_entry(el, JSGCObjectHeader, link);
         assert(p->mark == 0);
+        rt->gc_stats.scanned_count++;
         mark_children(rt, p, gc_decref_child);
         p->mark = 1;
         if (p->ref_count == 0) {
@@ -5709,18 +6836,22 @@ static void gc_decref(JSRuntime *rt)
 
 static void gc_scan_incref_child(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    if (rt->gc_young_pass && p->gc_old)
+        return;
     p->ref_count++;
     if (p->ref_count == 1) {
         /* ref_count was 0: remove from tmp_obj_list and add at the
-           end of gc_obj_list */
+           end of the scanned list */
         list_del(&p->link);
-        list_add_tail(&p->link, &rt->gc_obj_list);
+        list_add_tail(&p->link, gc_get_scan_list(rt));
         p->mark = 0; /* reset the mark for the next GC call */
     }
 }
 
 static void gc_scan_incref_child2(JSRuntime *rt, JSGCObjectHeader *p)
 {
+    if (rt->gc_young_pass && p->gc_old)
+        return;
     p->ref_count++;
 }
 
@@ -5730,7 +6861,7 @@ static void gc_scan(JSRuntime *rt)
     JSGCObjectHeader *p;
 
     /* keep the objects with a refcount > 0 and their children. */
-    list_for_each(el, &rt->gc_obj_list) {
+    list_for_each(el, gc_get_scan_list(rt)) {
         p = list_entry(el, JSGCObjectHeader, link);
         assert(p->ref_count > 0);
         p->mark = 0; /* reset the mark for the next GC call */
@@ -5740,6 +6871,7 @@ static void gc_scan(JSRuntime *rt)
     /* restore the refcount of the objects to be deleted. */
     list_for_each(el, &rt->tmp_obj_list) {
         p = list_entry(el, JSGCObjectHeader, link);
+        rt->gc_stats.freed_count++;
         mark_children(rt, p, gc_scan_incref_child2);
     }
 }
@@ -5787,14 +6919,46 @@ static void gc_free_cycles(JSRuntime *rt)
         p = list_entry(el, JSGCObjectHeader, link);
         assert(p->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT ||
                p->gc_obj_type == JS_GC_OBJ_TYPE_FUNCTION_BYTECODE);
-        js_free_rt(rt, p);
+        if (p->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT)
+            js_pool_free_rt(rt, p, sizeof(JSObject));
+        else
+            js_free_rt(rt, p);
     }
 
     init_list_head(&rt->gc_zero_ref_count_list);
 }
 
-void JS_RunGC(JSRuntime *rt)
+static int64_t gc_get_time_us(void)
 {
+#if defined(_WIN32)
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + (ts.tv_nsec / 1000);
+#endif
+}
+
+/* Cycle collection. A young collection only examines the objects
+   allocated since the last collection: the references from the old
+   objects are not seen by gc_decref() so they act as external
+   references, hence no write barrier or remembered set is needed on
+   top of the reference counts. The surviving young objects are then
+   promoted to the old generation. A full collection examines all the
+   objects. */
+static void js_run_gc(JSRuntime *rt, BOOL full)
+{
+    JSGCStats *st = &rt->gc_stats;
+    int64_t t0, t;
+
+    t0 = gc_get_time_us();
+    if (full) {
+        gc_promote_young(rt);
+    }
+    rt->gc_young_pass = !full;
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5804,6 +6968,50 @@ void JS_RunGC(JSRuntime *rt)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    rt->gc_young_pass = FALSE;
+    /* the objects allocated by the finalizers are promoted too */
+    gc_promote_young(rt);
+
+    t = gc_get_time_us() - t0;
+    if (full) {
+        size_t size = rt->malloc_state.malloc_size;
+        size += size >> 1; /* same computation as malloc_gc_threshold */
+        st->full_gc_count++;
+        st->full_gc_time += t;
+        if (size > SIZE_MAX / JS_GC_FULL_GROWTH)
+            rt->malloc_gc_full_threshold = SIZE_MAX;
+        else
+            rt->malloc_gc_full_threshold = size * JS_GC_FULL_GROWTH;
+    } else {
+        st->young_gc_count++;
+        st->young_gc_time += t;
+    }
+    if (t > st->max_gc_time)
+        st->max_gc_time = t;
+#ifdef DUMP_GC
+    printf("GC: %s collection, %" PRId64 " us\n", full ? "full" : "young", t);
+#endif
+}
+
+void JS_RunGC(JSRuntime *rt)
+{
+    js_run_gc(rt, TRUE);
+}
+
+void JS_GetGCStats(JSRuntime *rt, JSGCStats *s)
+{
+    struct list_head *el;
+
+    *s = rt->gc_stats;
+    s->young_obj_count = 0;
+    list_for_each(el, &rt->gc_young_list) {
+        s->young_obj_count++;
+    }
+    s->old_obj_count = 0;
+    list_for_each(el, &rt->gc_obj_list) {
+        s->old_obj_count++;
+    }
 }
 
 /* Return false if not an object or if the object has already been
@@ -5862,9 +7070,20 @@ static void compute_bytecode_size(JSFunctionBytecode *b, JSMemoryUsage_helper *h
     if (b->closure_var) {
         js_func_size += b->closure_var_count * sizeof(*b->closure_var);
     }
+    if (b->ic) {
+        memory_used_count++;
+        js_func_size += b->ic_count * sizeof(*b->ic);
+    }
+    if (b->global_ic) {
+        memory_used_count++;
+        js_func_size += (b->global_ic_mask + 1) * sizeof(*b->global_ic);
+    }
     if (!b->read_only_bytecode && b->byte_code_buf) {
         hp->js_func_code_size += b->byte_code_len;
     }
+#ifdef CONFIG_JIT
+    hp->js_func_code_size += b->jit_code_size;
+#endif
     if (b->has_debug) {
         js_func_size += sizeof(*b) - offsetof(JSFunctionBytecode, debug);
         if (b->debug.source) {
@@ -5888,6 +7107,15 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
     case JS_TAG_STRING:
         compute_jsstring_size(JS_VALUE_GET_STRING(val), hp);
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_PTR(val);
+            /* the leaves are counted as strings */
+            hp->str_size += sizeof(*r) / (double)r->header.ref_count;
+            compute_value_size(r->left, hp);
+            compute_value_size(r->right, hp);
+        }
+        break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_INT:
     case JS_TAG_BIG_FLOAT:
@@ -5901,7 +7129,7 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
 {
     struct list_head *el, *el1;
-    int i;
+    int i, gen;
     JSMemoryUsage_helper mem = { 0 }, *hp = &mem;
 
     memset(s, 0, sizeof(*s));
@@ -5960,7 +7188,7 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
         }
     }
 
-    list_for_each(el, &rt->gc_obj_list) {
+    list_for_each_gc_obj(el, gen, rt) {
         JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
         JSObject *p;
         JSShape *sh;
@@ -6186,6 +7414,23 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     s->memory_used_size += s->atom_size + s->str_size +
         s->obj_size + s->prop_size + s->shape_size +
         s->js_func_size + s->js_func_code_size + s->js_func_pc2line_size;
+
+#ifdef CONFIG_POOL_ALLOC
+    for(i = 0; i < JS_POOL_CLASS_COUNT; i++) {
+        JSPool *pool = &rt->pools[i];
+        s->pool_count += pool->slab_count;
+        s->pool_used_size += (int64_t)pool->used_count * (i + 1) * JS_POOL_ALIGN;
+    }
+    s->pool_size = s->pool_count * JS_POOL_SLAB_SIZE;
+#endif
+
+    s->regexp_cache_count = rt->regexp_cache_count;
+    if (rt->regexp_cache_hash) {
+        s->regexp_cache_size = sizeof(rt->regexp_cache_hash[0]) *
+            JS_REGEXP_CACHE_HASH_SIZE + rt->regexp_cache_size;
+    }
+    s->regexp_cache_hits = rt->regexp_cache_hits;
+    s->regexp_cache_misses = rt->regexp_cache_misses;
 }
 
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
@@ -6227,9 +7472,9 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
         }
         {
             int obj_classes[JS_CLASS_INIT_COUNT + 1] = { 0 };
-            int class_id;
+            int class_id, gen;
             struct list_head *el;
-            list_for_each(el, &rt->gc_obj_list) {
+            list_for_each_gc_obj(el, gen, rt) {
                 JSGCObjectHeader *gp = list_entry(el, JSGCObjectHeader, link);
                 JSObject *p;
                 if (gp->gc_obj_type == JS_GC_OBJ_TYPE_JS_OBJECT) {
@@ -6315,6 +7560,16 @@ void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
         fprintf(fp, "%-20s %8"PRId64" %8"PRId64"\n",
                 "binary objects", s->binary_object_count, s->binary_object_size);
     }
+    if (s->pool_count) {
+        fprintf(fp, "%-20s %8"PRId64" %8"PRId64"  (%0.1f%% used)\n",
+                "object pools", s->pool_count, s->pool_size,
+                100.0 * s->pool_used_size / s->pool_size);
+    }
+    if (s->regexp_cache_hits + s->regexp_cache_misses) {
+        fprintf(fp, "%-20s %8"PRId64" %8"PRId64"  (%"PRId64" hits, %"PRId64" misses)\n",
+                "regexp cache", s->regexp_cache_count, s->regexp_cache_size,
+                s->regexp_cache_hits, s->regexp_cache_misses);
+    }
 }
 
 JSValue JS_GetGlobalObject(JSContext *ctx)
@@ -6338,6 +7593,12 @@ JSValue JS_GetException(JSContext *ctx)
     JSRuntime *rt = ctx->rt;
     val = rt->current_exception;
     rt->current_exception = JS_NULL;
+    val = js_linearize_string(ctx, val);
+    if (JS_IsException(val)) {
+        /* return the out of memory exception instead */
+        val = rt->current_exception;
+        rt->current_exception = JS_NULL;
+    }
     return val;
 }
 
@@ -6770,10 +8031,70 @@ static JSValue JS_ThrowTypeErrorInvalidClass(JSContext *ctx, int class_id)
     return JS_ThrowTypeErrorAtom(ctx, "%s object expected", name);
 }
 
+#define JS_PROFILE_MAX_SAMPLES 100000
+#define JS_PROFILE_MAX_DEPTH   64
+
+/* record the current call stack in rt->profile_samples, outermost
+   frame first */
+static void js_profile_sample(JSContext *ctx)
+{
+    JSRuntime *rt = ctx->rt;
+    DynBuf *dbuf = &rt->profile_samples;
+    JSStackFrame *sf, *frames[JS_PROFILE_MAX_DEPTH];
+    char buf[ATOM_GET_STR_BUF_SIZE];
+    const char *func_name_str;
+    JSObject *p;
+    int n, i, line_num;
+
+    if (rt->profile_sample_count >= JS_PROFILE_MAX_SAMPLES)
+        return;
+    n = 0;
+    for(sf = rt->current_stack_frame; sf != NULL && n < JS_PROFILE_MAX_DEPTH;
+        sf = sf->prev_frame) {
+        frames[n++] = sf;
+    }
+    if (n == 0)
+        return;
+    for(i = n - 1; i >= 0; i--) {
+        sf = frames[i];
+        if (i != n - 1)
+            dbuf_putc(dbuf, ';');
+        func_name_str = get_func_name(ctx, sf->cur_func);
+        if (!func_name_str || func_name_str[0] == '\0')
+            dbuf_putstr(dbuf, "<anonymous>");
+        else
+            dbuf_putstr(dbuf, func_name_str);
+        JS_FreeCString(ctx, func_name_str);
+
+        p = JS_VALUE_GET_OBJ(sf->cur_func);
+        if (js_class_has_bytecode(p->class_id)) {
+            JSFunctionBytecode *b = p->u.func.function_bytecode;
+            if (i == 0)
+                b->sample_count++;
+            if (b->has_debug) {
+                line_num = find_line_num(ctx, b,
+                                         sf->cur_pc - b->byte_code_buf - 1);
+                dbuf_printf(dbuf, " (%s",
+                            JS_AtomGetStrRT(rt, buf, sizeof(buf),
+                                            b->debug.filename));
+                if (line_num != -1)
+                    dbuf_printf(dbuf, ":%d", line_num);
+                dbuf_putc(dbuf, ')');
+            }
+        } else {
+            dbuf_putstr(dbuf, " (native)");
+        }
+    }
+    dbuf_putc(dbuf, '\0');
+    rt->profile_sample_count++;
+}
+
 static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
     ctx->interrupt_counter = JS_INTERRUPT_COUNTER_INIT;
+    if (unlikely(rt->profile_sampling))
+        js_profile_sample(ctx);
     if (rt->interrupt_handler) {
         if (rt->interrupt_handler(rt, rt->interrupt_opaque)) {
             /* XXX: should set a specific flag to avoid catching */
@@ -6794,6 +8115,168 @@ static inline __exception int js_poll_interrupts(JSContext *ctx)
     }
 }
 
+int JS_GetFunctionProfile(JSContext *ctx, JSValueConst func_obj,
+                          JSFunctionProfile *pr)
+{
+    JSObject *p;
+    JSFunctionBytecode *b;
+
+    if (JS_VALUE_GET_TAG(func_obj) != JS_TAG_OBJECT)
+        return -1;
+    p = JS_VALUE_GET_OBJ(func_obj);
+    if (!js_class_has_bytecode(p->class_id))
+        return -1;
+    b = p->u.func.function_bytecode;
+    pr->call_count = b->call_count;
+    pr->loop_count = b->loop_count;
+    pr->sample_count = b->sample_count;
+    return 0;
+}
+
+void JS_SetProfileSampling(JSRuntime *rt, BOOL enable)
+{
+    rt->profile_sampling = enable;
+}
+
+int JS_SetPerfMapFile(JSRuntime *rt, const char *filename)
+{
+#ifdef CONFIG_JIT
+    char buf[64];
+    FILE *f;
+
+    if (!filename) {
+        snprintf(buf, sizeof(buf), "/tmp/perf-%d.map", (int)getpid());
+        filename = buf;
+    }
+    f = fopen(filename, "a");
+    if (!f)
+        return -1;
+    if (rt->perf_map_file)
+        fclose(rt->perf_map_file);
+    rt->perf_map_file = f;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+static JSValue js_profile_function(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSValue obj;
+
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    JS_DefinePropertyValueStr(ctx, obj, "name",
+                              JS_AtomToString(ctx, b->func_name),
+                              JS_PROP_C_W_E);
+    if (b->has_debug) {
+        JS_DefinePropertyValueStr(ctx, obj, "fileName",
+                                  JS_AtomToString(ctx, b->debug.filename),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "lineNumber",
+                                  JS_NewInt32(ctx, b->debug.line_num),
+                                  JS_PROP_C_W_E);
+    }
+    JS_DefinePropertyValueStr(ctx, obj, "calls",
+                              JS_NewUint32(ctx, b->call_count),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "loops",
+                              JS_NewUint32(ctx, b->loop_count),
+                              JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "samples",
+                              JS_NewUint32(ctx, b->sample_count),
+                              JS_PROP_C_W_E);
+    return obj;
+}
+
+JSValue JS_GetProfile(JSContext *ctx, BOOL reset)
+{
+    JSRuntime *rt = ctx->rt;
+    struct list_head *el;
+    JSGCObjectHeader *gp;
+    JSFunctionBytecode *b, **tab;
+    int i, count, size, gen;
+    JSValue ret, functions, samples, val;
+    const char *ptr, *end;
+
+    /* the GC may run when creating the result, so the functions are
+       collected first */
+    tab = NULL;
+    count = 0;
+    size = 0;
+    list_for_each_gc_obj(el, gen, rt) {
+        gp = list_entry(el, JSGCObjectHeader, link);
+        if (gp->gc_obj_type != JS_GC_OBJ_TYPE_FUNCTION_BYTECODE)
+            continue;
+        b = (JSFunctionBytecode *)gp;
+        if (b->call_count == 0 && b->loop_count == 0 && b->sample_count == 0)
+            continue;
+        if (js_resize_array(ctx, (void **)&tab, sizeof(tab[0]), &size,
+                            count + 1)) {
+            for(i = 0; i < count; i++)
+                JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, tab[i]));
+            js_free(ctx, tab);
+            return JS_EXCEPTION;
+        }
+        tab[count++] = b;
+        JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    }
+
+    functions = JS_NewArray(ctx);
+    for(i = 0; i < count; i++) {
+        b = tab[i];
+        if (!JS_IsException(functions)) {
+            val = js_profile_function(ctx, b);
+            if (JS_DefinePropertyValueUint32(ctx, functions, i, val,
+                                             JS_PROP_C_W_E) < 0) {
+                JS_FreeValue(ctx, functions);
+                functions = JS_EXCEPTION;
+            }
+        }
+        if (reset) {
+            b->call_count = 0;
+            b->loop_count = 0;
+            b->sample_count = 0;
+        }
+        JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    }
+    js_free(ctx, tab);
+
+    if (JS_IsException(functions))
+        return JS_EXCEPTION;
+
+    samples = JS_NewArray(ctx);
+    if (JS_IsException(samples))
+        goto fail;
+    ptr = (const char *)rt->profile_samples.buf;
+    end = ptr + rt->profile_samples.size;
+    for(i = 0; ptr < end; i++) {
+        val = JS_NewString(ctx, ptr);
+        if (JS_DefinePropertyValueUint32(ctx, samples, i, val,
+                                         JS_PROP_C_W_E) < 0)
+            goto fail;
+        ptr += strlen(ptr) + 1;
+    }
+    if (reset) {
+        dbuf_free(&rt->profile_samples);
+        dbuf_init2(&rt->profile_samples, rt,
+                   (DynBufReallocFunc *)js_realloc_rt);
+        rt->profile_sample_count = 0;
+    }
+
+    ret = JS_NewObject(ctx);
+    if (JS_IsException(ret))
+        goto fail;
+    JS_DefinePropertyValueStr(ctx, ret, "functions", functions, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, ret, "samples", samples, JS_PROP_C_W_E);
+    return ret;
+ fail:
+    JS_FreeValue(ctx, functions);
+    JS_FreeValue(ctx, samples);
+    return JS_EXCEPTION;
+}
+
 /* return -1 (exception) or TRUE/FALSE */
 static int JS_SetPrototypeInternal(JSContext *ctx, JSValueConst obj,
                                    JSValueConst proto_val,
@@ -6880,10 +8363,10 @@ static JSValueConst JS_GetPrototypePrimitive(JSContext *ctx, JSValueConst val)
         val = ctx->class_proto[JS_CLASS_BIG_INT];
         break;
     case JS_TAG_BIG_FLOAT:
-        val = ctx->class_proto[JS_CLASS_BIG_FLOAT];
+        val = js_get_class_proto(ctx, JS_CLASS_BIG_FLOAT);
         break;
     case JS_TAG_BIG_DECIMAL:
-        val = ctx->class_proto[JS_CLASS_BIG_DECIMAL];
+        val = js_get_class_proto(ctx, JS_CLASS_BIG_DECIMAL);
         break;
 #endif
     case JS_TAG_INT:
@@ -6894,6 +8377,7 @@ static JSValueConst JS_GetPrototypePrimitive(JSContext *ctx, JSValueConst val)
         val = ctx->class_proto[JS_CLASS_BOOLEAN];
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = ctx->class_proto[JS_CLASS_STRING];
         break;
     case JS_TAG_SYMBOL:
@@ -7045,6 +8529,7 @@ static JSAutoInitFunc *js_autoinit_func_table[] = {
     js_instantiate_prototype, /* JS_AUTOINIT_ID_PROTOTYPE */
     js_module_ns_autoinit, /* JS_AUTOINIT_ID_MODULE_NS */
     JS_InstantiateFunctionListItem2, /* JS_AUTOINIT_ID_PROP */
+    NULL, /* JS_AUTOINIT_ID_INTRINSIC: see js_init_lazy_intrinsic() */
 };
 
 /* warning: 'prs' is reallocated after it */
@@ -7055,6 +8540,12 @@ static int JS_AutoInitProperty(JSContext *ctx, JSObject *p, JSAtom prop,
     JSContext *realm;
     JSAutoInitFunc *func;
 
+    if (js_autoinit_get_id(pr) == JS_AUTOINIT_ID_INTRINSIC) {
+        /* all the global properties of the intrinsic are defined */
+        return js_init_lazy_intrinsic(js_autoinit_get_realm(pr),
+                                      (uintptr_t)pr->u.init.opaque);
+    }
+
     if (js_shape_prepare_update(ctx, p, &prs))
         return -1;
 
@@ -7071,9 +8562,10 @@ static int JS_AutoInitProperty(JSContext *ctx, JSObject *p, JSAtom prop,
     return 0;
 }
 
-JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
-                               JSAtom prop, JSValueConst this_obj,
-                               BOOL throw_ref_error)
+/* same as JS_GetPropertyInternal() but the result may be a rope */
+static JSValue JS_GetPropertyInternal2(JSContext *ctx, JSValueConst obj,
+                                       JSAtom prop, JSValueConst this_obj,
+                                       BOOL throw_ref_error)
 {
     JSObject *p;
     JSProperty *pr;
@@ -7107,6 +8599,20 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
                 }
             }
             break;
+        case JS_TAG_STRING_ROPE:
+            if (__JS_AtomIsTaggedInt(prop)) {
+                JSValue str, ret;
+                str = js_linearize_string_rope(ctx, JS_DupValue(ctx, obj));
+                if (JS_IsException(str))
+                    return str;
+                ret = JS_GetPropertyInternal2(ctx, str, prop, this_obj,
+                                             throw_ref_error);
+                JS_FreeValue(ctx, str);
+                return ret;
+            } else if (prop == JS_ATOM_length) {
+                return JS_NewInt32(ctx, js_string_value_len(obj));
+            }
+            break;
         default:
             break;
         }
@@ -7217,6 +8723,15 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
     }
 }
 
+JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
+                               JSAtom prop, JSValueConst this_obj,
+                               BOOL throw_ref_error)
+{
+    return js_linearize_string(ctx, JS_GetPropertyInternal2(ctx, obj, prop,
+                                                            this_obj,
+                                                            throw_ref_error));
+}
+
 static JSValue JS_ThrowTypeErrorPrivateNotFound(JSContext *ctx, JSAtom atom)
 {
     return JS_ThrowTypeErrorAtom(ctx, "private class field '%s' does not exist",
@@ -7731,11 +9246,22 @@ retry:
 int JS_GetOwnProperty(JSContext *ctx, JSPropertyDescriptor *desc,
                       JSValueConst obj, JSAtom prop)
 {
+    int ret;
+
     if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT) {
         JS_ThrowTypeErrorNotAnObject(ctx);
         return -1;
     }
-    return JS_GetOwnPropertyInternal(ctx, desc, JS_VALUE_GET_OBJ(obj), prop);
+    ret = JS_GetOwnPropertyInternal(ctx, desc, JS_VALUE_GET_OBJ(obj), prop);
+    if (ret > 0 && desc) {
+        desc->value = js_linearize_string(ctx, desc->value);
+        if (JS_IsException(desc->value)) {
+            desc->value = JS_UNDEFINED;
+            js_free_desc(ctx, desc);
+            return -1;
+        }
+    }
+    return ret;
 }
 
 /* return -1 if exception (Proxy object only) or TRUE/FALSE */
@@ -7895,7 +9421,7 @@ static JSValue JS_GetPropertyValue(JSContext *ctx, JSValueConst this_obj,
         JS_FreeValue(ctx, prop);
         if (unlikely(atom == JS_ATOM_NULL))
             return JS_EXCEPTION;
-        ret = JS_GetProperty(ctx, this_obj, atom);
+        ret = JS_GetPropertyInternal2(ctx, this_obj, atom, this_obj, FALSE);
         JS_FreeAtom(ctx, atom);
         return ret;
     }
@@ -7904,7 +9430,8 @@ static JSValue JS_GetPropertyValue(JSContext *ctx, JSValueConst this_obj,
 JSValue JS_GetPropertyUint32(JSContext *ctx, JSValueConst this_obj,
                              uint32_t idx)
 {
-    return JS_GetPropertyValue(ctx, this_obj, JS_NewUint32(ctx, idx));
+    return js_linearize_string(ctx, JS_GetPropertyValue(ctx, this_obj,
+                                                        JS_NewUint32(ctx, idx)));
 }
 
 /* Check if an object has a generalized numeric property. Return value:
@@ -8309,6 +9836,19 @@ static void js_free_desc(JSContext *ctx, JSPropertyDescriptor *desc)
     JS_FreeValue(ctx, desc->value);
 }
 
+/* the value given to the set_property exotic method is not a rope */
+static int js_exotic_set_property(JSContext *ctx,
+                                  const JSClassExoticMethods *em,
+                                  JSValueConst obj, JSAtom prop,
+                                  JSValueConst val, JSValueConst this_obj,
+                                  int flags)
+{
+    val = js_linearize_string_const(ctx, val);
+    if (JS_IsException(val))
+        return -1;
+    return em->set_property(ctx, obj, prop, val, this_obj, flags);
+}
+
 /* generic (and slower) version of JS_SetProperty() for
  * Reflect.set(). 'obj' must be an object.  */
 static int JS_SetPropertyGeneric(JSContext *ctx,
@@ -8327,8 +9867,8 @@ static int JS_SetPropertyGeneric(JSContext *ctx,
         if (p->is_exotic) {
             const JSClassExoticMethods *em = ctx->rt->class_array[p->class_id].exotic;
             if (em && em->set_property) {
-                ret = em->set_property(ctx, obj1, prop,
-                                       val, this_obj, flags);
+                ret = js_exotic_set_property(ctx, em, obj1, prop,
+                                             val, this_obj, flags);
                 JS_FreeValue(ctx, obj1);
                 JS_FreeValue(ctx, val);
                 return ret;
@@ -8523,8 +10063,8 @@ retry:
                     if (em->set_property) {
                         /* set_property can free the prototype */
                         obj1 = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p1));
-                        ret = em->set_property(ctx, obj1, prop,
-                                               val, this_obj, flags);
+                        ret = js_exotic_set_property(ctx, em, obj1, prop,
+                                                     val, this_obj, flags);
                         JS_FreeValue(ctx, obj1);
                         JS_FreeValue(ctx, val);
                         return ret;
@@ -8641,6 +10181,127 @@ retry:
     return TRUE;
 }
 
+/* Inline caches of OP_get_field, OP_get_field2 and OP_put_field. A
+   cache entry is valid as long as the shape identifier of the object
+   (and of its prototype for inherited properties) is unchanged. */
+
+/* return the cached property of 'p' or NULL if not found */
+static inline JSProperty *js_ic_find(JSInlineCache *ic, JSObject *p)
+{
+    JSShape *sh = p->shape;
+    JSInlineCacheEntry *e;
+    JSObject *proto;
+    int i;
+
+    for(i = 0; i < JS_IC_ENTRY_COUNT; i++) {
+        e = &ic->entries[i];
+        if (e->shape_id == sh->id) {
+            if (likely(e->proto_shape_id == 0))
+                return &p->prop[e->prop_idx];
+            proto = sh->proto;
+            /* exotic objects other than arrays may define the
+               property without adding it to their shape */
+            if (proto->shape->id == e->proto_shape_id &&
+                (!p->is_exotic || p->class_id == JS_CLASS_ARRAY))
+                return &proto->prop[e->prop_idx];
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void js_ic_add(JSInlineCache *ic, uint32_t shape_id,
+                      uint32_t proto_shape_id, uint32_t prop_idx)
+{
+    JSInlineCacheEntry *e;
+    int i;
+
+    for(i = 0; i < JS_IC_ENTRY_COUNT - 1; i++) {
+        if (ic->entries[i].shape_id == shape_id)
+            break;
+    }
+    /* the most recent entry comes first */
+    memmove(&ic->entries[1], &ic->entries[0], sizeof(ic->entries[0]) * i);
+    e = &ic->entries[0];
+    e->shape_id = shape_id;
+    e->proto_shape_id = proto_shape_id;
+    e->prop_idx = prop_idx;
+}
+
+/* return NULL if no inline cache can be used */
+static JSInlineCache *js_get_ic(JSRuntime *rt, JSFunctionBytecode *b,
+                                int ic_idx)
+{
+    if (unlikely(!b->ic)) {
+        b->ic = js_mallocz_rt(rt, sizeof(b->ic[0]) * b->ic_count);
+        if (!b->ic)
+            return NULL;
+    }
+    if (ic_idx == JS_IC_NONE)
+        return NULL;
+    return &b->ic[ic_idx];
+}
+
+/* slow path of OP_get_field and OP_get_field2 */
+static JSValue js_get_field_ic(JSContext *ctx, JSValueConst obj, JSAtom prop,
+                               JSFunctionBytecode *b, int ic_idx)
+{
+    JSObject *p, *p1;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSInlineCache *ic;
+
+    if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+        goto slow_path;
+    ic = js_get_ic(ctx->rt, b, ic_idx);
+    if (!ic)
+        goto slow_path;
+    p = JS_VALUE_GET_OBJ(obj);
+    prs = find_own_property(&pr, p, prop);
+    if (prs) {
+        if ((prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL) {
+            js_ic_add(ic, p->shape->id, 0, pr - p->prop);
+            return JS_DupValue(ctx, pr->u.value);
+        }
+    } else if ((!p->is_exotic || p->class_id == JS_CLASS_ARRAY) &&
+               !__JS_AtomIsTaggedInt(prop)) {
+        p1 = p->shape->proto;
+        if (p1) {
+            prs = find_own_property(&pr, p1, prop);
+            if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL) {
+                js_ic_add(ic, p->shape->id, p1->shape->id, pr - p1->prop);
+                return JS_DupValue(ctx, pr->u.value);
+            }
+        }
+    }
+ slow_path:
+    return JS_GetPropertyInternal2(ctx, obj, prop, obj, FALSE);
+}
+
+/* slow path of OP_put_field. Only the writable own data properties
+   are cached. */
+static int js_put_field_ic(JSContext *ctx, JSValueConst obj, JSAtom prop,
+                           JSValue val, JSFunctionBytecode *b, int ic_idx)
+{
+    JSObject *p;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSInlineCache *ic;
+
+    if (JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT &&
+        (ic = js_get_ic(ctx->rt, b, ic_idx)) != NULL) {
+        p = JS_VALUE_GET_OBJ(obj);
+        prs = find_own_property(&pr, p, prop);
+        if (prs && (prs->flags & (JS_PROP_TMASK | JS_PROP_WRITABLE |
+                                  JS_PROP_LENGTH)) == JS_PROP_WRITABLE) {
+            js_ic_add(ic, p->shape->id, 0, pr - p->prop);
+            set_value(ctx, &pr->u.value, val);
+            return TRUE;
+        }
+    }
+    return JS_SetPropertyInternal(ctx, obj, prop, val, JS_PROP_THROW_STRICT);
+}
+
 /* flags can be JS_PROP_THROW or JS_PROP_THROW_STRICT */
 static int JS_SetPropertyValue(JSContext *ctx, JSValueConst this_obj,
                                JSValue prop, JSValue val, int flags)
@@ -8888,6 +10549,9 @@ static int JS_CreateProperty(JSContext *ctx, JSObject *p,
             const JSClassExoticMethods *em = ctx->rt->class_array[p->class_id].exotic;
             if (em) {
                 if (em->define_own_property) {
+                    val = js_linearize_string_const(ctx, val);
+                    if (JS_IsException(val))
+                        return -1;
                     return em->define_own_property(ctx, JS_MKPTR(JS_TAG_OBJECT, p),
                                                    prop, val, getter, setter, flags);
                 }
@@ -8990,7 +10654,10 @@ static int js_shape_prepare_update(JSContext *ctx, JSObject *p,
         } else {
             js_shape_hash_unlink(ctx->rt, sh);
             sh->is_hashed = FALSE;
+            sh->id = js_new_shape_id(ctx->rt);
         }
+    } else {
+        sh->id = js_new_shape_id(ctx->rt);
     }
     return 0;
 }
@@ -9563,8 +11230,8 @@ static JSValue JS_GetGlobalVar(JSContext *ctx, JSAtom prop,
             return JS_ThrowReferenceErrorUninitialized(ctx, prs->atom);
         return JS_DupValue(ctx, pr->u.value);
     }
-    return JS_GetPropertyInternal(ctx, ctx->global_obj, prop,
-                                 ctx->global_obj, throw_ref_error);
+    return JS_GetPropertyInternal2(ctx, ctx->global_obj, prop,
+                                   ctx->global_obj, throw_ref_error);
 }
 
 /* construct a reference to a global variable */
@@ -9661,6 +11328,119 @@ static int JS_SetGlobalVar(JSContext *ctx, JSAtom prop, JSValue val,
     return JS_SetPropertyInternal(ctx, ctx->global_obj, prop, val, flags);
 }
 
+/* return the cached global variable 'prop' or NULL if not found. The
+   variable must be writable if 'is_put' is true. */
+static inline JSProperty *js_global_ic_find(JSContext *ctx,
+                                            JSFunctionBytecode *b,
+                                            JSAtom prop, BOOL is_put)
+{
+    JSGlobalCacheEntry *e;
+    JSObject *p;
+    JSProperty *pr;
+
+    if (unlikely(!b->global_ic))
+        return NULL;
+    e = &b->global_ic[prop & b->global_ic_mask];
+    p = JS_VALUE_GET_OBJ(ctx->global_var_obj);
+    if (e->atom != prop || e->var_shape_id != p->shape->id)
+        return NULL;
+    if (is_put && !e->is_writable)
+        return NULL;
+    if (e->global_shape_id == 0) {
+        pr = &p->prop[e->prop_idx];
+        /* the lexical variable may not be initialized yet */
+        if (unlikely(JS_IsUninitialized(pr->u.value)))
+            return NULL;
+    } else {
+        p = JS_VALUE_GET_OBJ(ctx->global_obj);
+        if (e->global_shape_id != p->shape->id)
+            return NULL;
+        pr = &p->prop[e->prop_idx];
+    }
+    return pr;
+}
+
+/* return the cache entry of 'prop'. The cache is enlarged in case of
+   collision. Return NULL if not enough memory. */
+static JSGlobalCacheEntry *js_get_global_ic(JSRuntime *rt,
+                                            JSFunctionBytecode *b,
+                                            JSAtom prop)
+{
+    JSGlobalCacheEntry *e, *tab;
+    uint32_t i, size, mask;
+
+    if (b->global_ic) {
+        e = &b->global_ic[prop & b->global_ic_mask];
+        if (e->atom == JS_ATOM_NULL || e->atom == prop ||
+            b->global_ic_mask == JS_GLOBAL_IC_SIZE_MAX - 1)
+            return e;
+        size = (b->global_ic_mask + 1) * 2;
+    } else {
+        size = JS_GLOBAL_IC_SIZE_INIT;
+    }
+    tab = js_mallocz_rt(rt, sizeof(tab[0]) * size);
+    if (!tab)
+        return NULL;
+    mask = size - 1;
+    if (b->global_ic) {
+        for(i = 0; i <= b->global_ic_mask; i++) {
+            e = &b->global_ic[i];
+            if (e->atom != JS_ATOM_NULL)
+                tab[e->atom & mask] = *e;
+        }
+        js_free_rt(rt, b->global_ic);
+    }
+    b->global_ic = tab;
+    b->global_ic_mask = mask;
+    return &tab[prop & mask];
+}
+
+/* update the global variable cache of 'b' with the current location
+   of the global variable 'prop'. Return the variable if it can be
+   accessed directly (same conditions as js_global_ic_find()) so that
+   the caller does not need to look it up again, otherwise NULL. */
+static JSProperty *js_global_ic_update(JSContext *ctx, JSFunctionBytecode *b,
+                                       JSAtom prop, BOOL is_put)
+{
+    JSObject *p, *p1;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSGlobalCacheEntry *e;
+    uint32_t global_shape_id;
+    BOOL is_writable;
+
+    p = JS_VALUE_GET_OBJ(ctx->global_var_obj);
+    prs = find_own_property(&pr, p, prop);
+    if (prs) {
+        p1 = p;
+        global_shape_id = 0;
+    } else {
+        p1 = JS_VALUE_GET_OBJ(ctx->global_obj);
+        prs = find_own_property(&pr, p1, prop);
+        if (!prs)
+            return NULL;
+        global_shape_id = p1->shape->id;
+    }
+    if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
+        return NULL;
+    is_writable = ((prs->flags & (JS_PROP_WRITABLE | JS_PROP_LENGTH)) ==
+                   JS_PROP_WRITABLE);
+    e = js_get_global_ic(ctx->rt, b, prop);
+    if (e) {
+        e->atom = prop;
+        e->var_shape_id = p->shape->id;
+        e->global_shape_id = global_shape_id;
+        e->prop_idx = pr - p1->prop;
+        e->is_writable = is_writable;
+    }
+    if (is_put && !is_writable)
+        return NULL;
+    /* the lexical variable may not be initialized yet */
+    if (global_shape_id == 0 && unlikely(JS_IsUninitialized(pr->u.value)))
+        return NULL;
+    return pr;
+}
+
 /* return -1, FALSE or TRUE. return FALSE if not configurable or
    invalid object. return -1 in case of exception.
    flags can be 0, JS_PROP_THROW or JS_PROP_THROW_STRICT */
@@ -9935,6 +11715,9 @@ static int JS_ToBoolFree(JSContext *ctx, JSValue val)
             JS_FreeValue(ctx, val);
             return ret;
         }
+    case JS_TAG_STRING_ROPE:
+        JS_FreeValue(ctx, val);
+        return TRUE; /* a rope is never empty */
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_INT:
     case JS_TAG_BIG_FLOAT:
@@ -10456,6 +12239,7 @@ static JSValue JS_ToNumberHintFree(JSContext *ctx, JSValue val,
             return JS_EXCEPTION;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str;
             const char *p;
@@ -11549,6 +13333,8 @@ JSValue JS_ToStringInternal(JSContext *ctx, JSValueConst val, BOOL is_ToProperty
     switch(tag) {
     case JS_TAG_STRING:
         return JS_DupValue(ctx, val);
+    case JS_TAG_STRING_ROPE:
+        return js_linearize_string_rope(ctx, JS_DupValue(ctx, val));
     case JS_TAG_INT:
         snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(val));
         str = buf;
@@ -11917,6 +13703,12 @@ static __maybe_unused void JS_DumpValueShort(JSRuntime *rt,
             JS_DumpString(rt, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSStringRope *r = JS_VALUE_GET_PTR(val);
+            printf("[rope len=%d depth=%d]", r->len, r->depth);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         {
             JSFunctionBytecode *b = JS_VALUE_GET_PTR(val);
@@ -12192,6 +13984,7 @@ static bf_t *JS_ToBigIntFree(JSContext *ctx, bf_t *buf, JSValue val)
         JS_FreeValue(ctx, val);
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         if (JS_IsException(val))
             return NULL;
@@ -13476,10 +15269,10 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         /* try to call an overloaded operator */
         if ((tag1 == JS_TAG_OBJECT &&
              (tag2 != JS_TAG_NULL && tag2 != JS_TAG_UNDEFINED &&
-              tag2 != JS_TAG_STRING)) ||
+              !tag_is_string(tag2))) ||
             (tag2 == JS_TAG_OBJECT &&
              (tag1 != JS_TAG_NULL && tag1 != JS_TAG_UNDEFINED &&
-              tag1 != JS_TAG_STRING))) {
+              !tag_is_string(tag1)))) {
             ret = js_call_binary_op_fallback(ctx, &res, op1, op2, OP_add,
                                              FALSE, HINT_NONE);
             if (ret != 0) {
@@ -13509,7 +15302,7 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         tag2 = JS_VALUE_GET_NORM_TAG(op2);
     }
 
-    if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+    if (tag_is_string(tag1) || tag_is_string(tag2)) {
         sp[-2] = JS_ConcatString(ctx, op1, op2);
         if (JS_IsException(sp[-2]))
             goto exception;
@@ -13792,6 +15585,8 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
         JS_FreeValue(ctx, op1);
         goto exception;
     }
+    if (js_linearize_string2(ctx, &op1, &op2))
+        goto exception;
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
 
@@ -13926,6 +15721,8 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
     op1 = sp[-2];
     op2 = sp[-1];
  redo:
+    if (js_linearize_string2(ctx, &op1, &op2))
+        goto exception;
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
     if (tag_is_number(tag1) && tag_is_number(tag2)) {
@@ -14308,7 +16105,7 @@ static no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
         }
         tag1 = JS_VALUE_GET_TAG(op1);
         tag2 = JS_VALUE_GET_TAG(op2);
-        if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+        if (tag_is_string(tag1) || tag_is_string(tag2)) {
             sp[-2] = JS_ConcatString(ctx, op1, op2);
             if (JS_IsException(sp[-2]))
                 goto exception;
@@ -14403,6 +16200,8 @@ static no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
         JS_FreeValue(ctx, op1);
         goto exception;
     }
+    if (js_linearize_string2(ctx, &op1, &op2))
+        goto exception;
     if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
         JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
         JSString *p1, *p2;
@@ -14468,6 +16267,8 @@ static no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
     op1 = sp[-2];
     op2 = sp[-1];
  redo:
+    if (js_linearize_string2(ctx, &op1, &op2))
+        goto exception;
     tag1 = JS_VALUE_GET_NORM_TAG(op1);
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
     if (tag1 == tag2 ||
@@ -14583,15 +16384,23 @@ static BOOL js_strict_eq2(JSContext *ctx, JSValue op1, JSValue op2,
     case JS_TAG_STRING:
         {
             JSString *p1, *p2;
-            if (tag1 != tag2) {
-                res = FALSE;
-            } else {
+            if (tag1 == tag2) {
                 p1 = JS_VALUE_GET_STRING(op1);
                 p2 = JS_VALUE_GET_STRING(op2);
                 res = (js_string_compare(ctx, p1, p2) == 0);
+            } else if (tag2 == JS_TAG_STRING_ROPE) {
+                res = (js_string_rope_compare(op1, op2, TRUE) == 0);
+            } else {
+                res = FALSE;
             }
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        if (tag_is_string(tag2))
+            res = (js_string_rope_compare(op1, op2, TRUE) == 0);
+        else
+            res = FALSE;
+        break;
     case JS_TAG_SYMBOL:
         {
             JSAtomStruct *p1, *p2;
@@ -14833,6 +16642,7 @@ static __exception int js_operator_typeof(JSContext *ctx, JSValueConst op1)
         atom = JS_ATOM_boolean;
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         atom = JS_ATOM_string;
         break;
     case JS_TAG_OBJECT:
@@ -15729,7 +17539,7 @@ static JSVarRef *get_var_ref(JSContext *ctx, JSStackFrame *sf,
         }
     }
     /* create a new one */
-    var_ref = js_malloc(ctx, sizeof(JSVarRef));
+    var_ref = js_pool_alloc(ctx, sizeof(JSVarRef));
     if (!var_ref)
         return NULL;
     var_ref->header.ref_count = 1;
@@ -16179,6 +17989,37 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
     }
 }
 
+/* call the function 'func_obj' which is not a bytecode function. The
+   ropes given to the C code are linearized. */
+static JSValue js_call_class_func(JSContext *ctx, JSClassCall *call_func,
+                                  JSValueConst func_obj, JSValueConst this_obj,
+                                  int argc, JSValueConst *argv, int flags)
+{
+    JSValueConst *arg_buf;
+    int i;
+
+    for(i = 0; i < argc; i++) {
+        if (JS_VALUE_GET_TAG(argv[i]) == JS_TAG_STRING_ROPE)
+            break;
+    }
+    if (likely(i == argc &&
+               JS_VALUE_GET_TAG(this_obj) != JS_TAG_STRING_ROPE))
+        return call_func(ctx, func_obj, this_obj, argc, argv, flags);
+
+    if (js_check_stack_overflow(ctx->rt, sizeof(arg_buf[0]) * argc))
+        return JS_ThrowStackOverflow(ctx);
+    arg_buf = alloca(sizeof(arg_buf[0]) * argc);
+    for(i = 0; i < argc; i++) {
+        arg_buf[i] = js_linearize_string_const(ctx, argv[i]);
+        if (JS_IsException(arg_buf[i]))
+            return JS_EXCEPTION;
+    }
+    this_obj = js_linearize_string_const(ctx, this_obj);
+    if (JS_IsException(this_obj))
+        return JS_EXCEPTION;
+    return call_func(ctx, func_obj, this_obj, argc, arg_buf, flags);
+}
+
 /* argument of OP_special_object */
 typedef enum {
     OP_SPECIAL_OBJECT_ARGUMENTS,
@@ -16194,6 +18035,180 @@ typedef enum {
 #define FUNC_RET_YIELD      1
 #define FUNC_RET_YIELD_STAR 2
 
+/* The following opcode helpers are shared by JS_CallInternal() and
+   the JIT. */
+
+static JSValue js_op_push_this(JSContext *ctx, JSFunctionBytecode *b,
+                               JSValueConst this_obj)
+{
+    if (!(b->js_mode & JS_MODE_STRICT)) {
+        uint32_t tag = JS_VALUE_GET_TAG(this_obj);
+        if (likely(tag == JS_TAG_OBJECT))
+            return JS_DupValue(ctx, this_obj);
+        if (tag == JS_TAG_NULL || tag == JS_TAG_UNDEFINED)
+            return JS_DupValue(ctx, ctx->global_obj);
+        return JS_ToObject(ctx, this_obj);
+    }
+    return JS_DupValue(ctx, this_obj);
+}
+
+/* get_var, get_var_undef */
+static force_inline JSValue js_op_get_var(JSContext *ctx,
+                                          JSFunctionBytecode *b,
+                                          JSAtom atom, BOOL throw_ref_error)
+{
+    JSProperty *pr;
+
+    pr = js_global_ic_find(ctx, b, atom, FALSE);
+    if (unlikely(!pr)) {
+        pr = js_global_ic_update(ctx, b, atom, FALSE);
+        if (!pr)
+            return JS_GetGlobalVar(ctx, atom, throw_ref_error);
+    }
+    return JS_DupValue(ctx, pr->u.value);
+}
+
+/* put_var, put_var_init. 'val' is freed. */
+static force_inline int js_op_put_var(JSContext *ctx, JSFunctionBytecode *b,
+                                      JSAtom atom, JSValue val, int opcode)
+{
+    JSProperty *pr;
+
+    if (opcode == OP_put_var) {
+        pr = js_global_ic_find(ctx, b, atom, TRUE);
+        if (unlikely(!pr))
+            pr = js_global_ic_update(ctx, b, atom, TRUE);
+        if (likely(pr)) {
+            set_value(ctx, &pr->u.value, val);
+            return 0;
+        }
+    }
+    return JS_SetGlobalVar(ctx, atom, val, opcode - OP_put_var);
+}
+
+static force_inline JSValue js_op_get_field(JSContext *ctx,
+                                            JSFunctionBytecode *b,
+                                            JSValueConst obj, JSAtom atom,
+                                            int ic_idx)
+{
+    JSProperty *pr;
+
+    if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT && b->ic) &&
+        (pr = js_ic_find(&b->ic[ic_idx], JS_VALUE_GET_OBJ(obj))))
+        return JS_DupValue(ctx, pr->u.value);
+    return js_get_field_ic(ctx, obj, atom, b, ic_idx);
+}
+
+/* 'val' is freed */
+static force_inline int js_op_put_field(JSContext *ctx, JSFunctionBytecode *b,
+                                        JSValueConst obj, JSAtom atom,
+                                        JSValue val, int ic_idx)
+{
+    JSProperty *pr;
+
+    if (likely(JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT && b->ic) &&
+        (pr = js_ic_find(&b->ic[ic_idx], JS_VALUE_GET_OBJ(obj)))) {
+        set_value(ctx, &pr->u.value, val);
+        return TRUE;
+    }
+    return js_put_field_ic(ctx, obj, atom, val, b, ic_idx);
+}
+
+/* build an array from the 'argc' values of 'argv'. The values are
+   replaced by JS_UNDEFINED. */
+static JSValue js_op_array_from(JSContext *ctx, JSValue *argv, int argc)
+{
+    JSValue obj;
+    int i, ret;
+
+    obj = JS_NewArray(ctx);
+    if (unlikely(JS_IsException(obj)))
+        return obj;
+    for(i = 0; i < argc; i++) {
+        ret = JS_DefinePropertyValue(ctx, obj, __JS_AtomFromUInt32(i), argv[i],
+                                     JS_PROP_C_W_E | JS_PROP_THROW);
+        argv[i] = JS_UNDEFINED;
+        if (ret < 0) {
+            JS_FreeValue(ctx, obj);
+            return JS_EXCEPTION;
+        }
+    }
+    return obj;
+}
+
+/* to_propkey, to_propkey2: convert sp[-1] in place */
+static force_inline int js_op_to_propkey(JSContext *ctx, JSValue *sp,
+                                         int opcode)
+{
+    JSValue val;
+
+    /* must be tested first */
+    if (opcode == OP_to_propkey2 &&
+        unlikely(JS_IsUndefined(sp[-2]) || JS_IsNull(sp[-2]))) {
+        JS_ThrowTypeError(ctx, "value has no property");
+        return -1;
+    }
+    switch (JS_VALUE_GET_TAG(sp[-1])) {
+    case JS_TAG_INT:
+    case JS_TAG_STRING:
+    case JS_TAG_SYMBOL:
+        break;
+    default:
+        val = JS_ToPropertyKey(ctx, sp[-1]);
+        if (JS_IsException(val))
+            return -1;
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = val;
+        break;
+    }
+    return 0;
+}
+
+/* add_loc when the operands are not both int32: *pv += op2. 'op2' is
+   freed. */
+static int js_add_loc_slow(JSContext *ctx, JSValue *pv, JSValue op2)
+{
+    JSValue ops[2];
+
+    if (tag_is_string(JS_VALUE_GET_TAG(*pv))) {
+        op2 = JS_ToPrimitiveFree(ctx, op2, HINT_NONE);
+        if (JS_IsException(op2))
+            return -1;
+        if (js_concat_string_in_place(ctx, pv, op2)) {
+            JS_FreeValue(ctx, op2);
+            return 0;
+        }
+        op2 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op2);
+        if (JS_IsException(op2))
+            return -1;
+        set_value(ctx, pv, op2);
+    } else {
+        /* In case of exception, js_add_slow frees ops[0]
+           and ops[1], so we must duplicate *pv */
+        ops[0] = JS_DupValue(ctx, *pv);
+        ops[1] = op2;
+        if (js_add_slow(ctx, ops + 2))
+            return -1;
+        set_value(ctx, pv, ops[0]);
+    }
+    return 0;
+}
+
+/* inc_loc, dec_loc when the variable is not an int32 or overflows */
+static int js_inc_loc_slow(JSContext *ctx, JSValue *pv, int opcode)
+{
+    JSValue op1;
+
+    /* must duplicate otherwise the variable value may
+       be destroyed before JS code accesses it */
+    op1 = JS_DupValue(ctx, *pv);
+    if (js_unary_arith_slow(ctx, &op1 + 1,
+                            opcode == OP_inc_loc ? OP_inc : OP_dec))
+        return -1;
+    set_value(ctx, pv, op1);
+    return 0;
+}
+
 /* argv[] is modified if (flags & JS_CALL_FLAG_COPY_ARGV) = 0. */
 static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                                JSValueConst this_obj, JSValueConst new_target,
@@ -16232,6 +18247,20 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 #define BREAK           SWITCH(pc)
 #endif
 
+/* poll the interrupts after a jump of 'diff' bytes and count the
+   backward jumps for the profiler. sf->cur_pc is updated so that the
+   sampled stack shows the current position. */
+#define POLL_BRANCH(diff)                                       \
+    do {                                                        \
+        if ((diff) < 0)                                         \
+            b->loop_count++;                                    \
+        if (unlikely(--ctx->interrupt_counter <= 0)) {          \
+            sf->cur_pc = pc;                                    \
+            if (__js_poll_interrupts(ctx))                      \
+                goto exception;                                 \
+        }                                                       \
+    } while (0)
+
     if (js_poll_interrupts(caller_ctx))
         return JS_EXCEPTION;
     if (unlikely(JS_VALUE_GET_TAG(func_obj) != JS_TAG_OBJECT)) {
@@ -16268,10 +18297,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
         not_a_function:
             return JS_ThrowTypeError(caller_ctx, "not a function");
         }
-        return call_func(caller_ctx, func_obj, this_obj, argc,
-                         (JSValueConst *)argv, flags);
+        return js_call_class_func(caller_ctx, call_func, func_obj, this_obj,
+                                  argc, (JSValueConst *)argv, flags);
     }
     b = p->u.func.function_bytecode;
+    b->call_count++;
 
     if (unlikely(argc < b->arg_count || (flags & JS_CALL_FLAG_COPY_ARGV))) {
         arg_allocated_size = b->arg_count;
@@ -16314,6 +18344,39 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
     sf->prev_frame = rt->current_stack_frame;
     rt->current_stack_frame = sf;
     ctx = b->realm; /* set the current realm */
+
+#ifdef CONFIG_JIT
+    if (b->func_kind == JS_FUNC_NORMAL) {
+        JSJitFunc *jit_func = b->jit_func;
+        if (!jit_func && !b->jit_failed &&
+            (b->call_count >= JS_JIT_CALL_THRESHOLD ||
+             b->loop_count >= JS_JIT_LOOP_THRESHOLD || rt->perf_map_file)) {
+            jit_func = js_jit_compile(ctx, b);
+        }
+        if (jit_func) {
+            JSJitFrame jf;
+            int ret;
+            jf.ctx = ctx;
+            jf.b = b;
+            jf.sf = sf;
+            jf.var_refs = var_refs;
+            jf.var_buf = var_buf;
+            jf.arg_buf = arg_buf;
+            jf.sp = sp;
+            jf.pc = pc;
+            jf.this_obj = this_obj;
+            ret = jit_func(&jf);
+            pc = jf.pc;
+            sp = jf.sp;
+            if (ret < 0)
+                goto exception;
+            if (ret > 0) {
+                ret_val = jf.ret_val;
+                goto done;
+            }
+        }
+    }
+#endif
     
  restart:
     for(;;) {
@@ -16386,21 +18449,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             /* OP_push_this is only called at the start of a function */
             {
                 JSValue val;
-                if (!(b->js_mode & JS_MODE_STRICT)) {
-                    uint32_t tag = JS_VALUE_GET_TAG(this_obj);
-                    if (likely(tag == JS_TAG_OBJECT))
-                        goto normal_this;
-                    if (tag == JS_TAG_NULL || tag == JS_TAG_UNDEFINED) {
-                        val = JS_DupValue(ctx, ctx->global_obj);
-                    } else {
-                        val = JS_ToObject(ctx, this_obj);
-                        if (JS_IsException(val))
-                            goto exception;
-                    }
-                } else {
-                normal_this:
-                    val = JS_DupValue(ctx, this_obj);
-                }
+                val = js_op_push_this(ctx, b, this_obj);
+                if (unlikely(JS_IsException(val)))
+                    goto exception;
                 *sp++ = val;
             }
             BREAK;
@@ -16688,27 +18739,13 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
         CASE(OP_array_from):
-            {
-                int i, ret;
-
-                call_argc = get_u16(pc);
-                pc += 2;
-                ret_val = JS_NewArray(ctx);
-                if (unlikely(JS_IsException(ret_val)))
-                    goto exception;
-                call_argv = sp - call_argc;
-                for(i = 0; i < call_argc; i++) {
-                    ret = JS_DefinePropertyValue(ctx, ret_val, __JS_AtomFromUInt32(i), call_argv[i],
-                                                 JS_PROP_C_W_E | JS_PROP_THROW);
-                    call_argv[i] = JS_UNDEFINED;
-                    if (ret < 0) {
-                        JS_FreeValue(ctx, ret_val);
-                        goto exception;
-                    }
-                }
-                sp -= call_argc;
-                *sp++ = ret_val;
-            }
+            call_argc = get_u16(pc);
+            pc += 2;
+            ret_val = js_op_array_from(ctx, sp - call_argc, call_argc);
+            if (unlikely(JS_IsException(ret_val)))
+                goto exception;
+            sp -= call_argc;
+            *sp++ = ret_val;
             BREAK;
 
         CASE(OP_apply):
@@ -16914,7 +18951,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 atom = get_u32(pc);
                 pc += 4;
 
-                val = JS_GetGlobalVar(ctx, atom, opcode - OP_get_var_undef);
+                val = js_op_get_var(ctx, b, atom, opcode - OP_get_var_undef);
                 if (unlikely(JS_IsException(val)))
                     goto exception;
                 *sp++ = val;
@@ -16929,7 +18966,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 atom = get_u32(pc);
                 pc += 4;
 
-                ret = JS_SetGlobalVar(ctx, atom, sp[-1], opcode - OP_put_var);
+                ret = js_op_put_var(ctx, b, atom, sp[-1], opcode);
                 sp--;
                 if (unlikely(ret < 0))
                     goto exception;
@@ -16940,6 +18977,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 int ret;
                 JSAtom atom;
+                JSProperty *pr;
                 atom = get_u32(pc);
                 pc += 4;
 
@@ -16948,7 +18986,15 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     JS_ThrowReferenceErrorNotDefined(ctx, atom);
                     goto exception;
                 }
-                ret = JS_SetGlobalVar(ctx, atom, sp[-1], 2);
+                pr = js_global_ic_find(ctx, b, atom, TRUE);
+                if (unlikely(!pr))
+                    pr = js_global_ic_update(ctx, b, atom, TRUE);
+                if (likely(pr)) {
+                    set_value(ctx, &pr->u.value, sp[-1]);
+                    ret = 0;
+                } else {
+                    ret = JS_SetGlobalVar(ctx, atom, sp[-1], 2);
+                }
                 sp -= 2;
                 if (unlikely(ret < 0))
                     goto exception;
@@ -17257,25 +19303,31 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             BREAK;
 
         CASE(OP_goto):
-            pc += (int32_t)get_u32(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int32_t diff = get_u32(pc);
+                pc += diff;
+                POLL_BRANCH(diff);
+            }
             BREAK;
 #if SHORT_OPCODES
         CASE(OP_goto16):
-            pc += (int16_t)get_u16(pc);
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int diff = (int16_t)get_u16(pc);
+                pc += diff;
+                POLL_BRANCH(diff);
+            }
             BREAK;
         CASE(OP_goto8):
-            pc += (int8_t)pc[0];
-            if (unlikely(js_poll_interrupts(ctx)))
-                goto exception;
+            {
+                int diff = (int8_t)pc[0];
+                pc += diff;
+                POLL_BRANCH(diff);
+            }
             BREAK;
 #endif
         CASE(OP_if_true):
             {
-                int res;
+                int res, diff;
                 JSValue op1;
 
                 op1 = sp[-1];
@@ -17286,16 +19338,17 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     res = JS_ToBoolFree(ctx, op1);
                 }
                 sp--;
+                diff = 0;
                 if (res) {
-                    pc += (int32_t)get_u32(pc - 4) - 4;
+                    diff = (int32_t)get_u32(pc - 4);
+                    pc += diff - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_BRANCH(diff);
             }
             BREAK;
         CASE(OP_if_false):
             {
-                int res;
+                int res, diff;
                 JSValue op1;
 
                 op1 = sp[-1];
@@ -17306,17 +19359,18 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     res = JS_ToBoolFree(ctx, op1);
                 }
                 sp--;
+                diff = 0;
                 if (!res) {
-                    pc += (int32_t)get_u32(pc - 4) - 4;
+                    diff = (int32_t)get_u32(pc - 4);
+                    pc += diff - 4;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_BRANCH(diff);
             }
             BREAK;
 #if SHORT_OPCODES
         CASE(OP_if_true8):
             {
-                int res;
+                int res, diff;
                 JSValue op1;
 
                 op1 = sp[-1];
@@ -17327,16 +19381,17 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     res = JS_ToBoolFree(ctx, op1);
                 }
                 sp--;
+                diff = 0;
                 if (res) {
-                    pc += (int8_t)pc[-1] - 1;
+                    diff = (int8_t)pc[-1];
+                    pc += diff - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_BRANCH(diff);
             }
             BREAK;
         CASE(OP_if_false8):
             {
-                int res;
+                int res, diff;
                 JSValue op1;
 
                 op1 = sp[-1];
@@ -17347,11 +19402,12 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     res = JS_ToBoolFree(ctx, op1);
                 }
                 sp--;
+                diff = 0;
                 if (!res) {
-                    pc += (int8_t)pc[-1] - 1;
+                    diff = (int8_t)pc[-1];
+                    pc += diff - 1;
                 }
-                if (unlikely(js_poll_interrupts(ctx)))
-                    goto exception;
+                POLL_BRANCH(diff);
             }
             BREAK;
 #endif
@@ -17534,10 +19590,12 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue val;
                 JSAtom atom;
+                int ic_idx;
                 atom = get_u32(pc);
-                pc += 4;
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
 
-                val = JS_GetProperty(ctx, sp[-1], atom);
+                val = js_op_get_field(ctx, b, sp[-1], atom, ic_idx);
                 if (unlikely(JS_IsException(val)))
                     goto exception;
                 JS_FreeValue(ctx, sp[-1]);
@@ -17549,25 +19607,60 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             {
                 JSValue val;
                 JSAtom atom;
+                int ic_idx;
                 atom = get_u32(pc);
-                pc += 4;
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
 
-                val = JS_GetProperty(ctx, sp[-1], atom);
+                val = js_op_get_field(ctx, b, sp[-1], atom, ic_idx);
                 if (unlikely(JS_IsException(val)))
                     goto exception;
                 *sp++ = val;
             }
             BREAK;
 
+        CASE(OP_get_loc_get_field):
+        CASE(OP_get_loc_get_field2):
+        CASE(OP_get_loc_check_get_field):
+        CASE(OP_get_loc_check_get_field2):
+            {
+                JSValue val;
+                JSAtom atom;
+                int ic_idx, idx;
+                atom = get_u32(pc);
+                ic_idx = get_u16(pc + 4);
+                idx = get_u16(pc + 6);
+                pc += 8;
+                if (opcode >= OP_get_loc_check_get_field &&
+                    unlikely(JS_IsUninitialized(var_buf[idx]))) {
+                    JS_ThrowReferenceErrorUninitialized2(ctx, b, idx, FALSE);
+                    goto exception;
+                }
+                sp[0] = JS_DupValue(ctx, var_buf[idx]);
+                sp++;
+                val = js_op_get_field(ctx, b, sp[-1], atom, ic_idx);
+                if (unlikely(JS_IsException(val)))
+                    goto exception;
+                if ((opcode - OP_get_loc_get_field) & 1) {
+                    /* get_field2 */
+                    *sp++ = val;
+                } else {
+                    JS_FreeValue(ctx, sp[-1]);
+                    sp[-1] = val;
+                }
+            }
+            BREAK;
+
         CASE(OP_put_field):
             {
                 int ret;
                 JSAtom atom;
+                int ic_idx;
                 atom = get_u32(pc);
-                pc += 4;
+                ic_idx = get_u16(pc + 4);
+                pc += 6;
 
-                ret = JS_SetPropertyInternal(ctx, sp[-2], atom, sp[-1],
-                                             JS_PROP_THROW_STRICT);
+                ret = js_op_put_field(ctx, b, sp[-2], atom, sp[-1], ic_idx);
                 JS_FreeValue(ctx, sp[-2]);
                 sp -= 2;
                 if (unlikely(ret < 0))
@@ -17803,7 +19896,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                 atom = JS_ValueToAtom(ctx, sp[-1]);
                 if (unlikely(atom == JS_ATOM_NULL))
                     goto exception;
-                val = JS_GetPropertyInternal(ctx, sp[-2], atom, sp[-3], FALSE);
+                val = JS_GetPropertyInternal2(ctx, sp[-2], atom, sp[-3], FALSE);
                 JS_FreeAtom(ctx, atom);
                 if (unlikely(JS_IsException(val)))
                     goto exception;
@@ -17952,28 +20045,11 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         goto add_loc_slow;
                     *pv = JS_NewInt32(ctx, r);
                     sp--;
-                } else if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING) {
-                    JSValue op1;
-                    op1 = sp[-1];
-                    sp--;
-                    op1 = JS_ToPrimitiveFree(ctx, op1, HINT_NONE);
-                    if (JS_IsException(op1))
-                        goto exception;
-                    op1 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op1);
-                    if (JS_IsException(op1))
-                        goto exception;
-                    set_value(ctx, pv, op1);
                 } else {
-                    JSValue ops[2];
                 add_loc_slow:
-                    /* In case of exception, js_add_slow frees ops[0]
-                       and ops[1], so we must duplicate *pv */
-                    ops[0] = JS_DupValue(ctx, *pv);
-                    ops[1] = sp[-1];
                     sp--;
-                    if (js_add_slow(ctx, ops + 2))
+                    if (js_add_loc_slow(ctx, pv, sp[0]))
                         goto exception;
-                    set_value(ctx, pv, ops[0]);
                 }
             }
             BREAK;
@@ -18188,12 +20264,8 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     var_buf[idx] = JS_NewInt32(ctx, val + 1);
                 } else {
                 inc_loc_slow:
-                    /* must duplicate otherwise the variable value may
-                       be destroyed before JS code accesses it */
-                    op1 = JS_DupValue(ctx, op1);
-                    if (js_unary_arith_slow(ctx, &op1 + 1, OP_inc))
+                    if (js_inc_loc_slow(ctx, &var_buf[idx], opcode))
                         goto exception;
-                    set_value(ctx, &var_buf[idx], op1);
                 }
             }
             BREAK;
@@ -18213,12 +20285,8 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     var_buf[idx] = JS_NewInt32(ctx, val - 1);
                 } else {
                 dec_loc_slow:
-                    /* must duplicate otherwise the variable value may
-                       be destroyed before JS code accesses it */
-                    op1 = JS_DupValue(ctx, op1);
-                    if (js_unary_arith_slow(ctx, &op1 + 1, OP_dec))
+                    if (js_inc_loc_slow(ctx, &var_buf[idx], opcode))
                         goto exception;
-                    set_value(ctx, &var_buf[idx], op1);
                 }
             }
             BREAK;
@@ -18403,6 +20471,36 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             OP_CMP(OP_strict_eq, ==, js_strict_eq_slow(ctx, sp, 0));
             OP_CMP(OP_strict_neq, !=, js_strict_eq_slow(ctx, sp, 1));
 
+#define OP_CMP_IF_FALSE(opcode, binary_op, slow_call)            \
+            CASE(opcode):                                       \
+                {                                               \
+                JSValue op1, op2;                               \
+                int res, diff;                                  \
+                op1 = sp[-2];                                   \
+                op2 = sp[-1];                                   \
+                pc += 4;                                        \
+                if (likely(JS_VALUE_IS_BOTH_INT(op1, op2))) {   \
+                    res = JS_VALUE_GET_INT(op1) binary_op JS_VALUE_GET_INT(op2); \
+                } else {                                        \
+                    if (slow_call)                              \
+                        goto exception;                         \
+                    res = JS_ToBoolFree(ctx, sp[-2]);           \
+                }                                               \
+                sp -= 2;                                        \
+                diff = 0;                                       \
+                if (!res) {                                     \
+                    diff = (int32_t)get_u32(pc - 4);            \
+                    pc += diff - 4;                             \
+                }                                               \
+                POLL_BRANCH(diff);                              \
+                }                                               \
+            BREAK
+
+            OP_CMP_IF_FALSE(OP_lt_if_false, <, js_relational_slow(ctx, sp, OP_lt));
+            OP_CMP_IF_FALSE(OP_lte_if_false, <=, js_relational_slow(ctx, sp, OP_lte));
+            OP_CMP_IF_FALSE(OP_gt_if_false, >, js_relational_slow(ctx, sp, OP_gt));
+            OP_CMP_IF_FALSE(OP_gte_if_false, >=, js_relational_slow(ctx, sp, OP_gte));
+
 #ifdef CONFIG_BIGNUM
         CASE(OP_mul_pow10):
             if (rt->bigfloat_ops.mul_pow10(ctx, sp))
@@ -18462,40 +20560,9 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             BREAK;
 
         CASE(OP_to_propkey):
-            switch (JS_VALUE_GET_TAG(sp[-1])) {
-            case JS_TAG_INT:
-            case JS_TAG_STRING:
-            case JS_TAG_SYMBOL:
-                break;
-            default:
-                ret_val = JS_ToPropertyKey(ctx, sp[-1]);
-                if (JS_IsException(ret_val))
-                    goto exception;
-                JS_FreeValue(ctx, sp[-1]);
-                sp[-1] = ret_val;
-                break;
-            }
-            BREAK;
-
         CASE(OP_to_propkey2):
-            /* must be tested first */
-            if (unlikely(JS_IsUndefined(sp[-2]) || JS_IsNull(sp[-2]))) {
-                JS_ThrowTypeError(ctx, "value has no property");
+            if (js_op_to_propkey(ctx, sp, opcode))
                 goto exception;
-            }
-            switch (JS_VALUE_GET_TAG(sp[-1])) {
-            case JS_TAG_INT:
-            case JS_TAG_STRING:
-            case JS_TAG_SYMBOL:
-                break;
-            default:
-                ret_val = JS_ToPropertyKey(ctx, sp[-1]);
-                if (JS_IsException(ret_val))
-                    goto exception;
-                JS_FreeValue(ctx, sp[-1]);
-                sp[-1] = ret_val;
-                break;
-            }
             BREAK;
 #if 0
         CASE(OP_to_string):
@@ -18538,7 +20605,7 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                     }
                     switch (opcode) {
                     case OP_with_get_var:
-                        val = JS_GetProperty(ctx, obj, atom);
+                        val = JS_GetPropertyInternal2(ctx, obj, atom, obj, FALSE);
                         if (unlikely(JS_IsException(val)))
                             goto exception;
                         set_value(ctx, &sp[-1], val);
@@ -18565,14 +20632,14 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
                         break;
                     case OP_with_get_ref:
                         /* produce a pair object/method on the stack */
-                        val = JS_GetProperty(ctx, obj, atom);
+                        val = JS_GetPropertyInternal2(ctx, obj, atom, obj, FALSE);
                         if (unlikely(JS_IsException(val)))
                             goto exception;
                         *sp++ = val;
                         break;
                     case OP_with_get_ref_undef:
                         /* produce a pair undefined/function on the stack */
-                        val = JS_GetProperty(ctx, obj, atom);
+                        val = JS_GetPropertyInternal2(ctx, obj, atom, obj, FALSE);
                         if (unlikely(JS_IsException(val)))
                             goto exception;
                         JS_FreeValue(ctx, sp[-1]);
@@ -18712,8 +20779,10 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
 JSValue JS_Call(JSContext *ctx, JSValueConst func_obj, JSValueConst this_obj,
                 int argc, JSValueConst *argv)
 {
-    return JS_CallInternal(ctx, func_obj, this_obj, JS_UNDEFINED,
-                           argc, (JSValue *)argv, JS_CALL_FLAG_COPY_ARGV);
+    return js_linearize_string(ctx, JS_CallInternal(ctx, func_obj, this_obj,
+                                                    JS_UNDEFINED, argc,
+                                                    (JSValue *)argv,
+                                                    JS_CALL_FLAG_COPY_ARGV));
 }
 
 static JSValue JS_CallFree(JSContext *ctx, JSValue func_obj, JSValueConst this_obj,
@@ -18782,7 +20851,7 @@ static JSValue js_create_from_ctor(JSContext *ctx, JSValueConst ctor,
     JSContext *realm;
     
     if (JS_IsUndefined(ctor)) {
-        proto = JS_DupValue(ctx, ctx->class_proto[class_id]);
+        proto = JS_DupValue(ctx, js_get_class_proto(ctx, class_id));
     } else {
         proto = JS_GetProperty(ctx, ctor, JS_ATOM_prototype);
         if (JS_IsException(proto))
@@ -18792,7 +20861,7 @@ static JSValue js_create_from_ctor(JSContext *ctx, JSValueConst ctor,
             realm = JS_GetFunctionRealm(ctx, ctor);
             if (!realm)
                 return JS_EXCEPTION;
-            proto = JS_DupValue(ctx, realm->class_proto[class_id]);
+            proto = JS_DupValue(ctx, js_get_class_proto(realm, class_id));
         }
     }
     obj = JS_NewObjectProtoClass(ctx, proto, class_id);
@@ -18824,8 +20893,8 @@ static JSValue JS_CallConstructorInternal(JSContext *ctx,
         not_a_function:
             return JS_ThrowTypeError(ctx, "not a function");
         }
-        return call_func(ctx, func_obj, new_target, argc,
-                         (JSValueConst *)argv, flags);
+        return js_call_class_func(ctx, call_func, func_obj, new_target,
+                                  argc, (JSValueConst *)argv, flags);
     }
 
     b = p->u.func.function_bytecode;
@@ -18873,7 +20942,8 @@ JSValue JS_Invoke(JSContext *ctx, JSValueConst this_val, JSAtom atom,
     func_obj = JS_GetProperty(ctx, this_val, atom);
     if (JS_IsException(func_obj))
         return func_obj;
-    return JS_CallFree(ctx, func_obj, this_val, argc, argv);
+    return js_linearize_string(ctx, JS_CallFree(ctx, func_obj, this_val,
+                                                argc, argv));
 }
 
 static JSValue JS_InvokeFree(JSContext *ctx, JSValue this_val, JSAtom atom,
@@ -20036,6 +22106,8 @@ typedef struct JSFunctionDef {
     int closure_var_size;
     JSClosureVar *closure_var;
 
+    int ic_count; /* number of inline caches, set in resolve_labels() */
+
     JumpSlot *jump_slots;
     int jump_size;
     int jump_count;
@@ -21569,6 +23641,13 @@ static void emit_atom(JSParseState *s, JSAtom name)
     emit_u32(s, JS_DupAtom(s->ctx, name));
 }
 
+/* inline cache index of OP_get_field, OP_get_field2 and
+   OP_put_field. The actual index is allocated in resolve_labels() */
+static void emit_ic(JSParseState *s)
+{
+    emit_u16(s, 0);
+}
+
 static int update_label(JSFunctionDef *s, int label, int delta)
 {
     LabelSlot *ls;
@@ -21669,6 +23748,244 @@ static __exception int emit_push_const(JSParseState *s, JSValueConst val,
     return 0;
 }
 
+/* Constant folding: the operands of an operator are evaluated at
+   compile time when their code consists of a single push of a
+   primitive constant. */
+
+/* return TRUE if the opcode at 'op_pos' pushes a primitive constant
+   and store its value in '*pval' */
+static BOOL js_get_const_op(JSParseState *s, int op_pos, JSValue *pval)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionDef *fd = s->cur_func;
+    const uint8_t *bc = fd->byte_code.buf;
+    JSValue val;
+
+    switch(bc[op_pos]) {
+    case OP_undefined:
+        val = JS_UNDEFINED;
+        break;
+    case OP_null:
+        val = JS_NULL;
+        break;
+    case OP_push_false:
+    case OP_push_true:
+        val = JS_NewBool(ctx, bc[op_pos] == OP_push_true);
+        break;
+    case OP_push_i32:
+        val = JS_NewInt32(ctx, get_i32(bc + op_pos + 1));
+        break;
+    case OP_push_const:
+        val = fd->cpool[get_u32(bc + op_pos + 1)];
+        switch(JS_VALUE_GET_NORM_TAG(val)) {
+        case JS_TAG_INT:
+        case JS_TAG_FLOAT64:
+        case JS_TAG_STRING:
+            break;
+        default:
+            return FALSE;
+        }
+        val = JS_DupValue(ctx, val);
+        break;
+    case OP_push_atom_value:
+        val = JS_AtomToString(ctx, get_u32(bc + op_pos + 1));
+        if (JS_IsException(val)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return FALSE;
+        }
+        break;
+    default:
+        return FALSE;
+    }
+    *pval = val;
+    return TRUE;
+}
+
+/* return TRUE if the code between 'pos' and 'end' only pushes a
+   primitive constant. '*pop_pos' is set to the position of the push
+   opcode. */
+static BOOL js_get_const_expr(JSParseState *s, int pos, int end,
+                              int *pop_pos, JSValue *pval)
+{
+    const uint8_t *bc = s->cur_func->byte_code.buf;
+
+    while (pos < end && bc[pos] == OP_line_num)
+        pos += opcode_info[OP_line_num].size;
+    if (pos >= end || pos + opcode_info[bc[pos]].size != end)
+        return FALSE;
+    *pop_pos = pos;
+    return js_get_const_op(s, pos, pval);
+}
+
+/* remove the code starting at 'op_pos'. The opcode at 'op_pos' must
+   be a constant push. */
+static void js_remove_const_op(JSParseState *s, int op_pos)
+{
+    JSFunctionDef *fd = s->cur_func;
+    const uint8_t *bc = fd->byte_code.buf;
+    int idx;
+
+    switch(bc[op_pos]) {
+    case OP_push_const:
+        /* the constant pool entry is reused if it is the last one */
+        idx = get_u32(bc + op_pos + 1);
+        if (idx == fd->cpool_count - 1) {
+            JS_FreeValue(s->ctx, fd->cpool[idx]);
+            fd->cpool_count--;
+        }
+        break;
+    case OP_push_atom_value:
+        JS_FreeAtom(s->ctx, get_u32(bc + op_pos + 1));
+        break;
+    default:
+        break;
+    }
+    fd->byte_code.size = op_pos;
+    fd->last_opcode_pos = -1;
+    /* the removed code may contain line number information */
+    fd->last_opcode_line_num = -1;
+}
+
+/* emit a push of the primitive value 'val'. 'val' is freed. */
+static __exception int emit_const_value(JSParseState *s, JSValue val)
+{
+    int ret;
+
+    switch(JS_VALUE_GET_NORM_TAG(val)) {
+    case JS_TAG_UNDEFINED:
+        emit_op(s, OP_undefined);
+        return 0;
+    case JS_TAG_NULL:
+        emit_op(s, OP_null);
+        return 0;
+    case JS_TAG_BOOL:
+        emit_op(s, JS_VALUE_GET_BOOL(val) ? OP_push_true : OP_push_false);
+        return 0;
+    case JS_TAG_FLOAT64:
+        /* use the integer representation if possible */
+        val = JS_NewFloat64(s->ctx, JS_VALUE_GET_FLOAT64(val));
+        if (JS_VALUE_GET_TAG(val) != JS_TAG_INT)
+            break;
+        /* fall thru */
+    case JS_TAG_INT:
+        emit_op(s, OP_push_i32);
+        emit_u32(s, JS_VALUE_GET_INT(val));
+        return 0;
+    case JS_TAG_STRING_ROPE:
+        val = js_linearize_string(s->ctx, val);
+        if (JS_IsException(val))
+            return -1;
+        break;
+    default:
+        break;
+    }
+    ret = emit_push_const(s, val, 1);
+    JS_FreeValue(s->ctx, val);
+    return ret;
+}
+
+/* Emit the operator 'opcode'. Its operands are pushed by the code
+   starting at 'pos1' and 'pos2' ('pos2' < 0 for unary
+   operators). The operator is evaluated at compile time if the
+   operands are constants. */
+static __exception int emit_op_fold(JSParseState *s, int opcode,
+                                    int pos1, int pos2)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionDef *fd = s->cur_func;
+    JSValue stack[2], *sp;
+    int op_pos1, op_pos2, ret;
+    JSAtom atom;
+
+    if (!OPTIMIZE)
+        goto no_fold;
+#ifdef CONFIG_BIGNUM
+    /* the semantics of the operators depend on the runtime mode */
+    if ((fd->js_mode & JS_MODE_MATH) || is_math_mode(ctx))
+        goto no_fold;
+#endif
+    sp = stack;
+    if (pos2 < 0) {
+        if (!js_get_const_expr(s, pos1, fd->byte_code.size, &op_pos1, sp))
+            goto no_fold;
+        sp++;
+    } else {
+        if (!js_get_const_expr(s, pos1, pos2, &op_pos1, sp))
+            goto no_fold;
+        if (!js_get_const_expr(s, pos2, fd->byte_code.size, &op_pos2, sp + 1)) {
+            JS_FreeValue(ctx, sp[0]);
+            goto no_fold;
+        }
+        sp += 2;
+        js_remove_const_op(s, op_pos2);
+    }
+    js_remove_const_op(s, op_pos1);
+
+    switch(opcode) {
+    case OP_neg:
+    case OP_plus:
+        ret = js_unary_arith_slow(ctx, sp, opcode);
+        break;
+    case OP_not:
+        ret = js_not_slow(ctx, sp);
+        break;
+    case OP_lnot:
+        sp[-1] = JS_NewBool(ctx, !JS_ToBoolFree(ctx, sp[-1]));
+        ret = 0;
+        break;
+    case OP_typeof:
+        atom = js_operator_typeof(ctx, sp[-1]);
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = JS_AtomToString(ctx, atom);
+        ret = 0;
+        if (JS_IsException(sp[-1]))
+            ret = -1;
+        break;
+    case OP_add:
+        ret = js_add_slow(ctx, sp);
+        break;
+    case OP_sub:
+    case OP_mul:
+    case OP_div:
+    case OP_mod:
+    case OP_pow:
+        ret = js_binary_arith_slow(ctx, sp, opcode);
+        break;
+    case OP_shl:
+    case OP_sar:
+    case OP_and:
+    case OP_or:
+    case OP_xor:
+        ret = js_binary_logic_slow(ctx, sp, opcode);
+        break;
+    case OP_shr:
+        ret = js_shr_slow(ctx, sp);
+        break;
+    case OP_lt:
+    case OP_lte:
+    case OP_gt:
+    case OP_gte:
+        ret = js_relational_slow(ctx, sp, opcode);
+        break;
+    case OP_eq:
+    case OP_neq:
+        ret = js_eq_slow(ctx, sp, opcode == OP_neq);
+        break;
+    case OP_strict_eq:
+    case OP_strict_neq:
+        ret = js_strict_eq_slow(ctx, sp, opcode == OP_strict_neq);
+        break;
+    default:
+        abort();
+    }
+    if (ret)
+        return -1;
+    return emit_const_value(s, stack[0]);
+ no_fold:
+    emit_op(s, opcode);
+    return 0;
+}
+
 /* return the variable index or -1 if not found,
    add ARGUMENT_VAR_OFFSET for argument variables */
 static int find_arg(JSContext *ctx, JSFunctionDef *fd, JSAtom name)
@@ -22165,10 +24482,16 @@ static int seal_template_obj(JSContext *ctx, JSValueConst obj)
 static __exception int js_parse_template(JSParseState *s, int call, int *argc)
 {
     JSContext *ctx = s->ctx;
-    JSValue raw_array, template_object;
+    JSFunctionDef *fd = s->cur_func;
+    JSValue raw_array, template_object, prefix, val;
     JSToken cooked;
-    int depth, ret;
+    int depth, ret, pos, op_pos, lit_pos, lit_end;
 
+    /* constant substitutions are concatenated with the adjacent
+       string parts at compile time. 'prefix' is the constant string
+       to prepend to the next string part. */
+    prefix = JS_UNDEFINED;
+    lit_pos = lit_end = -1;
     raw_array = JS_UNDEFINED; /* avoid warning */
     template_object = JS_UNDEFINED; /* avoid warning */
     if (call) {
@@ -22176,18 +24499,18 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
         /* Create an array of raw strings and store it to the raw property */
         template_object = JS_NewArray(ctx);
         if (JS_IsException(template_object))
-            return -1;
+            goto fail;
         //        pool_idx = s->cur_func->cpool_count;
         ret = emit_push_const(s, template_object, 0);
         JS_FreeValue(ctx, template_object);
         if (ret)
-            return -1;
+            goto fail;
         raw_array = JS_NewArray(ctx);
         if (JS_IsException(raw_array))
-            return -1;
+            goto fail;
         if (JS_DefinePropertyValue(ctx, template_object, JS_ATOM_raw,
                                    raw_array, JS_PROP_THROW) < 0) {
-            return -1;
+            goto fail;
         }
     }
 
@@ -22199,7 +24522,7 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
             if (JS_DefinePropertyValueUint32(ctx, raw_array, depth,
                                              JS_DupValue(ctx, s->token.u.str.str),
                                              JS_PROP_ENUMERABLE | JS_PROP_THROW) < 0) {
-                return -1;
+                goto fail;
             }
             /* re-parse the string with escape sequences but do not throw a
                syntax error if it contains invalid sequences
@@ -22210,7 +24533,7 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
             if (JS_DefinePropertyValueUint32(ctx, template_object, depth,
                                              cooked.u.str.str,
                                              JS_PROP_ENUMERABLE | JS_PROP_THROW) < 0) {
-                return -1;
+                goto fail;
             }
         } else {
             JSString *str;
@@ -22220,19 +24543,29 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
             JS_FreeValue(ctx, s->token.u.str.str);
             s->token.u.str.str = JS_UNDEFINED;
             if (js_parse_string(s, '`', TRUE, p, &cooked, &p))
-                return -1;
+                goto fail;
+            if (!JS_IsUndefined(prefix)) {
+                val = JS_ConcatString(ctx, prefix, cooked.u.str.str);
+                prefix = JS_UNDEFINED;
+                cooked.u.str.str = js_linearize_string(ctx, val);
+                if (JS_IsException(cooked.u.str.str))
+                    goto fail;
+            }
             str = JS_VALUE_GET_STRING(cooked.u.str.str);
             if (str->len != 0 || depth == 0) {
                 ret = emit_push_const(s, cooked.u.str.str, 1);
                 JS_FreeValue(s->ctx, cooked.u.str.str);
                 if (ret)
-                    return -1;
+                    goto fail;
+                lit_pos = fd->last_opcode_pos;
                 if (depth == 0) {
                     if (s->token.u.str.sep == '`')
                         goto done1;
                     emit_op(s, OP_get_field2);
                     emit_atom(s, JS_ATOM_concat);
+                    emit_ic(s);
                 }
+                lit_end = fd->byte_code.size;
                 depth++;
             } else {
                 JS_FreeValue(s->ctx, cooked.u.str.str);
@@ -22241,12 +24574,33 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
         if (s->token.u.str.sep == '`')
             goto done;
         if (next_token(s))
-            return -1;
+            goto fail;
+        pos = fd->byte_code.size;
         if (js_parse_expr(s))
-            return -1;
-        depth++;
+            goto fail;
+        if (!call && OPTIMIZE &&
+            js_get_const_expr(s, pos, fd->byte_code.size, &op_pos, &val)) {
+            js_remove_const_op(s, op_pos);
+            val = JS_ToStringFree(ctx, val);
+            if (JS_IsException(val))
+                goto fail;
+            if (lit_end == pos && js_get_const_op(s, lit_pos, &prefix)) {
+                /* merge with the previous string part */
+                js_remove_const_op(s, lit_pos);
+                val = JS_ConcatString(ctx, prefix, val);
+                prefix = JS_UNDEFINED;
+                if (JS_IsException(val))
+                    goto fail;
+                depth--;
+            }
+            prefix = val;
+        } else {
+            depth++;
+        }
+        lit_end = -1;
         if (s->token.val != '}') {
-            return js_parse_error(s, "expected '}' after template expression");
+            js_parse_error(s, "expected '}' after template expression");
+            goto fail;
         }
         /* XXX: should convert to string at this stage? */
         free_token(s, &s->token);
@@ -22255,9 +24609,13 @@ static __exception int js_parse_template(JSParseState *s, int call, int *argc)
         s->got_lf = FALSE;
         s->last_line_num = s->token.line_num;
         if (js_parse_template_part(s, s->buf_ptr))
-            return -1;
+            goto fail;
     }
+    JS_FreeValue(ctx, prefix);
     return js_parse_expect(s, TOK_TEMPLATE);
+ fail:
+    JS_FreeValue(ctx, prefix);
+    return -1;
 
  done:
     if (call) {
@@ -23429,6 +25787,7 @@ static __exception int js_parse_array_literal(JSParseState *s)
             emit_u32(s, idx);
             emit_op(s, OP_put_field);
             emit_atom(s, JS_ATOM_length);
+            emit_ic(s);
         }
         goto done;
     }
@@ -23493,6 +25852,7 @@ static __exception int js_parse_array_literal(JSParseState *s)
         emit_op(s, OP_dup1);    /* array length - array array length */
         emit_op(s, OP_put_field);
         emit_atom(s, JS_ATOM_length);
+        emit_ic(s);
     } else {
         emit_op(s, OP_drop);    /* array length - array */
     }
@@ -23593,6 +25953,7 @@ static __exception int get_lvalue(JSParseState *s, int *popcode, int *pscope,
         case OP_get_field:
             emit_op(s, OP_get_field2);
             emit_atom(s, name);
+            emit_ic(s);
             break;
         case OP_scope_get_private_field:
             emit_op(s, OP_scope_get_private_field2);
@@ -23740,6 +26101,7 @@ static void put_lvalue(JSParseState *s, int opcode, int scope,
     case OP_get_field:
         emit_op(s, OP_put_field);
         emit_u32(s, name);  /* name has refcount */
+        emit_ic(s);
         break;
     case OP_scope_get_private_field:
         emit_op(s, OP_scope_put_private_field);
@@ -24001,6 +26363,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                         /* get the named property from the source object */
                         emit_op(s, OP_get_field2);
                         emit_u32(s, prop_name);
+                        emit_ic(s);
                     }
                     if (js_parse_destructuring_element(s, tok, is_arg, TRUE, -1, TRUE) < 0)
                         return -1;
@@ -24090,6 +26453,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                     /* source -- val */
                     emit_op(s, OP_get_field);
                     emit_u32(s, prop_name);
+                    emit_ic(s);
                 }
             } else {
                 /* prop_type = PROP_TYPE_VAR, cannot be a computed property */
@@ -24121,6 +26485,7 @@ static int js_parse_destructuring_element(JSParseState *s, int tok, int is_arg,
                 /* source -- source val */
                 emit_op(s, OP_get_field2);
                 emit_u32(s, prop_name);
+                emit_ic(s);
             }
         set_val:
             if (tok) {
@@ -24931,6 +27296,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
                     }
                     emit_op(s, OP_get_field);
                     emit_atom(s, s->token.u.ident.atom);
+                    emit_ic(s);
                 }
             }
             if (next_token(s))
@@ -25026,8 +27392,9 @@ static __exception int js_parse_delete(JSParseState *s)
 /* allowed parse_flags: PF_ARROW_FUNC, PF_POW_ALLOWED, PF_POW_FORBIDDEN */
 static __exception int js_parse_unary(JSParseState *s, int parse_flags)
 {
-    int op;
+    int op, pos1, pos2, opcode;
 
+    pos1 = s->cur_func->byte_code.size;
     switch(s->token.val) {
     case '+':
     case '-':
@@ -25041,16 +27408,19 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             return -1;
         switch(op) {
         case '-':
-            emit_op(s, OP_neg);
-            break;
+            opcode = OP_neg;
+            goto unary_op;
         case '+':
-            emit_op(s, OP_plus);
-            break;
+            opcode = OP_plus;
+            goto unary_op;
         case '!':
-            emit_op(s, OP_lnot);
-            break;
+            opcode = OP_lnot;
+            goto unary_op;
         case '~':
-            emit_op(s, OP_not);
+            opcode = OP_not;
+        unary_op:
+            if (emit_op_fold(s, opcode, pos1, -1))
+                return -1;
             break;
         case TOK_VOID:
             emit_op(s, OP_drop);
@@ -25091,7 +27461,8 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             if (get_prev_opcode(fd) == OP_scope_get_var) {
                 fd->byte_code.buf[fd->last_opcode_pos] = OP_scope_get_var_undef;
             }
-            emit_op(s, OP_typeof);
+            if (emit_op_fold(s, OP_typeof, pos1, -1))
+                return -1;
             parse_flags = 0;
         }
         break;
@@ -25145,9 +27516,11 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             }
             if (next_token(s))
                 return -1;
+            pos2 = s->cur_func->byte_code.size;
             if (js_parse_unary(s, PF_POW_ALLOWED))
                 return -1;
-            emit_op(s, OP_pow);
+            if (emit_op_fold(s, OP_pow, pos1, pos2))
+                return -1;
         }
 #else
         if (s->token.val == TOK_POW) {
@@ -25162,9 +27535,11 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
             }
             if (next_token(s))
                 return -1;
+            pos2 = s->cur_func->byte_code.size;
             if (js_parse_unary(s, PF_POW_ALLOWED))
                 return -1;
-            emit_op(s, OP_pow);
+            if (emit_op_fold(s, OP_pow, pos1, pos2))
+                return -1;
         }
 #endif
     }
@@ -25175,12 +27550,13 @@ static __exception int js_parse_unary(JSParseState *s, int parse_flags)
 static __exception int js_parse_expr_binary(JSParseState *s, int level,
                                             int parse_flags)
 {
-    int op, opcode;
+    int op, opcode, pos1, pos2;
 
     if (level == 0) {
         return js_parse_unary(s, (parse_flags & PF_ARROW_FUNC) |
                               PF_POW_ALLOWED);
     }
+    pos1 = s->cur_func->byte_code.size;
     if (js_parse_expr_binary(s, level - 1, parse_flags))
         return -1;
     for(;;) {
@@ -25311,9 +27687,22 @@ static __exception int js_parse_expr_binary(JSParseState *s, int level,
         }
         if (next_token(s))
             return -1;
+        pos2 = s->cur_func->byte_code.size;
         if (js_parse_expr_binary(s, level - 1, parse_flags & ~PF_ARROW_FUNC))
             return -1;
-        emit_op(s, opcode);
+        switch(opcode) {
+        case OP_instanceof:
+        case OP_in:
+#ifdef CONFIG_BIGNUM
+        case OP_math_mod:
+#endif
+            emit_op(s, opcode);
+            break;
+        default:
+            if (emit_op_fold(s, opcode, pos1, pos2))
+                return -1;
+            break;
+        }
     }
     return 0;
 }
@@ -25476,12 +27865,14 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             label_next = emit_goto(s, OP_if_true, -1); /* end of loop */
             emit_label(s, label_yield);
             if (is_async) {
                 /* OP_async_yield_star takes the value as parameter */
                 emit_op(s, OP_get_field);
                 emit_atom(s, JS_ATOM_value);
+                emit_ic(s);
                 emit_op(s, OP_await);
                 emit_op(s, OP_async_yield_star);
             } else {
@@ -25510,10 +27901,12 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             emit_goto(s, OP_if_false, label_yield);
 
             emit_op(s, OP_get_field);
             emit_atom(s, JS_ATOM_value);
+            emit_ic(s);
             
             emit_label(s, label_return1);
             emit_op(s, OP_nip);
@@ -25531,6 +27924,7 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_op(s, OP_iterator_check_object);
             emit_op(s, OP_get_field2);
             emit_atom(s, JS_ATOM_done);
+            emit_ic(s);
             emit_goto(s, OP_if_false, label_yield);
             emit_goto(s, OP_goto, label_next);
             /* close the iterator and throw a type error exception */
@@ -25549,6 +27943,7 @@ static __exception int js_parse_assign_expr2(JSParseState *s, int parse_flags)
             emit_label(s, label_next);
             emit_op(s, OP_get_field);
             emit_atom(s, JS_ATOM_value);
+            emit_ic(s);
             emit_op(s, OP_nip); /* keep the value associated with
                                    done = true */
             emit_op(s, OP_nip);
@@ -25800,6 +28195,7 @@ static void emit_return(JSParseState *s, BOOL hasval)
                 emit_op(s, OP_drop); /* next */
                 emit_op(s, OP_get_field2);
                 emit_atom(s, JS_ATOM_return);
+                emit_ic(s);
                 /* stack: iter_obj return_func */
                 emit_op(s, OP_dup);
                 emit_op(s, OP_is_undefined_or_null);
@@ -27843,7 +30239,7 @@ static int js_resolve_module(JSContext *ctx, JSModuleDef *m)
 static JSVarRef *js_create_module_var(JSContext *ctx, BOOL is_lexical)
 {
     JSVarRef *var_ref;
-    var_ref = js_malloc(ctx, sizeof(JSVarRef));
+    var_ref = js_pool_alloc(ctx, sizeof(JSVarRef));
     if (!var_ref)
         return NULL;
     var_ref->header.ref_count = 1;
@@ -28144,6 +30540,11 @@ JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m)
     return JS_DupAtom(ctx, m->module_name);
 }
 
+JSValue JS_GetModuleNamespace(JSContext *ctx, JSModuleDef *m)
+{
+    return js_get_module_ns(ctx, m);
+}
+
 JSValue JS_GetImportMeta(JSContext *ctx, JSModuleDef *m)
 {
     JSValue obj;
@@ -28214,7 +30615,7 @@ static JSValue js_dynamic_import_job(JSContext *ctx,
     const char *basename = NULL, *filename;
     JSValue ret, err, ns;
 
-    if (!JS_IsString(basename_val)) {
+    if (!js_is_string(basename_val)) {
         JS_ThrowTypeError(ctx, "no function filename for import()");
         goto exception;
     }
@@ -28796,6 +31197,7 @@ static void free_bytecode_atoms(JSRuntime *rt,
         case OP_FMT_atom_u16:
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
+        case OP_FMT_atom_u16_loc:
             atom = get_u32(bc_buf + pos + 1);
             JS_FreeAtomRT(rt, atom);
             break;
@@ -29096,6 +31498,16 @@ static void dump_byte_code(JSContext *ctx, int pass,
             print_atom(ctx, get_u32(tab + pos));
             printf(",%d", get_u16(tab + pos + 4));
             break;
+        case OP_FMT_atom_u16_loc:
+            printf(" ");
+            print_atom(ctx, get_u32(tab + pos));
+            printf(",%d", get_u16(tab + pos + 4));
+            idx = get_u16(tab + pos + 6);
+            printf(" %d: ", idx);
+            if (idx < var_count) {
+                print_atom(ctx, vars[idx].var_name);
+            }
+            break;
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
             printf(" ");
@@ -31342,6 +33754,30 @@ static void put_short_code(DynBuf *bc_out, int op, int idx)
     dbuf_put_u16(bc_out, idx);
 }
 
+/* match get_field(a) or get_field2(a) with a != length */
+static BOOL code_match_get_field(CodeContext *cc, int pos)
+{
+    if (!code_match(cc, pos, M2(OP_get_field, OP_get_field2), -1))
+        return FALSE;
+    /* get_length is used for 'length' */
+    return (cc->op == OP_get_field2 || cc->atom != JS_ATOM_length);
+}
+
+/* allocate the inline cache of a property access opcode */
+static void put_ic_index(JSFunctionDef *s, DynBuf *bc_out)
+{
+    int idx;
+
+    if (s->ic_count < JS_IC_NONE) {
+        idx = s->ic_count++;
+    } else {
+        /* the last inline cache is shared and never filled */
+        idx = JS_IC_NONE;
+        s->ic_count = JS_IC_NONE + 1;
+    }
+    dbuf_put_u16(bc_out, idx);
+}
+
 /* peephole optimizations and resolve goto/labels */
 static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
 {
@@ -31786,8 +34222,10 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 }
             }
             goto no_change;
+#endif
 
         case OP_get_field:
+#if SHORT_OPCODES
             if (OPTIMIZE) {
                 JSAtom atom = get_u32(bc_buf + pos + 1);
                 if (atom == JS_ATOM_length) {
@@ -31797,8 +34235,14 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     break;
                 }
             }
-            goto no_change;
 #endif
+            /* fall thru */
+        case OP_get_field2:
+        case OP_put_field:
+            add_pc2line_info(s, bc_out.size, line_num);
+            dbuf_put(&bc_out, bc_buf + pos, 5);
+            put_ic_index(s, &bc_out);
+            break;
         case OP_push_atom_value:
             if (OPTIMIZE) {
                 JSAtom atom = get_u32(bc_buf + pos + 1);
@@ -31887,6 +34331,8 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     add_pc2line_info(s, bc_out.size, line_num);
                     dbuf_putc(&bc_out, cc.op);
                     dbuf_put_u32(&bc_out, cc.atom);
+                    if (cc.op == OP_put_field)
+                        put_ic_index(s, &bc_out);
                     pos_next = cc.pos;
                     break;
                 }
@@ -31922,16 +34368,30 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
 
         case OP_get_loc:
             if (OPTIMIZE) {
+                int idx;
+                idx = get_u16(bc_buf + pos + 1);
+                if (code_match_get_field(&cc, pos_next)) {
+                    /* transformation:
+                       get_loc(n) get_field(a) -> get_loc_get_field(a, n)
+                       get_loc(n) get_field2(a) -> get_loc_get_field2(a, n)
+                    */
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    dbuf_putc(&bc_out, OP_get_loc_get_field + cc.op - OP_get_field);
+                    dbuf_put_u32(&bc_out, cc.atom);
+                    put_ic_index(s, &bc_out);
+                    dbuf_put_u16(&bc_out, idx);
+                    pos_next = cc.pos;
+                    break;
+                }
+                if (idx >= 256)
+                    goto no_change;
                 /* transformation:
                    get_loc(n) post_dec put_loc(n) drop -> dec_loc(n)
                    get_loc(n) post_inc put_loc(n) drop -> inc_loc(n)
                    get_loc(n) dec dup put_loc(n) drop -> dec_loc(n)
                    get_loc(n) inc dup put_loc(n) drop -> inc_loc(n)
                  */
-                int idx;
-                idx = get_u16(bc_buf + pos + 1);
-                if (idx >= 256)
-                    goto no_change;
                 if (code_match(&cc, pos_next, M2(OP_post_dec, OP_post_inc), OP_put_loc, idx, OP_drop, -1) ||
                     code_match(&cc, pos_next, M2(OP_dec, OP_inc), OP_dup, OP_put_loc, idx, OP_drop, -1)) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
@@ -31993,6 +34453,25 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                 break;
             }
             goto no_change;
+        case OP_get_loc_check:
+            if (OPTIMIZE) {
+                /* transformation:
+                   get_loc_check(n) get_field(a) -> get_loc_check_get_field(a, n)
+                   get_loc_check(n) get_field2(a) -> get_loc_check_get_field2(a, n)
+                */
+                if (code_match_get_field(&cc, pos_next)) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    dbuf_putc(&bc_out, OP_get_loc_check_get_field + cc.op - OP_get_field);
+                    dbuf_put_u32(&bc_out, cc.atom);
+                    put_ic_index(s, &bc_out);
+                    dbuf_put_u16(&bc_out, get_u16(bc_buf + pos + 1));
+                    pos_next = cc.pos;
+                    break;
+                }
+            }
+            goto no_change;
+
 #if SHORT_OPCODES
         case OP_get_arg:
         case OP_get_var_ref:
@@ -32010,9 +34489,12 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
         case OP_put_var_ref:
             if (OPTIMIZE) {
                 /* transformation: put_x(n) get_x(n) -> set_x(n) */
+                /* transformation: put_loc(n) get_loc_check(n) -> set_loc(n) */
                 int idx;
                 idx = get_u16(bc_buf + pos + 1);
-                if (code_match(&cc, pos_next, op - 1, idx, -1)) {
+                if (code_match(&cc, pos_next, op - 1, idx, -1) ||
+                    (op == OP_put_loc &&
+                     code_match(&cc, pos_next, OP_get_loc_check, idx, -1))) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
                     add_pc2line_info(s, bc_out.size, line_num);
                     put_short_code(&bc_out, op + 1, idx);
@@ -32025,6 +34507,33 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             }
             goto no_change;
 
+        case OP_lt:
+        case OP_lte:
+        case OP_gt:
+        case OP_gte:
+            if (OPTIMIZE) {
+                /* transformation: lt if_false(l) -> lt_if_false(l) */
+                if (code_match(&cc, pos_next, OP_if_false, -1)) {
+                    int pos1 = cc.pos;
+                    int line1 = cc.line_num;
+                    int label1 = cc.label;
+                    label = find_jump_target(s, label1, &op1, NULL);
+                    /* keep the if_false transformations which remove
+                       or invert the jump */
+                    if (!code_has_label(&cc, pos1, label) &&
+                        !(code_match(&cc, pos1, OP_goto, -1) &&
+                          code_has_label(&cc, cc.pos, label))) {
+                        if (line1 >= 0) line_num = line1;
+                        pos_next = pos1;
+                        op += OP_lt_if_false - OP_lt;
+                        goto has_label;
+                    }
+                    update_label(s, label, -1);
+                    update_label(s, label1, +1);
+                }
+            }
+            goto no_change;
+
         case OP_post_inc:
         case OP_post_dec:
             if (OPTIMIZE) {
@@ -32056,6 +34565,8 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                     dbuf_putc(&bc_out, OP_dec + (op - OP_post_dec));
                     dbuf_putc(&bc_out, cc.op);
                     dbuf_put_u32(&bc_out, cc.atom);
+                    if (cc.op == OP_put_field)
+                        put_ic_index(s, &bc_out);
                     pos_next = cc.pos;
                     break;
                 }
@@ -32370,6 +34881,10 @@ static __exception int compute_stack_size(JSContext *ctx,
         case OP_if_true:
         case OP_if_false:
         case OP_catch:
+        case OP_lt_if_false:
+        case OP_lte_if_false:
+        case OP_gt_if_false:
+        case OP_gte_if_false:
             diff = get_u32(bc_buf + pos + 1);
             if (ss_check(ctx, s, pos + 1 + diff, op, stack_len))
                 goto fail;
@@ -32416,6 +34931,1593 @@ static __exception int compute_stack_size(JSContext *ctx,
     return -1;
 }
 
+#ifdef CONFIG_JIT
+
+/* Baseline JIT for x86-64. Each opcode of a JSFunctionBytecode is
+   translated to a native code template which works directly on the
+   interpreter stack frame (var_buf, arg_buf and the value stack), so
+   that the execution can leave the native code at any opcode
+   boundary. The opcodes without template exit to the interpreter
+   which resumes at the same pc. The exceptions are also handled by
+   the interpreter. The fast paths are inlined and the slow paths call
+   js_jit_op().
+
+   Register usage in the generated code:
+   rbx: stack pointer, r12: var_buf, r13: arg_buf, r14: ctx,
+   r15: JSJitFrame. */
+
+enum {
+    JIT_RAX, JIT_RCX, JIT_RDX, JIT_RBX, JIT_RSP, JIT_RBP, JIT_RSI, JIT_RDI,
+    JIT_R8, JIT_R9, JIT_R10, JIT_R11, JIT_R12, JIT_R13, JIT_R14, JIT_R15,
+};
+
+/* condition codes */
+enum {
+    JIT_CC_O = 0x0,
+    JIT_CC_B = 0x2,
+    JIT_CC_E = 0x4,
+    JIT_CC_NE = 0x5,
+    JIT_CC_A = 0x7,
+    JIT_CC_S = 0x8,
+    JIT_CC_L = 0xc,
+    JIT_CC_GE = 0xd,
+    JIT_CC_LE = 0xe,
+    JIT_CC_G = 0xf,
+};
+
+/* x86 opcodes of the "op reg, r/m" form. Two byte opcodes are
+   prefixed with 0x0f */
+#define X86_ADD     0x03
+#define X86_OR      0x0b
+#define X86_AND     0x23
+#define X86_SUB     0x2b
+#define X86_XOR     0x33
+#define X86_CMP     0x3b
+#define X86_STORE   0x89
+#define X86_LOAD    0x8b
+#define X86_LEA     0x8d
+#define X86_IMUL    0x0faf
+
+typedef struct JSJitReloc {
+    int pos; /* position of the 32 bit displacement in the native code */
+    int target; /* bytecode position */
+} JSJitReloc;
+
+typedef struct JSJitState {
+    JSContext *ctx;
+    JSFunctionBytecode *b;
+    DynBuf code;
+    int sp_offset; /* pending stack pointer adjustment, in bytes */
+    int exc_epilogue_pos;
+    int epilogue_pos;
+    int *native_pos; /* native code position of each opcode */
+    uint8_t *is_target; /* TRUE if the bytecode position is a jump target */
+    JSJitReloc *jumps;
+    int jump_count;
+    int jump_size;
+    JSJitReloc *exc_stubs; /* target is the pc used for the exception */
+    int exc_stub_count;
+    int exc_stub_size;
+} JSJitState;
+
+static void js_jit_free_value(JSContext *ctx, void *ptr, int64_t tag)
+{
+    __JS_FreeValueRT(ctx->rt, JS_MKPTR(tag, ptr));
+}
+
+static int js_jit_to_bool(JSContext *ctx, JSValue *pv)
+{
+    return JS_ToBoolFree(ctx, *pv);
+}
+
+/* Execute 'opcode' whose operands start at 'pc'. Used for the opcodes
+   without native template and for the slow paths of the templates, so
+   it must implement the complete semantics of each opcode. The non
+   trivial cases use the helpers of JS_CallInternal(). Return -1 if
+   exception with f->sp set to the stack pointer to unwind. */
+static int js_jit_op(JSJitFrame *f, JSValue *sp, const uint8_t *pc,
+                     int opcode)
+{
+    JSContext *ctx = f->ctx;
+    JSFunctionBytecode *b = f->b;
+    JSValue *var_buf = f->var_buf;
+    JSValue ret_val, *call_argv;
+    int call_argc, i, idx, ret;
+
+    switch(opcode) {
+    case OP_push_const:
+        *sp++ = JS_DupValue(ctx, b->cpool[get_u32(pc)]);
+        break;
+    case OP_push_const8:
+        *sp++ = JS_DupValue(ctx, b->cpool[*pc]);
+        break;
+    case OP_fclosure:
+    case OP_fclosure8:
+        idx = (opcode == OP_fclosure) ? get_u32(pc) : *pc;
+        *sp++ = js_closure(ctx, JS_DupValue(ctx, b->cpool[idx]),
+                           f->var_refs, f->sf);
+        if (unlikely(JS_IsException(sp[-1])))
+            goto exception;
+        break;
+    case OP_push_atom_value:
+        *sp++ = JS_AtomToValue(ctx, get_u32(pc));
+        break;
+    case OP_push_empty_string:
+        *sp++ = JS_AtomToString(ctx, JS_ATOM_empty_string);
+        break;
+    case OP_push_this:
+        ret_val = js_op_push_this(ctx, b, f->this_obj);
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        *sp++ = ret_val;
+        break;
+    case OP_object:
+        *sp++ = JS_NewObject(ctx);
+        if (unlikely(JS_IsException(sp[-1])))
+            goto exception;
+        break;
+
+    case OP_call0:
+    case OP_call1:
+    case OP_call2:
+    case OP_call3:
+    case OP_call:
+    case OP_call_method:
+    case OP_call_constructor:
+        if (opcode == OP_call || opcode == OP_call_method ||
+            opcode == OP_call_constructor) {
+            call_argc = get_u16(pc);
+            pc += 2;
+        } else {
+            call_argc = opcode - OP_call0;
+        }
+        call_argv = sp - call_argc;
+        f->sf->cur_pc = pc;
+        if (opcode == OP_call_constructor) {
+            ret_val = JS_CallConstructorInternal(ctx, call_argv[-2],
+                                                 call_argv[-1],
+                                                 call_argc, call_argv, 0);
+        } else {
+            ret_val = JS_CallInternal(ctx, call_argv[-1],
+                                      opcode == OP_call_method ?
+                                      call_argv[-2] : JS_UNDEFINED,
+                                      JS_UNDEFINED, call_argc, call_argv, 0);
+        }
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        i = (opcode == OP_call_method || opcode == OP_call_constructor) ? -2 : -1;
+        sp = call_argv + i;
+        for(; i < call_argc; i++)
+            JS_FreeValue(ctx, call_argv[i]);
+        *sp++ = ret_val;
+        break;
+    case OP_array_from:
+        call_argc = get_u16(pc);
+        ret_val = js_op_array_from(ctx, sp - call_argc, call_argc);
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        sp -= call_argc;
+        *sp++ = ret_val;
+        break;
+
+    case OP_get_var_undef:
+    case OP_get_var:
+        ret_val = js_op_get_var(ctx, b, get_u32(pc), opcode - OP_get_var_undef);
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        *sp++ = ret_val;
+        break;
+    case OP_put_var:
+    case OP_put_var_init:
+        ret = js_op_put_var(ctx, b, get_u32(pc), sp[-1], opcode);
+        sp--;
+        if (unlikely(ret < 0))
+            goto exception;
+        break;
+
+    case OP_get_loc_check:
+    case OP_put_loc_check:
+        idx = get_u16(pc);
+        if (unlikely(JS_IsUninitialized(var_buf[idx]))) {
+            JS_ThrowReferenceErrorUninitialized2(ctx, b, idx, FALSE);
+            goto exception;
+        }
+        if (opcode == OP_get_loc_check) {
+            *sp++ = JS_DupValue(ctx, var_buf[idx]);
+        } else {
+            set_value(ctx, &var_buf[idx], sp[-1]);
+            sp--;
+        }
+        break;
+    case OP_set_loc_uninitialized:
+        set_value(ctx, &var_buf[get_u16(pc)], JS_UNINITIALIZED);
+        break;
+    case OP_get_var_ref_check:
+    case OP_put_var_ref_check:
+        {
+            JSValue *pv;
+            idx = get_u16(pc);
+            pv = f->var_refs[idx]->pvalue;
+            if (unlikely(JS_IsUninitialized(*pv))) {
+                JS_ThrowReferenceErrorUninitialized2(ctx, b, idx, TRUE);
+                goto exception;
+            }
+            if (opcode == OP_get_var_ref_check) {
+                *sp++ = JS_DupValue(ctx, *pv);
+            } else {
+                set_value(ctx, pv, sp[-1]);
+                sp--;
+            }
+        }
+        break;
+
+    case OP_get_length:
+        ret_val = JS_GetProperty(ctx, sp[-1], JS_ATOM_length);
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = ret_val;
+        break;
+    case OP_get_field:
+    case OP_get_field2:
+    case OP_get_loc_get_field:
+    case OP_get_loc_get_field2:
+    case OP_get_loc_check_get_field:
+    case OP_get_loc_check_get_field2:
+        if (opcode >= OP_get_loc_get_field) {
+            idx = get_u16(pc + 6);
+            if (opcode >= OP_get_loc_check_get_field &&
+                unlikely(JS_IsUninitialized(var_buf[idx]))) {
+                JS_ThrowReferenceErrorUninitialized2(ctx, b, idx, FALSE);
+                goto exception;
+            }
+            *sp++ = JS_DupValue(ctx, var_buf[idx]);
+        }
+        ret_val = js_op_get_field(ctx, b, sp[-1], get_u32(pc), get_u16(pc + 4));
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        if (opcode == OP_get_field2 ||
+            (opcode >= OP_get_loc_get_field &&
+             ((opcode - OP_get_loc_get_field) & 1))) {
+            *sp++ = ret_val;
+        } else {
+            JS_FreeValue(ctx, sp[-1]);
+            sp[-1] = ret_val;
+        }
+        break;
+    case OP_put_field:
+        ret = js_op_put_field(ctx, b, sp[-2], get_u32(pc), sp[-1],
+                              get_u16(pc + 4));
+        JS_FreeValue(ctx, sp[-2]);
+        sp -= 2;
+        if (unlikely(ret < 0))
+            goto exception;
+        break;
+    case OP_get_array_el:
+    case OP_get_array_el2:
+        ret_val = JS_GetPropertyValue(ctx, sp[-2], sp[-1]);
+        if (opcode == OP_get_array_el) {
+            JS_FreeValue(ctx, sp[-2]);
+            sp[-2] = ret_val;
+            sp--;
+        } else {
+            sp[-1] = ret_val;
+        }
+        if (unlikely(JS_IsException(ret_val)))
+            goto exception;
+        break;
+    case OP_put_array_el:
+        ret = JS_SetPropertyValue(ctx, sp[-3], sp[-2], sp[-1], JS_PROP_THROW_STRICT);
+        JS_FreeValue(ctx, sp[-3]);
+        sp -= 3;
+        if (unlikely(ret < 0))
+            goto exception;
+        break;
+    case OP_to_propkey:
+    case OP_to_propkey2:
+        if (js_op_to_propkey(ctx, sp, opcode))
+            goto exception;
+        break;
+
+    case OP_add:
+        if (js_add_slow(ctx, sp))
+            goto exception;
+        sp--;
+        break;
+    case OP_add_loc:
+        sp--;
+        if (js_add_loc_slow(ctx, &var_buf[*pc], sp[0]))
+            goto exception;
+        break;
+    case OP_sub:
+    case OP_mul:
+    case OP_div:
+    case OP_mod:
+        if (js_binary_arith_slow(ctx, sp, opcode))
+            goto exception;
+        sp--;
+        break;
+    case OP_plus:
+    case OP_neg:
+    case OP_inc:
+    case OP_dec:
+        if (js_unary_arith_slow(ctx, sp, opcode))
+            goto exception;
+        break;
+    case OP_inc_loc:
+    case OP_dec_loc:
+        if (js_inc_loc_slow(ctx, &var_buf[*pc], opcode))
+            goto exception;
+        break;
+    case OP_post_inc:
+    case OP_post_dec:
+        if (js_post_inc_slow(ctx, sp, opcode))
+            goto exception;
+        sp++;
+        break;
+    case OP_not:
+        if (js_not_slow(ctx, sp))
+            goto exception;
+        break;
+    case OP_lnot:
+        sp[-1] = JS_NewBool(ctx, !JS_ToBoolFree(ctx, sp[-1]));
+        break;
+    case OP_shl:
+    case OP_sar:
+    case OP_and:
+    case OP_or:
+    case OP_xor:
+        if (js_binary_logic_slow(ctx, sp, opcode))
+            goto exception;
+        sp--;
+        break;
+    case OP_shr:
+        if (js_shr_slow(ctx, sp))
+            goto exception;
+        sp--;
+        break;
+    case OP_lt:
+    case OP_lte:
+    case OP_gt:
+    case OP_gte:
+        if (js_relational_slow(ctx, sp, opcode))
+            goto exception;
+        sp--;
+        break;
+    case OP_eq:
+    case OP_neq:
+        if (js_eq_slow(ctx, sp, opcode == OP_neq))
+            goto exception;
+        sp--;
+        break;
+    case OP_strict_eq:
+    case OP_strict_neq:
+        if (js_strict_eq_slow(ctx, sp, opcode == OP_strict_neq))
+            goto exception;
+        sp--;
+        break;
+    case OP_typeof:
+        {
+            JSAtom atom;
+            atom = js_operator_typeof(ctx, sp[-1]);
+            JS_FreeValue(ctx, sp[-1]);
+            sp[-1] = JS_AtomToString(ctx, atom);
+        }
+        break;
+    case OP_is_undefined_or_null:
+        i = (JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_UNDEFINED ||
+             JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_NULL);
+        goto set_bool;
+    case OP_is_undefined:
+        i = (JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_UNDEFINED);
+        goto set_bool;
+    case OP_is_null:
+        i = (JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_NULL);
+        goto set_bool;
+    case OP_typeof_is_undefined:
+        i = (js_operator_typeof(ctx, sp[-1]) == JS_ATOM_undefined);
+        goto set_bool;
+    case OP_typeof_is_function:
+        i = (js_operator_typeof(ctx, sp[-1]) == JS_ATOM_function);
+    set_bool:
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = JS_NewBool(ctx, i);
+        break;
+    default:
+        abort();
+    }
+    return 0;
+ exception:
+    f->sp = sp;
+    return -1;
+}
+
+/* return TRUE if js_jit_op() implements the opcode */
+static BOOL js_jit_has_op(int op)
+{
+    switch(op) {
+    case OP_push_const:
+    case OP_push_const8:
+    case OP_fclosure:
+    case OP_fclosure8:
+    case OP_push_atom_value:
+    case OP_push_empty_string:
+    case OP_push_this:
+    case OP_object:
+    case OP_call0:
+    case OP_call1:
+    case OP_call2:
+    case OP_call3:
+    case OP_call:
+    case OP_call_method:
+    case OP_call_constructor:
+    case OP_array_from:
+    case OP_get_var_undef:
+    case OP_get_var:
+    case OP_put_var:
+    case OP_put_var_init:
+    case OP_put_loc_check:
+    case OP_set_loc_uninitialized:
+    case OP_get_var_ref_check:
+    case OP_put_var_ref_check:
+    case OP_get_length:
+    case OP_get_field:
+    case OP_get_field2:
+    case OP_get_loc_get_field:
+    case OP_get_loc_get_field2:
+    case OP_get_loc_check_get_field:
+    case OP_get_loc_check_get_field2:
+    case OP_put_field:
+    case OP_get_array_el:
+    case OP_get_array_el2:
+    case OP_put_array_el:
+    case OP_to_propkey:
+    case OP_to_propkey2:
+    case OP_div:
+    case OP_mod:
+    case OP_plus:
+    case OP_neg:
+    case OP_post_inc:
+    case OP_post_dec:
+    case OP_not:
+    case OP_lnot:
+    case OP_shr:
+    case OP_typeof:
+    case OP_is_undefined_or_null:
+    case OP_is_undefined:
+    case OP_is_null:
+    case OP_typeof_is_undefined:
+    case OP_typeof_is_function:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+static void jit_putc(JSJitState *s, int c)
+{
+    dbuf_putc(&s->code, c);
+}
+
+static void jit_put32(JSJitState *s, uint32_t v)
+{
+    dbuf_put_u32(&s->code, v);
+}
+
+static void jit_rex(JSJitState *s, int w, int reg, int base)
+{
+    int rex = 0x40 | (w << 3) | ((reg >> 3) << 2) | (base >> 3);
+    if (rex != 0x40)
+        jit_putc(s, rex);
+}
+
+static void jit_opcode(JSJitState *s, int op)
+{
+    if (op > 0xff)
+        jit_putc(s, op >> 8);
+    jit_putc(s, op & 0xff);
+}
+
+/* ModRM byte for [base + disp] */
+static void jit_modrm_mem(JSJitState *s, int reg, int base, int disp)
+{
+    int mod = (disp == (int8_t)disp) ? 1 : 2;
+    jit_putc(s, (mod << 6) | ((reg & 7) << 3) | (base & 7));
+    if ((base & 7) == JIT_RSP)
+        jit_putc(s, 0x24); /* SIB byte: no index */
+    if (mod == 1)
+        jit_putc(s, disp);
+    else
+        jit_put32(s, disp);
+}
+
+/* op reg, [base + disp] ('w' selects the 64 bit operand size) */
+static void jit_op_mem(JSJitState *s, int w, int op, int reg, int base, int disp)
+{
+    jit_rex(s, w, reg, base);
+    jit_opcode(s, op);
+    jit_modrm_mem(s, reg, base, disp);
+}
+
+/* op reg, rm */
+static void jit_op_reg(JSJitState *s, int w, int op, int reg, int rm)
+{
+    jit_rex(s, w, reg, rm);
+    jit_opcode(s, op);
+    jit_putc(s, 0xc0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+/* group 1 operation with an immediate: ext is 0 (add), 1 (or), 4
+   (and), 5 (sub) or 7 (cmp) */
+static void jit_op_mem_imm(JSJitState *s, int w, int ext, int base, int disp,
+                           int32_t imm)
+{
+    if (imm == (int8_t)imm) {
+        jit_op_mem(s, w, 0x83, ext, base, disp);
+        jit_putc(s, imm);
+    } else {
+        jit_op_mem(s, w, 0x81, ext, base, disp);
+        jit_put32(s, imm);
+    }
+}
+
+static void jit_op_reg_imm(JSJitState *s, int w, int ext, int reg, int32_t imm)
+{
+    if (imm == (int8_t)imm) {
+        jit_op_reg(s, w, 0x83, ext, reg);
+        jit_putc(s, imm);
+    } else {
+        jit_op_reg(s, w, 0x81, ext, reg);
+        jit_put32(s, imm);
+    }
+}
+
+/* mov [base + disp], imm (sign extended if 'w') */
+static void jit_store_imm(JSJitState *s, int w, int base, int disp, int32_t imm)
+{
+    jit_op_mem(s, w, 0xc7, 0, base, disp);
+    jit_put32(s, imm);
+}
+
+static void jit_mov_imm64(JSJitState *s, int reg, uint64_t imm)
+{
+    if (imm <= UINT32_MAX) {
+        jit_rex(s, 0, 0, reg);
+        jit_putc(s, 0xb8 + (reg & 7));
+        jit_put32(s, imm);
+    } else {
+        jit_rex(s, 1, 0, reg);
+        jit_putc(s, 0xb8 + (reg & 7));
+        dbuf_put_u64(&s->code, imm);
+    }
+}
+
+static void jit_mov_reg(JSJitState *s, int dst, int src)
+{
+    jit_op_reg(s, 1, X86_STORE, src, dst);
+}
+
+/* scalar double operation on xmm0: 0x10 (load), 0x11 (store), 0x58
+   (add), 0x59 (mul), 0x5c (sub) */
+static void jit_sse_mem(JSJitState *s, int op, int base, int disp)
+{
+    jit_putc(s, 0xf2);
+    jit_op_mem(s, 0, 0x0f00 | op, 0, base, disp);
+}
+
+static void jit_call(JSJitState *s, void *func)
+{
+    jit_mov_imm64(s, JIT_RAX, (uintptr_t)func);
+    jit_op_reg(s, 0, 0xff, 2, JIT_RAX);
+}
+
+/* emit a jump with a 32 bit displacement and return the position of
+   the displacement. 'cc' is -1 for an unconditional jump */
+static int jit_jump(JSJitState *s, int cc)
+{
+    if (cc < 0) {
+        jit_putc(s, 0xe9);
+    } else {
+        jit_putc(s, 0x0f);
+        jit_putc(s, 0x80 + cc);
+    }
+    jit_put32(s, 0);
+    return s->code.size - 4;
+}
+
+static void jit_patch(JSJitState *s, int pos, int target)
+{
+    put_u32(s->code.buf + pos, target - (pos + 4));
+}
+
+/* patch the jump at 'pos' to the current position */
+static void jit_label(JSJitState *s, int pos)
+{
+    jit_patch(s, pos, s->code.size);
+}
+
+static int jit_add_reloc(JSJitState *s, JSJitReloc **ptab, int *pcount,
+                         int *psize, int pos, int target)
+{
+    JSJitReloc *r;
+    if (js_resize_array(s->ctx, (void **)ptab, sizeof(**ptab), psize,
+                        *pcount + 1))
+        return -1;
+    r = &(*ptab)[(*pcount)++];
+    r->pos = pos;
+    r->target = target;
+    return 0;
+}
+
+/* jump to the bytecode position 'target' */
+static int jit_jump_to(JSJitState *s, int cc, int target)
+{
+    int pos = jit_jump(s, cc);
+    return jit_add_reloc(s, &s->jumps, &s->jump_count, &s->jump_size,
+                         pos, target);
+}
+
+/* jump to an exception stub which sets the interpreter pc to
+   'pc_pos'. The stack pointer must already be stored in the frame. */
+static int jit_jump_exception(JSJitState *s, int cc, int pc_pos)
+{
+    int pos = jit_jump(s, cc);
+    return jit_add_reloc(s, &s->exc_stubs, &s->exc_stub_count,
+                         &s->exc_stub_size, pos, pc_pos);
+}
+
+/* stack slot 'n' relative to the current stack pointer */
+static int jit_sp(JSJitState *s, int n)
+{
+    return s->sp_offset + n * (int)sizeof(JSValue);
+}
+
+static void jit_flush_sp(JSJitState *s)
+{
+    if (s->sp_offset != 0) {
+        jit_op_mem(s, 1, X86_LEA, JIT_RBX, JIT_RBX, s->sp_offset);
+        s->sp_offset = 0;
+    }
+}
+
+static void jit_load_value(JSJitState *s, int reg_u, int reg_tag,
+                           int base, int disp)
+{
+    jit_op_mem(s, 1, X86_LOAD, reg_u, base, disp);
+    jit_op_mem(s, 1, X86_LOAD, reg_tag, base, disp + 8);
+}
+
+static void jit_store_value(JSJitState *s, int base, int disp,
+                            int reg_u, int reg_tag)
+{
+    jit_op_mem(s, 1, X86_STORE, reg_u, base, disp);
+    jit_op_mem(s, 1, X86_STORE, reg_tag, base, disp + 8);
+}
+
+static void jit_push_const(JSJitState *s, int tag, int32_t val)
+{
+    jit_store_imm(s, 1, JIT_RBX, jit_sp(s, 0), val);
+    jit_store_imm(s, 1, JIT_RBX, jit_sp(s, 0) + 8, tag);
+    s->sp_offset += sizeof(JSValue);
+}
+
+/* increment the reference count of the value in rax (pointer) and rcx
+   (tag) */
+static void jit_dup_value(JSJitState *s)
+{
+    int pos;
+    jit_op_reg_imm(s, 0, 7, JIT_RCX, JS_TAG_FIRST);
+    pos = jit_jump(s, JIT_CC_B);
+    jit_op_mem(s, 0, 0xff, 0, JIT_RAX, 0);
+    jit_label(s, pos);
+}
+
+/* free the value in rsi (pointer) and rdx (tag) */
+static void jit_free_value(JSJitState *s)
+{
+    int pos1, pos2;
+    jit_op_reg_imm(s, 0, 7, JIT_RDX, JS_TAG_FIRST);
+    pos1 = jit_jump(s, JIT_CC_B);
+    jit_op_mem(s, 0, 0xff, 1, JIT_RSI, 0);
+    pos2 = jit_jump(s, JIT_CC_G);
+    jit_mov_reg(s, JIT_RDI, JIT_R14);
+    jit_call(s, js_jit_free_value);
+    jit_label(s, pos1);
+    jit_label(s, pos2);
+}
+
+/* copy the stack slot 'src' to 'dst'. The value is left in rax
+   (pointer) and rcx (tag). */
+static void jit_copy_slot(JSJitState *s, int dst, int src)
+{
+    jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, src));
+    jit_store_value(s, JIT_RBX, jit_sp(s, dst), JIT_RAX, JIT_RCX);
+}
+
+/* slots[0] <- slots[1] <- ... <- slots[n - 1] <- slots[0]. The
+   previous value of slots[0] is left in rax and rcx. */
+static void jit_rotate_slots(JSJitState *s, const int8_t *slots, int n)
+{
+    int i;
+    jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, slots[0]));
+    for(i = 0; i < n - 1; i++) {
+        jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, slots[i + 1]));
+        jit_store_value(s, JIT_RBX, jit_sp(s, slots[i]), JIT_RSI, JIT_RDX);
+    }
+    jit_store_value(s, JIT_RBX, jit_sp(s, slots[n - 1]), JIT_RAX, JIT_RCX);
+}
+
+/* return the pointer to the variable of a get_loc/put_loc/set_loc,
+   get_arg/put_arg/set_arg or get_var_ref/put_var_ref/set_var_ref
+   opcode in base + disp. The var_ref pointer is loaded in rdi. */
+static void jit_var_address(JSJitState *s, int kind, int idx,
+                            int *pbase, int *pdisp)
+{
+    switch(kind) {
+    case 0:
+        *pbase = JIT_R12;
+        *pdisp = idx * sizeof(JSValue);
+        break;
+    case 1:
+        *pbase = JIT_R13;
+        *pdisp = idx * sizeof(JSValue);
+        break;
+    default:
+        jit_op_mem(s, 1, X86_LOAD, JIT_RDI, JIT_R15,
+                   offsetof(JSJitFrame, var_refs));
+        jit_op_mem(s, 1, X86_LOAD, JIT_RDI, JIT_RDI, idx * sizeof(JSVarRef *));
+        jit_op_mem(s, 1, X86_LOAD, JIT_RDI, JIT_RDI, offsetof(JSVarRef, pvalue));
+        *pbase = JIT_RDI;
+        *pdisp = 0;
+        break;
+    }
+}
+
+/* call js_jit_op() for 'op' with the operands of the opcode at 'pos'
+   and jump to an exception stub if it fails */
+static int jit_call_op(JSJitState *s, int pos, int op, int pc_pos)
+{
+    const JSOpCode *oi = &short_opcode_info(op);
+    int n_pop;
+
+    jit_mov_reg(s, JIT_RDI, JIT_R15);
+    jit_op_mem(s, 1, X86_LEA, JIT_RSI, JIT_RBX, s->sp_offset);
+    jit_mov_imm64(s, JIT_RDX, (uintptr_t)(s->b->byte_code_buf + pos + 1));
+    jit_mov_imm64(s, JIT_RCX, op);
+    jit_call(s, js_jit_op);
+    jit_op_reg(s, 0, 0x85, JIT_RAX, JIT_RAX); /* test eax, eax */
+    if (jit_jump_exception(s, JIT_CC_NE, pc_pos))
+        return -1;
+    n_pop = oi->n_pop;
+    if (oi->fmt == OP_FMT_npop || oi->fmt == OP_FMT_npop_u16)
+        n_pop += get_u16(s->b->byte_code_buf + pos + 1);
+    else if (oi->fmt == OP_FMT_npopx)
+        n_pop += op - OP_call0;
+    s->sp_offset += (oi->n_push - n_pop) * (int)sizeof(JSValue);
+    return 0;
+}
+
+/* same as POLL_BRANCH() in JS_CallInternal(): count the backward
+   jumps, decrement the interrupt counter and call
+   __js_poll_interrupts() when it reaches zero. The stack pointer must
+   be flushed. */
+static int jit_poll_interrupts(JSJitState *s, int pc_pos, BOOL is_backward)
+{
+    int pos;
+    if (is_backward) {
+        jit_mov_imm64(s, JIT_RAX, (uintptr_t)&s->b->loop_count);
+        jit_op_mem(s, 0, 0xff, 0, JIT_RAX, 0);
+    }
+    jit_op_mem_imm(s, 0, 5, JIT_R14, offsetof(JSContext, interrupt_counter), 1);
+    pos = jit_jump(s, JIT_CC_G);
+    jit_op_mem(s, 1, X86_STORE, JIT_RBX, JIT_R15, offsetof(JSJitFrame, sp));
+    /* the profiler needs the current position */
+    jit_op_mem(s, 1, X86_LOAD, JIT_RAX, JIT_R15, offsetof(JSJitFrame, sf));
+    jit_mov_imm64(s, JIT_RCX, (uintptr_t)(s->b->byte_code_buf + pc_pos));
+    jit_op_mem(s, 1, X86_STORE, JIT_RCX, JIT_RAX,
+               offsetof(JSStackFrame, cur_pc));
+    jit_mov_reg(s, JIT_RDI, JIT_R14);
+    jit_call(s, __js_poll_interrupts);
+    jit_op_reg(s, 0, 0x85, JIT_RAX, JIT_RAX);
+    if (jit_jump_exception(s, JIT_CC_NE, pc_pos))
+        return -1;
+    jit_label(s, pos);
+    return 0;
+}
+
+/* leave the native code and resume the interpreter at 'pos' */
+static void jit_exit(JSJitState *s, int pos)
+{
+    jit_flush_sp(s);
+    jit_op_mem(s, 1, X86_STORE, JIT_RBX, JIT_R15, offsetof(JSJitFrame, sp));
+    jit_mov_imm64(s, JIT_RAX, (uintptr_t)(s->b->byte_code_buf + pos));
+    jit_op_mem(s, 1, X86_STORE, JIT_RAX, JIT_R15, offsetof(JSJitFrame, pc));
+    jit_op_reg(s, 0, X86_XOR, JIT_RAX, JIT_RAX);
+    jit_patch(s, jit_jump(s, -1), s->epilogue_pos);
+}
+
+/* leave the native code and return f->ret_val from the function */
+static void jit_return(JSJitState *s)
+{
+    jit_flush_sp(s);
+    jit_op_mem(s, 1, X86_STORE, JIT_RBX, JIT_R15, offsetof(JSJitFrame, sp));
+    jit_mov_imm64(s, JIT_RAX, 1);
+    jit_patch(s, jit_jump(s, -1), s->epilogue_pos);
+}
+
+/* integer binary operation with a float64 fast path for add, sub
+   and mul */
+static int jit_binary_arith(JSJitState *s, int pos, int op, int pc_pos)
+{
+    int slow1 = -1, slow2 = -1, slow3 = -1, slow4 = -1, done1, done2 = -1;
+    int not_int, alu, sse_op;
+
+    jit_op_mem(s, 1, X86_LOAD, JIT_RAX, JIT_RBX, jit_sp(s, -2) + 8);
+    jit_op_mem(s, 1, X86_OR, JIT_RAX, JIT_RBX, jit_sp(s, -1) + 8);
+    not_int = jit_jump(s, JIT_CC_NE);
+    jit_op_mem(s, 0, X86_LOAD, JIT_RAX, JIT_RBX, jit_sp(s, -2));
+    switch(op) {
+    case OP_shl:
+    case OP_sar:
+        jit_op_mem(s, 0, X86_LOAD, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+        jit_op_reg(s, 0, 0xd3, op == OP_shl ? 4 : 7, JIT_RAX);
+        break;
+    default:
+        switch(op) {
+        case OP_add: alu = X86_ADD; break;
+        case OP_sub: alu = X86_SUB; break;
+        case OP_mul: alu = X86_IMUL; break;
+        case OP_and: alu = X86_AND; break;
+        case OP_or: alu = X86_OR; break;
+        default: alu = X86_XOR; break;
+        }
+        jit_op_mem(s, 0, alu, JIT_RAX, JIT_RBX, jit_sp(s, -1));
+        if (op == OP_add || op == OP_sub || op == OP_mul)
+            slow1 = jit_jump(s, JIT_CC_O);
+        if (op == OP_mul) {
+            int pos1;
+            /* the result is -0 if one operand is negative */
+            jit_op_reg(s, 0, 0x85, JIT_RAX, JIT_RAX);
+            pos1 = jit_jump(s, JIT_CC_NE);
+            jit_op_mem(s, 0, X86_LOAD, JIT_RCX, JIT_RBX, jit_sp(s, -2));
+            jit_op_mem(s, 0, X86_OR, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            slow2 = jit_jump(s, JIT_CC_S);
+            jit_label(s, pos1);
+        }
+        break;
+    }
+    jit_op_mem(s, 0, X86_STORE, JIT_RAX, JIT_RBX, jit_sp(s, -2));
+    done1 = jit_jump(s, -1);
+    jit_label(s, not_int);
+    if (op == OP_add || op == OP_sub || op == OP_mul) {
+        if (op == OP_add)
+            sse_op = 0x58;
+        else if (op == OP_sub)
+            sse_op = 0x5c;
+        else
+            sse_op = 0x59;
+        jit_op_mem_imm(s, 1, 7, JIT_RBX, jit_sp(s, -2) + 8, JS_TAG_FLOAT64);
+        slow3 = jit_jump(s, JIT_CC_NE);
+        jit_op_mem_imm(s, 1, 7, JIT_RBX, jit_sp(s, -1) + 8, JS_TAG_FLOAT64);
+        slow4 = jit_jump(s, JIT_CC_NE);
+        jit_sse_mem(s, 0x10, JIT_RBX, jit_sp(s, -2));
+        jit_sse_mem(s, sse_op, JIT_RBX, jit_sp(s, -1));
+        jit_sse_mem(s, 0x11, JIT_RBX, jit_sp(s, -2));
+        done2 = jit_jump(s, -1);
+    }
+    if (slow1 >= 0)
+        jit_label(s, slow1);
+    if (slow2 >= 0)
+        jit_label(s, slow2);
+    if (slow3 >= 0) {
+        jit_label(s, slow3);
+        jit_label(s, slow4);
+    }
+    if (jit_call_op(s, pos, op, pc_pos))
+        return -1;
+    jit_label(s, done1);
+    if (done2 >= 0)
+        jit_label(s, done2);
+    /* jit_call_op() already popped the operand */
+    return 0;
+}
+
+/* integer comparison. If 'target' >= 0, the result is used to jump to
+   'target' if false and the stack pointer must be flushed. */
+static int jit_compare(JSJitState *s, int pos, int op, int pc_pos,
+                       int target)
+{
+    int not_int, done, cc;
+
+    switch(op) {
+    case OP_lt: cc = JIT_CC_L; break;
+    case OP_lte: cc = JIT_CC_LE; break;
+    case OP_gt: cc = JIT_CC_G; break;
+    case OP_gte: cc = JIT_CC_GE; break;
+    case OP_eq:
+    case OP_strict_eq: cc = JIT_CC_E; break;
+    default: cc = JIT_CC_NE; break;
+    }
+    jit_op_mem(s, 1, X86_LOAD, JIT_RAX, JIT_RBX, jit_sp(s, -2) + 8);
+    jit_op_mem(s, 1, X86_OR, JIT_RAX, JIT_RBX, jit_sp(s, -1) + 8);
+    not_int = jit_jump(s, JIT_CC_NE);
+    jit_op_mem(s, 0, X86_LOAD, JIT_RAX, JIT_RBX, jit_sp(s, -2));
+    jit_op_mem(s, 0, X86_CMP, JIT_RAX, JIT_RBX, jit_sp(s, -1));
+    if (target >= 0) {
+        /* lea does not modify the flags */
+        s->sp_offset -= 2 * sizeof(JSValue);
+        jit_flush_sp(s);
+        if (jit_jump_to(s, cc ^ 1, target))
+            return -1;
+        done = jit_jump(s, -1);
+        jit_label(s, not_int);
+        s->sp_offset = 0;
+        if (jit_call_op(s, pos, op, pc_pos))
+            return -1;
+        jit_mov_reg(s, JIT_RDI, JIT_R14);
+        jit_op_mem(s, 1, X86_LEA, JIT_RSI, JIT_RBX, jit_sp(s, -1));
+        jit_call(s, js_jit_to_bool);
+        s->sp_offset -= sizeof(JSValue);
+        jit_flush_sp(s);
+        jit_op_reg(s, 0, 0x85, JIT_RAX, JIT_RAX);
+        if (jit_jump_to(s, JIT_CC_E, target))
+            return -1;
+        jit_label(s, done);
+    } else {
+        /* setcc al; movzx eax, al */
+        jit_putc(s, 0x0f);
+        jit_putc(s, 0x90 + cc);
+        jit_putc(s, 0xc0);
+        jit_op_reg(s, 0, 0x0fb6, JIT_RAX, JIT_RAX);
+        jit_op_mem(s, 0, X86_STORE, JIT_RAX, JIT_RBX, jit_sp(s, -2));
+        jit_store_imm(s, 1, JIT_RBX, jit_sp(s, -2) + 8, JS_TAG_BOOL);
+        done = jit_jump(s, -1);
+        jit_label(s, not_int);
+        if (jit_call_op(s, pos, op, pc_pos))
+            return -1;
+        jit_label(s, done);
+    }
+    return 0;
+}
+
+/* inc, dec on the stack top or on a local variable */
+static int jit_inc_dec(JSJitState *s, int pos, int op, int pc_pos,
+                       int base, int disp)
+{
+    int slow1, slow2, done;
+
+    jit_op_mem_imm(s, 1, 7, base, disp + 8, JS_TAG_INT);
+    slow1 = jit_jump(s, JIT_CC_NE);
+    jit_op_mem(s, 0, X86_LOAD, JIT_RAX, base, disp);
+    jit_op_reg_imm(s, 0, (op == OP_inc || op == OP_inc_loc) ? 0 : 5,
+                   JIT_RAX, 1);
+    slow2 = jit_jump(s, JIT_CC_O);
+    jit_op_mem(s, 0, X86_STORE, JIT_RAX, base, disp);
+    done = jit_jump(s, -1);
+    jit_label(s, slow1);
+    jit_label(s, slow2);
+    if (jit_call_op(s, pos, op, pc_pos))
+        return -1;
+    jit_label(s, done);
+    return 0;
+}
+
+static int jit_add_loc(JSJitState *s, int pos, int idx, int pc_pos)
+{
+    int slow1, slow2, done, disp;
+
+    disp = idx * sizeof(JSValue);
+    jit_op_mem(s, 1, X86_LOAD, JIT_RAX, JIT_R12, disp + 8);
+    jit_op_mem(s, 1, X86_OR, JIT_RAX, JIT_RBX, jit_sp(s, -1) + 8);
+    slow1 = jit_jump(s, JIT_CC_NE);
+    jit_op_mem(s, 0, X86_LOAD, JIT_RAX, JIT_R12, disp);
+    jit_op_mem(s, 0, X86_ADD, JIT_RAX, JIT_RBX, jit_sp(s, -1));
+    slow2 = jit_jump(s, JIT_CC_O);
+    jit_op_mem(s, 0, X86_STORE, JIT_RAX, JIT_R12, disp);
+    done = jit_jump(s, -1);
+    jit_label(s, slow1);
+    jit_label(s, slow2);
+    if (jit_call_op(s, pos, OP_add_loc, pc_pos))
+        return -1;
+    jit_label(s, done);
+    return 0;
+}
+
+/* if_true, if_false: the stack pointer must be flushed */
+static int jit_if(JSJitState *s, BOOL is_true, int target)
+{
+    int slow, done;
+
+    jit_op_mem_imm(s, 1, 7, JIT_RBX, -8, JS_TAG_UNDEFINED);
+    slow = jit_jump(s, JIT_CC_A);
+    jit_op_mem(s, 0, X86_LOAD, JIT_RAX, JIT_RBX, -16);
+    done = jit_jump(s, -1);
+    jit_label(s, slow);
+    jit_mov_reg(s, JIT_RDI, JIT_R14);
+    jit_op_mem(s, 1, X86_LEA, JIT_RSI, JIT_RBX, -16);
+    jit_call(s, js_jit_to_bool);
+    jit_label(s, done);
+    jit_op_mem(s, 1, X86_LEA, JIT_RBX, JIT_RBX, -16);
+    jit_op_reg(s, 0, 0x85, JIT_RAX, JIT_RAX);
+    return jit_jump_to(s, is_true ? JIT_CC_NE : JIT_CC_E, target);
+}
+
+static int jit_jump_target(const uint8_t *bc_buf, int pos)
+{
+    int op = bc_buf[pos];
+    switch(op) {
+    case OP_goto:
+    case OP_if_false:
+    case OP_if_true:
+    case OP_lt_if_false:
+    case OP_lte_if_false:
+    case OP_gt_if_false:
+    case OP_gte_if_false:
+        return pos + 1 + (int32_t)get_u32(bc_buf + pos + 1);
+    case OP_goto16:
+        return pos + 1 + (int16_t)get_u16(bc_buf + pos + 1);
+    case OP_goto8:
+    case OP_if_false8:
+    case OP_if_true8:
+        return pos + 1 + (int8_t)bc_buf[pos + 1];
+    default:
+        return -1;
+    }
+}
+
+static int jit_compile_body(JSJitState *s)
+{
+    JSFunctionBytecode *b = s->b;
+    const uint8_t *bc_buf = b->byte_code_buf;
+    int pos, pos_next, op, idx, kind, base, disp, target;
+    const JSOpCode *oi;
+
+    for(pos = 0; pos < b->byte_code_len; pos = pos_next) {
+        op = bc_buf[pos];
+        oi = &short_opcode_info(op);
+        pos_next = pos + oi->size;
+        if (s->is_target[pos])
+            jit_flush_sp(s);
+        s->native_pos[pos] = s->code.size;
+        switch(op) {
+        case OP_nop:
+            break;
+        case OP_push_i32:
+            jit_push_const(s, JS_TAG_INT, get_u32(bc_buf + pos + 1));
+            break;
+        case OP_push_minus1:
+        case OP_push_0:
+        case OP_push_1:
+        case OP_push_2:
+        case OP_push_3:
+        case OP_push_4:
+        case OP_push_5:
+        case OP_push_6:
+        case OP_push_7:
+            jit_push_const(s, JS_TAG_INT, op - OP_push_0);
+            break;
+        case OP_push_i8:
+            jit_push_const(s, JS_TAG_INT, get_i8(bc_buf + pos + 1));
+            break;
+        case OP_push_i16:
+            jit_push_const(s, JS_TAG_INT, get_i16(bc_buf + pos + 1));
+            break;
+        case OP_undefined:
+            jit_push_const(s, JS_TAG_UNDEFINED, 0);
+            break;
+        case OP_null:
+            jit_push_const(s, JS_TAG_NULL, 0);
+            break;
+        case OP_push_false:
+        case OP_push_true:
+            jit_push_const(s, JS_TAG_BOOL, op - OP_push_false);
+            break;
+
+        case OP_get_loc:
+        case OP_get_arg:
+        case OP_get_var_ref:
+            kind = (op - OP_get_loc) / 3;
+            idx = get_u16(bc_buf + pos + 1);
+            goto get_var;
+        case OP_get_loc8:
+            kind = 0;
+            idx = bc_buf[pos + 1];
+            goto get_var;
+        case OP_get_loc0:
+        case OP_get_loc1:
+        case OP_get_loc2:
+        case OP_get_loc3:
+            kind = 0;
+            idx = op - OP_get_loc0;
+            goto get_var;
+        case OP_get_arg0:
+        case OP_get_arg1:
+        case OP_get_arg2:
+        case OP_get_arg3:
+            kind = 1;
+            idx = op - OP_get_arg0;
+            goto get_var;
+        case OP_get_var_ref0:
+        case OP_get_var_ref1:
+        case OP_get_var_ref2:
+        case OP_get_var_ref3:
+            kind = 2;
+            idx = op - OP_get_var_ref0;
+        get_var:
+            jit_var_address(s, kind, idx, &base, &disp);
+            jit_load_value(s, JIT_RAX, JIT_RCX, base, disp);
+            jit_store_value(s, JIT_RBX, jit_sp(s, 0), JIT_RAX, JIT_RCX);
+            jit_dup_value(s);
+            s->sp_offset += sizeof(JSValue);
+            break;
+
+        case OP_put_loc:
+        case OP_put_arg:
+        case OP_put_var_ref:
+            kind = (op - OP_put_loc) / 3;
+            idx = get_u16(bc_buf + pos + 1);
+            goto put_var;
+        case OP_put_loc8:
+            kind = 0;
+            idx = bc_buf[pos + 1];
+            goto put_var;
+        case OP_put_loc0:
+        case OP_put_loc1:
+        case OP_put_loc2:
+        case OP_put_loc3:
+            kind = 0;
+            idx = op - OP_put_loc0;
+            goto put_var;
+        case OP_put_arg0:
+        case OP_put_arg1:
+        case OP_put_arg2:
+        case OP_put_arg3:
+            kind = 1;
+            idx = op - OP_put_arg0;
+            goto put_var;
+        case OP_put_var_ref0:
+        case OP_put_var_ref1:
+        case OP_put_var_ref2:
+        case OP_put_var_ref3:
+            kind = 2;
+            idx = op - OP_put_var_ref0;
+        put_var:
+            jit_var_address(s, kind, idx, &base, &disp);
+            jit_load_value(s, JIT_RSI, JIT_RDX, base, disp);
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, base, disp, JIT_RAX, JIT_RCX);
+            s->sp_offset -= sizeof(JSValue);
+            jit_free_value(s);
+            break;
+
+        case OP_set_loc:
+        case OP_set_arg:
+        case OP_set_var_ref:
+            kind = (op - OP_set_loc) / 3;
+            idx = get_u16(bc_buf + pos + 1);
+            goto set_var;
+        case OP_set_loc8:
+            kind = 0;
+            idx = bc_buf[pos + 1];
+            goto set_var;
+        case OP_set_loc0:
+        case OP_set_loc1:
+        case OP_set_loc2:
+        case OP_set_loc3:
+            kind = 0;
+            idx = op - OP_set_loc0;
+            goto set_var;
+        case OP_set_arg0:
+        case OP_set_arg1:
+        case OP_set_arg2:
+        case OP_set_arg3:
+            kind = 1;
+            idx = op - OP_set_arg0;
+            goto set_var;
+        case OP_set_var_ref0:
+        case OP_set_var_ref1:
+        case OP_set_var_ref2:
+        case OP_set_var_ref3:
+            kind = 2;
+            idx = op - OP_set_var_ref0;
+        set_var:
+            jit_var_address(s, kind, idx, &base, &disp);
+            jit_load_value(s, JIT_RSI, JIT_RDX, base, disp);
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, base, disp, JIT_RAX, JIT_RCX);
+            jit_dup_value(s);
+            jit_free_value(s);
+            break;
+
+        case OP_get_loc_check:
+            {
+                int slow, done;
+                idx = get_u16(bc_buf + pos + 1);
+                disp = idx * sizeof(JSValue);
+                jit_load_value(s, JIT_RAX, JIT_RCX, JIT_R12, disp);
+                jit_op_reg_imm(s, 0, 7, JIT_RCX, JS_TAG_UNINITIALIZED);
+                slow = jit_jump(s, JIT_CC_E);
+                jit_store_value(s, JIT_RBX, jit_sp(s, 0), JIT_RAX, JIT_RCX);
+                jit_dup_value(s);
+                done = jit_jump(s, -1);
+                jit_label(s, slow);
+                if (jit_call_op(s, pos, op, pos_next))
+                    return -1;
+                jit_label(s, done);
+            }
+            break;
+
+        case OP_drop:
+            jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, -1));
+            s->sp_offset -= sizeof(JSValue);
+            jit_free_value(s);
+            break;
+        case OP_nip:
+            jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, -2));
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, JIT_RBX, jit_sp(s, -2), JIT_RAX, JIT_RCX);
+            s->sp_offset -= sizeof(JSValue);
+            jit_free_value(s);
+            break;
+        case OP_dup:
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, JIT_RBX, jit_sp(s, 0), JIT_RAX, JIT_RCX);
+            jit_dup_value(s);
+            s->sp_offset += sizeof(JSValue);
+            break;
+        case OP_swap:
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -2));
+            jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, JIT_RBX, jit_sp(s, -2), JIT_RSI, JIT_RDX);
+            jit_store_value(s, JIT_RBX, jit_sp(s, -1), JIT_RAX, JIT_RCX);
+            break;
+        case OP_insert2: /* obj a -> a obj a */
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, -2));
+            jit_store_value(s, JIT_RBX, jit_sp(s, 0), JIT_RAX, JIT_RCX);
+            jit_store_value(s, JIT_RBX, jit_sp(s, -1), JIT_RSI, JIT_RDX);
+            jit_store_value(s, JIT_RBX, jit_sp(s, -2), JIT_RAX, JIT_RCX);
+            jit_dup_value(s);
+            s->sp_offset += sizeof(JSValue);
+            break;
+        case OP_insert3: /* obj prop a -> a obj prop a */
+        case OP_insert4: /* this obj prop a -> a this obj prop a */
+            {
+                static const int8_t slots[] = { -1, -2, -3, -4 };
+                jit_copy_slot(s, 0, -1);
+                jit_rotate_slots(s, slots, op - OP_insert3 + 3);
+                jit_dup_value(s);
+                s->sp_offset += sizeof(JSValue);
+            }
+            break;
+        case OP_perm3: /* obj a b -> a obj b */
+        case OP_perm4: /* obj prop a b -> a obj prop b */
+        case OP_perm5: /* this obj prop a b -> a this obj prop b */
+            {
+                static const int8_t slots[] = { -2, -3, -4, -5 };
+                jit_rotate_slots(s, slots, op - OP_perm3 + 2);
+            }
+            break;
+        case OP_rot3l: /* x a b -> a b x */
+            {
+                static const int8_t slots[] = { -3, -2, -1 };
+                jit_rotate_slots(s, slots, 3);
+            }
+            break;
+        case OP_rot3r: /* a b x -> x a b */
+            {
+                static const int8_t slots[] = { -1, -2, -3 };
+                jit_rotate_slots(s, slots, 3);
+            }
+            break;
+        case OP_nip1: /* a b c -> b c */
+            jit_load_value(s, JIT_RSI, JIT_RDX, JIT_RBX, jit_sp(s, -3));
+            jit_copy_slot(s, -3, -2);
+            jit_copy_slot(s, -2, -1);
+            s->sp_offset -= sizeof(JSValue);
+            jit_free_value(s);
+            break;
+        case OP_dup1: /* a b -> a a b */
+            jit_copy_slot(s, 0, -1);
+            jit_copy_slot(s, -1, -2);
+            jit_dup_value(s);
+            s->sp_offset += sizeof(JSValue);
+            break;
+        case OP_dup2: /* a b -> a b a b */
+            jit_copy_slot(s, 0, -2);
+            jit_dup_value(s);
+            jit_copy_slot(s, 1, -1);
+            jit_dup_value(s);
+            s->sp_offset += 2 * sizeof(JSValue);
+            break;
+
+        case OP_add:
+        case OP_sub:
+        case OP_mul:
+        case OP_and:
+        case OP_or:
+        case OP_xor:
+        case OP_shl:
+        case OP_sar:
+            if (jit_binary_arith(s, pos, op, pos_next))
+                return -1;
+            break;
+        case OP_lt:
+        case OP_lte:
+        case OP_gt:
+        case OP_gte:
+        case OP_eq:
+        case OP_neq:
+        case OP_strict_eq:
+        case OP_strict_neq:
+            if (jit_compare(s, pos, op, pos_next, -1))
+                return -1;
+            break;
+        case OP_inc:
+        case OP_dec:
+            if (jit_inc_dec(s, pos, op, pos_next, JIT_RBX, jit_sp(s, -1)))
+                return -1;
+            break;
+        case OP_inc_loc:
+        case OP_dec_loc:
+            if (jit_inc_dec(s, pos, op, pos_next, JIT_R12,
+                            bc_buf[pos + 1] * sizeof(JSValue)))
+                return -1;
+            break;
+        case OP_add_loc:
+            if (jit_add_loc(s, pos, bc_buf[pos + 1], pos_next))
+                return -1;
+            break;
+
+        case OP_goto:
+        case OP_goto16:
+        case OP_goto8:
+        case OP_if_false:
+        case OP_if_true:
+        case OP_if_false8:
+        case OP_if_true8:
+        case OP_lt_if_false:
+        case OP_lte_if_false:
+        case OP_gt_if_false:
+        case OP_gte_if_false:
+            target = jit_jump_target(bc_buf, pos);
+            jit_flush_sp(s);
+            if (jit_poll_interrupts(s, pos_next, target <= pos))
+                return -1;
+            if (op == OP_goto || op == OP_goto16 || op == OP_goto8) {
+                if (jit_jump_to(s, -1, target))
+                    return -1;
+            } else if (op >= OP_lt_if_false) {
+                if (jit_compare(s, pos, OP_lt + op - OP_lt_if_false,
+                                pos_next, target))
+                    return -1;
+            } else {
+                if (jit_if(s, op == OP_if_true || op == OP_if_true8, target))
+                    return -1;
+            }
+            break;
+
+        case OP_return:
+            jit_load_value(s, JIT_RAX, JIT_RCX, JIT_RBX, jit_sp(s, -1));
+            jit_store_value(s, JIT_R15, offsetof(JSJitFrame, ret_val),
+                            JIT_RAX, JIT_RCX);
+            s->sp_offset -= sizeof(JSValue);
+            jit_return(s);
+            break;
+        case OP_return_undef:
+            jit_store_imm(s, 1, JIT_R15, offsetof(JSJitFrame, ret_val), 0);
+            jit_store_imm(s, 1, JIT_R15, offsetof(JSJitFrame, ret_val) + 8,
+                          JS_TAG_UNDEFINED);
+            jit_return(s);
+            break;
+
+        default:
+            if (js_jit_has_op(op)) {
+                if (jit_call_op(s, pos, op, pos_next))
+                    return -1;
+            } else {
+                jit_exit(s, pos);
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
+/* add the symbol of the native code of 'b' to the perf map */
+static void js_jit_perf_map(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    char buf[ATOM_GET_STR_BUF_SIZE], buf1[ATOM_GET_STR_BUF_SIZE];
+    const char *name;
+
+    if (b->func_name == JS_ATOM_NULL)
+        name = "<anonymous>";
+    else
+        name = JS_AtomGetStrRT(rt, buf, sizeof(buf), b->func_name);
+    fprintf(rt->perf_map_file, "%" PRIxPTR " %x js:%s", (uintptr_t)b->jit_code,
+            b->jit_code_size, name);
+    if (b->has_debug) {
+        fprintf(rt->perf_map_file, " %s:%d",
+                JS_AtomGetStrRT(rt, buf1, sizeof(buf1), b->debug.filename),
+                b->debug.line_num);
+    }
+    fputc('\n', rt->perf_map_file);
+    fflush(rt->perf_map_file);
+}
+
+/* size of the code chunks, except for the larger functions */
+#define JS_JIT_CHUNK_SIZE (256 * 1024)
+
+static void js_jit_free_chunk(JSRuntime *rt, JSJitChunk *c)
+{
+    munmap(c->buf, c->size);
+    js_free_rt(rt, c);
+}
+
+/* copy the native code of 'b' to the executable memory. Return NULL
+   if not enough memory. */
+static uint8_t *js_jit_alloc_code(JSRuntime *rt, JSFunctionBytecode *b,
+                                  const uint8_t *code, size_t size)
+{
+    JSJitChunk *c = rt->jit_chunk;
+    size_t page_size, start, end;
+    uint8_t *ptr;
+
+    page_size = sysconf(_SC_PAGESIZE);
+    if (!c || c->used + size > c->size) {
+        if (c && c->func_count == 0) {
+            js_jit_free_chunk(rt, c);
+            rt->jit_chunk = NULL;
+        }
+        c = js_malloc_rt(rt, sizeof(*c));
+        if (!c)
+            return NULL;
+        c->size = (size + page_size - 1) & ~(page_size - 1);
+        if (c->size < JS_JIT_CHUNK_SIZE)
+            c->size = JS_JIT_CHUNK_SIZE;
+        c->buf = mmap(NULL, c->size, PROT_NONE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (c->buf == MAP_FAILED) {
+            js_free_rt(rt, c);
+            return NULL;
+        }
+        c->used = 0;
+        c->func_count = 0;
+        /* the previous chunk is freed with its last function */
+        rt->jit_chunk = c;
+    }
+    /* the pages are only writable during the copy */
+    start = c->used & ~(page_size - 1);
+    end = (c->used + size + page_size - 1) & ~(page_size - 1);
+    if (mprotect(c->buf + start, end - start, PROT_READ | PROT_WRITE))
+        return NULL;
+    ptr = c->buf + c->used;
+    memcpy(ptr, code, size);
+    /* cannot fail: the other functions of the pages must stay
+       executable */
+    if (mprotect(c->buf + start, end - start, PROT_READ | PROT_EXEC))
+        abort();
+    c->used = (c->used + size + 15) & ~15;
+    c->func_count++;
+    b->jit_chunk = c;
+    return ptr;
+}
+
+static void js_jit_free(JSRuntime *rt, JSFunctionBytecode *b)
+{
+    JSJitChunk *c = b->jit_chunk;
+
+    if (c) {
+        b->jit_chunk = NULL;
+        b->jit_code = NULL;
+        b->jit_func = NULL;
+        if (--c->func_count == 0) {
+            if (c == rt->jit_chunk)
+                c->used = 0; /* reuse the current chunk */
+            else
+                js_jit_free_chunk(rt, c);
+        }
+    }
+}
+
+/* compile 'b' to native code. Return NULL if it is not possible. */
+static JSJitFunc *js_jit_compile(JSContext *ctx, JSFunctionBytecode *b)
+{
+    JSJitState s_s, *s = &s_s;
+    const uint8_t *bc_buf = b->byte_code_buf;
+    int pos, i, target, entry_pos;
+    size_t size;
+    uint8_t *code;
+
+    b->jit_failed = TRUE; /* only one attempt */
+    if (b->func_kind != JS_FUNC_NORMAL)
+        return NULL;
+#ifdef CONFIG_BIGNUM
+    if (b->js_mode & JS_MODE_MATH)
+        return NULL;
+#endif
+
+    memset(s, 0, sizeof(*s));
+    s->ctx = ctx;
+    s->b = b;
+    js_dbuf_init(ctx, &s->code);
+    s->native_pos = js_malloc(ctx, sizeof(s->native_pos[0]) * b->byte_code_len);
+    s->is_target = js_mallocz(ctx, b->byte_code_len);
+    if (!s->native_pos || !s->is_target)
+        goto fail;
+
+    for(pos = 0; pos < b->byte_code_len;
+        pos += short_opcode_info(bc_buf[pos]).size) {
+        target = jit_jump_target(bc_buf, pos);
+        if (target >= 0)
+            s->is_target[target] = TRUE;
+    }
+
+    /* exception exit, then normal exit */
+    s->exc_epilogue_pos = s->code.size;
+    jit_mov_imm64(s, JIT_RAX, (uint32_t)-1);
+    s->epilogue_pos = s->code.size;
+    jit_op_reg_imm(s, 1, 0, JIT_RSP, 8);
+    jit_rex(s, 0, 0, JIT_R15); jit_putc(s, 0x58 + (JIT_R15 & 7));
+    jit_rex(s, 0, 0, JIT_R14); jit_putc(s, 0x58 + (JIT_R14 & 7));
+    jit_rex(s, 0, 0, JIT_R13); jit_putc(s, 0x58 + (JIT_R13 & 7));
+    jit_rex(s, 0, 0, JIT_R12); jit_putc(s, 0x58 + (JIT_R12 & 7));
+    jit_putc(s, 0x58 + JIT_RBP);
+    jit_putc(s, 0x58 + JIT_RBX);
+    jit_putc(s, 0xc3);
+
+    /* entry point: int func(JSJitFrame *f) */
+    entry_pos = s->code.size;
+    jit_putc(s, 0x50 + JIT_RBX);
+    jit_putc(s, 0x50 + JIT_RBP);
+    jit_rex(s, 0, 0, JIT_R12); jit_putc(s, 0x50 + (JIT_R12 & 7));
+    jit_rex(s, 0, 0, JIT_R13); jit_putc(s, 0x50 + (JIT_R13 & 7));
+    jit_rex(s, 0, 0, JIT_R14); jit_putc(s, 0x50 + (JIT_R14 & 7));
+    jit_rex(s, 0, 0, JIT_R15); jit_putc(s, 0x50 + (JIT_R15 & 7));
+    jit_op_reg_imm(s, 1, 5, JIT_RSP, 8); /* align the stack */
+    jit_mov_reg(s, JIT_R15, JIT_RDI);
+    jit_op_mem(s, 1, X86_LOAD, JIT_R14, JIT_R15, offsetof(JSJitFrame, ctx));
+    jit_op_mem(s, 1, X86_LOAD, JIT_RBX, JIT_R15, offsetof(JSJitFrame, sp));
+    jit_op_mem(s, 1, X86_LOAD, JIT_R12, JIT_R15, offsetof(JSJitFrame, var_buf));
+    jit_op_mem(s, 1, X86_LOAD, JIT_R13, JIT_R15, offsetof(JSJitFrame, arg_buf));
+
+    if (jit_compile_body(s))
+        goto fail;
+
+    for(i = 0; i < s->jump_count; i++) {
+        jit_patch(s, s->jumps[i].pos, s->native_pos[s->jumps[i].target]);
+    }
+    for(i = 0; i < s->exc_stub_count; i++) {
+        jit_label(s, s->exc_stubs[i].pos);
+        jit_mov_imm64(s, JIT_RAX,
+                      (uintptr_t)(bc_buf + s->exc_stubs[i].target));
+        jit_op_mem(s, 1, X86_STORE, JIT_RAX, JIT_R15,
+                   offsetof(JSJitFrame, pc));
+        jit_patch(s, jit_jump(s, -1), s->exc_epilogue_pos);
+    }
+    if (dbuf_error(&s->code))
+        goto fail;
+
+    size = s->code.size;
+    code = js_jit_alloc_code(ctx->rt, b, s->code.buf, size);
+    if (!code)
+        goto fail;
+    b->jit_code = code;
+    b->jit_code_size = size;
+    b->jit_func = (JSJitFunc *)(code + entry_pos);
+    if (ctx->rt->perf_map_file)
+        js_jit_perf_map(ctx->rt, b);
+ fail:
+    dbuf_free(&s->code);
+    js_free(ctx, s->native_pos);
+    js_free(ctx, s->is_target);
+    js_free(ctx, s->jumps);
+    js_free(ctx, s->exc_stubs);
+    return b->jit_func;
+}
+
+#endif /* CONFIG_JIT */
+
 static int add_module_variables(JSContext *ctx, JSFunctionDef *fd)
 {
     int i, idx;
@@ -32611,6 +36713,7 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
     fd->cpool = NULL;
 
     b->stack_size = stack_size;
+    b->ic_count = fd->ic_count;
 
     if (fd->js_mode & JS_MODE_STRIP) {
         JS_FreeAtom(ctx, fd->filename);
@@ -32705,6 +36808,11 @@ static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b)
     }
     if (b->realm)
         JS_FreeContext(b->realm);
+    js_free_rt(rt, b->ic);
+    js_free_rt(rt, b->global_ic);
+#ifdef CONFIG_JIT
+    js_jit_free(rt, b);
+#endif
 
     JS_FreeAtomRT(rt, b->func_name);
     if (b->has_debug) {
@@ -33544,7 +37652,9 @@ static JSValue JS_EvalFunctionInternal(JSContext *ctx, JSValue fun_obj,
 
 JSValue JS_EvalFunction(JSContext *ctx, JSValue fun_obj)
 {
-    return JS_EvalFunctionInternal(ctx, fun_obj, ctx->global_obj, NULL, NULL);
+    return js_linearize_string(ctx, JS_EvalFunctionInternal(ctx, fun_obj,
+                                                            ctx->global_obj,
+                                                            NULL, NULL));
 }
 
 static void skip_shebang(JSParseState *s)
@@ -33702,7 +37812,7 @@ static JSValue JS_EvalObject(JSContext *ctx, JSValueConst this_obj,
     const char *str;
     size_t len;
 
-    if (!JS_IsString(val))
+    if (!js_is_string(val))
         return JS_DupValue(ctx, val);
     str = JS_ToCStringLen(ctx, &len, val);
     if (!str)
@@ -33724,7 +37834,7 @@ JSValue JS_EvalThis(JSContext *ctx, JSValueConst this_obj,
            eval_type == JS_EVAL_TYPE_MODULE);
     ret = JS_EvalInternal(ctx, this_obj, input, input_len, filename,
                           eval_flags, -1);
-    return ret;
+    return js_linearize_string(ctx, ret);
 }
 
 JSValue JS_Eval(JSContext *ctx, const char *input, size_t input_len,
@@ -33875,12 +37985,13 @@ typedef enum BCTagEnum {
     BC_TAG_DATE,
     BC_TAG_OBJECT_VALUE,
     BC_TAG_OBJECT_REFERENCE,
+    BC_TAG_ARRAY_BUFFER_TRANSFER,
 } BCTagEnum;
 
 #ifdef CONFIG_BIGNUM
-#define BC_BASE_VERSION 2
+#define BC_BASE_VERSION 5
 #else
-#define BC_BASE_VERSION 1
+#define BC_BASE_VERSION 4
 #endif
 #define BC_BE_VERSION 0x40
 #ifdef WORDS_BIGENDIAN
@@ -33905,6 +38016,9 @@ typedef struct BCWriterState {
     uint8_t **sab_tab;
     int sab_tab_len;
     int sab_tab_size;
+    /* ArrayBuffers which are transferred instead of copied */
+    JSValueConst *transfer_list;
+    int transfer_len;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
 } BCWriterState;
@@ -33933,6 +38047,7 @@ static const char * const bc_tag_str[] = {
     "Date",
     "ObjectValue",
     "ObjectReference",
+    "ArrayBufferTransfer",
 };
 #endif
 
@@ -34069,6 +38184,14 @@ static void bc_byte_swap(uint8_t *bc_buf, int bc_len)
             put_u16(bc_buf + pos + 1 + 4,
                     bswap16(get_u16(bc_buf + pos + 1 + 4)));
             break;
+        case OP_FMT_atom_u16_loc:
+            put_u32(bc_buf + pos + 1,
+                    bswap32(get_u32(bc_buf + pos + 1)));
+            put_u16(bc_buf + pos + 1 + 4,
+                    bswap16(get_u16(bc_buf + pos + 1 + 4)));
+            put_u16(bc_buf + pos + 1 + 4 + 2,
+                    bswap16(get_u16(bc_buf + pos + 1 + 4 + 2)));
+            break;
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
             put_u32(bc_buf + pos + 1,
@@ -34116,6 +38239,7 @@ static int JS_WriteFunctionBytecode(BCWriterState *s,
         case OP_FMT_atom_u16:
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
+        case OP_FMT_atom_u16_loc:
             atom = get_u32(bc_buf + pos + 1);
             if (bc_atom_to_idx(s, &val, atom))
                 goto fail;
@@ -34522,6 +38646,16 @@ static int JS_WriteArrayBuffer(BCWriterState *s, JSValueConst obj)
 {
     JSObject *p = JS_VALUE_GET_OBJ(obj);
     JSArrayBuffer *abuf = p->u.array_buffer;
+    int i;
+
+    for(i = 0; i < s->transfer_len; i++) {
+        if (JS_VALUE_GET_OBJ(s->transfer_list[i]) == p) {
+            /* only the index in the transfer list is stored */
+            bc_put_u8(s, BC_TAG_ARRAY_BUFFER_TRANSFER);
+            bc_put_leb128(s, i);
+            return 0;
+        }
+    }
     if (abuf->detached) {
         JS_ThrowTypeErrorDetachedArrayBuffer(s->ctx);
         return -1;
@@ -34587,6 +38721,17 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
             JS_WriteString(s, p);
         }
         break;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSValue str;
+            str = JS_ToString(s->ctx, obj);
+            if (JS_IsException(str))
+                goto fail;
+            bc_put_u8(s, BC_TAG_STRING);
+            JS_WriteString(s, JS_VALUE_GET_STRING(str));
+            JS_FreeValue(s->ctx, str);
+        }
+        break;
     case JS_TAG_FUNCTION_BYTECODE:
         if (!s->allow_bytecode)
             goto invalid_tag;
@@ -34725,12 +38870,47 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     return -1;
 }
 
-uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
-                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+static int js_array_buffer_transfer(JSContext *ctx,
+                                    JSTransferredArrayBuffer *tb,
+                                    JSValueConst obj);
+
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list,
+                         JSTransferredArrayBuffer *transfer_tab,
+                         int transfer_len)
 {
     BCWriterState ss, *s = &ss;
+    JSArrayBuffer *abuf;
+    int i, j;
+
+    for(i = 0; i < transfer_len; i++) {
+        abuf = JS_GetOpaque(transfer_list[i], JS_CLASS_ARRAY_BUFFER);
+        if (!abuf) {
+            JS_ThrowTypeError(ctx, "only ArrayBuffers can be transferred");
+            goto fail1;
+        }
+        if (abuf->detached) {
+            JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+            goto fail1;
+        }
+        /* its data is still used, e.g. by an asynchronous I/O */
+        if (abuf->pin_count != 0) {
+            JS_ThrowTypeErrorPinnedArrayBuffer(ctx);
+            goto fail1;
+        }
+        for(j = 0; j < i; j++) {
+            if (JS_VALUE_GET_OBJ(transfer_list[j]) ==
+                JS_VALUE_GET_OBJ(transfer_list[i])) {
+                JS_ThrowTypeError(ctx, "duplicate ArrayBuffer in the transfer list");
+                goto fail1;
+            }
+        }
+    }
 
     memset(s, 0, sizeof(*s));
+    s->transfer_list = transfer_list;
+    s->transfer_len = transfer_len;
     s->ctx = ctx;
     /* XXX: byte swapped output is untested */
     s->byte_swap = ((flags & JS_WRITE_OBJ_BSWAP) != 0);
@@ -34752,6 +38932,19 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
+    /* the ArrayBuffers are detached once the object is written */
+    for(i = 0; i < transfer_len; i++) {
+        if (js_array_buffer_transfer(ctx, &transfer_tab[i],
+                                     transfer_list[i])) {
+            while (--i >= 0) {
+                JSTransferredArrayBuffer *tb = &transfer_tab[i];
+                if (tb->free_func)
+                    tb->free_func(ctx->rt, tb->opaque, tb->data);
+            }
+            js_free(ctx, s->sab_tab);
+            goto fail2;
+        }
+    }
     *psize = s->dbuf.size;
     if (psab_tab)
         *psab_tab = s->sab_tab;
@@ -34762,7 +38955,10 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     js_object_list_end(ctx, &s->object_list);
     js_free(ctx, s->atom_to_idx);
     js_free(ctx, s->idx_to_atom);
+    js_free(ctx, s->sab_tab);
+ fail2:
     dbuf_free(&s->dbuf);
+ fail1:
     *psize = 0;
     if (psab_tab)
         *psab_tab = NULL;
@@ -34771,6 +38967,13 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     return NULL;
 }
 
+uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+{
+    return JS_WriteObject3(ctx, psize, obj, flags, psab_tab, psab_tab_len,
+                           NULL, NULL, 0);
+}
+
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags)
 {
@@ -34788,6 +38991,9 @@ typedef struct BCReaderState {
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
     BOOL allow_reference : 8;
+    /* data of the transferred ArrayBuffers */
+    JSTransferredArrayBuffer *transfer_tab;
+    int transfer_len;
     /* object references */
     JSObject **objects;
     int objects_count;
@@ -35041,6 +39247,7 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         case OP_FMT_atom_u16:
         case OP_FMT_atom_label_u8:
         case OP_FMT_atom_label_u16:
+        case OP_FMT_atom_u16_loc:
             idx = get_u32(bc_buf + pos + 1);
             if (s->is_rom_data) {
                 /* just increment the reference count of the atom */
@@ -35060,6 +39267,11 @@ static int JS_ReadFunctionBytecode(BCReaderState *s, JSFunctionBytecode *b,
         default:
             break;
         }
+        if (op == OP_get_field || op == OP_get_field2 || op == OP_put_field ||
+            short_opcode_info(op).fmt == OP_FMT_atom_u16_loc) {
+            idx = get_u16(bc_buf + pos + 5);
+            b->ic_count = max_int(b->ic_count, idx + 1);
+        }
         pos += len;
     }
     return 0;
@@ -35689,6 +39901,34 @@ static JSValue JS_ReadSharedArrayBuffer(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static JSValue JS_ReadArrayBufferTransfer(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSTransferredArrayBuffer *tb;
+    uint32_t idx;
+    JSValue obj;
+
+    if (bc_get_leb128(s, &idx))
+        return JS_EXCEPTION;
+    if (idx >= s->transfer_len)
+        return JS_ThrowSyntaxError(ctx, "invalid transferred ArrayBuffer");
+    tb = &s->transfer_tab[idx];
+    obj = js_array_buffer_constructor3(ctx, JS_UNDEFINED, tb->byte_length,
+                                       JS_CLASS_ARRAY_BUFFER, tb->data,
+                                       tb->free_func, tb->opaque, FALSE);
+    if (JS_IsException(obj))
+        return obj;
+    /* the data now belongs to the ArrayBuffer */
+    tb->data = NULL;
+    tb->byte_length = 0;
+    tb->free_func = NULL;
+    if (BC_add_object_ref(s, obj)) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    return obj;
+}
+
 static JSValue JS_ReadDate(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -35701,7 +39941,7 @@ static JSValue JS_ReadDate(BCReaderState *s)
         JS_ThrowTypeError(ctx, "Number tag expected for date");
         goto fail;
     }
-    obj = JS_NewObjectProtoClass(ctx, ctx->class_proto[JS_CLASS_DATE],
+    obj = JS_NewObjectProtoClass(ctx, js_get_class_proto(ctx, JS_CLASS_DATE),
                                  JS_CLASS_DATE);
     if (JS_IsException(obj))
         goto fail;
@@ -35816,6 +40056,9 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             goto invalid_tag;
         obj = JS_ReadSharedArrayBuffer(s);
         break;
+    case BC_TAG_ARRAY_BUFFER_TRANSFER:
+        obj = JS_ReadArrayBufferTransfer(s);
+        break;
     case BC_TAG_DATE:
         obj = JS_ReadDate(s);
         break;
@@ -35906,8 +40149,9 @@ static void bc_reader_free(BCReaderState *s)
     js_free(s->ctx, s->objects);
 }
 
-JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
-                       int flags)
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, JSTransferredArrayBuffer *transfer_tab,
+                       int transfer_len)
 {
     BCReaderState ss, *s = &ss;
     JSValue obj;
@@ -35924,6 +40168,8 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->transfer_tab = transfer_tab;
+    s->transfer_len = transfer_len;
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
@@ -35937,6 +40183,12 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     return obj;
 }
 
+JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags)
+{
+    return JS_ReadObject2(ctx, buf, buf_len, flags, NULL, 0);
+}
+
 /*******************************************************************/
 /* runtime functions & objects */
 
@@ -36283,6 +40535,17 @@ static JSValue JS_ToObject(JSContext *ctx, JSValueConst val)
             JS_DefinePropertyValue(ctx, obj, JS_ATOM_length, JS_NewInt32(ctx, p1->len), 0);
         }
         goto set_value;
+    case JS_TAG_STRING_ROPE:
+        {
+            JSValue str;
+            /* the string object needs a linear string */
+            str = JS_ToString(ctx, val);
+            if (JS_IsException(str))
+                return str;
+            obj = JS_ToObject(ctx, str);
+            JS_FreeValue(ctx, str);
+            return obj;
+        }
     case JS_TAG_BOOL:
         obj = JS_NewObjectClass(ctx, JS_CLASS_BOOLEAN);
         goto set_value;
@@ -36935,7 +41198,7 @@ static JSValue js_object_toString(JSContext *ctx, JSValueConst this_val,
         JS_FreeValue(ctx, obj);
         if (JS_IsException(tag))
             return JS_EXCEPTION;
-        if (!JS_IsString(tag)) {
+        if (!js_is_string(tag)) {
             JS_FreeValue(ctx, tag);
             tag = JS_AtomToString(ctx, atom);
         }
@@ -37734,7 +41997,7 @@ static JSValue js_function_bind(JSContext *ctx, JSValueConst this_val,
     name1 = JS_GetProperty(ctx, this_val, JS_ATOM_name);
     if (JS_IsException(name1))
         goto exception;
-    if (!JS_IsString(name1)) {
+    if (!js_is_string(name1)) {
         JS_FreeValue(ctx, name1);
         name1 = JS_AtomToString(ctx, JS_ATOM_empty_string);
     }
@@ -40179,7 +44442,7 @@ static JSValue js_string_constructor(JSContext *ctx, JSValueConst new_target,
 
 static JSValue js_thisStringValue(JSContext *ctx, JSValueConst this_val)
 {
-    if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING)
+    if (js_is_string(this_val))
         return JS_DupValue(ctx, this_val);
 
     if (JS_VALUE_GET_TAG(this_val) == JS_TAG_OBJECT) {
@@ -40708,7 +44971,8 @@ static JSValue js_string___GetSubstitution(JSContext *ctx, JSValueConst this_val
     namedCaptures = argv[4];
     rep = argv[5];
 
-    if (!JS_IsString(rep) || !JS_IsString(str))
+    if (JS_VALUE_GET_TAG(rep) != JS_TAG_STRING ||
+        JS_VALUE_GET_TAG(str) != JS_TAG_STRING)
         return JS_ThrowTypeError(ctx, "not a string");
 
     sp = JS_VALUE_GET_STRING(str);
@@ -42076,6 +46340,99 @@ static void js_regexp_finalizer(JSRuntime *rt, JSValue val)
     JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, re->pattern));
 }
 
+static inline uint32_t js_regexp_cache_hash(JSAtom pattern, int flags)
+{
+    return (pattern * 0x9e3779b1 + flags) & (JS_REGEXP_CACHE_HASH_SIZE - 1);
+}
+
+static void js_regexp_cache_remove(JSRuntime *rt, JSRegExpCacheEntry *e)
+{
+    JSRegExpCacheEntry **pe;
+
+    pe = &rt->regexp_cache_hash[js_regexp_cache_hash(e->pattern, e->flags)];
+    while (*pe != e)
+        pe = &(*pe)->hash_next;
+    *pe = e->hash_next;
+    list_del(&e->link);
+    rt->regexp_cache_count--;
+    rt->regexp_cache_size -= e->size;
+    JS_FreeAtomRT(rt, e->pattern);
+    JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+    js_free_rt(rt, e);
+}
+
+static void js_regexp_cache_free(JSRuntime *rt)
+{
+    struct list_head *el, *el1;
+
+    list_for_each_safe(el, el1, &rt->regexp_cache_list) {
+        js_regexp_cache_remove(rt, list_entry(el, JSRegExpCacheEntry, link));
+    }
+    js_free_rt(rt, rt->regexp_cache_hash);
+    rt->regexp_cache_hash = NULL;
+}
+
+/* return the cached bytecode or JS_UNDEFINED if none */
+static JSValue js_regexp_cache_find(JSRuntime *rt, JSAtom pattern, int flags)
+{
+    JSRegExpCacheEntry *e;
+
+    if (rt->regexp_cache_hash) {
+        for(e = rt->regexp_cache_hash[js_regexp_cache_hash(pattern, flags)];
+            e != NULL; e = e->hash_next) {
+            if (e->pattern == pattern && e->flags == flags) {
+                list_del(&e->link);
+                list_add(&e->link, &rt->regexp_cache_list);
+                rt->regexp_cache_hits++;
+                return JS_DupValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+            }
+        }
+    }
+    rt->regexp_cache_misses++;
+    return JS_UNDEFINED;
+}
+
+/* the cache is only an optimization, so allocation errors are ignored */
+static void js_regexp_cache_add(JSRuntime *rt, JSAtom pattern,
+                                JSString *pattern_str, int flags,
+                                JSValueConst bc)
+{
+    JSRegExpCacheEntry *e;
+    uint32_t h;
+    size_t size;
+
+    if (!rt->regexp_cache_hash) {
+        rt->regexp_cache_hash = js_mallocz_rt(rt, sizeof(rt->regexp_cache_hash[0]) *
+                                              JS_REGEXP_CACHE_HASH_SIZE);
+        if (!rt->regexp_cache_hash)
+            return;
+    }
+    size = sizeof(*e) + 2 * sizeof(JSString) +
+        (pattern_str->len << pattern_str->is_wide_char) +
+        JS_VALUE_GET_STRING(bc)->len;
+    if (size > JS_REGEXP_CACHE_MAX_BYTES / 16)
+        return;
+    /* remove the least recently used entries */
+    while (rt->regexp_cache_count >= JS_REGEXP_CACHE_SIZE ||
+           rt->regexp_cache_size + size > JS_REGEXP_CACHE_MAX_BYTES) {
+        js_regexp_cache_remove(rt, list_entry(rt->regexp_cache_list.prev,
+                                              JSRegExpCacheEntry, link));
+    }
+    e = js_malloc_rt(rt, sizeof(*e));
+    if (!e)
+        return;
+    h = js_regexp_cache_hash(pattern, flags);
+    e->pattern = JS_DupAtomRT(rt, pattern);
+    e->flags = flags;
+    e->bytecode = JS_VALUE_GET_STRING(JS_DupValueRT(rt, bc));
+    e->size = size;
+    e->hash_next = rt->regexp_cache_hash[h];
+    rt->regexp_cache_hash[h] = e;
+    list_add(&e->link, &rt->regexp_cache_list);
+    rt->regexp_cache_count++;
+    rt->regexp_cache_size += size;
+}
+
 /* create a string containing the RegExp bytecode */
 static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags)
@@ -42086,6 +46443,7 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
     size_t i, len;
     int re_bytecode_len;
     JSValue ret;
+    JSAtom atom;
     char error_msg[64];
 
     re_flags = 0;
@@ -42127,20 +46485,44 @@ static JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
         JS_FreeCString(ctx, str);
     }
 
+    /* the same regexps are often created again, e.g. by new RegExp()
+       in loops or String.prototype.match() with a string */
+    atom = JS_ATOM_NULL;
+    if (JS_VALUE_GET_TAG(pattern) == JS_TAG_STRING &&
+        JS_VALUE_GET_STRING(pattern)->len <= JS_REGEXP_CACHE_PATTERN_MAX) {
+        atom = JS_ValueToAtom(ctx, pattern);
+        if (atom == JS_ATOM_NULL)
+            return JS_EXCEPTION;
+        ret = js_regexp_cache_find(ctx->rt, atom, re_flags);
+        if (!JS_IsUndefined(ret)) {
+            JS_FreeAtom(ctx, atom);
+            return ret;
+        }
+    }
+
     str = JS_ToCStringLen2(ctx, &len, pattern, !(re_flags & LRE_FLAG_UTF16));
     if (!str)
-        return JS_EXCEPTION;
+        goto fail;
     re_bytecode_buf = lre_compile(&re_bytecode_len, error_msg,
                                   sizeof(error_msg), str, len, re_flags, ctx);
     JS_FreeCString(ctx, str);
     if (!re_bytecode_buf) {
         JS_ThrowSyntaxError(ctx, "%s", error_msg);
-        return JS_EXCEPTION;
+        goto fail;
     }
 
     ret = js_new_string8(ctx, re_bytecode_buf, re_bytecode_len);
     js_free(ctx, re_bytecode_buf);
+    if (atom != JS_ATOM_NULL) {
+        if (!JS_IsException(ret))
+            js_regexp_cache_add(ctx->rt, atom, JS_VALUE_GET_STRING(pattern),
+                                re_flags, ret);
+        JS_FreeAtom(ctx, atom);
+    }
     return ret;
+ fail:
+    JS_FreeAtom(ctx, atom);
+    return JS_EXCEPTION;
 }
 
 /* create a RegExp object from a string containing the RegExp bytecode
@@ -42513,6 +46895,18 @@ void *lre_realloc(void *opaque, void *ptr, size_t size)
     return js_realloc_rt(ctx->rt, ptr, size);
 }
 
+BOOL lre_check_timeout(void *opaque, uint64_t step_count)
+{
+    JSContext *ctx = opaque;
+    JSRuntime *rt = ctx->rt;
+    if (rt->regexp_step_limit != 0 && step_count >= rt->regexp_step_limit) {
+        JS_ThrowInternalError(ctx, "regexp step limit exceeded");
+        return TRUE;
+    }
+    /* the exception is pending if the execution is interrupted */
+    return __js_poll_interrupts(ctx) < 0;
+}
+
 static JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
                               int argc, JSValueConst *argv)
 {
@@ -42570,7 +46964,8 @@ static JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
                     goto fail;
             }
         } else {
-            JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+            if (ret == -1)
+                JS_ThrowInternalError(ctx, "out of memory in regexp execution");
             goto fail;
         }
         JS_FreeValue(ctx, str_val);
@@ -42695,7 +47090,8 @@ static JSValue JS_RegExpDelete(JSContext *ctx, JSValueConst this_val, JSValueCon
                         goto fail;
                 }
             } else {
-                JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+                if (ret == -1)
+                    JS_ThrowInternalError(ctx, "out of memory in regexp execution");
                 goto fail;
             }
             break;
@@ -43091,6 +47487,233 @@ static int js_is_standard_regexp(JSContext *ctx, JSValueConst rx)
     return res;
 }
 
+/* Return the RegExp object if 'rx' is a RegExp whose 'exec' method is
+   the original one and whose 'lastIndex' is a writable integer. In
+   this case, calling exec() has no observable side effect other than
+   updating 'lastIndex', so lre_exec() can be called directly. */
+static JSRegExp *js_get_unmodified_regexp(JSContext *ctx, JSValueConst rx)
+{
+    JSObject *p, *proto;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+
+    if (JS_VALUE_GET_TAG(rx) != JS_TAG_OBJECT)
+        return NULL;
+    p = JS_VALUE_GET_OBJ(rx);
+    if (p->class_id != JS_CLASS_REGEXP)
+        return NULL;
+    /* 'lastIndex' must be the only own property */
+    if (p->shape->prop_count != 1)
+        return NULL;
+    prs = get_shape_prop(p->shape);
+    if (prs->atom != JS_ATOM_lastIndex ||
+        (prs->flags & (JS_PROP_TMASK | JS_PROP_WRITABLE)) != JS_PROP_WRITABLE ||
+        JS_VALUE_GET_TAG(p->prop[0].u.value) != JS_TAG_INT)
+        return NULL;
+    proto = p->shape->proto;
+    if (!proto || proto != JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_REGEXP]))
+        return NULL;
+    prs = find_own_property(&pr, proto, JS_ATOM_exec);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        !JS_IsCFunction(ctx, pr->u.value, js_regexp_exec, 0))
+        return NULL;
+    return &p->u.regexp;
+}
+
+/* GetSubstitution() with the captures given as start and end
+   positions in 'sp' (-1 if undefined). Named captures are not
+   supported. */
+static void js_regexp_get_substitution(StringBuffer *b, JSString *sp,
+                                       JSString *rp, const int *pos,
+                                       int captures_len)
+{
+    int i, j, j0, k, k1, c, c1, len;
+
+    len = rp->len;
+    i = 0;
+    for(;;) {
+        j = string_indexof_char(rp, '$', i);
+        if (j < 0 || j + 1 >= len)
+            break;
+        string_buffer_concat(b, rp, i, j);
+        j0 = j++;
+        c = string_get(rp, j++);
+        if (c == '$') {
+            string_buffer_putc8(b, '$');
+        } else if (c == '&') {
+            string_buffer_concat(b, sp, pos[0], pos[1]);
+        } else if (c == '`') {
+            string_buffer_concat(b, sp, 0, pos[0]);
+        } else if (c == '\'') {
+            string_buffer_concat(b, sp, pos[1], sp->len);
+        } else if (c >= '0' && c <= '9') {
+            k = c - '0';
+            if (j < len) {
+                c1 = string_get(rp, j);
+                if (c1 >= '0' && c1 <= '9') {
+                    /* same behavior as js_string___GetSubstitution() */
+                    k1 = k * 10 + c1 - '0';
+                    if (k1 >= 1 && k1 < captures_len) {
+                        k = k1;
+                        j++;
+                    }
+                }
+            }
+            if (k >= 1 && k < captures_len) {
+                if (pos[2 * k] >= 0)
+                    string_buffer_concat(b, sp, pos[2 * k], pos[2 * k + 1]);
+            } else {
+                goto norep;
+            }
+        } else {
+        norep:
+            string_buffer_concat(b, rp, j0, j);
+        }
+        i = j;
+    }
+    string_buffer_concat(b, rp, i, rp->len);
+}
+
+/* RegExp.prototype[Symbol.replace] for an unmodified RegExp object
+   without named groups: the matches are computed with lre_exec()
+   instead of creating the exec() result objects. 'rp' is NULL if
+   'rep' is a function. */
+static JSValue js_regexp_replace_fast(JSContext *ctx, JSValueConst rx,
+                                      JSRegExp *re, JSValueConst str,
+                                      JSValueConst rep, JSString *rp,
+                                      BOOL is_global, BOOL full_unicode)
+{
+    JSString *sp = JS_VALUE_GET_STRING(str);
+    StringBuffer b_s, *b = &b_s;
+    DynBuf dbuf;
+    JSValue *args, val;
+    uint8_t *re_bytecode, **capture, *str_buf;
+    int *pos, capture_count, re_flags, shift, ret, i, j, n;
+    int start, end, next_src_pos;
+    int64_t last_index, new_last_index;
+
+    string_buffer_init(ctx, b, 0);
+    js_dbuf_init(ctx, &dbuf);
+    args = NULL;
+    re_bytecode = re->bytecode->u.str8;
+    re_flags = lre_get_flags(re_bytecode);
+    capture_count = lre_get_capture_count(re_bytecode);
+    capture = js_malloc(ctx, sizeof(capture[0]) * capture_count * 2 +
+                        sizeof(pos[0]) * capture_count * 2);
+    if (!capture)
+        goto exception;
+    pos = (int *)(capture + capture_count * 2);
+    shift = sp->is_wide_char;
+    str_buf = sp->u.str8;
+
+    last_index = 0;
+    if (!is_global && (re_flags & LRE_FLAG_STICKY))
+        last_index = max_int(JS_VALUE_GET_INT(JS_VALUE_GET_OBJ(rx)->prop[0].u.value), 0);
+    /* no user code can be called during the matching, so only the
+       last value of 'lastIndex' is stored */
+    new_last_index = -1;
+    next_src_pos = 0;
+    for(;;) {
+        if (last_index > sp->len) {
+            new_last_index = 0;
+            break;
+        }
+        ret = lre_exec(capture, re_bytecode, str_buf, last_index, sp->len,
+                       shift, ctx);
+        if (ret != 1) {
+            if (ret < 0) {
+                if (ret == -1)
+                    JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+                goto exception;
+            }
+            if (re_flags & (LRE_FLAG_GLOBAL | LRE_FLAG_STICKY))
+                new_last_index = 0;
+            break;
+        }
+        for(i = 0; i < capture_count; i++) {
+            if (capture[2 * i] == NULL || capture[2 * i + 1] == NULL) {
+                pos[2 * i] = pos[2 * i + 1] = -1;
+            } else {
+                pos[2 * i] = (capture[2 * i] - str_buf) >> shift;
+                pos[2 * i + 1] = (capture[2 * i + 1] - str_buf) >> shift;
+            }
+        }
+        start = pos[0];
+        end = pos[1];
+        if (re_flags & (LRE_FLAG_GLOBAL | LRE_FLAG_STICKY))
+            new_last_index = end;
+        if (rp) {
+            string_buffer_concat(b, sp, next_src_pos, start);
+            js_regexp_get_substitution(b, sp, rp, pos, capture_count);
+            next_src_pos = end;
+        } else {
+            /* the replace function is called after all the matches
+               are found */
+            if (dbuf_put(&dbuf, (uint8_t *)pos,
+                         sizeof(pos[0]) * capture_count * 2)) {
+                JS_ThrowOutOfMemory(ctx);
+                goto exception;
+            }
+        }
+        if (!is_global)
+            break;
+        if (end == start)
+            end = string_advance_index(sp, end, full_unicode);
+        last_index = end;
+    }
+    if (new_last_index >= 0) {
+        if (JS_SetProperty(ctx, rx, JS_ATOM_lastIndex,
+                           JS_NewInt64(ctx, new_last_index)) < 0)
+            goto exception;
+    }
+
+    if (!rp) {
+        args = js_malloc(ctx, sizeof(args[0]) * (capture_count + 2));
+        if (!args)
+            goto exception;
+        n = dbuf.size / (sizeof(pos[0]) * capture_count * 2);
+        for(j = 0; j < n; j++) {
+            pos = (int *)dbuf.buf + j * capture_count * 2;
+            for(i = 0; i < capture_count; i++) {
+                if (pos[2 * i] < 0) {
+                    val = JS_UNDEFINED;
+                } else {
+                    val = js_sub_string(ctx, sp, pos[2 * i], pos[2 * i + 1]);
+                    if (JS_IsException(val)) {
+                        while (--i >= 0)
+                            JS_FreeValue(ctx, args[i]);
+                        goto exception;
+                    }
+                }
+                args[i] = val;
+            }
+            args[capture_count] = JS_NewInt32(ctx, pos[0]);
+            args[capture_count + 1] = JS_DupValue(ctx, str);
+            val = JS_Call(ctx, rep, JS_UNDEFINED, capture_count + 2,
+                          (JSValueConst *)args);
+            for(i = 0; i < capture_count + 2; i++)
+                JS_FreeValue(ctx, args[i]);
+            val = JS_ToStringFree(ctx, val);
+            if (JS_IsException(val))
+                goto exception;
+            string_buffer_concat(b, sp, next_src_pos, pos[0]);
+            string_buffer_concat_value_free(b, val);
+            next_src_pos = pos[1];
+        }
+    }
+    string_buffer_concat(b, sp, next_src_pos, sp->len);
+    js_free(ctx, args);
+    js_free(ctx, capture);
+    dbuf_free(&dbuf);
+    return string_buffer_end(b);
+ exception:
+    js_free(ctx, args);
+    js_free(ctx, capture);
+    dbuf_free(&dbuf);
+    string_buffer_free(b);
+    return JS_EXCEPTION;
+}
+
 static JSValue js_regexp_Symbol_replace(JSContext *ctx, JSValueConst this_val,
                                         int argc, JSValueConst *argv)
 {
@@ -43099,9 +47722,11 @@ static JSValue js_regexp_Symbol_replace(JSContext *ctx, JSValueConst this_val,
     JSValueConst args[6];
     JSValue str, rep_val, matched, tab, rep_str, namedCaptures, res;
     JSString *sp, *rp;
+    JSRegExp *re;
     StringBuffer b_s, *b = &b_s;
     ValueBuffer v_b, *results = &v_b;
     int nextSourcePosition, n, j, functionalReplace, is_global, fullUnicode;
+    int re_flags;
     uint32_t nCaptures;
     int64_t position;
 
@@ -43147,6 +47772,19 @@ static JSValue js_regexp_Symbol_replace(JSContext *ctx, JSValueConst this_val,
         res = JS_RegExpDelete(ctx, rx, str);
         goto done;
     }
+    re = js_get_unmodified_regexp(ctx, rx);
+    if (re) {
+        re_flags = lre_get_flags(re->bytecode->u.str8);
+        /* the flag getters must be consistent with the regexp flags */
+        if (is_global == ((re_flags & LRE_FLAG_GLOBAL) != 0) &&
+            (!is_global || fullUnicode == ((re_flags & LRE_FLAG_UTF16) != 0)) &&
+            (!(re_flags & LRE_FLAG_NAMED_GROUPS) ||
+             (rp && string_indexof_char(rp, '$', 0) < 0))) {
+            res = js_regexp_replace_fast(ctx, rx, re, str, rep, rp,
+                                         is_global, fullUnicode);
+            goto done;
+        }
+    }
     for(;;) {
         JSValue result;
         result = JS_RegExpExec(ctx, rx, str);
@@ -43332,6 +47970,113 @@ exception:
     return JS_EXCEPTION;
 }
 
+/* RegExp.prototype[Symbol.split] when 'splitter' is an unmodified
+   RegExp object created by the RegExp constructor: the sticky
+   matches are computed with lre_exec(). If 'rx' has the same
+   pattern and flags except 'y', its bytecode is used to search the
+   next match instead of trying each position. */
+static int js_regexp_split_fast(JSContext *ctx, JSValueConst A,
+                                JSValueConst rx, JSRegExp *re,
+                                JSString *strp, uint32_t lim,
+                                BOOL unicode_matching)
+{
+    JSRegExp *re1;
+    JSValue sub;
+    uint8_t *re_bytecode, **capture, *str_buf;
+    uint32_t size, p, q, e;
+    int capture_count, shift, ret, i;
+    int64_t lengthA;
+    BOOL is_sticky;
+
+    re_bytecode = re->bytecode->u.str8;
+    re1 = js_get_regexp(ctx, rx, FALSE);
+    if (re1 && js_string_compare(ctx, re1->pattern, re->pattern) == 0 &&
+        (lre_get_flags(re1->bytecode->u.str8) | LRE_FLAG_STICKY) ==
+        lre_get_flags(re_bytecode)) {
+        re_bytecode = re1->bytecode->u.str8;
+    }
+    is_sticky = (lre_get_flags(re_bytecode) & LRE_FLAG_STICKY) != 0;
+    capture_count = lre_get_capture_count(re_bytecode);
+    capture = js_malloc(ctx, sizeof(capture[0]) * capture_count * 2);
+    if (!capture)
+        return -1;
+    shift = strp->is_wide_char;
+    str_buf = strp->u.str8;
+    size = strp->len;
+    lengthA = 0;
+    p = q = 0;
+    if (size == 0) {
+        ret = lre_exec(capture, re_bytecode, str_buf, 0, 0, shift, ctx);
+        if (ret < 0)
+            goto exec_fail;
+        if (ret == 1)
+            goto done;
+        goto add_tail;
+    }
+    while (q < size) {
+        ret = lre_exec(capture, re_bytecode, str_buf, q, size, shift, ctx);
+        if (ret < 0)
+            goto exec_fail;
+        if (ret == 0) {
+            if (!is_sticky)
+                break;
+            q = string_advance_index(strp, q, unicode_matching);
+            continue;
+        }
+        /* the search may have skipped positions */
+        q = (capture[0] - str_buf) >> shift;
+        if (q >= size)
+            break;
+        e = (capture[1] - str_buf) >> shift;
+        if (e == p) {
+            q = string_advance_index(strp, q, unicode_matching);
+            continue;
+        }
+        sub = js_sub_string(ctx, strp, p, q);
+        if (JS_IsException(sub))
+            goto fail;
+        if (JS_DefinePropertyValueInt64(ctx, A, lengthA++, sub,
+                                        JS_PROP_C_W_E | JS_PROP_THROW) < 0)
+            goto fail;
+        if (lengthA == lim)
+            goto done;
+        p = e;
+        for(i = 1; i < capture_count; i++) {
+            if (capture[2 * i] == NULL || capture[2 * i + 1] == NULL) {
+                sub = JS_UNDEFINED;
+            } else {
+                sub = js_sub_string(ctx, strp,
+                                    (capture[2 * i] - str_buf) >> shift,
+                                    (capture[2 * i + 1] - str_buf) >> shift);
+                if (JS_IsException(sub))
+                    goto fail;
+            }
+            if (JS_DefinePropertyValueInt64(ctx, A, lengthA++, sub,
+                                            JS_PROP_C_W_E | JS_PROP_THROW) < 0)
+                goto fail;
+            if (lengthA == lim)
+                goto done;
+        }
+        q = p;
+    }
+ add_tail:
+    sub = js_sub_string(ctx, strp, p, size);
+    if (JS_IsException(sub))
+        goto fail;
+    if (JS_DefinePropertyValueInt64(ctx, A, lengthA++, sub,
+                                    JS_PROP_C_W_E | JS_PROP_THROW) < 0)
+        goto fail;
+ done:
+    js_free(ctx, capture);
+    return 0;
+ exec_fail:
+    if (ret == -1)
+        JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+ fail:
+    js_free(ctx, capture);
+    return -1;
+}
+
 static JSValue js_regexp_Symbol_split(JSContext *ctx, JSValueConst this_val,
                                        int argc, JSValueConst *argv)
 {
@@ -43340,6 +48085,7 @@ static JSValue js_regexp_Symbol_split(JSContext *ctx, JSValueConst this_val,
     JSValueConst args[2];
     JSValue str, ctor, splitter, A, flags, z, sub;
     JSString *strp;
+    JSRegExp *re;
     uint32_t lim, size, p, q;
     int unicodeMatching;
     int64_t lengthA, e, numberOfCaptures, i;
@@ -43386,6 +48132,16 @@ static JSValue js_regexp_Symbol_split(JSContext *ctx, JSValueConst this_val,
             goto done;
     }
     strp = JS_VALUE_GET_STRING(str);
+    if (js_same_value(ctx, ctor, ctx->regexp_ctor)) {
+        /* the splitter is not visible from user code */
+        re = js_get_unmodified_regexp(ctx, splitter);
+        if (re) {
+            if (js_regexp_split_fast(ctx, A, rx, re, strp, lim,
+                                     unicodeMatching))
+                goto exception;
+            goto done;
+        }
+    }
     p = q = 0;
     size = strp->len;
     if (size == 0) {
@@ -43425,7 +48181,7 @@ static JSValue js_regexp_Symbol_split(JSContext *ctx, JSValueConst this_val,
                 if (js_get_length64(ctx, &numberOfCaptures, z))
                     goto exception;
                 for(i = 1; i < numberOfCaptures; i++) {
-                    sub = JS_ToStringFree(ctx, JS_GetPropertyInt64(ctx, z, i));
+                    sub = JS_GetPropertyInt64(ctx, z, i);
                     if (JS_IsException(sub))
                         goto exception;
                     if (JS_DefinePropertyValueInt64(ctx, A, lengthA++, sub, JS_PROP_C_W_E | JS_PROP_THROW) < 0)
@@ -43843,6 +48599,7 @@ static JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
         if (JS_IsFunction(ctx, val))
             break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_INT:
     case JS_TAG_FLOAT64:
 #ifdef CONFIG_BIGNUM
@@ -44024,6 +48781,7 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
         JS_FreeValue(ctx, prop);
         return 0;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_ToQuotedStringFree(ctx, val);
         if (JS_IsException(val))
             goto exception;
@@ -44116,7 +48874,7 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
                     v = JS_ToStringFree(ctx, v);
                     if (JS_IsException(v))
                         goto exception;
-                } else if (!JS_IsString(v)) {
+                } else if (!js_is_string(v)) {
                     JS_FreeValue(ctx, v);
                     continue;
                 }
@@ -44147,12 +48905,15 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
             goto exception;
         }
     }
+    space = js_linearize_string(ctx, space);
+    if (JS_IsException(space))
+        goto exception;
     if (JS_IsNumber(space)) {
         int n;
         if (JS_ToInt32Clamp(ctx, &n, space, 0, 10, 0))
             goto exception;
         jsc->gap = JS_NewStringLen(ctx, "          ", n);
-    } else if (JS_IsString(space)) {
+    } else if (js_is_string(space)) {
         JSString *p = JS_VALUE_GET_STRING(space);
         jsc->gap = js_sub_string(ctx, p, 0, min_int(p->len, 10));
     } else {
@@ -44289,7 +49050,7 @@ static JSValue js_reflect_get(JSContext *ctx, JSValueConst this_val,
     atom = JS_ValueToAtom(ctx, prop);
     if (unlikely(atom == JS_ATOM_NULL))
         return JS_EXCEPTION;
-    ret = JS_GetPropertyInternal(ctx, obj, atom, receiver, FALSE);
+    ret = JS_GetPropertyInternal2(ctx, obj, atom, receiver, FALSE);
     JS_FreeAtom(ctx, atom);
     return ret;
 }
@@ -44637,7 +49398,7 @@ static JSValue js_proxy_get(JSContext *ctx, JSValueConst obj, JSAtom atom,
         return JS_EXCEPTION;
     /* Note: recursion is possible thru the prototype of s->target */
     if (JS_IsUndefined(method))
-        return JS_GetPropertyInternal(ctx, s->target, atom, receiver, FALSE);
+        return JS_GetPropertyInternal2(ctx, s->target, atom, receiver, FALSE);
     atom_val = JS_AtomToValue(ctx, atom);
     if (JS_IsException(atom_val)) {
         JS_FreeValue(ctx, method);
@@ -45065,7 +49826,7 @@ static int js_proxy_get_own_property_names(JSContext *ctx,
         val = JS_GetPropertyUint32(ctx, prop_array, i);
         if (JS_IsException(val))
             goto fail;
-        if (!JS_IsString(val) && !JS_IsSymbol(val)) {
+        if (!js_is_string(val) && !JS_IsSymbol(val)) {
             JS_FreeValue(ctx, val);
             JS_ThrowTypeError(ctx, "proxy: properties must be strings or symbols");
             goto fail;
@@ -45612,6 +50373,9 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
     case JS_TAG_STRING:
         h = hash_string(JS_VALUE_GET_STRING(key), 0);
         break;
+    case JS_TAG_STRING_ROPE:
+        h = js_string_rope_hash(key, 0);
+        break;
     case JS_TAG_OBJECT:
     case JS_TAG_SYMBOL:
         h = (uintptr_t)JS_VALUE_GET_PTR(key) * 3163;
@@ -45690,7 +50454,7 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
     uint32_t h;
     JSMapRecord *mr;
 
-    mr = js_malloc(ctx, sizeof(*mr));
+    mr = js_pool_alloc(ctx, sizeof(*mr));
     if (!mr)
         return NULL;
     mr->ref_count = 1;
@@ -45749,7 +50513,7 @@ static void map_delete_record(JSRuntime *rt, JSMapState *s, JSMapRecord *mr)
     JS_FreeValueRT(rt, mr->value);
     if (--mr->ref_count == 0) {
         list_del(&mr->link);
-        js_free_rt(rt, mr);
+        js_pool_free_rt(rt, mr, sizeof(*mr));
     } else {
         /* keep a zombie record for iterators */
         mr->empty = TRUE;
@@ -45765,7 +50529,7 @@ static void map_decref_record(JSRuntime *rt, JSMapRecord *mr)
         /* the record can be safely removed */
         assert(mr->empty);
         list_del(&mr->link);
-        js_free_rt(rt, mr);
+        js_pool_free_rt(rt, mr, sizeof(*mr));
     }
 }
 
@@ -45789,7 +50553,7 @@ static void reset_weak_ref(JSRuntime *rt, JSObject *p)
     for(mr = p->first_weak_ref; mr != NULL; mr = mr_next) {
         mr_next = mr->next_weak_ref;
         JS_FreeValueRT(rt, mr->value);
-        js_free_rt(rt, mr);
+        js_pool_free_rt(rt, mr, sizeof(*mr));
     }
 
     p->first_weak_ref = NULL; /* fail safe */
@@ -45964,7 +50728,7 @@ static void js_map_finalizer(JSRuntime *rt, JSValue val)
                     JS_FreeValueRT(rt, mr->key);
                 JS_FreeValueRT(rt, mr->value);
             }
-            js_free_rt(rt, mr);
+            js_pool_free_rt(rt, mr, sizeof(*mr));
         }
         js_free_rt(rt, s->hash_table);
         js_free_rt(rt, s);
@@ -46335,6 +51099,31 @@ void JS_SetHostPromiseRejectionTracker(JSRuntime *rt,
     rt->host_promise_rejection_tracker_opaque = opaque;
 }
 
+/* call the host promise rejection tracker. The ropes are internal
+   so 'reason' is linearized first. */
+static void js_promise_rejection_tracker(JSContext *ctx,
+                                         JSValueConst promise,
+                                         JSValueConst reason, BOOL is_handled)
+{
+    JSRuntime *rt = ctx->rt;
+    JSValue exception;
+
+    if (!rt->host_promise_rejection_tracker)
+        return;
+    reason = js_linearize_string_const(ctx, reason);
+    if (JS_IsException(reason)) {
+        /* out of memory: report the exception instead */
+        exception = JS_GetException(ctx);
+        rt->host_promise_rejection_tracker(ctx, promise, exception,
+                                           is_handled,
+                                           rt->host_promise_rejection_tracker_opaque);
+        JS_FreeValue(ctx, exception);
+        return;
+    }
+    rt->host_promise_rejection_tracker(ctx, promise, reason, is_handled,
+                                       rt->host_promise_rejection_tracker_opaque);
+}
+
 static void fulfill_or_reject_promise(JSContext *ctx, JSValueConst promise,
                                       JSValueConst value, BOOL is_reject)
 {
@@ -46350,13 +51139,8 @@ static void fulfill_or_reject_promise(JSContext *ctx, JSValueConst promise,
 #ifdef DUMP_PROMISE
     printf("fulfill_or_reject_promise: is_reject=%d\n", is_reject);
 #endif
-    if (s->promise_state == JS_PROMISE_REJECTED && !s->is_handled) {
-        JSRuntime *rt = ctx->rt;
-        if (rt->host_promise_rejection_tracker) {
-            rt->host_promise_rejection_tracker(ctx, promise, value, FALSE,
-                                               rt->host_promise_rejection_tracker_opaque);
-        }
-    }
+    if (s->promise_state == JS_PROMISE_REJECTED && !s->is_handled)
+        js_promise_rejection_tracker(ctx, promise, value, FALSE);
 
     list_for_each_safe(el, el1, &s->promise_reactions[is_reject]) {
         rd = list_entry(el, JSPromiseReactionData, link);
@@ -47086,13 +51870,8 @@ static __exception int perform_promise_then(JSContext *ctx,
             list_add_tail(&rd_array[i]->link, &s->promise_reactions[i]);
     } else {
         JSValueConst args[5];
-        if (s->promise_state == JS_PROMISE_REJECTED && !s->is_handled) {
-            JSRuntime *rt = ctx->rt;
-            if (rt->host_promise_rejection_tracker) {
-                rt->host_promise_rejection_tracker(ctx, promise, s->promise_result,
-                                                   TRUE, rt->host_promise_rejection_tracker_opaque);
-            }
-        }
+        if (s->promise_state == JS_PROMISE_REJECTED && !s->is_handled)
+            js_promise_rejection_tracker(ctx, promise, s->promise_result, TRUE);
         i = s->promise_state - JS_PROMISE_FULFILLED;
         rd = rd_array[i];
         args[0] = rd->resolving_funcs[0];
@@ -48220,7 +52999,7 @@ static JSValue js_date_constructor(JSContext *ctx, JSValueConst new_target,
             }
         }
         v = JS_ToPrimitive(ctx, argv[0], HINT_NONE);
-        if (JS_IsString(v)) {
+        if (js_is_string(v)) {
             dv = js_Date_parse(ctx, JS_UNDEFINED, 1, (JSValueConst *)&v);
             JS_FreeValue(ctx, v);
             if (JS_IsException(dv))
@@ -48600,7 +53379,7 @@ static JSValue js_date_Symbol_toPrimitive(JSContext *ctx, JSValueConst this_val,
     if (!JS_IsObject(obj))
         return JS_ThrowTypeErrorNotAnObject(ctx);
 
-    if (JS_IsString(argv[0])) {
+    if (js_is_string(argv[0])) {
         hint = JS_ValueToAtom(ctx, argv[0]);
         if (hint == JS_ATOM_NULL)
             return JS_EXCEPTION;
@@ -48772,7 +53551,7 @@ static const JSCFunctionListEntry js_date_proto_funcs[] = {
     JS_CFUNC_DEF("toJSON", 1, js_date_toJSON ),
 };
 
-void JS_AddIntrinsicDate(JSContext *ctx)
+static void js_init_date(JSContext *ctx)
 {
     JSValueConst obj;
 
@@ -48785,6 +53564,11 @@ void JS_AddIntrinsicDate(JSContext *ctx)
     JS_SetPropertyFunctionList(ctx, obj, js_date_funcs, countof(js_date_funcs));
 }
 
+void JS_AddIntrinsicDate(JSContext *ctx)
+{
+    js_add_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_DATE);
+}
+
 /* eval */
 
 void JS_AddIntrinsicEval(JSContext *ctx)
@@ -49075,6 +53859,9 @@ void JS_AddIntrinsicOperators(JSContext *ctx)
 {
     JSValue obj;
 
+    /* the prototypes must exist to have a default operator set */
+    js_init_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_BIG_FLOAT);
+    js_init_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_BIG_DECIMAL);
     ctx->allow_operator_overloading = TRUE;
     obj = JS_NewCFunction(ctx, js_global_operators, "Operators", 1);
     JS_SetPropertyFunctionList(ctx, obj,
@@ -49148,6 +53935,7 @@ static JSValue JS_ToBigIntCtorFree(JSContext *ctx, JSValue val)
             break;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         val = JS_StringToBigIntErr(ctx, val);
         break;
     case JS_TAG_OBJECT:
@@ -49702,6 +54490,7 @@ static JSValue js_bigfloat_constructor(JSContext *ctx,
                 break;
             goto redo;
         case JS_TAG_STRING:
+        case JS_TAG_STRING_ROPE:
             {
                 const char *str, *p;
                 size_t len;
@@ -50312,7 +55101,6 @@ static const JSCFunctionListEntry js_float_env_proto_funcs[] = {
 void JS_AddIntrinsicBigFloat(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
-    JSValueConst obj1;
     
     rt->bigfloat_ops.to_string = js_bigfloat_to_string;
     rt->bigfloat_ops.from_string = js_string_to_bigfloat;
@@ -50321,7 +55109,14 @@ void JS_AddIntrinsicBigFloat(JSContext *ctx)
     rt->bigfloat_ops.compare = js_compare_bigfloat;
     rt->bigfloat_ops.mul_pow10_to_float64 = js_mul_pow10_to_float64;
     rt->bigfloat_ops.mul_pow10 = js_mul_pow10;
-    
+
+    js_add_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_BIG_FLOAT);
+}
+
+static void js_init_big_float(JSContext *ctx)
+{
+    JSValueConst obj1;
+
     ctx->class_proto[JS_CLASS_BIG_FLOAT] = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_BIG_FLOAT],
                                js_bigfloat_proto_funcs,
@@ -50380,6 +55175,7 @@ static JSValue JS_ToBigDecimalFree(JSContext *ctx, JSValue val,
             break;
         goto redo;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
         {
             const char *str, *p;
             size_t len;
@@ -50802,7 +55598,6 @@ static const JSCFunctionListEntry js_bigdecimal_funcs[] = {
 void JS_AddIntrinsicBigDecimal(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
-    JSValueConst obj1;
 
     rt->bigdecimal_ops.to_string = js_bigdecimal_to_string;
     rt->bigdecimal_ops.from_string = js_string_to_bigdecimal;
@@ -50810,6 +55605,13 @@ void JS_AddIntrinsicBigDecimal(JSContext *ctx)
     rt->bigdecimal_ops.binary_arith = js_binary_arith_bigdecimal;
     rt->bigdecimal_ops.compare = js_compare_bigdecimal;
 
+    js_add_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_BIG_DECIMAL);
+}
+
+static void js_init_big_decimal(JSContext *ctx)
+{
+    JSValueConst obj1;
+
     ctx->class_proto[JS_CLASS_BIG_DECIMAL] = JS_NewObject(ctx);
     JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_BIG_DECIMAL],
                                js_bigdecimal_proto_funcs,
@@ -51144,6 +55946,7 @@ static JSValue js_array_buffer_constructor3(JSContext *ctx,
     init_list_head(&abuf->array_list);
     abuf->detached = FALSE;
     abuf->shared = (class_id == JS_CLASS_SHARED_ARRAY_BUFFER);
+    abuf->pin_count = 0;
     abuf->opaque = opaque;
     abuf->free_func = free_func;
     if (alloc_flag && buf)
@@ -51276,6 +56079,12 @@ static JSValue js_array_buffer_get_byteLength(JSContext *ctx,
     return JS_NewUint32(ctx, abuf->byte_length);
 }
 
+static JSValue JS_ThrowTypeErrorPinnedArrayBuffer(JSContext *ctx)
+{
+    return JS_ThrowTypeError(ctx, "ArrayBuffer is in use by a pending operation");
+}
+
+/* a TypeError is thrown if the ArrayBuffer is pinned */
 void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
 {
     JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
@@ -51283,6 +56092,10 @@ void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
 
     if (!abuf || abuf->detached)
         return;
+    if (abuf->pin_count != 0) {
+        JS_ThrowTypeErrorPinnedArrayBuffer(ctx);
+        return;
+    }
     if (abuf->free_func)
         abuf->free_func(ctx->rt, abuf->opaque, abuf->data);
     abuf->data = NULL;
@@ -51303,6 +56116,47 @@ void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj)
     }
 }
 
+/* detach the ArrayBuffer 'obj' without freeing its data, which is
+   stored in 'tb' so that it can be used by another runtime */
+static int js_array_buffer_transfer(JSContext *ctx,
+                                    JSTransferredArrayBuffer *tb,
+                                    JSValueConst obj)
+{
+    JSRuntime *rt = ctx->rt;
+    JSArrayBuffer *abuf = JS_GetOpaque(obj, JS_CLASS_ARRAY_BUFFER);
+    JSMallocState *ms = &rt->malloc_state;
+
+    tb->byte_length = abuf->byte_length;
+    if (abuf->free_func != js_array_buffer_free) {
+        tb->data = abuf->data;
+        tb->free_func = abuf->free_func;
+        tb->opaque = abuf->opaque;
+    } else if (rt->mf.js_malloc == js_def_malloc) {
+        /* the data was allocated with malloc(): it is removed from
+           the memory usage of the runtime */
+        ms->malloc_count--;
+        ms->malloc_size -= js_def_malloc_usable_size(abuf->data) +
+            MALLOC_OVERHEAD;
+        tb->data = abuf->data;
+        tb->free_func = js_array_buffer_free_transferred;
+        tb->opaque = NULL;
+    } else {
+        /* unknown allocator: the data must be copied */
+        tb->data = js_array_buffer_alloc_transferred(abuf->byte_length);
+        if (!tb->data) {
+            JS_ThrowOutOfMemory(ctx);
+            return -1;
+        }
+        memcpy(tb->data, abuf->data, abuf->byte_length);
+        tb->free_func = js_array_buffer_free_transferred;
+        tb->opaque = NULL;
+        js_free_rt(rt, abuf->data);
+    }
+    abuf->free_func = NULL;
+    JS_DetachArrayBuffer(ctx, obj);
+    return 0;
+}
+
 /* get an ArrayBuffer or SharedArrayBuffer */
 static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj)
 {
@@ -51319,6 +56173,29 @@ static JSArrayBuffer *js_get_array_buffer(JSContext *ctx, JSValueConst obj)
     return p->u.array_buffer;
 }
 
+/* the data of a pinned ArrayBuffer stays valid until it is unpinned
+   because it cannot be detached. Return -1 if exception. */
+int JS_PinArrayBuffer(JSContext *ctx, JSValueConst obj)
+{
+    JSArrayBuffer *abuf = js_get_array_buffer(ctx, obj);
+    if (!abuf)
+        return -1;
+    if (abuf->detached) {
+        JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
+        return -1;
+    }
+    abuf->pin_count++;
+    return 0;
+}
+
+void JS_UnpinArrayBuffer(JSRuntime *rt, JSValueConst obj)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSArrayBuffer *abuf = p->u.array_buffer;
+    assert(abuf->pin_count > 0);
+    abuf->pin_count--;
+}
+
 /* return NULL if exception. WARNING: any JS call can detach the
    buffer and render the returned pointer invalid */
 uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *psize, JSValueConst obj)
@@ -53949,7 +58826,7 @@ void JS_AddIntrinsicAtomics(JSContext *ctx)
 
 #endif /* CONFIG_ATOMICS */
 
-void JS_AddIntrinsicTypedArrays(JSContext *ctx)
+static void js_init_typed_arrays(JSContext *ctx)
 {
     JSValue typed_array_base_proto, typed_array_base_func;
     JSValueConst array_buffer_func, shared_array_buffer_func;
@@ -54029,8 +58906,117 @@ void JS_AddIntrinsicTypedArrays(JSContext *ctx)
     JS_NewGlobalCConstructorOnly(ctx, "DataView",
                                  js_dataview_constructor, 1,
                                  ctx->class_proto[JS_CLASS_DATAVIEW]);
+}
+
+void JS_AddIntrinsicTypedArrays(JSContext *ctx)
+{
+    js_add_lazy_intrinsic(ctx, JS_LAZY_INTRINSIC_TYPED_ARRAYS);
     /* Atomics */
 #ifdef CONFIG_ATOMICS
     JS_AddIntrinsicAtomics(ctx);
 #endif
 }
+
+/* Lazy intrinsics */
+
+typedef struct {
+    void (*init)(JSContext *ctx);
+    /* the prototypes of these classes are created by 'init' */
+    uint16_t class_id_first, class_id_last;
+    /* the global properties defined by 'init' */
+    uint16_t atom_first, atom_last;
+} JSLazyIntrinsic;
+
+static const JSLazyIntrinsic js_lazy_intrinsics[JS_LAZY_INTRINSIC_COUNT] = {
+    { js_init_date, JS_CLASS_DATE, JS_CLASS_DATE,
+      JS_ATOM_Date, JS_ATOM_Date },
+    /* the atoms have the same order as the class IDs */
+    { js_init_typed_arrays, JS_CLASS_ARRAY_BUFFER, JS_CLASS_DATAVIEW,
+      JS_ATOM_ArrayBuffer, JS_ATOM_DataView },
+#ifdef CONFIG_BIGNUM
+    { js_init_big_float, JS_CLASS_BIG_FLOAT, JS_CLASS_FLOAT_ENV,
+      JS_ATOM_BigFloat, JS_ATOM_BigFloatEnv },
+    { js_init_big_decimal, JS_CLASS_BIG_DECIMAL, JS_CLASS_BIG_DECIMAL,
+      JS_ATOM_BigDecimal, JS_ATOM_BigDecimal },
+#endif
+};
+
+/* define the global properties of the intrinsic 'idx' as placeholders
+   which create it when they are accessed */
+static void js_add_lazy_intrinsic(JSContext *ctx, int idx)
+{
+    const JSLazyIntrinsic *li = &js_lazy_intrinsics[idx];
+    JSAtom atom;
+
+    if (ctx->lazy_intrinsics & (1 << idx))
+        return;
+    for(atom = li->atom_first; atom <= li->atom_last; atom++) {
+        JS_DefineAutoInitProperty(ctx, ctx->global_obj, atom,
+                                  JS_AUTOINIT_ID_INTRINSIC,
+                                  (void *)(uintptr_t)idx,
+                                  JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    }
+    ctx->lazy_intrinsics |= 1 << idx;
+}
+
+static int js_init_lazy_intrinsic(JSContext *ctx, int idx)
+{
+    const JSLazyIntrinsic *li = &js_lazy_intrinsics[idx];
+    JSObject *p;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSValue global_obj, holder, val;
+    JSAtom atom;
+
+    if (!(ctx->lazy_intrinsics & (1 << idx)))
+        return 0;
+    ctx->lazy_intrinsics &= ~(1 << idx);
+
+    /* 'init' defines the global properties in a temporary object so
+       that the placeholders can be replaced without instantiating them
+       again and without modifying the properties redefined by the
+       user */
+    holder = JS_NewObject(ctx);
+    if (JS_IsException(holder))
+        return -1;
+    global_obj = ctx->global_obj;
+    ctx->global_obj = holder;
+    li->init(ctx);
+    ctx->global_obj = global_obj;
+
+    p = JS_VALUE_GET_OBJ(global_obj);
+    for(atom = li->atom_first; atom <= li->atom_last; atom++) {
+        prs = find_own_property(&pr, p, atom);
+        if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_AUTOINIT &&
+            js_autoinit_get_id(pr) == JS_AUTOINIT_ID_INTRINSIC) {
+            val = JS_GetProperty(ctx, holder, atom);
+            if (JS_IsException(val))
+                goto fail;
+            if (js_shape_prepare_update(ctx, p, &prs)) {
+                JS_FreeValue(ctx, val);
+                goto fail;
+            }
+            js_autoinit_free(ctx->rt, pr);
+            prs->flags &= ~JS_PROP_TMASK;
+            pr->u.value = val;
+        }
+    }
+    JS_FreeValue(ctx, holder);
+    return 0;
+ fail:
+    JS_FreeValue(ctx, holder);
+    return -1;
+}
+
+/* create the intrinsic defining the prototype of 'class_id' */
+static void js_init_lazy_class_proto(JSContext *ctx, JSClassID class_id)
+{
+    int idx;
+    for(idx = 0; idx < JS_LAZY_INTRINSIC_COUNT; idx++) {
+        const JSLazyIntrinsic *li = &js_lazy_intrinsics[idx];
+        if (class_id >= li->class_id_first && class_id <= li->class_id_last) {
+            js_init_lazy_intrinsic(ctx, idx);
+            break;
+        }
+    }
+}
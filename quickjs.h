@@ -335,6 +335,9 @@ void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
 /* use 0 to disable maximum stack size check */
 void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
+/* maximum number of execution steps of a regular expression before
+   an InternalError is raised. Use 0 to disable it. */
+void JS_SetRegExpStepLimit(JSRuntime *rt, uint64_t step_limit);
 /* should be called when changing thread to update the stack top value
    used to check stack overflow. */
 void JS_UpdateStackTop(JSRuntime *rt);
@@ -410,11 +413,56 @@ typedef struct JSMemoryUsage {
     int64_t c_func_count, array_count;
     int64_t fast_array_count, fast_array_elements;
     int64_t binary_object_count, binary_object_size;
+    int64_t pool_count, pool_size; /* object pool slabs */
+    int64_t pool_used_size; /* size of the allocated pool blocks */
+    int64_t regexp_cache_count, regexp_cache_size; /* compiled regexp cache */
+    int64_t regexp_cache_hits, regexp_cache_misses;
 } JSMemoryUsage;
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
+typedef struct JSGCStats {
+    int64_t young_gc_count; /* collections of the young generation */
+    int64_t full_gc_count; /* collections of all the objects */
+    int64_t young_gc_time, full_gc_time; /* total pause time in us */
+    int64_t max_gc_time; /* longest pause in us */
+    int64_t scanned_count; /* GC objects examined by the collections */
+    int64_t freed_count; /* GC objects freed because in a cycle */
+    int64_t promoted_count; /* GC objects moved to the old generation */
+    int64_t young_obj_count, old_obj_count; /* current GC objects */
+} JSGCStats;
+
+void JS_GetGCStats(JSRuntime *rt, JSGCStats *s);
+
+/* execution profile */
+typedef struct JSFunctionProfile {
+    uint32_t call_count; /* number of calls */
+    uint32_t loop_count; /* number of backward jumps */
+    uint32_t sample_count; /* number of samples where the function was
+                              executing */
+} JSFunctionProfile;
+
+/* return -1 if 'func_obj' is not a bytecode function */
+int JS_GetFunctionProfile(JSContext *ctx, JSValueConst func_obj,
+                          JSFunctionProfile *p);
+/* if enabled, the call stack is recorded each time the interrupt
+   handler is polled */
+void JS_SetProfileSampling(JSRuntime *rt, JS_BOOL enable);
+/* return { functions, samples } where 'functions' is the array of the
+   executed functions with their counters and 'samples' the array of
+   the recorded call stacks (outermost frame first, separated by
+   ';'). The counters and samples are cleared if 'reset' is TRUE. */
+JSValue JS_GetProfile(JSContext *ctx, JS_BOOL reset);
+/* write the symbols of the native code generated by the JIT to
+   'filename' in the Linux perf map format, or to
+   "/tmp/perf-<pid>.map" if 'filename' is NULL. The functions are then
+   compiled on their first call. Only the JIT generated code can be
+   mapped: without CONFIG_JIT, the interpreted functions all run in
+   the same C function, so -1 is always returned. Return -1 too if the
+   file cannot be opened. */
+int JS_SetPerfMapFile(JSRuntime *rt, const char *filename);
+
 /* atom support */
 #define JS_ATOM_NULL 0
 
@@ -818,6 +866,10 @@ JSValue JS_NewArrayBuffer(JSContext *ctx, uint8_t *buf, size_t len,
 JSValue JS_NewArrayBufferCopy(JSContext *ctx, const uint8_t *buf, size_t len);
 void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj);
 uint8_t *JS_GetArrayBuffer(JSContext *ctx, size_t *psize, JSValueConst obj);
+/* A pinned ArrayBuffer cannot be detached or transferred, so its data
+   can be used outside of the JS code, e.g. by asynchronous I/O */
+int JS_PinArrayBuffer(JSContext *ctx, JSValueConst obj);
+void JS_UnpinArrayBuffer(JSRuntime *rt, JSValueConst obj);
 JSValue JS_GetTypedArrayBuffer(JSContext *ctx, JSValueConst obj,
                                size_t *pbyte_offset,
                                size_t *pbyte_length,
@@ -865,6 +917,8 @@ void JS_SetModuleLoaderFunc(JSRuntime *rt,
 /* return the import.meta object of a module */
 JSValue JS_GetImportMeta(JSContext *ctx, JSModuleDef *m);
 JSAtom JS_GetModuleName(JSContext *ctx, JSModuleDef *m);
+/* return the namespace object of a module */
+JSValue JS_GetModuleNamespace(JSContext *ctx, JSModuleDef *m);
 
 /* JS Job support */
 
@@ -886,12 +940,37 @@ uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
 uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
                          int flags, uint8_t ***psab_tab, size_t *psab_tab_len);
 
+/* data of an ArrayBuffer transferred by JS_WriteObject3(). It must be
+   freed with 'free_func' if it is not given to JS_ReadObject2(). In
+   this case, 'rt' may be NULL. */
+typedef struct JSTransferredArrayBuffer {
+    uint8_t *data;
+    size_t byte_length;
+    JSFreeArrayBufferDataFunc *free_func;
+    void *opaque;
+} JSTransferredArrayBuffer;
+
+/* same as JS_WriteObject2() but the 'transfer_len' ArrayBuffers of
+   'transfer_list' are not copied: they are detached and their data is
+   stored in 'transfer_tab' */
+uint8_t *JS_WriteObject3(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len,
+                         JSValueConst *transfer_list,
+                         JSTransferredArrayBuffer *transfer_tab,
+                         int transfer_len);
+
 #define JS_READ_OBJ_BYTECODE  (1 << 0) /* allow function/module */
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                       int flags);
+/* read an object written by JS_WriteObject3(). The data of the
+   entries of 'transfer_tab' given to the new ArrayBuffers is set to
+   NULL. */
+JSValue JS_ReadObject2(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags, JSTransferredArrayBuffer *transfer_tab,
+                       int transfer_len);
 /* instantiate and evaluate a bytecode function. Only used when
    reading a script or module with JS_ReadObject() */
 JSValue JS_EvalFunction(JSContext *ctx, JSValue fun_obj);
@@ -0,0 +1,2091 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include <inttypes.h>
+
+const uint32_t qjsc_repl_size = 16652;
+
+const uint8_t qjsc_repl[16652] = {
+ 0x05, 0x97, 0x03, 0x0e, 0x72, 0x65, 0x70, 0x6c,
+ 0x2e, 0x6a, 0x73, 0x06, 0x73, 0x74, 0x64, 0x04,
+ 0x6f, 0x73, 0x10, 0x69, 0x73, 0x46, 0x69, 0x6e,
+ 0x69, 0x74, 0x65, 0x14, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x08, 0x6f,
+ 0x70, 0x65, 0x6e, 0x10, 0x46, 0x72, 0x61, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x1b, 0x5b, 0x30,
+ 0x6d, 0x08, 0x6e, 0x6f, 0x6e, 0x65, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x30, 0x6d, 0x0a, 0x62, 0x6c, 0x61,
+ 0x63, 0x6b, 0x0a, 0x1b, 0x5b, 0x33, 0x31, 0x6d,
+ 0x06, 0x72, 0x65, 0x64, 0x0a, 0x1b, 0x5b, 0x33,
+ 0x32, 0x6d, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x33, 0x6d, 0x0c, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0a, 0x1b, 0x5b,
+ 0x33, 0x34, 0x6d, 0x08, 0x62, 0x6c, 0x75, 0x65,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x35, 0x6d, 0x0e, 0x6d,
+ 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x36, 0x6d, 0x08, 0x63, 0x79, 0x61,
+ 0x6e, 0x0a, 0x1b, 0x5b, 0x33, 0x37, 0x6d, 0x0a,
+ 0x77, 0x68, 0x69, 0x74, 0x65, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x30, 0x3b, 0x31, 0x6d, 0x08, 0x67, 0x72,
+ 0x61, 0x79, 0x08, 0x67, 0x72, 0x65, 0x79, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x31, 0x3b, 0x31, 0x6d, 0x14,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x72,
+ 0x65, 0x64, 0x0e, 0x1b, 0x5b, 0x33, 0x32, 0x3b,
+ 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69, 0x67, 0x68,
+ 0x74, 0x5f, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x33, 0x3b, 0x31, 0x6d, 0x1a,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x34, 0x3b, 0x31, 0x6d, 0x16, 0x62, 0x72,
+ 0x69, 0x67, 0x68, 0x74, 0x5f, 0x62, 0x6c, 0x75,
+ 0x65, 0x0e, 0x1b, 0x5b, 0x33, 0x35, 0x3b, 0x31,
+ 0x6d, 0x1c, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+ 0x5f, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61,
+ 0x0e, 0x1b, 0x5b, 0x33, 0x36, 0x3b, 0x31, 0x6d,
+ 0x16, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+ 0x63, 0x79, 0x61, 0x6e, 0x0e, 0x1b, 0x5b, 0x33,
+ 0x37, 0x3b, 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69,
+ 0x67, 0x68, 0x74, 0x5f, 0x77, 0x68, 0x69, 0x74,
+ 0x65, 0x0e, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x0e,
+ 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x08,
+ 0x74, 0x79, 0x70, 0x65, 0x14, 0x69, 0x64, 0x65,
+ 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x0a,
+ 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0c, 0x72, 0x65,
+ 0x73, 0x75, 0x6c, 0x74, 0x12, 0x65, 0x72, 0x72,
+ 0x6f, 0x72, 0x5f, 0x6d, 0x73, 0x67, 0x04, 0x3e,
+ 0x20, 0x0c, 0x71, 0x6a, 0x73, 0x20, 0x3e, 0x20,
+ 0x0c, 0x20, 0x20, 0x2e, 0x2e, 0x2e, 0x20, 0x02,
+ 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02,
+ 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02,
+ 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0d, 0x02,
+ 0x0e, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02,
+ 0x13, 0x02, 0x14, 0x02, 0x18, 0x02, 0x19, 0x06,
+ 0x1b, 0x4f, 0x41, 0x06, 0x1b, 0x4f, 0x42, 0x06,
+ 0x1b, 0x4f, 0x43, 0x06, 0x1b, 0x4f, 0x44, 0x06,
+ 0x1b, 0x4f, 0x46, 0x06, 0x1b, 0x4f, 0x48, 0x0c,
+ 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x43, 0x0c, 0x1b,
+ 0x5b, 0x31, 0x3b, 0x35, 0x44, 0x08, 0x1b, 0x5b,
+ 0x31, 0x7e, 0x08, 0x1b, 0x5b, 0x33, 0x7e, 0x08,
+ 0x1b, 0x5b, 0x34, 0x7e, 0x08, 0x1b, 0x5b, 0x35,
+ 0x7e, 0x08, 0x1b, 0x5b, 0x36, 0x7e, 0x06, 0x1b,
+ 0x5b, 0x41, 0x06, 0x1b, 0x5b, 0x42, 0x06, 0x1b,
+ 0x5b, 0x43, 0x06, 0x1b, 0x5b, 0x44, 0x06, 0x1b,
+ 0x5b, 0x46, 0x06, 0x1b, 0x5b, 0x48, 0x04, 0x1b,
+ 0x7f, 0x04, 0x1b, 0x62, 0x04, 0x1b, 0x64, 0x04,
+ 0x1b, 0x66, 0x04, 0x1b, 0x6b, 0x04, 0x1b, 0x6c,
+ 0x04, 0x1b, 0x74, 0x04, 0x1b, 0x75, 0x02, 0x7f,
+ 0x0e, 0x65, 0x78, 0x65, 0x63, 0x43, 0x6d, 0x64,
+ 0x10, 0x74, 0x65, 0x72, 0x6d, 0x49, 0x6e, 0x69,
+ 0x74, 0x0c, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x6f,
+ 0x0c, 0x69, 0x73, 0x61, 0x74, 0x74, 0x79, 0x1a,
+ 0x74, 0x74, 0x79, 0x47, 0x65, 0x74, 0x57, 0x69,
+ 0x6e, 0x53, 0x69, 0x7a, 0x65, 0x12, 0x74, 0x74,
+ 0x79, 0x53, 0x65, 0x74, 0x52, 0x61, 0x77, 0x0c,
+ 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x53,
+ 0x49, 0x47, 0x49, 0x4e, 0x54, 0x1c, 0x73, 0x65,
+ 0x74, 0x52, 0x65, 0x61, 0x64, 0x48, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x72, 0x1c, 0x73, 0x69, 0x67,
+ 0x69, 0x6e, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x72, 0x16, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x22,
+ 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+ 0x64, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x72, 0x08, 0x72, 0x65, 0x61, 0x64, 0x0c, 0x62,
+ 0x75, 0x66, 0x66, 0x65, 0x72, 0x10, 0x69, 0x73,
+ 0x5f, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x02, 0x41,
+ 0x02, 0x5a, 0x02, 0x61, 0x02, 0x7a, 0x10, 0x69,
+ 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x0e,
+ 0x69, 0x73, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x02,
+ 0x5f, 0x02, 0x24, 0x14, 0x75, 0x63, 0x73, 0x5f,
+ 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x14, 0x63,
+ 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41,
+ 0x74, 0x2a, 0x69, 0x73, 0x5f, 0x74, 0x72, 0x61,
+ 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x75,
+ 0x72, 0x72, 0x6f, 0x67, 0x61, 0x74, 0x65, 0x16,
+ 0x63, 0x6f, 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x41, 0x74, 0x16, 0x69, 0x73, 0x5f, 0x62,
+ 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x04,
+ 0x28, 0x29, 0x04, 0x5b, 0x5d, 0x04, 0x7b, 0x7d,
+ 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x74, 0x65, 0x78,
+ 0x74, 0x08, 0x70, 0x75, 0x74, 0x73, 0x12, 0x73,
+ 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+ 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x73, 0x69, 0x04, 0x1b, 0x5b, 0x16, 0x6d, 0x6f,
+ 0x76, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f,
+ 0x72, 0x06, 0x6d, 0x69, 0x6e, 0x02, 0x43, 0x02,
+ 0x44, 0x0c, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+ 0x04, 0x20, 0x08, 0x06, 0x1b, 0x5b, 0x4a, 0x06,
+ 0x6f, 0x75, 0x74, 0x0a, 0x66, 0x6c, 0x75, 0x73,
+ 0x68, 0x0c, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74,
+ 0x1a, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x64, 0x5f,
+ 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x14, 0x71,
+ 0x75, 0x6f, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x61,
+ 0x67, 0x0a, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x06,
+ 0x63, 0x6d, 0x64, 0x14, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x0a, 0x61,
+ 0x6c, 0x65, 0x72, 0x74, 0x22, 0x62, 0x65, 0x67,
+ 0x69, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x5f, 0x6f,
+ 0x66, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x16, 0x65,
+ 0x6e, 0x64, 0x5f, 0x6f, 0x66, 0x5f, 0x6c, 0x69,
+ 0x6e, 0x65, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x0c,
+ 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x63, 0x68, 0x61, 0x72, 0x22, 0x73, 0x6b, 0x69,
+ 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x66,
+ 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x24, 0x73,
+ 0x6b, 0x69, 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64,
+ 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72,
+ 0x64, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72,
+ 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x61, 0x63, 0x63,
+ 0x65, 0x70, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+ 0x16, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x5f, 0x61, 0x64, 0x64, 0x08, 0x70, 0x75, 0x73,
+ 0x68, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
+ 0x75, 0x73, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x1a, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+ 0x0e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x18, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x1c, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65,
+ 0x61, 0x72, 0x63, 0x68, 0x2e, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x2c, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x66, 0x6f, 0x72, 0x77,
+ 0x61, 0x72, 0x64, 0x1e, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f,
+ 0x64, 0x69, 0x72, 0x16, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x12,
+ 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f,
+ 0x64, 0x28, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+ 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x63, 0x68, 0x61, 0x72, 0x73, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x16, 0x75,
+ 0x70, 0x63, 0x61, 0x73, 0x65, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x16, 0x74, 0x6f, 0x55, 0x70, 0x70,
+ 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x1a, 0x64,
+ 0x6f, 0x77, 0x6e, 0x63, 0x61, 0x73, 0x65, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x74, 0x6f, 0x4c,
+ 0x6f, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65,
+ 0x16, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x72, 0x65,
+ 0x67, 0x69, 0x6f, 0x6e, 0x12, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x24, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x12, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x77,
+ 0x6f, 0x72, 0x64, 0x24, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x5f, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x08, 0x79,
+ 0x61, 0x6e, 0x6b, 0x14, 0x63, 0x6c, 0x69, 0x70,
+ 0x5f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x12, 0x63,
+ 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f, 0x63,
+ 0x10, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x66, 0x75,
+ 0x6e, 0x2a, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74,
+ 0x5f, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x08,
+ 0x65, 0x78, 0x69, 0x74, 0x3c, 0x0a, 0x28, 0x50,
+ 0x72, 0x65, 0x73, 0x73, 0x20, 0x43, 0x74, 0x72,
+ 0x6c, 0x2d, 0x43, 0x20, 0x61, 0x67, 0x61, 0x69,
+ 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x71, 0x75, 0x69,
+ 0x74, 0x29, 0x0a, 0x0a, 0x72, 0x65, 0x73, 0x65,
+ 0x74, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f,
+ 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x24, 0x67, 0x65, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x6f,
+ 0x62, 0x6a, 0x65, 0x63, 0x74, 0x08, 0x6c, 0x69,
+ 0x6e, 0x65, 0x06, 0x70, 0x6f, 0x73, 0x06, 0x6f,
+ 0x62, 0x6a, 0x08, 0x62, 0x61, 0x73, 0x65, 0x02,
+ 0x63, 0x02, 0x67, 0x1c, 0x63, 0x6f, 0x6e, 0x66,
+ 0x69, 0x67, 0x5f, 0x6e, 0x75, 0x6d, 0x63, 0x61,
+ 0x6c, 0x63, 0x14, 0x68, 0x61, 0x73, 0x5f, 0x6a,
+ 0x73, 0x63, 0x61, 0x6c, 0x63, 0x14, 0x68, 0x61,
+ 0x73, 0x5f, 0x62, 0x69, 0x67, 0x6e, 0x75, 0x6d,
+ 0x0c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0c,
+ 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x08, 0x70,
+ 0x72, 0x65, 0x63, 0x0e, 0x65, 0x78, 0x70, 0x42,
+ 0x69, 0x74, 0x73, 0x0e, 0x6c, 0x6f, 0x67, 0x32,
+ 0x5f, 0x31, 0x30, 0x0c, 0x70, 0x73, 0x74, 0x61,
+ 0x74, 0x65, 0x0c, 0x70, 0x72, 0x6f, 0x6d, 0x70,
+ 0x74, 0x08, 0x70, 0x6c, 0x65, 0x6e, 0x06, 0x70,
+ 0x73, 0x31, 0x06, 0x70, 0x73, 0x32, 0x08, 0x75,
+ 0x74, 0x66, 0x38, 0x12, 0x73, 0x68, 0x6f, 0x77,
+ 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x16, 0x73, 0x68,
+ 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+ 0x73, 0x12, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x74,
+ 0x69, 0x6d, 0x65, 0x0a, 0x6d, 0x65, 0x78, 0x70,
+ 0x72, 0x0a, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x10,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64,
+ 0x1e, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x75,
+ 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+ 0x10, 0x74, 0x68, 0x69, 0x73, 0x5f, 0x66, 0x75,
+ 0x6e, 0x14, 0x75, 0x74, 0x66, 0x38, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x10, 0x75, 0x74, 0x66,
+ 0x38, 0x5f, 0x76, 0x61, 0x6c, 0x0e, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x66, 0x64, 0x1a, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f,
+ 0x62, 0x75, 0x66, 0x14, 0x74, 0x65, 0x72, 0x6d,
+ 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x1a, 0x74,
+ 0x65, 0x72, 0x6d, 0x5f, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x78, 0x1e, 0x67, 0x65, 0x74,
+ 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74,
+ 0x69, 0x6f, 0x6e, 0x73, 0x14, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x10,
+ 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73,
+ 0x0c, 0x64, 0x75, 0x70, 0x73, 0x74, 0x72, 0x1a,
+ 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65,
+ 0x5f, 0x6b, 0x65, 0x79, 0x73, 0x1c, 0x72, 0x65,
+ 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x16, 0x72, 0x65, 0x61,
+ 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x63, 0x62,
+ 0x1c, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x16,
+ 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63,
+ 0x68, 0x61, 0x72, 0x14, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x10, 0x68,
+ 0x65, 0x78, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x12,
+ 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x6d, 0x6f, 0x64,
+ 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+ 0x5f, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x24, 0x62, 0x69, 0x67, 0x66, 0x6c,
+ 0x6f, 0x61, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x73,
+ 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x69,
+ 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x22, 0x65, 0x78, 0x74,
+ 0x72, 0x61, 0x63, 0x74, 0x5f, 0x64, 0x69, 0x72,
+ 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x08,
+ 0x68, 0x65, 0x6c, 0x70, 0x1c, 0x65, 0x76, 0x61,
+ 0x6c, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x12, 0x63, 0x6d, 0x64, 0x5f,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x24, 0x63, 0x6d,
+ 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74,
+ 0x26, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x5f, 0x63, 0x6d, 0x64, 0x14, 0x68, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x16,
+ 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x69, 0x7a, 0x65,
+ 0x5f, 0x6a, 0x73, 0x2a, 0x20, 0x7e, 0x21, 0x25,
+ 0x5e, 0x26, 0x2a, 0x28, 0x2d, 0x2b, 0x3d, 0x7b,
+ 0x5b, 0x7c, 0x3a, 0x3b, 0x2c, 0x3c, 0x3e, 0x3f,
+ 0x2f, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x02, 0x2e, 0x02, 0x27, 0x02, 0x22, 0x02,
+ 0x5d, 0x02, 0x7d, 0x02, 0x2f, 0x10, 0x69, 0x6e,
+ 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x0a, 0x69,
+ 0x73, 0x4e, 0x61, 0x4e, 0x26, 0x67, 0x65, 0x74,
+ 0x4f, 0x77, 0x6e, 0x50, 0x72, 0x6f, 0x70, 0x65,
+ 0x72, 0x74, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x73,
+ 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57,
+ 0x69, 0x74, 0x68, 0x08, 0x73, 0x6f, 0x72, 0x74,
+ 0x06, 0x74, 0x61, 0x62, 0x06, 0x63, 0x74, 0x78,
+ 0x0c, 0x73, 0x79, 0x6d, 0x63, 0x6d, 0x70, 0x02,
+ 0x28, 0x02, 0x29, 0x06, 0x6d, 0x61, 0x78, 0x0a,
+ 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x08, 0x63, 0x65,
+ 0x69, 0x6c, 0x0c, 0x70, 0x61, 0x64, 0x45, 0x6e,
+ 0x64, 0x02, 0x20, 0x0a, 0x72, 0x6f, 0x75, 0x6e,
+ 0x64, 0x1a, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x6f,
+ 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x02,
+ 0x1b, 0x02, 0x5b, 0x02, 0x4f, 0x02, 0x3b, 0x04,
+ 0x2d, 0x30, 0x02, 0x2d, 0x04, 0x30, 0x78, 0x08,
+ 0x6d, 0x61, 0x74, 0x68, 0x12, 0x42, 0x69, 0x67,
+ 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x02, 0x6c,
+ 0x02, 0x70, 0x02, 0x65, 0x04, 0x2e, 0x30, 0x02,
+ 0x6e, 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f,
+ 0x72, 0x65, 0x63, 0x14, 0x5b, 0x63, 0x69, 0x72,
+ 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5d, 0x0e, 0x43,
+ 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x06, 0x4d,
+ 0x6f, 0x64, 0x14, 0x50, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x0e, 0x50, 0x6f,
+ 0x6c, 0x79, 0x4d, 0x6f, 0x64, 0x20, 0x52, 0x61,
+ 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x46, 0x75,
+ 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0c, 0x53,
+ 0x65, 0x72, 0x69, 0x65, 0x73, 0x0e, 0x69, 0x73,
+ 0x41, 0x72, 0x72, 0x61, 0x79, 0x04, 0x5b, 0x20,
+ 0x04, 0x2c, 0x20, 0x0e, 0x3c, 0x65, 0x6d, 0x70,
+ 0x74, 0x79, 0x3e, 0x06, 0x2e, 0x2e, 0x2e, 0x04,
+ 0x20, 0x5d, 0x14, 0x5f, 0x5f, 0x67, 0x65, 0x74,
+ 0x43, 0x6c, 0x61, 0x73, 0x73, 0x08, 0x6b, 0x65,
+ 0x79, 0x73, 0x04, 0x7b, 0x20, 0x04, 0x3a, 0x20,
+ 0x04, 0x20, 0x7d, 0x06, 0x70, 0x6f, 0x70, 0x0e,
+ 0x5f, 0x5f, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x08,
+ 0x2e, 0x2e, 0x2e, 0x22, 0x02, 0x6d, 0x12, 0x66,
+ 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+ 0x02, 0x5c, 0x02, 0x68, 0x02, 0x3f, 0x08, 0x6c,
+ 0x6f, 0x61, 0x64, 0x08, 0x74, 0x72, 0x69, 0x6d,
+ 0x16, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64,
+ 0x65, 0x78, 0x4f, 0x66, 0x06, 0x2e, 0x6a, 0x73,
+ 0x14, 0x6c, 0x6f, 0x61, 0x64, 0x53, 0x63, 0x72,
+ 0x69, 0x70, 0x74, 0x02, 0x78, 0x02, 0x64, 0x02,
+ 0x74, 0x26, 0x42, 0x69, 0x67, 0x46, 0x6c, 0x6f,
+ 0x61, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69,
+ 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x10, 0x20, 0x62,
+ 0x69, 0x74, 0x73, 0x20, 0x28, 0x7e, 0x30, 0x20,
+ 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+ 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+ 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x0c,
+ 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x06, 0x66,
+ 0x31, 0x36, 0x06, 0x66, 0x33, 0x32, 0x06, 0x66,
+ 0x36, 0x34, 0x08, 0x66, 0x31, 0x32, 0x38, 0x10,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74,
+ 0x14, 0x65, 0x78, 0x70, 0x42, 0x69, 0x74, 0x73,
+ 0x4d, 0x61, 0x78, 0x0e, 0x70, 0x72, 0x65, 0x63,
+ 0x4d, 0x69, 0x6e, 0x0e, 0x70, 0x72, 0x65, 0x63,
+ 0x4d, 0x61, 0x78, 0x24, 0x49, 0x6e, 0x76, 0x61,
+ 0x6c, 0x69, 0x64, 0x20, 0x70, 0x72, 0x65, 0x63,
+ 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x14, 0x65,
+ 0x78, 0x70, 0x42, 0x69, 0x74, 0x73, 0x4d, 0x69,
+ 0x6e, 0x2c, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+ 0x64, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+ 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a,
+ 0x0c, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x08,
+ 0x6d, 0x6f, 0x64, 0x65, 0x1a, 0x52, 0x75, 0x6e,
+ 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x64,
+ 0x65, 0x3d, 0x1a, 0x49, 0x6e, 0x76, 0x61, 0x6c,
+ 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a,
+ 0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x0c, 0x1b,
+ 0x5b, 0x48, 0x1b, 0x5b, 0x4a, 0x02, 0x71, 0x1a,
+ 0x61, 0x6c, 0x67, 0x65, 0x62, 0x72, 0x61, 0x69,
+ 0x63, 0x4d, 0x6f, 0x64, 0x65, 0x26, 0x55, 0x6e,
+ 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3a,
+ 0x20, 0x06, 0x64, 0x65, 0x63, 0x06, 0x68, 0x65,
+ 0x78, 0x06, 0x6e, 0x75, 0x6d, 0x06, 0x61, 0x6c,
+ 0x67, 0x42, 0x5c, 0x68, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68,
+ 0x69, 0x73, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x0a,
+ 0x5c, 0x78, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x36, 0x68, 0x65, 0x78, 0x61,
+ 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x20,
+ 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x64,
+ 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a, 0x16,
+ 0x5c, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x2e, 0x64, 0x65, 0x63, 0x69,
+ 0x6d, 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d, 0x62,
+ 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c,
+ 0x61, 0x79, 0x0a, 0x16, 0x5c, 0x74, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2c,
+ 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x20, 0x74,
+ 0x69, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x69,
+ 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a, 0x3e, 0x5c,
+ 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72,
+ 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72,
+ 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x0a, 0x16, 0x5c,
+ 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x1e, 0x61, 0x6c, 0x67, 0x65, 0x62,
+ 0x72, 0x61, 0x69, 0x63, 0x20, 0x6d, 0x6f, 0x64,
+ 0x65, 0x0a, 0x16, 0x5c, 0x6e, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1a, 0x6e,
+ 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20, 0x6d,
+ 0x6f, 0x64, 0x65, 0x0a, 0xea, 0x01, 0x5c, 0x70,
+ 0x20, 0x5b, 0x6d, 0x20, 0x5b, 0x65, 0x5d, 0x5d,
+ 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68,
+ 0x65, 0x20, 0x42, 0x69, 0x67, 0x46, 0x6c, 0x6f,
+ 0x61, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69,
+ 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+ 0x27, 0x6d, 0x27, 0x20, 0x62, 0x69, 0x74, 0x73,
+ 0x0a, 0x5c, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+ 0x20, 0x6e, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74,
+ 0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x69, 0x67,
+ 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70, 0x72,
+ 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+ 0x74, 0x6f, 0x20, 0x27, 0x63, 0x65, 0x69, 0x6c,
+ 0x28, 0x6e, 0x2a, 0x6c, 0x6f, 0x67, 0x32, 0x28,
+ 0x31, 0x30, 0x29, 0x29, 0x27, 0x20, 0x62, 0x69,
+ 0x74, 0x73, 0x0a, 0x68, 0x5c, 0x6d, 0x6f, 0x64,
+ 0x65, 0x20, 0x5b, 0x73, 0x74, 0x64, 0x7c, 0x6d,
+ 0x61, 0x74, 0x68, 0x5d, 0x20, 0x63, 0x68, 0x61,
+ 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+ 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20,
+ 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x28, 0x63, 0x75,
+ 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+ 0x04, 0x29, 0x0a, 0x22, 0x5c, 0x71, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x65, 0x78, 0x69, 0x74, 0x0a, 0x06, 0x73, 0x65,
+ 0x6c, 0x26, 0x22, 0x75, 0x73, 0x65, 0x20, 0x6d,
+ 0x61, 0x74, 0x68, 0x22, 0x3b, 0x20, 0x76, 0x6f,
+ 0x69, 0x64, 0x20, 0x30, 0x3b, 0x0e, 0x67, 0x65,
+ 0x74, 0x54, 0x69, 0x6d, 0x65, 0x14, 0x65, 0x76,
+ 0x61, 0x6c, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
+ 0x22, 0x62, 0x61, 0x63, 0x6b, 0x74, 0x72, 0x61,
+ 0x63, 0x65, 0x5f, 0x62, 0x61, 0x72, 0x72, 0x69,
+ 0x65, 0x72, 0x0e, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+ 0x6c, 0x65, 0x06, 0x6c, 0x6f, 0x67, 0x0e, 0x54,
+ 0x68, 0x72, 0x6f, 0x77, 0x3a, 0x20, 0x3a, 0x51,
+ 0x4a, 0x53, 0x43, 0x61, 0x6c, 0x63, 0x20, 0x2d,
+ 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x22, 0x5c,
+ 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68,
+ 0x65, 0x6c, 0x70, 0x0a, 0x3a, 0x51, 0x75, 0x69,
+ 0x63, 0x6b, 0x4a, 0x53, 0x20, 0x2d, 0x20, 0x54,
+ 0x79, 0x70, 0x65, 0x20, 0x22, 0x5c, 0x68, 0x22,
+ 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68, 0x65, 0x6c,
+ 0x70, 0x0a, 0x08, 0x20, 0x20, 0x20, 0x20, 0x0e,
+ 0x73, 0x65, 0x74, 0x50, 0x72, 0x65, 0x63, 0x08,
+ 0x62, 0x69, 0x6e, 0x64, 0x04, 0x67, 0x63, 0x88,
+ 0x05, 0x7c, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x7c,
+ 0x63, 0x61, 0x73, 0x65, 0x7c, 0x63, 0x61, 0x74,
+ 0x63, 0x68, 0x7c, 0x63, 0x6f, 0x6e, 0x74, 0x69,
+ 0x6e, 0x75, 0x65, 0x7c, 0x64, 0x65, 0x62, 0x75,
+ 0x67, 0x67, 0x65, 0x72, 0x7c, 0x64, 0x65, 0x66,
+ 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x64, 0x65, 0x6c,
+ 0x65, 0x74, 0x65, 0x7c, 0x64, 0x6f, 0x7c, 0x65,
+ 0x6c, 0x73, 0x65, 0x7c, 0x66, 0x69, 0x6e, 0x61,
+ 0x6c, 0x6c, 0x79, 0x7c, 0x66, 0x6f, 0x72, 0x7c,
+ 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+ 0x7c, 0x69, 0x66, 0x7c, 0x69, 0x6e, 0x7c, 0x69,
+ 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x6f,
+ 0x66, 0x7c, 0x6e, 0x65, 0x77, 0x7c, 0x72, 0x65,
+ 0x74, 0x75, 0x72, 0x6e, 0x7c, 0x73, 0x77, 0x69,
+ 0x74, 0x63, 0x68, 0x7c, 0x74, 0x68, 0x69, 0x73,
+ 0x7c, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x7c, 0x74,
+ 0x72, 0x79, 0x7c, 0x74, 0x79, 0x70, 0x65, 0x6f,
+ 0x66, 0x7c, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x7c,
+ 0x77, 0x69, 0x74, 0x68, 0x7c, 0x63, 0x6c, 0x61,
+ 0x73, 0x73, 0x7c, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+ 0x7c, 0x65, 0x6e, 0x75, 0x6d, 0x7c, 0x69, 0x6d,
+ 0x70, 0x6f, 0x72, 0x74, 0x7c, 0x65, 0x78, 0x70,
+ 0x6f, 0x72, 0x74, 0x7c, 0x65, 0x78, 0x74, 0x65,
+ 0x6e, 0x64, 0x73, 0x7c, 0x73, 0x75, 0x70, 0x65,
+ 0x72, 0x7c, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d,
+ 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x69, 0x6e, 0x74,
+ 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x7c, 0x6c,
+ 0x65, 0x74, 0x7c, 0x70, 0x61, 0x63, 0x6b, 0x61,
+ 0x67, 0x65, 0x7c, 0x70, 0x72, 0x69, 0x76, 0x61,
+ 0x74, 0x65, 0x7c, 0x70, 0x72, 0x6f, 0x74, 0x65,
+ 0x63, 0x74, 0x65, 0x64, 0x7c, 0x70, 0x75, 0x62,
+ 0x6c, 0x69, 0x63, 0x7c, 0x73, 0x74, 0x61, 0x74,
+ 0x69, 0x63, 0x7c, 0x79, 0x69, 0x65, 0x6c, 0x64,
+ 0x7c, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+ 0x65, 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7c,
+ 0x74, 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61, 0x6c,
+ 0x73, 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+ 0x69, 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e, 0x7c,
+ 0x65, 0x76, 0x61, 0x6c, 0x7c, 0x61, 0x72, 0x67,
+ 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x61,
+ 0x77, 0x61, 0x69, 0x74, 0x7c, 0x7a, 0x7c, 0x74,
+ 0x68, 0x69, 0x73, 0x7c, 0x73, 0x75, 0x70, 0x65,
+ 0x72, 0x7c, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69,
+ 0x6e, 0x65, 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c,
+ 0x7c, 0x74, 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61,
+ 0x6c, 0x73, 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69,
+ 0x6e, 0x69, 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e,
+ 0x7c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
+ 0x74, 0x73, 0x7c, 0x14, 0x7c, 0x76, 0x6f, 0x69,
+ 0x64, 0x7c, 0x76, 0x61, 0x72, 0x7c, 0x02, 0x2b,
+ 0x02, 0x60, 0x02, 0x7b, 0x14, 0x70, 0x75, 0x73,
+ 0x68, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x14,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x73, 0x74, 0x61,
+ 0x74, 0x65, 0x12, 0x70, 0x6f, 0x70, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x26, 0x70, 0x61, 0x72,
+ 0x73, 0x65, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+ 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
+ 0x0a, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x02, 0x69,
+ 0x06, 0x73, 0x74, 0x72, 0x24, 0x70, 0x61, 0x72,
+ 0x73, 0x65, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f,
+ 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x18,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x73, 0x74,
+ 0x72, 0x69, 0x6e, 0x67, 0x16, 0x70, 0x61, 0x72,
+ 0x73, 0x65, 0x5f, 0x72, 0x65, 0x67, 0x65, 0x78,
+ 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x6e,
+ 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x70, 0x61,
+ 0x72, 0x73, 0x65, 0x5f, 0x69, 0x64, 0x65, 0x6e,
+ 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x02, 0x7c,
+ 0x12, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x79,
+ 0x6c, 0x65, 0x0f, 0xc2, 0x03, 0x02, 0xc4, 0x03,
+ 0xc6, 0x03, 0x00, 0x00, 0x02, 0x00, 0xfa, 0x01,
+ 0x00, 0x01, 0xfa, 0x01, 0x01, 0x0e, 0x00, 0x02,
+ 0x03, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x02, 0x02,
+ 0x01, 0x0d, 0x00, 0xc4, 0x03, 0x00, 0x0d, 0xc6,
+ 0x03, 0x01, 0x0d, 0x08, 0xea, 0x02, 0x29, 0xc0,
+ 0x00, 0x38, 0x8a, 0x00, 0x00, 0x00, 0xef, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0x00, 0x01, 0x77, 0x01,
+ 0x02, 0x02, 0x48, 0x8d, 0x0a, 0x00, 0x00, 0x00,
+ 0x0c, 0x00, 0x01, 0x0c, 0xc0, 0x00, 0xc3, 0x2a,
+ 0xc0, 0x01, 0xc3, 0x2b, 0xc0, 0x02, 0xc3, 0x2c,
+ 0xc0, 0x03, 0xc3, 0x2d, 0xc0, 0x04, 0xc3, 0x2e,
+ 0xc0, 0x05, 0xc3, 0x2f, 0xc0, 0x06, 0xc3, 0x30,
+ 0xc0, 0x07, 0xc3, 0x31, 0xc0, 0x08, 0xc3, 0x32,
+ 0xc0, 0x09, 0xc3, 0x33, 0xc0, 0x0a, 0xc3, 0x34,
+ 0xc0, 0x0b, 0xc3, 0x35, 0xc0, 0x0c, 0xc3, 0x36,
+ 0xc0, 0x0d, 0xc3, 0x37, 0xc0, 0x0e, 0xc3, 0x38,
+ 0xc0, 0x0f, 0xc3, 0x39, 0xc0, 0x10, 0xc3, 0x3a,
+ 0xc0, 0x11, 0xc3, 0x3b, 0xc0, 0x12, 0xc3, 0x3c,
+ 0xc0, 0x13, 0xc3, 0x3d, 0xc0, 0x14, 0xc3, 0x3e,
+ 0xc0, 0x15, 0xc3, 0x3f, 0xc0, 0x16, 0xc3, 0x40,
+ 0xc0, 0x17, 0xc3, 0x41, 0xc0, 0x18, 0xc3, 0x42,
+ 0xc0, 0x19, 0xc3, 0x43, 0xc0, 0x1a, 0xc3, 0x44,
+ 0xc0, 0x1b, 0xc3, 0x45, 0xc0, 0x1c, 0xc3, 0x46,
+ 0xc0, 0x1d, 0xc3, 0x47, 0xc0, 0x1e, 0xc3, 0x48,
+ 0xc0, 0x1f, 0xc3, 0x49, 0xc0, 0x20, 0xc3, 0x4a,
+ 0xc0, 0x21, 0xc3, 0x4b, 0xc0, 0x22, 0xc3, 0x4c,
+ 0xc0, 0x23, 0xc3, 0x4d, 0xc0, 0x24, 0xc3, 0x4e,
+ 0xc0, 0x25, 0xc3, 0x4f, 0xc0, 0x26, 0xc3, 0x50,
+ 0xc0, 0x27, 0xc3, 0x51, 0xc0, 0x28, 0xc3, 0x52,
+ 0xc0, 0x29, 0xc3, 0x53, 0xc0, 0x2a, 0xc3, 0x54,
+ 0xc0, 0x2b, 0xc3, 0x55, 0xc0, 0x2c, 0xc3, 0x56,
+ 0xc0, 0x2d, 0xc3, 0x57, 0xc0, 0x2e, 0xc3, 0x58,
+ 0xc0, 0x2f, 0xc3, 0x59, 0xc0, 0x30, 0xc3, 0x5a,
+ 0xc0, 0x31, 0xc3, 0x5b, 0xc0, 0x32, 0xc3, 0x5c,
+ 0xc0, 0x33, 0xc3, 0x5d, 0xc0, 0x34, 0xc3, 0x5e,
+ 0xc0, 0x35, 0xc3, 0x60, 0xc0, 0x36, 0xc3, 0x64,
+ 0xc0, 0x37, 0xc3, 0x65, 0xc0, 0x38, 0xc3, 0x66,
+ 0xc0, 0x39, 0xc3, 0x67, 0xc0, 0x3a, 0xc3, 0x6a,
+ 0xc0, 0x3b, 0xc3, 0x6b, 0xc0, 0x3c, 0xc3, 0x6c,
+ 0xc0, 0x3d, 0xc3, 0x6d, 0xc0, 0x3e, 0xc3, 0x6e,
+ 0xc0, 0x3f, 0xc3, 0x6f, 0xc0, 0x41, 0xc3, 0x70,
+ 0xc0, 0x42, 0xc3, 0x71, 0xc0, 0x43, 0xc3, 0x72,
+ 0xc0, 0x44, 0xc3, 0x73, 0xc0, 0x45, 0xc3, 0x74,
+ 0xc0, 0x46, 0xc3, 0x75, 0xc0, 0x47, 0xc3, 0x76,
+ 0xd1, 0x65, 0x01, 0x00, 0x43, 0xe3, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0xd1, 0x65, 0x00, 0x00, 0x43,
+ 0xe2, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd1, 0x41,
+ 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0xc9, 0xd1,
+ 0x41, 0x99, 0x00, 0x00, 0x00, 0x03, 0x00, 0xca,
+ 0xd1, 0x41, 0x96, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0xcb, 0xd1, 0x41, 0x9f, 0x00, 0x00, 0x00, 0x05,
+ 0x00, 0xcc, 0xd1, 0x41, 0x9d, 0x00, 0x00, 0x00,
+ 0x06, 0x00, 0xc3, 0x04, 0xd1, 0x41, 0xe4, 0x00,
+ 0x00, 0x00, 0x07, 0x00, 0xc3, 0x05, 0xd1, 0x41,
+ 0xe5, 0x00, 0x00, 0x00, 0x08, 0x00, 0xc3, 0x06,
+ 0x65, 0x01, 0x00, 0x41, 0xe6, 0x00, 0x00, 0x00,
+ 0x09, 0x00, 0xf4, 0xc3, 0x07, 0x37, 0xe7, 0x00,
+ 0x00, 0x00, 0xf5, 0xc3, 0x08, 0x37, 0xb3, 0x00,
+ 0x00, 0x00, 0xf5, 0xc3, 0x09, 0x0b, 0x04, 0xe8,
+ 0x00, 0x00, 0x00, 0x4c, 0xe9, 0x00, 0x00, 0x00,
+ 0x04, 0xea, 0x00, 0x00, 0x00, 0x4c, 0xeb, 0x00,
+ 0x00, 0x00, 0x04, 0xec, 0x00, 0x00, 0x00, 0x4c,
+ 0xed, 0x00, 0x00, 0x00, 0x04, 0xee, 0x00, 0x00,
+ 0x00, 0x4c, 0xef, 0x00, 0x00, 0x00, 0x04, 0xf0,
+ 0x00, 0x00, 0x00, 0x4c, 0xf1, 0x00, 0x00, 0x00,
+ 0x04, 0xf2, 0x00, 0x00, 0x00, 0x4c, 0xf3, 0x00,
+ 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00, 0x4c,
+ 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00,
+ 0x00, 0x4c, 0xf7, 0x00, 0x00, 0x00, 0x04, 0xf8,
+ 0x00, 0x00, 0x00, 0x4c, 0xf9, 0x00, 0x00, 0x00,
+ 0x04, 0xfa, 0x00, 0x00, 0x00, 0x4c, 0xfb, 0x00,
+ 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x4c,
+ 0xfc, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x00,
+ 0x00, 0x4c, 0xfe, 0x00, 0x00, 0x00, 0x04, 0xff,
+ 0x00, 0x00, 0x00, 0x4c, 0x00, 0x01, 0x00, 0x00,
+ 0x04, 0x01, 0x01, 0x00, 0x00, 0x4c, 0x02, 0x01,
+ 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x4c,
+ 0x04, 0x01, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00,
+ 0x00, 0x4c, 0x06, 0x01, 0x00, 0x00, 0x04, 0x07,
+ 0x01, 0x00, 0x00, 0x4c, 0x08, 0x01, 0x00, 0x00,
+ 0x04, 0x09, 0x01, 0x00, 0x00, 0x4c, 0x0a, 0x01,
+ 0x00, 0x00, 0xc3, 0x0a, 0xc2, 0x07, 0xea, 0x7e,
+ 0x0b, 0x04, 0xeb, 0x00, 0x00, 0x00, 0x4c, 0x16,
+ 0x00, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00,
+ 0x4c, 0x0b, 0x01, 0x00, 0x00, 0x04, 0xef, 0x00,
+ 0x00, 0x00, 0x4c, 0x48, 0x00, 0x00, 0x00, 0x04,
+ 0xf7, 0x00, 0x00, 0x00, 0x4c, 0x0c, 0x01, 0x00,
+ 0x00, 0x04, 0xef, 0x00, 0x00, 0x00, 0x4c, 0x46,
+ 0x00, 0x00, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00,
+ 0x4c, 0x0d, 0x01, 0x00, 0x00, 0x04, 0xfb, 0x00,
+ 0x00, 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x00, 0x04,
+ 0x06, 0x01, 0x00, 0x00, 0x4c, 0x0e, 0x01, 0x00,
+ 0x00, 0x04, 0xf1, 0x00, 0x00, 0x00, 0x4c, 0x0f,
+ 0x01, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00,
+ 0x4c, 0x10, 0x01, 0x00, 0x00, 0x04, 0xeb, 0x00,
+ 0x00, 0x00, 0x4c, 0x11, 0x01, 0x00, 0x00, 0x04,
+ 0xfe, 0x00, 0x00, 0x00, 0x4c, 0x12, 0x01, 0x00,
+ 0x00, 0xc3, 0x0b, 0xec, 0x7c, 0x0b, 0x04, 0x00,
+ 0x01, 0x00, 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00,
+ 0x04, 0xf9, 0x00, 0x00, 0x00, 0x4c, 0x0b, 0x01,
+ 0x00, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x4c,
+ 0x48, 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00,
+ 0x00, 0x4c, 0x0c, 0x01, 0x00, 0x00, 0x04, 0xef,
+ 0x00, 0x00, 0x00, 0x4c, 0x46, 0x00, 0x00, 0x00,
+ 0x04, 0x0a, 0x01, 0x00, 0x00, 0x4c, 0x0d, 0x01,
+ 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x4c,
+ 0x1b, 0x00, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00,
+ 0x00, 0x4c, 0x0e, 0x01, 0x00, 0x00, 0x04, 0x00,
+ 0x01, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00,
+ 0x04, 0xed, 0x00, 0x00, 0x00, 0x4c, 0x10, 0x01,
+ 0x00, 0x00, 0x04, 0x0a, 0x01, 0x00, 0x00, 0x4c,
+ 0x11, 0x01, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
+ 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00, 0xc3, 0x0b,
+ 0x26, 0x00, 0x00, 0xc3, 0x0c, 0xc1, 0xc3, 0x0d,
+ 0xc1, 0xc3, 0x11, 0xc1, 0xc3, 0x12, 0xb5, 0xc3,
+ 0x13, 0xc2, 0x07, 0xea, 0x0a, 0x04, 0x13, 0x01,
+ 0x00, 0x00, 0xc3, 0x14, 0xec, 0x08, 0x04, 0x14,
+ 0x01, 0x00, 0x00, 0xc3, 0x14, 0x04, 0x15, 0x01,
+ 0x00, 0x00, 0xc3, 0x15, 0x0a, 0xc3, 0x16, 0x09,
+ 0xc3, 0x17, 0x0a, 0xc3, 0x18, 0xb5, 0xc3, 0x19,
+ 0xc1, 0xc3, 0x1a, 0xb5, 0xc3, 0x1b, 0xc1, 0xc3,
+ 0x1c, 0xb5, 0xc3, 0x1d, 0xc1, 0xc3, 0x1e, 0xb5,
+ 0xc3, 0x1f, 0x09, 0xc3, 0x23, 0xb5, 0xc3, 0x24,
+ 0xb5, 0xc3, 0x25, 0xb5, 0xc3, 0x29, 0x0b, 0xc2,
+ 0x3c, 0x4c, 0x16, 0x01, 0x00, 0x00, 0xc2, 0x3f,
+ 0x4c, 0x17, 0x01, 0x00, 0x00, 0xc2, 0x59, 0x4c,
+ 0x18, 0x01, 0x00, 0x00, 0xc2, 0x4d, 0x4c, 0x19,
+ 0x01, 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x1a, 0x01,
+ 0x00, 0x00, 0xc2, 0x3e, 0x4c, 0x1b, 0x01, 0x00,
+ 0x00, 0xc2, 0x3a, 0x4c, 0x1c, 0x01, 0x00, 0x00,
+ 0xc2, 0x4e, 0x4c, 0x1d, 0x01, 0x00, 0x00, 0xc2,
+ 0x5e, 0x4c, 0x1e, 0x01, 0x00, 0x00, 0xc2, 0x44,
+ 0x4c, 0x1f, 0x01, 0x00, 0x00, 0xc2, 0x54, 0x4c,
+ 0x20, 0x01, 0x00, 0x00, 0xc2, 0x44, 0x4c, 0x21,
+ 0x01, 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x22, 0x01,
+ 0x00, 0x00, 0xc2, 0x46, 0x4c, 0x23, 0x01, 0x00,
+ 0x00, 0xc2, 0x39, 0x4c, 0x24, 0x01, 0x00, 0x00,
+ 0xc2, 0x3b, 0x4c, 0x25, 0x01, 0x00, 0x00, 0xc2,
+ 0x3b, 0x4c, 0x26, 0x01, 0x00, 0x00, 0xc2, 0x4f,
+ 0x4c, 0x27, 0x01, 0x00, 0x00, 0xc2, 0x5a, 0x4c,
+ 0x28, 0x01, 0x00, 0x00, 0xc2, 0x58, 0x4c, 0x29,
+ 0x01, 0x00, 0x00, 0xc2, 0x46, 0x4c, 0x2a, 0x01,
+ 0x00, 0x00, 0xc2, 0x47, 0x4c, 0x2b, 0x01, 0x00,
+ 0x00, 0xc2, 0x3e, 0x4c, 0x2c, 0x01, 0x00, 0x00,
+ 0xc2, 0x3f, 0x4c, 0x2d, 0x01, 0x00, 0x00, 0xc2,
+ 0x42, 0x4c, 0x2e, 0x01, 0x00, 0x00, 0xc2, 0x43,
+ 0x4c, 0x2f, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c,
+ 0x30, 0x01, 0x00, 0x00, 0xc2, 0x43, 0x4c, 0x31,
+ 0x01, 0x00, 0x00, 0xc2, 0x3c, 0x4c, 0x32, 0x01,
+ 0x00, 0x00, 0xc2, 0x4c, 0x4c, 0x33, 0x01, 0x00,
+ 0x00, 0xc2, 0x3d, 0x4c, 0x34, 0x01, 0x00, 0x00,
+ 0xc2, 0x49, 0x4c, 0x35, 0x01, 0x00, 0x00, 0xc2,
+ 0x4a, 0x4c, 0x36, 0x01, 0x00, 0x00, 0xc2, 0x46,
+ 0x4c, 0x37, 0x01, 0x00, 0x00, 0xc2, 0x47, 0x4c,
+ 0x38, 0x01, 0x00, 0x00, 0xc2, 0x3e, 0x4c, 0x39,
+ 0x01, 0x00, 0x00, 0xc2, 0x3f, 0x4c, 0x3a, 0x01,
+ 0x00, 0x00, 0xc2, 0x3d, 0x4c, 0x3b, 0x01, 0x00,
+ 0x00, 0xc2, 0x3c, 0x4c, 0x3c, 0x01, 0x00, 0x00,
+ 0xc2, 0x57, 0x4c, 0x3d, 0x01, 0x00, 0x00, 0xc2,
+ 0x43, 0x4c, 0x3e, 0x01, 0x00, 0x00, 0xc2, 0x56,
+ 0x4c, 0x3f, 0x01, 0x00, 0x00, 0xc2, 0x42, 0x4c,
+ 0x40, 0x01, 0x00, 0x00, 0xc2, 0x55, 0x4c, 0x41,
+ 0x01, 0x00, 0x00, 0xc2, 0x52, 0x4c, 0x42, 0x01,
+ 0x00, 0x00, 0xc2, 0x50, 0x4c, 0x43, 0x01, 0x00,
+ 0x00, 0xc2, 0x51, 0x4c, 0x44, 0x01, 0x00, 0x00,
+ 0xc2, 0x4e, 0x4c, 0x45, 0x01, 0x00, 0x00, 0xc3,
+ 0x5f, 0x09, 0xc3, 0x68, 0x04, 0xe2, 0x00, 0x00,
+ 0x00, 0xc3, 0x69, 0xc2, 0x07, 0xea, 0x0b, 0xd1,
+ 0xc0, 0x40, 0x43, 0x46, 0x01, 0x00, 0x00, 0x0a,
+ 0x00, 0xc2, 0x2a, 0xee, 0x0e, 0xc2, 0x72, 0xee,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x8e, 0x05, 0x00,
+ 0x01, 0x00, 0x04, 0x07, 0x00, 0x9f, 0x01, 0x00,
+ 0x00, 0x26, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x28,
+ 0x01, 0x00, 0x01, 0x0c, 0x00, 0x2b, 0x01, 0x00,
+ 0x27, 0x01, 0x00, 0x2c, 0x01, 0x65, 0x01, 0x00,
+ 0x41, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+ 0x48, 0x01, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00,
+ 0x00, 0xe1, 0xbd, 0x50, 0xe3, 0x65, 0x03, 0x00,
+ 0x42, 0x49, 0x01, 0x00, 0x00, 0x02, 0x00, 0xdd,
+ 0x24, 0x01, 0x00, 0xea, 0x3d, 0x65, 0x03, 0x00,
+ 0x41, 0x4a, 0x01, 0x00, 0x00, 0x03, 0x00, 0xea,
+ 0x16, 0x65, 0x03, 0x00, 0x42, 0x4a, 0x01, 0x00,
+ 0x00, 0x04, 0x00, 0xdd, 0x24, 0x01, 0x00, 0xcd,
+ 0xea, 0x05, 0xc5, 0xb5, 0x47, 0xe3, 0x65, 0x03,
+ 0x00, 0x41, 0x4b, 0x01, 0x00, 0x00, 0x05, 0x00,
+ 0xea, 0x10, 0x65, 0x03, 0x00, 0x42, 0x4b, 0x01,
+ 0x00, 0x00, 0x06, 0x00, 0xdd, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x03, 0x00, 0x42, 0x4c, 0x01, 0x00,
+ 0x00, 0x07, 0x00, 0x65, 0x03, 0x00, 0x41, 0x4d,
+ 0x01, 0x00, 0x00, 0x08, 0x00, 0x5e, 0x04, 0x00,
+ 0x24, 0x02, 0x00, 0x0e, 0x38, 0xa8, 0x00, 0x00,
+ 0x00, 0x11, 0xbd, 0x40, 0x21, 0x01, 0x00, 0x5f,
+ 0x05, 0x00, 0x65, 0x03, 0x00, 0x42, 0x4e, 0x01,
+ 0x00, 0x00, 0x09, 0x00, 0xdd, 0x5e, 0x06, 0x00,
+ 0x24, 0x02, 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0x9e, 0x05, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+ 0x04, 0x00, 0xa0, 0x05, 0x2d, 0x01, 0xdd, 0xb8,
+ 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x05,
+ 0x00, 0x02, 0x00, 0x06, 0x04, 0x00, 0x2e, 0x00,
+ 0x00, 0x01, 0x0c, 0x00, 0x26, 0x01, 0x00, 0x27,
+ 0x01, 0x00, 0x2d, 0x01, 0x65, 0x00, 0x00, 0x42,
+ 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0xde, 0xdf,
+ 0x41, 0x53, 0x01, 0x00, 0x00, 0x01, 0x00, 0xb5,
+ 0xdf, 0xe9, 0x24, 0x04, 0x00, 0xc9, 0xb5, 0xca,
+ 0xc6, 0xc5, 0xfa, 0x0e, 0x00, 0x00, 0x00, 0xe0,
+ 0xdf, 0xc6, 0x47, 0xef, 0x0e, 0x93, 0x01, 0xec,
+ 0xf0, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x05,
+ 0x01, 0x00, 0x01, 0x04, 0x04, 0x00, 0x63, 0x00,
+ 0x00, 0x16, 0x01, 0x00, 0x66, 0x01, 0x00, 0x24,
+ 0x01, 0x00, 0x25, 0x01, 0xdd, 0x96, 0xea, 0x06,
+ 0xde, 0xd1, 0xef, 0x0e, 0x29, 0xdf, 0xb5, 0xac,
+ 0xea, 0x26, 0xd1, 0xbe, 0x80, 0x00, 0xfd, 0x20,
+ 0x00, 0x00, 0x00, 0xd1, 0xbe, 0xc0, 0x00, 0xa3,
+ 0xea, 0x16, 0xe0, 0xbb, 0xa0, 0xd1, 0xbd, 0x3f,
+ 0xad, 0xaf, 0xe4, 0xdf, 0x8e, 0xe7, 0xb5, 0xab,
+ 0xea, 0x35, 0xde, 0xe0, 0xef, 0x0e, 0x29, 0xd1,
+ 0xbe, 0xc0, 0x00, 0xfd, 0x24, 0x00, 0x00, 0x00,
+ 0xd1, 0xbe, 0xf8, 0x00, 0xa3, 0xea, 0x1a, 0xb6,
+ 0xd1, 0xbe, 0xe0, 0x00, 0xa6, 0x9d, 0xd1, 0xbe,
+ 0xf0, 0x00, 0xa6, 0x9d, 0xe3, 0xd1, 0xb6, 0xbb,
+ 0xdf, 0x9e, 0xa0, 0xb6, 0x9e, 0xad, 0xe4, 0x29,
+ 0xb5, 0xe3, 0xde, 0xd1, 0xef, 0x0e, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xa8, 0x05, 0x01, 0x00, 0x01,
+ 0x02, 0x00, 0x00, 0x35, 0x00, 0xd1, 0x97, 0x04,
+ 0x48, 0x00, 0x00, 0x00, 0xab, 0x11, 0xea, 0x2a,
+ 0x0e, 0xd1, 0x04, 0x55, 0x01, 0x00, 0x00, 0xa6,
+ 0x11, 0xea, 0x09, 0x0e, 0xd1, 0x04, 0x56, 0x01,
+ 0x00, 0x00, 0xa4, 0x11, 0xeb, 0x14, 0x0e, 0xd1,
+ 0x04, 0x57, 0x01, 0x00, 0x00, 0xa6, 0x11, 0xea,
+ 0x09, 0x0e, 0xd1, 0x04, 0x58, 0x01, 0x00, 0x00,
+ 0xa4, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x05,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x02, 0x19, 0x00,
+ 0xd1, 0x97, 0x04, 0x48, 0x00, 0x00, 0x00, 0xab,
+ 0x11, 0xea, 0x0e, 0x0e, 0xd1, 0xbf, 0x00, 0xa6,
+ 0x11, 0xea, 0x06, 0x0e, 0xd1, 0xbf, 0x01, 0xa4,
+ 0x28, 0x07, 0x02, 0x30, 0x07, 0x02, 0x39, 0x0e,
+ 0x43, 0x02, 0x03, 0xb4, 0x05, 0x01, 0x00, 0x01,
+ 0x02, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x01,
+ 0x00, 0x2f, 0x01, 0xd1, 0x97, 0x04, 0x48, 0x00,
+ 0x00, 0x00, 0xab, 0x11, 0xea, 0x22, 0x0e, 0xdd,
+ 0xd1, 0xef, 0x11, 0xeb, 0x1b, 0x0e, 0xde, 0xd1,
+ 0xef, 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x04, 0x5b,
+ 0x01, 0x00, 0x00, 0xa9, 0x11, 0xeb, 0x09, 0x0e,
+ 0xd1, 0x04, 0x5c, 0x01, 0x00, 0x00, 0xa9, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xba, 0x05, 0x01, 0x04,
+ 0x01, 0x03, 0x00, 0x00, 0x36, 0x00, 0xd1, 0xe9,
+ 0xcc, 0xb5, 0xc9, 0xb5, 0xcb, 0xc7, 0xc8, 0xfa,
+ 0x2a, 0x00, 0x00, 0x00, 0xd1, 0x42, 0x5e, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xc7, 0x24, 0x01, 0x00,
+ 0xce, 0x01, 0x00, 0xdc, 0x00, 0x00, 0xa3, 0x11,
+ 0xeb, 0x09, 0x0e, 0xc6, 0x01, 0x00, 0xe0, 0x00,
+ 0x00, 0xa6, 0xea, 0x03, 0x93, 0x00, 0x93, 0x02,
+ 0xec, 0xd4, 0xc5, 0x28, 0x0e, 0x43, 0x02, 0x03,
+ 0xbe, 0x05, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00,
+ 0x2b, 0x00, 0xd1, 0x97, 0x04, 0x48, 0x00, 0x00,
+ 0x00, 0xac, 0xea, 0x03, 0x09, 0x28, 0xd1, 0x42,
+ 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0x24,
+ 0x01, 0x00, 0xcd, 0x01, 0x00, 0xdc, 0x00, 0x00,
+ 0xa6, 0x11, 0xea, 0x09, 0x0e, 0xc5, 0x01, 0x00,
+ 0xe0, 0x00, 0x00, 0xa3, 0x28, 0x0e, 0x43, 0x02,
+ 0x03, 0xc2, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x23, 0x00, 0xd1, 0xd2, 0x9d, 0x11, 0x04,
+ 0x62, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11,
+ 0x04, 0x63, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a,
+ 0x11, 0x04, 0x64, 0x01, 0x00, 0x00, 0xab, 0xea,
+ 0x03, 0x0a, 0x28, 0x0e, 0x09, 0x28, 0x0e, 0x43,
+ 0x02, 0x03, 0xca, 0x05, 0x03, 0x03, 0x03, 0x06,
+ 0x03, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x0c, 0x00,
+ 0x0a, 0x01, 0x00, 0x0b, 0x01, 0xd2, 0xca, 0xc6,
+ 0xd1, 0xe9, 0xfa, 0x68, 0x00, 0x00, 0x00, 0xd3,
+ 0xc6, 0xcd, 0x47, 0xcb, 0xc6, 0x8f, 0xce, 0xd1,
+ 0xe9, 0xfa, 0x0b, 0x00, 0x00, 0x00, 0xd3, 0xc6,
+ 0x47, 0xc7, 0xa9, 0xeb, 0xf0, 0x65, 0x00, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0xde,
+ 0xdf, 0xc7, 0x47, 0x11, 0xeb, 0x07, 0x0e, 0x04,
+ 0x16, 0x00, 0x00, 0x00, 0x47, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xd1, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xc5, 0xc6, 0x24, 0x02, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x03, 0x00, 0xde, 0x04,
+ 0xe9, 0x00, 0x00, 0x00, 0x47, 0x24, 0x01, 0x00,
+ 0x0e, 0xec, 0x95, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xd0, 0x05, 0x02, 0x00, 0x02, 0x05, 0x01, 0x00,
+ 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x65, 0x00, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04,
+ 0x69, 0x01, 0x00, 0x00, 0xd1, 0xb6, 0xaa, 0xea,
+ 0x04, 0xd1, 0xec, 0x02, 0xc1, 0x9d, 0xd2, 0x9d,
+ 0x24, 0x01, 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xd4, 0x05, 0x01, 0x02, 0x01, 0x04, 0x05, 0x00,
+ 0xa9, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x28,
+ 0x01, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x01, 0x00,
+ 0x35, 0x01, 0xd1, 0xb5, 0xfc, 0x54, 0x00, 0x00,
+ 0x00, 0xd1, 0xb5, 0xaa, 0x69, 0x9d, 0x00, 0x00,
+ 0x00, 0xdd, 0xde, 0xb6, 0x9e, 0xa9, 0xea, 0x1b,
+ 0x65, 0x02, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x04, 0x1f, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xb5, 0xe1, 0xd1, 0x8e, 0xd5,
+ 0xec, 0xd8, 0xe0, 0x42, 0x6b, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xde, 0xb6, 0x9e, 0xdd, 0x9e, 0xd1,
+ 0x24, 0x02, 0x00, 0xca, 0x5e, 0x04, 0x00, 0xc6,
+ 0x04, 0x6c, 0x01, 0x00, 0x00, 0xf0, 0x0e, 0xd1,
+ 0xc6, 0x9e, 0xd5, 0xdd, 0xc6, 0x9d, 0xe1, 0xec,
+ 0xb1, 0xd1, 0x8c, 0xd5, 0xd1, 0xb5, 0xaa, 0xea,
+ 0x4a, 0xdd, 0xb5, 0xa9, 0xea, 0x22, 0x5e, 0x04,
+ 0x00, 0xb6, 0x04, 0x55, 0x01, 0x00, 0x00, 0xf0,
+ 0x0e, 0x5e, 0x04, 0x00, 0xde, 0xb6, 0x9e, 0x04,
+ 0x6c, 0x01, 0x00, 0x00, 0xf0, 0x0e, 0xd1, 0x8e,
+ 0xd5, 0xde, 0xb6, 0x9e, 0xe1, 0xec, 0xd6, 0xe0,
+ 0x42, 0x6b, 0x01, 0x00, 0x00, 0x02, 0x00, 0xd1,
+ 0xdd, 0x24, 0x02, 0x00, 0xca, 0x5e, 0x04, 0x00,
+ 0xc6, 0x04, 0x6d, 0x01, 0x00, 0x00, 0xf0, 0x0e,
+ 0xd1, 0xc6, 0x9e, 0xd5, 0xdd, 0xc6, 0x9e, 0xe1,
+ 0xec, 0xb3, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xdc,
+ 0x05, 0x00, 0x05, 0x00, 0x06, 0x0d, 0x00, 0xb8,
+ 0x02, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x1e, 0x01,
+ 0x00, 0x18, 0x01, 0x00, 0x1f, 0x01, 0x00, 0x00,
+ 0x0c, 0x00, 0x36, 0x01, 0x00, 0x31, 0x01, 0x00,
+ 0x1a, 0x01, 0x00, 0x76, 0x01, 0x00, 0x34, 0x01,
+ 0x00, 0x29, 0x01, 0x00, 0x28, 0x01, 0x00, 0x1d,
+ 0x01, 0xdd, 0xde, 0xaa, 0x69, 0xd6, 0x00, 0x00,
+ 0x00, 0xdf, 0x96, 0xea, 0x3a, 0xde, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xe0, 0x24,
+ 0x02, 0x00, 0xdd, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xb5, 0xe0, 0x24, 0x02, 0x00, 0xa9,
+ 0xea, 0x1d, 0x65, 0x04, 0x00, 0x42, 0x66, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0xdd, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0xe0, 0x24, 0x01, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xec, 0x57, 0x5e, 0x05,
+ 0x00, 0x5e, 0x06, 0x00, 0xde, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0xb5, 0xe0, 0x24, 0x02,
+ 0x00, 0xef, 0x8c, 0xef, 0x0e, 0xdf, 0xea, 0x2e,
+ 0x5e, 0x07, 0x00, 0xea, 0x0e, 0x5e, 0x07, 0x00,
+ 0x04, 0x1f, 0x01, 0x00, 0x00, 0x9d, 0xdd, 0x9d,
+ 0xec, 0x02, 0xdd, 0xcf, 0xe9, 0xdd, 0xe9, 0x9e,
+ 0xcc, 0x5e, 0x08, 0x00, 0xc7, 0xef, 0xc3, 0x04,
+ 0x5e, 0x09, 0x00, 0xc7, 0xc8, 0xc2, 0x04, 0xb7,
+ 0x47, 0xf1, 0x0e, 0xec, 0x10, 0x65, 0x04, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x05, 0x00, 0xdd,
+ 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x0a, 0x00, 0x5e,
+ 0x06, 0x00, 0xdd, 0xef, 0x9d, 0x5e, 0x0b, 0x00,
+ 0x9c, 0x60, 0x0a, 0x00, 0xb5, 0xa9, 0xea, 0x14,
+ 0x65, 0x04, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0x04, 0x6f, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x65, 0x04, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x70, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xdd, 0xe2,
+ 0xdd, 0xe9, 0xe4, 0x5e, 0x0c, 0x00, 0xe0, 0xfc,
+ 0x1e, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x5e,
+ 0x06, 0x00, 0xdd, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x08, 0x00, 0xe0, 0x5e, 0x0c, 0x00, 0x24, 0x02,
+ 0x00, 0xef, 0xef, 0x0e, 0xec, 0x23, 0x5e, 0x0c,
+ 0x00, 0xe0, 0xfa, 0x1d, 0x00, 0x00, 0x00, 0x5e,
+ 0x05, 0x00, 0x5e, 0x06, 0x00, 0xdd, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x09, 0x00, 0x5e, 0x0c, 0x00,
+ 0xe0, 0x24, 0x02, 0x00, 0xef, 0x8c, 0xef, 0x0e,
+ 0x5e, 0x0c, 0x00, 0xe4, 0x65, 0x04, 0x00, 0x41,
+ 0x71, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x42, 0x72,
+ 0x01, 0x00, 0x00, 0x0b, 0x00, 0x24, 0x00, 0x00,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe6, 0x05, 0x01,
+ 0x00, 0x01, 0x04, 0x02, 0x00, 0x26, 0x00, 0x00,
+ 0x1c, 0x01, 0x00, 0x1d, 0x01, 0xd1, 0xea, 0x23,
+ 0xdd, 0x42, 0x67, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xb5, 0xde, 0x24, 0x02, 0x00, 0xd1, 0x9d, 0xdd,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x01, 0x00, 0xde,
+ 0x24, 0x01, 0x00, 0x9d, 0xe1, 0xde, 0xd1, 0xe9,
+ 0x9d, 0xe2, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe8,
+ 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x03,
+ 0x00, 0xea, 0x05, 0x23, 0x01, 0x0a, 0xe1, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xec, 0x05, 0x00, 0x00,
+ 0x00, 0x01, 0x02, 0x00, 0x07, 0x00, 0xee, 0x05,
+ 0x1c, 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xc1, 0xe1,
+ 0xb5, 0xe2, 0xbd, 0xfe, 0x28, 0x0e, 0x43, 0x02,
+ 0x03, 0xf2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x00, 0x01, 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xf4, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+ 0x03, 0x00, 0xf0, 0x05, 0x1d, 0x01, 0xb5, 0xe1,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xf6, 0x05, 0x00,
+ 0x00, 0x00, 0x01, 0x02, 0x00, 0x04, 0x00, 0xf0,
+ 0x05, 0x1d, 0x01, 0xee, 0x05, 0x1c, 0x01, 0xde,
+ 0xe9, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xf8,
+ 0x05, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x21,
+ 0x00, 0xf0, 0x05, 0x1d, 0x01, 0xee, 0x05, 0x1c,
+ 0x01, 0xbe, 0x05, 0x32, 0x01, 0xdd, 0xde, 0xe9,
+ 0xfa, 0x1c, 0x00, 0x00, 0x00, 0xdd, 0x8f, 0xe1,
+ 0xdf, 0xde, 0x42, 0x7d, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xdd, 0x24, 0x01, 0x00, 0xef, 0xea, 0x06,
+ 0xdd, 0x8f, 0xe1, 0xec, 0xec, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x04,
+ 0x03, 0x00, 0x20, 0x00, 0xf0, 0x05, 0x1d, 0x01,
+ 0xbe, 0x05, 0x32, 0x01, 0xee, 0x05, 0x1c, 0x01,
+ 0xdd, 0xb5, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0xdd,
+ 0x8e, 0xe1, 0xde, 0xdf, 0x42, 0x7d, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xdd, 0x24, 0x01, 0x00, 0xef,
+ 0xea, 0x06, 0xdd, 0x8e, 0xe1, 0xec, 0xec, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xfe, 0x05, 0x01, 0x00,
+ 0x01, 0x04, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x1c,
+ 0x01, 0x00, 0x30, 0x01, 0xd1, 0xdd, 0xe9, 0xfa,
+ 0x1a, 0x00, 0x00, 0x00, 0xde, 0xdd, 0x42, 0x7d,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01,
+ 0x00, 0xef, 0x96, 0xea, 0x06, 0xd1, 0x8f, 0xd5,
+ 0xec, 0xe3, 0xd1, 0xdd, 0xe9, 0xfa, 0x19, 0x00,
+ 0x00, 0x00, 0xde, 0xdd, 0x42, 0x7d, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xd1, 0x24, 0x01, 0x00, 0xef,
+ 0xea, 0x06, 0xd1, 0x8f, 0xd5, 0xec, 0xe4, 0xd1,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0x80, 0x06, 0x01,
+ 0x00, 0x01, 0x05, 0x02, 0x00, 0x3f, 0x00, 0x00,
+ 0x30, 0x01, 0x00, 0x1c, 0x01, 0xd1, 0xb5, 0xfc,
+ 0x1c, 0x00, 0x00, 0x00, 0xdd, 0xde, 0x42, 0x7d,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xb6, 0x9e,
+ 0x24, 0x01, 0x00, 0xef, 0x96, 0xea, 0x06, 0xd1,
+ 0x8e, 0xd5, 0xec, 0xe2, 0xd1, 0xb5, 0xfc, 0x1b,
+ 0x00, 0x00, 0x00, 0xdd, 0xde, 0x42, 0x7d, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0xd1, 0xb6, 0x9e, 0x24,
+ 0x01, 0x00, 0xef, 0xea, 0x06, 0xd1, 0x8e, 0xd5,
+ 0xec, 0xe3, 0xd1, 0x28, 0x0e, 0x43, 0x02, 0x03,
+ 0x82, 0x06, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00,
+ 0x05, 0x00, 0xf0, 0x05, 0x1d, 0x01, 0xfe, 0x05,
+ 0x40, 0x01, 0xde, 0xdd, 0xef, 0xe1, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0x84, 0x06, 0x00, 0x00, 0x00,
+ 0x02, 0x02, 0x00, 0x05, 0x00, 0xf0, 0x05, 0x1d,
+ 0x01, 0x80, 0x06, 0x41, 0x01, 0xde, 0xdd, 0xef,
+ 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x86, 0x06,
+ 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x19, 0x00,
+ 0xc4, 0x03, 0x00, 0x0c, 0x88, 0x06, 0x45, 0x01,
+ 0xee, 0x05, 0x1c, 0x01, 0x65, 0x00, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f,
+ 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xde,
+ 0xdf, 0xef, 0x0e, 0xb4, 0x28, 0x0e, 0x43, 0x02,
+ 0x03, 0x88, 0x06, 0x01, 0x00, 0x01, 0x03, 0x02,
+ 0x00, 0x14, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x20,
+ 0x01, 0xd1, 0xea, 0x0e, 0xdd, 0x42, 0x85, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0x0e, 0xdd, 0xe9, 0xe2, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0x8c, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04,
+ 0x00, 0x24, 0x00, 0x8e, 0x06, 0x20, 0x01, 0x90,
+ 0x06, 0x0c, 0x01, 0xee, 0x05, 0x1c, 0x01, 0xf0,
+ 0x05, 0x1d, 0x01, 0xdd, 0xb5, 0xfc, 0x20, 0x00,
+ 0x00, 0x00, 0xdd, 0xde, 0xe9, 0xa9, 0xea, 0x0e,
+ 0xde, 0x42, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xdf, 0x24, 0x01, 0x00, 0x0e, 0xdd, 0x8e, 0xe1,
+ 0xde, 0xdd, 0x47, 0xe7, 0xe9, 0xe4, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0x92, 0x06, 0x00, 0x00, 0x00,
+ 0x03, 0x04, 0x00, 0x14, 0x00, 0x8e, 0x06, 0x20,
+ 0x01, 0x90, 0x06, 0x0c, 0x01, 0xee, 0x05, 0x1c,
+ 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xdd, 0xde, 0xe9,
+ 0xb6, 0x9e, 0xfa, 0x0d, 0x00, 0x00, 0x00, 0xdd,
+ 0x8f, 0xe1, 0xde, 0xdd, 0x47, 0xe7, 0xe9, 0xe4,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x94, 0x06, 0x01,
+ 0x03, 0x01, 0x05, 0x04, 0x00, 0x43, 0x00, 0x00,
+ 0x1d, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x20, 0x01,
+ 0x00, 0x1c, 0x01, 0xdd, 0xc9, 0xb6, 0xca, 0xc6,
+ 0xde, 0xe9, 0xfb, 0x3a, 0x00, 0x00, 0x00, 0xde,
+ 0xe9, 0xc6, 0xd1, 0x9a, 0x9d, 0xdf, 0x9d, 0xde,
+ 0xe9, 0x9c, 0xcb, 0xde, 0xc7, 0x47, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xc5, 0x24,
+ 0x02, 0x00, 0xe0, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xb5, 0xc5, 0x24, 0x02, 0x00, 0xa9,
+ 0xea, 0x08, 0xc7, 0xe3, 0xde, 0xc7, 0x47, 0xe4,
+ 0x29, 0x93, 0x01, 0xec, 0xc3, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0x96, 0x06, 0x00, 0x00, 0x00, 0x02,
+ 0x01, 0x00, 0x05, 0x00, 0x94, 0x06, 0x48, 0x01,
+ 0xdd, 0xb4, 0x23, 0x01, 0x00, 0x0e, 0x43, 0x02,
+ 0x03, 0x98, 0x06, 0x00, 0x00, 0x00, 0x02, 0x01,
+ 0x00, 0x05, 0x00, 0x94, 0x06, 0x48, 0x01, 0xdd,
+ 0xb6, 0x23, 0x01, 0x00, 0x0e, 0x43, 0x02, 0x03,
+ 0x9a, 0x06, 0x01, 0x02, 0x01, 0x04, 0x05, 0x00,
+ 0x72, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x32, 0x01,
+ 0x00, 0x1c, 0x01, 0x00, 0x22, 0x01, 0x00, 0x53,
+ 0x01, 0xdd, 0xc9, 0xd1, 0xb5, 0xfa, 0x1a, 0x00,
+ 0x00, 0x00, 0x92, 0x00, 0xde, 0xdf, 0x42, 0x7d,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x24, 0x01,
+ 0x00, 0xef, 0xea, 0x05, 0x92, 0x00, 0xec, 0xed,
+ 0xc5, 0xb6, 0x9d, 0xca, 0xde, 0xdf, 0x42, 0x7d,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xc6, 0x24, 0x01,
+ 0x00, 0xef, 0xea, 0x05, 0x93, 0x01, 0xec, 0xed,
+ 0xc5, 0xb5, 0xfd, 0x37, 0x00, 0x00, 0x00, 0xc5,
+ 0xdf, 0xe9, 0xa3, 0xea, 0x2e, 0xe0, 0x5e, 0x04,
+ 0x00, 0xab, 0xea, 0x0a, 0x5e, 0x04, 0x00, 0xc5,
+ 0xc6, 0xd1, 0xf1, 0x0e, 0x29, 0xdf, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0xb5, 0xc5, 0x24,
+ 0x02, 0x00, 0xdf, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0xc6, 0x24, 0x01, 0x00, 0x9d, 0xe3,
+ 0xc5, 0xe1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9c,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+ 0x00, 0x9a, 0x06, 0x4b, 0x01, 0xdd, 0xb6, 0xef,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e, 0x06, 0x00,
+ 0x00, 0x00, 0x03, 0x03, 0x00, 0x21, 0x00, 0xee,
+ 0x05, 0x1c, 0x01, 0xc4, 0x03, 0x00, 0x0c, 0x9a,
+ 0x06, 0x4b, 0x01, 0xdd, 0xe9, 0xb5, 0xa9, 0xea,
+ 0x17, 0x65, 0x01, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xbd, 0xfd, 0x28, 0xdf,
+ 0xb6, 0xef, 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xa0, 0x06, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+ 0x04, 0x00, 0x9a, 0x06, 0x4b, 0x01, 0xdd, 0xb4,
+ 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x06,
+ 0x00, 0x01, 0x00, 0x06, 0x02, 0x00, 0x5b, 0x00,
+ 0x00, 0x1d, 0x01, 0x00, 0x1c, 0x01, 0xdd, 0xc9,
+ 0xde, 0xe9, 0xb6, 0xfc, 0x54, 0x00, 0x00, 0x00,
+ 0xc5, 0xb5, 0xa5, 0xea, 0x4c, 0xc5, 0xde, 0xe9,
+ 0xa9, 0xea, 0x03, 0x92, 0x00, 0xde, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xc5, 0xb6,
+ 0x9e, 0x24, 0x02, 0x00, 0xde, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0xc5, 0xc5, 0xb6, 0x9d,
+ 0x24, 0x02, 0x00, 0x9d, 0xde, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0xc5, 0xb6, 0x9e, 0xc5,
+ 0x24, 0x02, 0x00, 0x9d, 0xde, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x03, 0x00, 0xc5, 0xb6, 0x9d, 0x24,
+ 0x01, 0x00, 0x9d, 0xe2, 0xc5, 0xb6, 0x9d, 0xe1,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa4, 0x06, 0x00,
+ 0x04, 0x00, 0x05, 0x04, 0x00, 0x65, 0x00, 0x00,
+ 0x41, 0x01, 0x00, 0x1d, 0x01, 0x00, 0x40, 0x01,
+ 0x00, 0x1c, 0x01, 0xdd, 0xde, 0xef, 0xc9, 0xdf,
+ 0xc5, 0xef, 0xca, 0xdf, 0xde, 0xef, 0xcb, 0xdd,
+ 0xc7, 0xef, 0xcc, 0xc5, 0xc6, 0xfa, 0x51, 0x00,
+ 0x00, 0x00, 0xc6, 0xde, 0xfb, 0x4a, 0x00, 0x00,
+ 0x00, 0xde, 0xc8, 0xfb, 0x43, 0x00, 0x00, 0x00,
+ 0xc8, 0xc7, 0xa3, 0xea, 0x3b, 0xe0, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xc5, 0x24,
+ 0x02, 0x00, 0xe0, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0xc8, 0xc7, 0x24, 0x02, 0x00, 0x9d,
+ 0xe0, 0x42, 0x67, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0xc6, 0xc8, 0x24, 0x02, 0x00, 0x9d, 0xe0, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc5, 0xc6,
+ 0x24, 0x02, 0x00, 0x9d, 0xe4, 0xc7, 0xe2, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xa6, 0x06, 0x00, 0x01,
+ 0x00, 0x05, 0x03, 0x00, 0x38, 0x00, 0x00, 0x40,
+ 0x01, 0x00, 0x1d, 0x01, 0x00, 0x1c, 0x01, 0xdd,
+ 0xde, 0xef, 0xc9, 0xdf, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xb5, 0xde, 0x24, 0x02, 0x00,
+ 0xdf, 0x42, 0x67, 0x01, 0x00, 0x00, 0x01, 0x00,
+ 0xde, 0xc5, 0x24, 0x02, 0x00, 0x42, 0x94, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x9d,
+ 0xdf, 0x42, 0x67, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xc5, 0x24, 0x01, 0x00, 0x9d, 0xe3, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xaa, 0x06, 0x00, 0x01, 0x00,
+ 0x05, 0x03, 0x00, 0x38, 0x00, 0x00, 0x40, 0x01,
+ 0x00, 0x1d, 0x01, 0x00, 0x1c, 0x01, 0xdd, 0xde,
+ 0xef, 0xc9, 0xdf, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0xb5, 0xde, 0x24, 0x02, 0x00, 0xdf,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x01, 0x00, 0xde,
+ 0xc5, 0x24, 0x02, 0x00, 0x42, 0x96, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x9d, 0xdf,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0x9d, 0xe3, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xae, 0x06, 0x03, 0x01, 0x03, 0x04,
+ 0x06, 0x00, 0x6a, 0x00, 0x00, 0x1c, 0x01, 0x00,
+ 0x22, 0x01, 0x00, 0x53, 0x01, 0x00, 0x0d, 0x01,
+ 0x00, 0x1d, 0x01, 0x00, 0x21, 0x01, 0xdd, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd2,
+ 0x24, 0x02, 0x00, 0xc9, 0xde, 0xdf, 0xac, 0xea,
+ 0x05, 0xc5, 0xe4, 0xec, 0x12, 0xd3, 0xb5, 0xfa,
+ 0x0a, 0x00, 0x00, 0x00, 0xc5, 0xe0, 0x9d, 0xe4,
+ 0xec, 0x05, 0xe0, 0xc5, 0x9d, 0xe4, 0xdd, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x01, 0x00, 0xb5, 0xd1,
+ 0x24, 0x02, 0x00, 0xdd, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0xd2, 0x24, 0x01, 0x00, 0x9d,
+ 0xe1, 0x5e, 0x04, 0x00, 0xd2, 0xfc, 0x10, 0x00,
+ 0x00, 0x00, 0x5e, 0x04, 0x00, 0xd2, 0xd1, 0x9e,
+ 0x9e, 0x5f, 0x04, 0x00, 0xec, 0x0e, 0x5e, 0x04,
+ 0x00, 0xd1, 0xfc, 0x08, 0x00, 0x00, 0x00, 0xd1,
+ 0x5f, 0x04, 0x00, 0xdf, 0x5f, 0x05, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xb0, 0x06, 0x00, 0x00,
+ 0x00, 0x04, 0x03, 0x00, 0x07, 0x00, 0xae, 0x06,
+ 0x53, 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xee, 0x05,
+ 0x1c, 0x01, 0xdd, 0xde, 0xdf, 0xe9, 0xb6, 0xf1,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x06, 0x00,
+ 0x00, 0x00, 0x04, 0x02, 0x00, 0x06, 0x00, 0xae,
+ 0x06, 0x53, 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xdd,
+ 0xb5, 0xde, 0xb4, 0xf1, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xb4, 0x06, 0x00, 0x00, 0x00, 0x04, 0x03,
+ 0x00, 0x08, 0x00, 0xae, 0x06, 0x53, 0x01, 0xf0,
+ 0x05, 0x1d, 0x01, 0xfe, 0x05, 0x40, 0x01, 0xdd,
+ 0xde, 0xdf, 0xde, 0xef, 0xb6, 0xf1, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xb6, 0x06, 0x00, 0x00, 0x00,
+ 0x04, 0x03, 0x00, 0x08, 0x00, 0xae, 0x06, 0x53,
+ 0x01, 0x80, 0x06, 0x41, 0x01, 0xf0, 0x05, 0x1d,
+ 0x01, 0xdd, 0xde, 0xdf, 0xef, 0xdf, 0xb4, 0xf1,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x02, 0x00, 0x04, 0x00, 0xe6,
+ 0x05, 0x38, 0x01, 0xba, 0x06, 0x0d, 0x01, 0xdd,
+ 0xde, 0xef, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xbc,
+ 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x3f,
+ 0x00, 0xbe, 0x06, 0x22, 0x01, 0xbc, 0x06, 0x59,
+ 0x01, 0xc4, 0x03, 0x00, 0x0c, 0xc0, 0x06, 0x64,
+ 0x01, 0xdd, 0xde, 0xab, 0xea, 0x24, 0x65, 0x02,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x04, 0x1f, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x02, 0x00, 0x42, 0xa1, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0xb5, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0x65, 0x02, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x02, 0x00, 0x04, 0xa2, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xe0, 0xee, 0x0e, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xc6, 0x06, 0x00, 0x00,
+ 0x00, 0x01, 0x02, 0x00, 0x05, 0x00, 0xee, 0x05,
+ 0x1c, 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xc1, 0xe1,
+ 0xb5, 0xe2, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc8,
+ 0x06, 0x02, 0x01, 0x02, 0x04, 0x01, 0x00, 0x1f,
+ 0x00, 0x00, 0x30, 0x01, 0xc1, 0xc9, 0xd2, 0xb5,
+ 0xfc, 0x18, 0x00, 0x00, 0x00, 0xdd, 0xd1, 0xd2,
+ 0xb6, 0x9e, 0x47, 0xef, 0xea, 0x0c, 0xd2, 0x8e,
+ 0xd6, 0xd1, 0xd2, 0x47, 0xc5, 0x9d, 0xc9, 0xec,
+ 0xe6, 0xc5, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xca,
+ 0x06, 0x02, 0x06, 0x02, 0x05, 0x7a, 0x02, 0x8a,
+ 0x02, 0x08, 0xcc, 0x06, 0x00, 0x01, 0x00, 0xce,
+ 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00,
+ 0x00, 0xd2, 0x06, 0x00, 0x01, 0x00, 0xd4, 0x06,
+ 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0xe2,
+ 0x01, 0x00, 0x01, 0x00, 0x9a, 0x01, 0x00, 0x01,
+ 0x00, 0xd6, 0x06, 0x00, 0x03, 0xaa, 0x02, 0x00,
+ 0x01, 0xb2, 0x02, 0x01, 0x01, 0xac, 0x02, 0x02,
+ 0x01, 0xbe, 0x02, 0x03, 0x01, 0xba, 0x02, 0x04,
+ 0x01, 0xc8, 0x03, 0x05, 0x01, 0xca, 0x03, 0x06,
+ 0x01, 0xd8, 0x06, 0x07, 0x01, 0xda, 0x06, 0x08,
+ 0x01, 0xdc, 0x06, 0x09, 0x01, 0xde, 0x06, 0x0a,
+ 0x01, 0xe0, 0x06, 0x0b, 0x01, 0x90, 0x06, 0x0c,
+ 0x01, 0xba, 0x06, 0x0d, 0x01, 0xe2, 0x06, 0x0e,
+ 0x01, 0xe4, 0x06, 0x0f, 0x01, 0xe6, 0x06, 0x10,
+ 0x01, 0xe8, 0x06, 0x11, 0x01, 0xea, 0x06, 0x12,
+ 0x01, 0xec, 0x06, 0x13, 0x01, 0xee, 0x06, 0x14,
+ 0x01, 0xf0, 0x06, 0x15, 0x01, 0xf2, 0x06, 0x16,
+ 0x01, 0xf4, 0x06, 0x17, 0x01, 0xf6, 0x06, 0x18,
+ 0x01, 0xf8, 0x06, 0x19, 0x01, 0xfa, 0x06, 0x1a,
+ 0x01, 0xfc, 0x06, 0x1b, 0x01, 0xee, 0x05, 0x1c,
+ 0x01, 0xf0, 0x05, 0x1d, 0x01, 0xfe, 0x06, 0x1e,
+ 0x01, 0x80, 0x07, 0x1f, 0x01, 0x8e, 0x06, 0x20,
+ 0x01, 0x82, 0x07, 0x21, 0x01, 0xbe, 0x06, 0x22,
+ 0x01, 0xea, 0x05, 0x23, 0x01, 0x84, 0x07, 0x24,
+ 0x01, 0x86, 0x07, 0x25, 0x01, 0x88, 0x07, 0x26,
+ 0x01, 0x8a, 0x07, 0x27, 0x01, 0x8c, 0x07, 0x28,
+ 0x01, 0x8e, 0x07, 0x29, 0x01, 0x8e, 0x05, 0x2a,
+ 0x01, 0x9e, 0x05, 0x2b, 0x01, 0xa2, 0x05, 0x2c,
+ 0x01, 0xa0, 0x05, 0x2d, 0x01, 0xa8, 0x05, 0x2e,
+ 0x01, 0xb2, 0x05, 0x2f, 0x01, 0xb4, 0x05, 0x30,
+ 0x01, 0xba, 0x05, 0x31, 0x01, 0xbe, 0x05, 0x32,
+ 0x01, 0xc2, 0x05, 0x33, 0x01, 0xca, 0x05, 0x34,
+ 0x01, 0xd0, 0x05, 0x35, 0x01, 0xd4, 0x05, 0x36,
+ 0x01, 0xdc, 0x05, 0x37, 0x01, 0xe6, 0x05, 0x38,
+ 0x01, 0xe8, 0x05, 0x39, 0x01, 0xec, 0x05, 0x3a,
+ 0x01, 0xf2, 0x05, 0x3b, 0x01, 0xf4, 0x05, 0x3c,
+ 0x01, 0xf6, 0x05, 0x3d, 0x01, 0xf8, 0x05, 0x3e,
+ 0x01, 0xfc, 0x05, 0x3f, 0x01, 0xfe, 0x05, 0x40,
+ 0x01, 0x80, 0x06, 0x41, 0x01, 0x82, 0x06, 0x42,
+ 0x01, 0x84, 0x06, 0x43, 0x01, 0x86, 0x06, 0x44,
+ 0x01, 0x88, 0x06, 0x45, 0x01, 0x8c, 0x06, 0x46,
+ 0x01, 0x92, 0x06, 0x47, 0x01, 0x94, 0x06, 0x48,
+ 0x01, 0x96, 0x06, 0x49, 0x01, 0x98, 0x06, 0x4a,
+ 0x01, 0x9a, 0x06, 0x4b, 0x01, 0x9c, 0x06, 0x4c,
+ 0x01, 0x9e, 0x06, 0x4d, 0x01, 0xa0, 0x06, 0x4e,
+ 0x01, 0xa2, 0x06, 0x4f, 0x01, 0xa4, 0x06, 0x50,
+ 0x01, 0xa6, 0x06, 0x51, 0x01, 0xaa, 0x06, 0x52,
+ 0x01, 0xae, 0x06, 0x53, 0x01, 0xb0, 0x06, 0x54,
+ 0x01, 0xb2, 0x06, 0x55, 0x01, 0xb4, 0x06, 0x56,
+ 0x01, 0xb6, 0x06, 0x57, 0x01, 0xb8, 0x06, 0x58,
+ 0x01, 0xbc, 0x06, 0x59, 0x01, 0xc6, 0x06, 0x5a,
+ 0x01, 0xc8, 0x06, 0x5b, 0x01, 0xca, 0x06, 0x5c,
+ 0x01, 0x90, 0x07, 0x5d, 0x01, 0x92, 0x07, 0x5e,
+ 0x01, 0x94, 0x07, 0x5f, 0x01, 0x96, 0x07, 0x60,
+ 0x01, 0x98, 0x07, 0x61, 0x01, 0x9a, 0x07, 0x62,
+ 0x01, 0x9c, 0x07, 0x63, 0x01, 0xc0, 0x06, 0x64,
+ 0x01, 0x9e, 0x07, 0x65, 0x01, 0xa0, 0x07, 0x66,
+ 0x01, 0xa2, 0x07, 0x67, 0x01, 0xa4, 0x07, 0x68,
+ 0x01, 0xa6, 0x07, 0x69, 0x01, 0xa8, 0x07, 0x6a,
+ 0x01, 0xaa, 0x07, 0x6b, 0x01, 0xac, 0x07, 0x6c,
+ 0x01, 0xae, 0x07, 0x6d, 0x01, 0xb0, 0x07, 0x6e,
+ 0x01, 0xb2, 0x07, 0x6f, 0x01, 0xb4, 0x07, 0x70,
+ 0x01, 0xb6, 0x07, 0x71, 0x01, 0xb8, 0x07, 0x72,
+ 0x01, 0xba, 0x07, 0x73, 0x01, 0xbc, 0x07, 0x74,
+ 0x01, 0xbe, 0x07, 0x75, 0x01, 0xc0, 0x07, 0x76,
+ 0x01, 0xc4, 0x03, 0x00, 0x0c, 0xc6, 0x03, 0x01,
+ 0x0c, 0x0c, 0x03, 0xc3, 0x04, 0x08, 0xcc, 0x0c,
+ 0x00, 0xc3, 0x05, 0xd2, 0xb5, 0xa4, 0x11, 0xeb,
+ 0x18, 0x0e, 0x04, 0xe1, 0x01, 0x00, 0x00, 0x42,
+ 0xe2, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd2,
+ 0xb6, 0x9e, 0x47, 0x24, 0x01, 0x00, 0xb5, 0xa6,
+ 0xea, 0x03, 0xdd, 0x28, 0xd2, 0xb7, 0xfd, 0xdb,
+ 0x00, 0x00, 0x00, 0xd1, 0xd2, 0xb6, 0x9e, 0x47,
+ 0x04, 0xe3, 0x01, 0x00, 0x00, 0xab, 0x69, 0xcb,
+ 0x00, 0x00, 0x00, 0xd2, 0x8e, 0xd6, 0x0b, 0xc9,
+ 0xd1, 0xd2, 0xb6, 0x9e, 0x47, 0xcf, 0x11, 0x04,
+ 0xe4, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
+ 0x04, 0xe5, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07,
+ 0x04, 0x57, 0x01, 0x00, 0x00, 0x28, 0x11, 0x04,
+ 0xe6, 0x01, 0x00, 0x00, 0xab, 0xea, 0x05, 0x26,
+ 0x00, 0x00, 0x28, 0x11, 0x04, 0xe7, 0x01, 0x00,
+ 0x00, 0xab, 0xea, 0x03, 0x0b, 0x28, 0x11, 0x04,
+ 0xe8, 0x01, 0x00, 0x00, 0xab, 0xea, 0x07, 0xbf,
+ 0x00, 0xbf, 0x01, 0x33, 0x28, 0x5e, 0x31, 0x00,
+ 0xc7, 0xef, 0xea, 0x75, 0x5e, 0x5c, 0x00, 0xd1,
+ 0xd2, 0xf0, 0xca, 0x04, 0x03, 0x00, 0x00, 0x00,
+ 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
+ 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x26,
+ 0x04, 0x00, 0x42, 0xe9, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xc6, 0x24, 0x01, 0x00, 0x11, 0xeb, 0x0b,
+ 0x0e, 0x38, 0xea, 0x01, 0x00, 0x00, 0xc6, 0x8d,
+ 0xef, 0x96, 0xea, 0x0d, 0x38, 0x3a, 0x00, 0x00,
+ 0x00, 0xc6, 0x31, 0x01, 0x00, 0x00, 0x00, 0x28,
+ 0x5e, 0x5d, 0x00, 0xd1, 0xd2, 0xc6, 0xe9, 0x9e,
+ 0xf0, 0xcd, 0xf3, 0x11, 0xeb, 0x04, 0x0e, 0xc5,
+ 0xf2, 0xea, 0x03, 0xc5, 0x28, 0xc5, 0xdd, 0xab,
+ 0xea, 0x13, 0xc5, 0xc6, 0x47, 0xf2, 0xea, 0x0d,
+ 0x38, 0x3a, 0x00, 0x00, 0x00, 0xc6, 0x31, 0x01,
+ 0x00, 0x00, 0x00, 0x28, 0xc5, 0xc6, 0x47, 0x28,
+ 0x0b, 0x28, 0x29, 0x07, 0x02, 0x20, 0x07, 0x42,
+ 0x40, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06,
+ 0x08, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5,
+ 0xff, 0xff, 0xff, 0x0b, 0x00, 0x01, 0x20, 0x00,
+ 0x0c, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x20, 0x20,
+ 0x00, 0x0e, 0x43, 0x02, 0x03, 0x90, 0x07, 0x02,
+ 0x0a, 0x02, 0x04, 0x03, 0x01, 0xf9, 0x01, 0x00,
+ 0x00, 0x5b, 0x01, 0x00, 0x5c, 0x01, 0x00, 0x00,
+ 0x01, 0xdd, 0xd1, 0xd2, 0xf0, 0xc9, 0xde, 0xd1,
+ 0xd2, 0xc5, 0xe9, 0x9e, 0xf0, 0xcb, 0x26, 0x00,
+ 0x00, 0xcc, 0xb5, 0xc3, 0x04, 0xc7, 0xca, 0xc2,
+ 0x04, 0xbd, 0x0a, 0xfa, 0x75, 0x00, 0x00, 0x00,
+ 0xc6, 0xf3, 0xeb, 0x6e, 0xc6, 0x06, 0xac, 0xea,
+ 0x69, 0xdf, 0x42, 0xeb, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xc6, 0x24, 0x01, 0x00, 0xc3, 0x07, 0xb5,
+ 0xc3, 0x05, 0xc2, 0x05, 0xc2, 0x07, 0xe9, 0xfa,
+ 0x40, 0x00, 0x00, 0x00, 0xc2, 0x07, 0xc2, 0x05,
+ 0x47, 0xc4, 0x08, 0x97, 0x04, 0x48, 0x00, 0x00,
+ 0x00, 0xa9, 0xea, 0x29, 0xc1, 0xc2, 0x08, 0x8d,
+ 0x9d, 0xc2, 0x08, 0xaa, 0xea, 0x1f, 0xf7, 0xec,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0xea, 0x10, 0xf7, 0x85, 0x01,
+ 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0xc2, 0x08,
+ 0x24, 0x01, 0x00, 0x0e, 0x93, 0x05, 0xec, 0xbb,
+ 0xdf, 0x42, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0xc6, 0x24, 0x01, 0x00, 0xca, 0x93, 0x04, 0xec,
+ 0x87, 0xc8, 0xe9, 0xb6, 0xfc, 0x50, 0x00, 0x00,
+ 0x00, 0xc0, 0x00, 0xc3, 0x09, 0xc0, 0x00, 0x0e,
+ 0xf7, 0xed, 0x01, 0x00, 0x00, 0x04, 0x00, 0x03,
+ 0x00, 0x62, 0x09, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xb6, 0xc4, 0x05, 0xc3, 0x04, 0xc2, 0x04, 0xc8,
+ 0xe9, 0xfa, 0x21, 0x00, 0x00, 0x00, 0xc8, 0xc2,
+ 0x04, 0x47, 0xc8, 0xc2, 0x04, 0xb6, 0x9e, 0x47,
+ 0xaa, 0xea, 0x0d, 0xc8, 0xc2, 0x05, 0x91, 0xc3,
+ 0x05, 0x71, 0xc8, 0xc2, 0x04, 0x47, 0x49, 0x93,
+ 0x04, 0xec, 0xdb, 0xc8, 0xc2, 0x05, 0x43, 0x30,
+ 0x00, 0x00, 0x00, 0x05, 0x00, 0x0b, 0xc8, 0x4c,
+ 0xee, 0x01, 0x00, 0x00, 0xc5, 0xe9, 0x4c, 0xa7,
+ 0x01, 0x00, 0x00, 0xc7, 0x4c, 0xef, 0x01, 0x00,
+ 0x00, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xe0, 0x07,
+ 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x37, 0x00,
+ 0xd1, 0xb5, 0x47, 0xd2, 0xb5, 0x47, 0xaa, 0xea,
+ 0x1b, 0xd1, 0xb5, 0x47, 0x04, 0x5b, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x03, 0xb6, 0x28, 0xd2, 0xb5,
+ 0x47, 0x04, 0x5b, 0x01, 0x00, 0x00, 0xa9, 0xea,
+ 0x03, 0xb4, 0x28, 0xd1, 0xd2, 0xfa, 0x06, 0x00,
+ 0x00, 0x00, 0xb4, 0x28, 0xd1, 0xd2, 0xfc, 0x06,
+ 0x00, 0x00, 0x00, 0xb6, 0x28, 0xb5, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0x92, 0x07, 0x00, 0x0d, 0x00,
+ 0x07, 0x0a, 0x00, 0xb4, 0x03, 0x00, 0x00, 0x5d,
+ 0x01, 0x00, 0x1c, 0x01, 0x00, 0x1d, 0x01, 0x00,
+ 0x38, 0x01, 0x00, 0x22, 0x01, 0x00, 0x5e, 0x01,
+ 0x00, 0x04, 0x01, 0x00, 0x28, 0x01, 0x00, 0x00,
+ 0x0c, 0x00, 0x64, 0x01, 0xdd, 0xde, 0xdf, 0xf0,
+ 0xce, 0x41, 0xee, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xcd, 0xe9, 0xb5, 0xab, 0xea, 0x02, 0x29, 0xc5,
+ 0xb5, 0x47, 0xcf, 0xe9, 0xc3, 0x05, 0xb6, 0xcc,
+ 0xc8, 0xc5, 0xe9, 0xfa, 0x2f, 0x00, 0x00, 0x00,
+ 0xc5, 0xc8, 0x47, 0xc3, 0x06, 0xb5, 0xc3, 0x04,
+ 0xc2, 0x04, 0xc2, 0x05, 0xfa, 0x1a, 0x00, 0x00,
+ 0x00, 0xc2, 0x06, 0xc2, 0x04, 0x47, 0xc7, 0xc2,
+ 0x04, 0x47, 0xac, 0xea, 0x07, 0xc2, 0x04, 0xc3,
+ 0x05, 0xec, 0x05, 0x93, 0x04, 0xec, 0xe2, 0x93,
+ 0x03, 0xec, 0xce, 0xf6, 0xa7, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x01, 0x00, 0xcc, 0xc8, 0xc2, 0x05,
+ 0xfa, 0x0e, 0x00, 0x00, 0x00, 0xe0, 0xc7, 0xc8,
+ 0x47, 0xef, 0x0e, 0x93, 0x03, 0xec, 0xef, 0x5e,
+ 0x04, 0x00, 0x5e, 0x05, 0x00, 0xab, 0xea, 0x45,
+ 0xc5, 0xe9, 0xb6, 0xa9, 0xea, 0x3f, 0xf6, 0xef,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xc5,
+ 0xb5, 0x47, 0x47, 0xc4, 0x0c, 0xf5, 0xea, 0x1a,
+ 0xe0, 0x04, 0xf1, 0x01, 0x00, 0x00, 0xef, 0x0e,
+ 0xc2, 0x0c, 0xe9, 0xb5, 0xa9, 0xea, 0x1e, 0xe0,
+ 0x04, 0xf2, 0x01, 0x00, 0x00, 0xef, 0x0e, 0xec,
+ 0x14, 0xc2, 0x0c, 0x97, 0x04, 0x49, 0x00, 0x00,
+ 0x00, 0xa9, 0xea, 0x09, 0xe0, 0x04, 0xe3, 0x01,
+ 0x00, 0x00, 0xef, 0x0e, 0x5e, 0x04, 0x00, 0x5e,
+ 0x05, 0x00, 0xab, 0x69, 0xf3, 0x00, 0x00, 0x00,
+ 0xc5, 0xe9, 0xb7, 0xa6, 0x69, 0xea, 0x00, 0x00,
+ 0x00, 0xb5, 0xc3, 0x07, 0xb5, 0xcc, 0xc8, 0xc5,
+ 0xe9, 0xfa, 0x1d, 0x00, 0x00, 0x00, 0x5e, 0x06,
+ 0x00, 0x42, 0xf3, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0xc2, 0x07, 0xc5, 0xc8, 0x47, 0xe9, 0x24, 0x02,
+ 0x00, 0xc3, 0x07, 0x93, 0x03, 0xec, 0xe0, 0xb7,
+ 0x94, 0x07, 0x5e, 0x06, 0x00, 0x42, 0xf3, 0x01,
+ 0x00, 0x00, 0x04, 0x00, 0xb6, 0x5e, 0x06, 0x00,
+ 0x42, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x5e,
+ 0x07, 0x00, 0xb6, 0x9d, 0xc2, 0x07, 0x9b, 0x24,
+ 0x01, 0x00, 0x24, 0x02, 0x00, 0xc3, 0x09, 0x5e,
+ 0x06, 0x00, 0x42, 0xf5, 0x01, 0x00, 0x00, 0x06,
+ 0x00, 0xc5, 0xe9, 0xc2, 0x09, 0x9b, 0x24, 0x01,
+ 0x00, 0xc3, 0x0b, 0x65, 0x08, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x07, 0x00, 0x04, 0x1f, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xb5, 0xc3,
+ 0x0a, 0xc2, 0x0a, 0xc2, 0x0b, 0xfa, 0x64, 0x00,
+ 0x00, 0x00, 0xb5, 0xc3, 0x08, 0xc2, 0x08, 0xc2,
+ 0x09, 0xfa, 0x41, 0x00, 0x00, 0x00, 0xc2, 0x08,
+ 0xc2, 0x0b, 0x9a, 0xc2, 0x0a, 0x9d, 0xd0, 0xc5,
+ 0xe9, 0xa6, 0xeb, 0x30, 0xc5, 0xc8, 0x47, 0xcb,
+ 0xc2, 0x08, 0xc2, 0x09, 0xb6, 0x9e, 0xaa, 0xea,
+ 0x10, 0xf7, 0xf6, 0x01, 0x00, 0x00, 0x08, 0x00,
+ 0x02, 0x00, 0xc2, 0x07, 0x24, 0x01, 0x00, 0xcb,
+ 0x65, 0x08, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x09, 0x00, 0xc7, 0x24, 0x01, 0x00, 0x0e, 0x93,
+ 0x08, 0xec, 0xbb, 0x65, 0x08, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x1f, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x93, 0x0a,
+ 0xec, 0x98, 0x5e, 0x09, 0x00, 0xee, 0x0e, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0x96, 0x07, 0x02, 0x01,
+ 0x02, 0x02, 0x00, 0x00, 0x12, 0x00, 0xc1, 0xc9,
+ 0xd2, 0x90, 0xd6, 0xb5, 0xfc, 0x09, 0x00, 0x00,
+ 0x00, 0xd1, 0x94, 0x00, 0xec, 0xf3, 0xc5, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x07, 0x00, 0x20, 0x00, 0xc4, 0x03,
+ 0x00, 0x0c, 0xea, 0x06, 0x12, 0x01, 0x8e, 0x07,
+ 0x29, 0x01, 0xba, 0x05, 0x31, 0x01, 0x8c, 0x07,
+ 0x28, 0x01, 0xfe, 0x06, 0x1e, 0x01, 0x80, 0x07,
+ 0x1f, 0x01, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0xde, 0x24, 0x01, 0x00,
+ 0x0e, 0xe0, 0xde, 0xef, 0x5e, 0x04, 0x00, 0x9c,
+ 0xe3, 0xc1, 0x5f, 0x05, 0x00, 0xb5, 0x5f, 0x06,
+ 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e, 0x07,
+ 0x02, 0x01, 0x02, 0x06, 0x12, 0x01, 0xb8, 0x01,
+ 0x00, 0x00, 0x1c, 0x01, 0x00, 0x1d, 0x01, 0x00,
+ 0x20, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x63, 0x01,
+ 0x00, 0x12, 0x01, 0x00, 0x11, 0x01, 0x00, 0x1a,
+ 0x01, 0x00, 0x60, 0x01, 0x00, 0x13, 0x01, 0x00,
+ 0x15, 0x01, 0x00, 0x17, 0x01, 0x00, 0x04, 0x01,
+ 0x00, 0x19, 0x01, 0x00, 0x14, 0x01, 0x00, 0x64,
+ 0x01, 0x00, 0x37, 0x01, 0x00, 0x62, 0x01, 0xd1,
+ 0x11, 0xeb, 0x03, 0x0e, 0xc1, 0xe5, 0xe9, 0xe2,
+ 0xe0, 0xe9, 0xe3, 0xd2, 0x5f, 0x04, 0x00, 0x5e,
+ 0x06, 0x00, 0x5f, 0x05, 0x00, 0x5e, 0x07, 0x00,
+ 0xea, 0x22, 0x5e, 0x05, 0x00, 0x5e, 0x08, 0x00,
+ 0x04, 0xf7, 0x01, 0x00, 0x00, 0x5e, 0x09, 0x00,
+ 0x5e, 0x05, 0x00, 0xe9, 0x9e, 0xf0, 0x9d, 0x60,
+ 0x05, 0x00, 0x5e, 0x0a, 0x00, 0x9d, 0x5f, 0x05,
+ 0x00, 0xec, 0x6e, 0x5e, 0x0b, 0x00, 0xea, 0x58,
+ 0x5e, 0x0c, 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x5e, 0x0d, 0x00, 0x24, 0x01, 0x00,
+ 0x04, 0xf7, 0x01, 0x00, 0x00, 0x9d, 0xc9, 0xb5,
+ 0x5f, 0x0d, 0x00, 0x5e, 0x08, 0x00, 0xbf, 0x00,
+ 0xba, 0xc5, 0xe9, 0x9e, 0xf0, 0xc5, 0x9d, 0xc9,
+ 0x5e, 0x05, 0x00, 0xf7, 0x67, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x00, 0x00, 0xb5, 0xc5, 0xe9, 0xb9,
+ 0x9e, 0x24, 0x02, 0x00, 0x04, 0xe3, 0x01, 0x00,
+ 0x00, 0x9d, 0xf7, 0x67, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x00, 0x00, 0xc5, 0xe9, 0xb9, 0x9e, 0x24,
+ 0x01, 0x00, 0x9d, 0x9d, 0x5f, 0x05, 0x00, 0x5e,
+ 0x05, 0x00, 0xe9, 0x5f, 0x09, 0x00, 0x5e, 0x05,
+ 0x00, 0x5e, 0x0e, 0x00, 0x9d, 0x5f, 0x05, 0x00,
+ 0x5e, 0x0f, 0x00, 0xee, 0x0e, 0x5e, 0x10, 0x00,
+ 0xee, 0x0e, 0xb5, 0x5f, 0x11, 0x00, 0x29, 0x07,
+ 0x02, 0x30, 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x07,
+ 0x01, 0x01, 0x01, 0x03, 0x04, 0x02, 0x8e, 0x01,
+ 0x00, 0x00, 0x01, 0x01, 0x00, 0x62, 0x01, 0x00,
+ 0x61, 0x01, 0x00, 0x67, 0x01, 0xdd, 0x42, 0xf9,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01,
+ 0x00, 0xc9, 0xde, 0x11, 0xb5, 0xab, 0xea, 0x16,
+ 0xc5, 0x04, 0xfa, 0x01, 0x00, 0x00, 0xa9, 0xea,
+ 0x07, 0xc5, 0xe3, 0xb6, 0xe2, 0xec, 0x6c, 0xe0,
+ 0xc5, 0xef, 0x0e, 0xec, 0x66, 0x11, 0xb6, 0xab,
+ 0xea, 0x27, 0xdf, 0xc5, 0x9d, 0xe3, 0xc5, 0x04,
+ 0xfb, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x05, 0xb7,
+ 0xe2, 0xec, 0x50, 0xc5, 0x04, 0xfc, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x05, 0xb8, 0xe2, 0xec, 0x43,
+ 0xe0, 0xdf, 0xef, 0x0e, 0xb5, 0xe2, 0xec, 0x3b,
+ 0x11, 0xb7, 0xab, 0xea, 0x27, 0xdf, 0xc5, 0x9d,
+ 0xe3, 0xc5, 0x04, 0xfd, 0x01, 0x00, 0x00, 0xa9,
+ 0x11, 0xeb, 0x0e, 0x0e, 0xc5, 0xbf, 0x00, 0xa6,
+ 0x11, 0xea, 0x06, 0x0e, 0xc5, 0xbf, 0x01, 0xa4,
+ 0x96, 0xea, 0x18, 0xe0, 0xdf, 0xef, 0x0e, 0xb5,
+ 0xe2, 0xec, 0x10, 0x11, 0xb8, 0xab, 0xea, 0x0b,
+ 0xdf, 0xc5, 0x9d, 0xe3, 0xe0, 0xdf, 0xef, 0x0e,
+ 0xb5, 0xe2, 0x29, 0x07, 0x02, 0x30, 0x07, 0x02,
+ 0x39, 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x07, 0x01,
+ 0x01, 0x01, 0x05, 0x0d, 0x00, 0xbb, 0x01, 0x00,
+ 0x00, 0x23, 0x01, 0x00, 0x31, 0x01, 0x00, 0x38,
+ 0x01, 0x00, 0x5f, 0x01, 0x00, 0x21, 0x01, 0x00,
+ 0x63, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x01, 0x0c,
+ 0x00, 0x26, 0x01, 0x00, 0x22, 0x01, 0x00, 0x3b,
+ 0x01, 0x00, 0x1d, 0x01, 0x00, 0x37, 0x01, 0xdd,
+ 0xea, 0x11, 0xde, 0xd1, 0xef, 0xb6, 0xab, 0xea,
+ 0x05, 0xdf, 0xd1, 0xef, 0x0e, 0x09, 0xe1, 0xed,
+ 0x81, 0x00, 0xe0, 0xd1, 0x47, 0xcd, 0xea, 0x5b,
+ 0xc5, 0x5f, 0x04, 0x00, 0xc5, 0xd1, 0xef, 0x11,
+ 0xb4, 0xab, 0xea, 0x09, 0x5e, 0x05, 0x00, 0x5e,
+ 0x06, 0x00, 0xef, 0x29, 0x11, 0xbd, 0xfe, 0xab,
+ 0xea, 0x07, 0x5e, 0x05, 0x00, 0x07, 0xef, 0x29,
+ 0x11, 0xbd, 0xfd, 0xab, 0xea, 0x2c, 0x65, 0x07,
+ 0x00, 0x42, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0x65, 0x07, 0x00, 0x41, 0x4d, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x07, 0x24, 0x02, 0x00, 0x0e, 0x65,
+ 0x07, 0x00, 0x42, 0x4e, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x5e, 0x08, 0x00, 0x07, 0x24, 0x02, 0x00,
+ 0x29, 0x0e, 0x5e, 0x04, 0x00, 0x5f, 0x09, 0x00,
+ 0xec, 0x20, 0xde, 0xd1, 0xef, 0xb6, 0xab, 0xea,
+ 0x14, 0xd1, 0x04, 0xf7, 0x01, 0x00, 0x00, 0xa6,
+ 0xea, 0x0b, 0xdf, 0xd1, 0xef, 0x0e, 0xdf, 0x5f,
+ 0x09, 0x00, 0xec, 0x06, 0x5e, 0x0a, 0x00, 0xee,
+ 0x0e, 0x5e, 0x0b, 0x00, 0xb5, 0xfa, 0x07, 0x00,
+ 0x00, 0x00, 0xb5, 0xec, 0x16, 0x5e, 0x0b, 0x00,
+ 0x5e, 0x06, 0x00, 0xe9, 0xfc, 0x0a, 0x00, 0x00,
+ 0x00, 0x5e, 0x06, 0x00, 0xe9, 0xec, 0x04, 0x5e,
+ 0x0b, 0x00, 0x5f, 0x0b, 0x00, 0x5e, 0x0c, 0x00,
+ 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa8, 0x07,
+ 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x7c, 0x00,
+ 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0xdd, 0xd1,
+ 0xef, 0x96, 0xea, 0x0c, 0xd1, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd1,
+ 0xb5, 0xa9, 0xea, 0x17, 0xb6, 0xd1, 0x9b, 0xb5,
+ 0xfa, 0x0c, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x01,
+ 0x00, 0x00, 0xc9, 0xec, 0x54, 0xbf, 0x00, 0xc9,
+ 0xec, 0x4f, 0xd2, 0xbd, 0x10, 0xa9, 0xea, 0x3d,
+ 0xd1, 0xde, 0x42, 0xf4, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xd1, 0x24, 0x01, 0x00, 0xab, 0xea, 0x2d,
+ 0xd1, 0xb5, 0xfa, 0x0f, 0x00, 0x00, 0x00, 0xd1,
+ 0x8c, 0xd5, 0x04, 0xff, 0x01, 0x00, 0x00, 0xc9,
+ 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x00, 0x02,
+ 0x00, 0x00, 0xd1, 0x42, 0x37, 0x00, 0x00, 0x00,
+ 0x02, 0x00, 0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d,
+ 0x9d, 0xc9, 0xec, 0x0d, 0xd1, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00, 0xc9,
+ 0xc5, 0x28, 0x07, 0x02, 0x30, 0x0e, 0x43, 0x02,
+ 0x03, 0xaa, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01,
+ 0x01, 0x97, 0x02, 0x00, 0x00, 0x69, 0x01, 0x38,
+ 0xb3, 0x00, 0x00, 0x00, 0x42, 0xe4, 0x00, 0x00,
+ 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x96,
+ 0xea, 0x2d, 0xdd, 0x04, 0x01, 0x02, 0x00, 0x00,
+ 0xac, 0xea, 0x19, 0x04, 0x02, 0x02, 0x00, 0x00,
+ 0xd1, 0x42, 0x37, 0x00, 0x00, 0x00, 0x01, 0x00,
+ 0x24, 0x00, 0x00, 0x9d, 0x04, 0xf2, 0x01, 0x00,
+ 0x00, 0x9d, 0x28, 0xd1, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0xd1, 0xb5,
+ 0xa9, 0xea, 0x17, 0xb6, 0xd1, 0x9b, 0xb5, 0xfa,
+ 0x0c, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x01, 0x00,
+ 0x00, 0xc9, 0xec, 0x44, 0xbf, 0x00, 0xc9, 0xec,
+ 0x3f, 0xd2, 0xbd, 0x10, 0xa9, 0xea, 0x2d, 0xd1,
+ 0xb5, 0xfa, 0x0f, 0x00, 0x00, 0x00, 0xd1, 0x8c,
+ 0xd5, 0x04, 0xff, 0x01, 0x00, 0x00, 0xc9, 0xec,
+ 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x00, 0x02, 0x00,
+ 0x00, 0xd1, 0x42, 0x37, 0x00, 0x00, 0x00, 0x03,
+ 0x00, 0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d, 0x9d,
+ 0xc9, 0xec, 0x0d, 0xd1, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0xc9, 0xd1,
+ 0x97, 0x04, 0x8c, 0x00, 0x00, 0x00, 0xab, 0xea,
+ 0x13, 0xdd, 0x04, 0x01, 0x02, 0x00, 0x00, 0xac,
+ 0xea, 0x0a, 0x04, 0x03, 0x02, 0x00, 0x00, 0x94,
+ 0x00, 0xec, 0x62, 0xdd, 0x04, 0xe2, 0x00, 0x00,
+ 0x00, 0xac, 0xea, 0x59, 0xf7, 0xe2, 0x01, 0x00,
+ 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0xe3, 0x01,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xb5, 0xfa, 0x45,
+ 0x00, 0x00, 0x00, 0xd2, 0xbd, 0x10, 0xa9, 0x11,
+ 0xea, 0x15, 0x0e, 0xf7, 0xe2, 0x01, 0x00, 0x00,
+ 0x06, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0xb5, 0xa3, 0x11, 0xeb,
+ 0x1b, 0x0e, 0xd2, 0xbd, 0x0a, 0xa9, 0xea, 0x1d,
+ 0xf7, 0xe2, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00,
+ 0x00, 0x04, 0x05, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xb5, 0xa3, 0xea, 0x08, 0x04, 0x06, 0x02,
+ 0x00, 0x00, 0x94, 0x00, 0xc5, 0x28, 0x07, 0x02,
+ 0x30, 0x0e, 0x43, 0x02, 0x03, 0xac, 0x07, 0x02,
+ 0x01, 0x02, 0x05, 0x01, 0x00, 0x50, 0x00, 0x00,
+ 0x69, 0x01, 0xd2, 0xbd, 0x10, 0xa9, 0xea, 0x2d,
+ 0xd1, 0xb5, 0xfa, 0x0f, 0x00, 0x00, 0x00, 0xd1,
+ 0x8c, 0xd5, 0x04, 0xff, 0x01, 0x00, 0x00, 0xc9,
+ 0xec, 0x03, 0xc1, 0xc9, 0xc5, 0x04, 0x00, 0x02,
+ 0x00, 0x00, 0xd1, 0x42, 0x37, 0x00, 0x00, 0x00,
+ 0x00, 0x00, 0xbd, 0x10, 0x24, 0x01, 0x00, 0x9d,
+ 0x9d, 0xc9, 0xec, 0x0d, 0xd1, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0xc9,
+ 0xdd, 0x04, 0xe2, 0x00, 0x00, 0x00, 0xab, 0xea,
+ 0x08, 0x04, 0x07, 0x02, 0x00, 0x00, 0x94, 0x00,
+ 0xc5, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xae, 0x07,
+ 0x01, 0x02, 0x01, 0x02, 0x09, 0x01, 0x0b, 0x00,
+ 0x00, 0x00, 0x0c, 0x00, 0x08, 0x01, 0x00, 0x02,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x6a, 0x01, 0x00,
+ 0x68, 0x01, 0x00, 0x6c, 0x01, 0x00, 0x6b, 0x01,
+ 0x00, 0x01, 0x01, 0xc0, 0x00, 0xca, 0x26, 0x00,
+ 0x00, 0xc9, 0xc6, 0xd1, 0xef, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0x90, 0x08, 0x01, 0x06, 0x01, 0x05,
+ 0x0b, 0x00, 0xe1, 0x06, 0x00, 0x00, 0x00, 0x0c,
+ 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00,
+ 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00,
+ 0x00, 0x07, 0x00, 0x00, 0x08, 0x00, 0xd1, 0x97,
+ 0xc4, 0x04, 0x04, 0x49, 0x00, 0x00, 0x00, 0xab,
+ 0x69, 0x0f, 0x02, 0x00, 0x00, 0xd1, 0xf3, 0xea,
+ 0x11, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0xde, 0x42, 0xe2, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0xd1, 0x24, 0x01, 0x00, 0xb5, 0xfd, 0x18,
+ 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x02, 0x00, 0x04, 0x09, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xdf,
+ 0xea, 0x66, 0xd1, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xa7, 0x11, 0xeb, 0x40, 0x0e, 0xd1, 0x38, 0x0a,
+ 0x02, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x35, 0x0e,
+ 0xd1, 0x38, 0x0b, 0x02, 0x00, 0x00, 0xa7, 0x11,
+ 0xeb, 0x2a, 0x0e, 0xd1, 0x38, 0x0c, 0x02, 0x00,
+ 0x00, 0xa7, 0x11, 0xeb, 0x1f, 0x0e, 0xd1, 0x38,
+ 0x0d, 0x02, 0x00, 0x00, 0xa7, 0x11, 0xeb, 0x14,
+ 0x0e, 0xd1, 0x38, 0x0e, 0x02, 0x00, 0x00, 0xa7,
+ 0x11, 0xeb, 0x09, 0x0e, 0xd1, 0x38, 0x0f, 0x02,
+ 0x00, 0x00, 0xa7, 0xea, 0x1b, 0x65, 0x00, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x03, 0x00, 0xd1,
+ 0x42, 0x37, 0x00, 0x00, 0x00, 0x04, 0x00, 0x24,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xde,
+ 0x42, 0x85, 0x01, 0x00, 0x00, 0x05, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0x0e, 0xe0, 0x42, 0x10, 0x02,
+ 0x00, 0x00, 0x06, 0x00, 0xd1, 0x24, 0x01, 0x00,
+ 0x69, 0x94, 0x00, 0x00, 0x00, 0xd1, 0xe9, 0xc9,
+ 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x07, 0x00, 0x04, 0x11, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xb5, 0xca, 0xc6, 0xc5, 0xfa,
+ 0x5f, 0x00, 0x00, 0x00, 0xc6, 0xb5, 0xac, 0xea,
+ 0x14, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x08, 0x00, 0x04, 0x12, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xc6, 0xd1, 0xa8, 0xea,
+ 0x0b, 0x5e, 0x04, 0x00, 0xd1, 0xc6, 0x47, 0xef,
+ 0x0e, 0xec, 0x14, 0x65, 0x00, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x09, 0x00, 0x04, 0x13, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xc6, 0xbd,
+ 0x14, 0xfc, 0x19, 0x00, 0x00, 0x00, 0x65, 0x00,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x0a, 0x00,
+ 0x04, 0x14, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xec, 0x05, 0x93, 0x01, 0xec, 0x9f, 0x65,
+ 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x0b,
+ 0x00, 0x04, 0x15, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xed, 0xaf, 0x00, 0x5e, 0x05, 0x00,
+ 0x42, 0x16, 0x02, 0x00, 0x00, 0x0c, 0x00, 0xd1,
+ 0x24, 0x01, 0x00, 0x04, 0xa3, 0x00, 0x00, 0x00,
+ 0xab, 0xea, 0x1c, 0x65, 0x00, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x0d, 0x00, 0xd1, 0x42, 0x37,
+ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x24, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xec, 0x7d, 0x5e, 0x05,
+ 0x00, 0x42, 0x17, 0x02, 0x00, 0x00, 0x0f, 0x00,
+ 0xd1, 0x24, 0x01, 0x00, 0xcf, 0xe9, 0xc9, 0x65,
+ 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x10,
+ 0x00, 0x04, 0x18, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xb5, 0xca, 0xc6, 0xc5, 0xfa, 0x40,
+ 0x00, 0x00, 0x00, 0xc6, 0xb5, 0xac, 0xea, 0x14,
+ 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x11, 0x00, 0x04, 0x12, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xc7, 0xc6, 0x47, 0xcc, 0x65,
+ 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x12,
+ 0x00, 0xc8, 0x04, 0x19, 0x02, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x5e, 0x04, 0x00, 0xd1, 0xc8,
+ 0x47, 0xef, 0x0e, 0x93, 0x01, 0xec, 0xbe, 0x65,
+ 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x13,
+ 0x00, 0x04, 0x1a, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xde, 0x42, 0x1b, 0x02, 0x00, 0x00,
+ 0x14, 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc2, 0x04, 0x04, 0x48, 0x00, 0x00, 0x00, 0xab,
+ 0xea, 0x3e, 0xd1, 0x42, 0x1c, 0x02, 0x00, 0x00,
+ 0x15, 0x00, 0x24, 0x00, 0x00, 0xc4, 0x05, 0xe9,
+ 0xbd, 0x4f, 0xfc, 0x1b, 0x00, 0x00, 0x00, 0xf7,
+ 0x67, 0x01, 0x00, 0x00, 0x16, 0x00, 0x05, 0x00,
+ 0xb5, 0xbd, 0x4b, 0x24, 0x02, 0x00, 0x04, 0x1d,
+ 0x02, 0x00, 0x00, 0x9d, 0xc3, 0x05, 0x65, 0x00,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x17, 0x00,
+ 0xc2, 0x05, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc2,
+ 0x04, 0x04, 0x46, 0x00, 0x00, 0x00, 0xab, 0xea,
+ 0x20, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x18, 0x00, 0x5e, 0x06, 0x00, 0xd1, 0x5e,
+ 0x07, 0x00, 0xea, 0x05, 0xbd, 0x10, 0xec, 0x03,
+ 0xbd, 0x0a, 0xf0, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc2, 0x04, 0x04, 0x8b, 0x00, 0x00, 0x00, 0xab,
+ 0xea, 0x20, 0x65, 0x00, 0x00, 0x42, 0x66, 0x01,
+ 0x00, 0x00, 0x19, 0x00, 0x5e, 0x08, 0x00, 0xd1,
+ 0x5e, 0x07, 0x00, 0xea, 0x05, 0xbd, 0x10, 0xec,
+ 0x03, 0xbd, 0x0a, 0xf0, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0xc2, 0x04, 0x04, 0x8c, 0x00, 0x00, 0x00,
+ 0xab, 0xea, 0x20, 0x65, 0x00, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x1a, 0x00, 0x5e, 0x09, 0x00,
+ 0xd1, 0x5e, 0x07, 0x00, 0xea, 0x05, 0xbd, 0x10,
+ 0xec, 0x03, 0xbd, 0x0a, 0xf0, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xc2, 0x04, 0x04, 0x8d, 0x00, 0x00,
+ 0x00, 0xab, 0xea, 0x21, 0x65, 0x00, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x1b, 0x00, 0xd1, 0x42,
+ 0x37, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x24, 0x00,
+ 0x00, 0x04, 0x1e, 0x02, 0x00, 0x00, 0x9d, 0x24,
+ 0x01, 0x00, 0x0e, 0x29, 0xc2, 0x04, 0x04, 0x4a,
+ 0x00, 0x00, 0x00, 0xab, 0xea, 0x15, 0x65, 0x00,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x1d, 0x00,
+ 0x5e, 0x0a, 0x00, 0xd1, 0xef, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xc2, 0x04, 0x04, 0x1b, 0x00, 0x00,
+ 0x00, 0xab, 0xea, 0x24, 0x65, 0x00, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x1f,
+ 0x02, 0x00, 0x00, 0xd1, 0x41, 0x36, 0x00, 0x00,
+ 0x00, 0x1f, 0x00, 0x9d, 0x04, 0x62, 0x01, 0x00,
+ 0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x65,
+ 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x20,
+ 0x00, 0xd1, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xb0, 0x07, 0x01, 0x01, 0x01,
+ 0x04, 0x01, 0x00, 0x30, 0x00, 0x00, 0x2e, 0x01,
+ 0xd1, 0xb5, 0x47, 0x04, 0x20, 0x02, 0x00, 0x00,
+ 0xac, 0xea, 0x03, 0xc1, 0x28, 0xb6, 0xc9, 0xc5,
+ 0xd1, 0xe9, 0xfa, 0x10, 0x00, 0x00, 0x00, 0xdd,
+ 0xd1, 0xc5, 0x47, 0xef, 0x96, 0xeb, 0x05, 0x93,
+ 0x00, 0xec, 0xed, 0xd1, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0xb6, 0xc5, 0x25, 0x02, 0x00,
+ 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x07, 0x02, 0x04,
+ 0x02, 0x07, 0x0c, 0x00, 0xfc, 0x07, 0x00, 0x00,
+ 0x70, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x68, 0x01,
+ 0x00, 0x17, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0e,
+ 0x01, 0x00, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00,
+ 0x0f, 0x01, 0x00, 0x06, 0x01, 0x00, 0x69, 0x01,
+ 0x00, 0x08, 0x01, 0xd1, 0x04, 0x21, 0x02, 0x00,
+ 0x00, 0xab, 0x11, 0xeb, 0x14, 0x0e, 0xd1, 0x04,
+ 0x22, 0x02, 0x00, 0x00, 0xab, 0x11, 0xeb, 0x09,
+ 0x0e, 0xd1, 0x04, 0xda, 0x01, 0x00, 0x00, 0xa9,
+ 0xea, 0x07, 0xdd, 0xee, 0x0e, 0xed, 0xd7, 0x03,
+ 0xd1, 0x04, 0x23, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x58, 0xd2, 0x42, 0x67, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0xd1, 0xe9, 0xb6, 0x9d, 0x24, 0x01, 0x00,
+ 0x42, 0x24, 0x02, 0x00, 0x00, 0x01, 0x00, 0x24,
+ 0x00, 0x00, 0xd0, 0x42, 0x25, 0x02, 0x00, 0x00,
+ 0x02, 0x00, 0x04, 0xe3, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xf7, 0x25, 0x02, 0x00, 0x00, 0x03,
+ 0x00, 0x03, 0x00, 0x04, 0xe8, 0x01, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xfb, 0x0b, 0x00, 0x00, 0x00,
+ 0x04, 0x26, 0x02, 0x00, 0x00, 0x94, 0x03, 0x65,
+ 0x01, 0x00, 0x42, 0x27, 0x02, 0x00, 0x00, 0x04,
+ 0x00, 0xc8, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28,
+ 0xd1, 0x04, 0x28, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x06, 0x0a, 0xe3, 0xed, 0x69, 0x03, 0xd1, 0x04,
+ 0x29, 0x02, 0x00, 0x00, 0xab, 0xea, 0x06, 0x09,
+ 0xe3, 0xed, 0x5b, 0x03, 0xd1, 0x04, 0x2a, 0x02,
+ 0x00, 0x00, 0xab, 0xea, 0x07, 0xe0, 0x96, 0xe4,
+ 0xed, 0x4c, 0x03, 0x5e, 0x04, 0x00, 0x69, 0xb4,
+ 0x01, 0x00, 0x00, 0xd1, 0x04, 0x04, 0x02, 0x00,
+ 0x00, 0xab, 0x69, 0xa8, 0x01, 0x00, 0x00, 0xd2,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x05, 0x00, 0xd1,
+ 0xe9, 0xb6, 0x9d, 0x24, 0x01, 0x00, 0x42, 0x24,
+ 0x02, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00,
+ 0x42, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04,
+ 0xf7, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0xcd,
+ 0xe9, 0xb6, 0xab, 0xea, 0x4d, 0xc5, 0xb5, 0x47,
+ 0xc1, 0xab, 0xea, 0x46, 0x65, 0x01, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x08, 0x00, 0x04, 0x2b,
+ 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9d, 0x04,
+ 0x2c, 0x02, 0x00, 0x00, 0x9d, 0x5e, 0x06, 0x00,
+ 0x42, 0xf4, 0x01, 0x00, 0x00, 0x09, 0x00, 0x5e,
+ 0x05, 0x00, 0x5e, 0x07, 0x00, 0x9b, 0x24, 0x01,
+ 0x00, 0x9d, 0x04, 0x2d, 0x02, 0x00, 0x00, 0x9d,
+ 0x5e, 0x08, 0x00, 0x9d, 0x04, 0x2e, 0x02, 0x00,
+ 0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e, 0xed, 0x2a,
+ 0x01, 0xc5, 0xb5, 0x47, 0x04, 0x2f, 0x02, 0x00,
+ 0x00, 0xab, 0xea, 0x0d, 0xbd, 0x0b, 0x5f, 0x05,
+ 0x00, 0xba, 0x5f, 0x08, 0x00, 0xed, 0x13, 0x01,
+ 0xc5, 0xb5, 0x47, 0x04, 0x30, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x0e, 0xbd, 0x18, 0x5f, 0x05, 0x00,
+ 0xbd, 0x08, 0x5f, 0x08, 0x00, 0xed, 0xfb, 0x00,
+ 0xc5, 0xb5, 0x47, 0x04, 0x31, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x0e, 0xbd, 0x35, 0x5f, 0x05, 0x00,
+ 0xbd, 0x0b, 0x5f, 0x08, 0x00, 0xed, 0xe3, 0x00,
+ 0xc5, 0xb5, 0x47, 0x04, 0x32, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x0e, 0xbd, 0x71, 0x5f, 0x05, 0x00,
+ 0xbd, 0x0f, 0x5f, 0x08, 0x00, 0xed, 0xcb, 0x00,
+ 0x38, 0x33, 0x02, 0x00, 0x00, 0xc5, 0xb5, 0x47,
+ 0xef, 0xca, 0xc5, 0xe9, 0xb7, 0xfd, 0x10, 0x00,
+ 0x00, 0x00, 0x38, 0x33, 0x02, 0x00, 0x00, 0xc5,
+ 0xb6, 0x47, 0xef, 0xcb, 0xec, 0x0e, 0x38, 0xb4,
+ 0x00, 0x00, 0x00, 0x41, 0x34, 0x02, 0x00, 0x00,
+ 0x0a, 0x00, 0xcb, 0x38, 0x98, 0x00, 0x00, 0x00,
+ 0x42, 0xea, 0x01, 0x00, 0x00, 0x0b, 0x00, 0xc6,
+ 0x24, 0x01, 0x00, 0x11, 0xeb, 0x22, 0x0e, 0xc6,
+ 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41, 0x35, 0x02,
+ 0x00, 0x00, 0x0c, 0x00, 0xa3, 0x11, 0xeb, 0x10,
+ 0x0e, 0xc6, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x41,
+ 0x36, 0x02, 0x00, 0x00, 0x0d, 0x00, 0xa5, 0xea,
+ 0x16, 0x65, 0x01, 0x00, 0x42, 0x66, 0x01, 0x00,
+ 0x00, 0x0e, 0x00, 0x04, 0x37, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28, 0x38, 0x98,
+ 0x00, 0x00, 0x00, 0x42, 0xea, 0x01, 0x00, 0x00,
+ 0x0f, 0x00, 0xc7, 0x24, 0x01, 0x00, 0x11, 0xeb,
+ 0x22, 0x0e, 0xc7, 0x38, 0xb4, 0x00, 0x00, 0x00,
+ 0x41, 0x38, 0x02, 0x00, 0x00, 0x10, 0x00, 0xa3,
+ 0x11, 0xeb, 0x10, 0x0e, 0xc7, 0x38, 0xb4, 0x00,
+ 0x00, 0x00, 0x41, 0x34, 0x02, 0x00, 0x00, 0x11,
+ 0x00, 0xa5, 0xea, 0x16, 0x65, 0x01, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x12, 0x00, 0x04, 0x39,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0x28, 0xc6, 0x5f, 0x05, 0x00, 0xc7, 0x5f, 0x08,
+ 0x00, 0x09, 0x28, 0x5e, 0x04, 0x00, 0x69, 0x89,
+ 0x00, 0x00, 0x00, 0xd1, 0x04, 0x3a, 0x02, 0x00,
+ 0x00, 0xab, 0xea, 0x7d, 0xd2, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x13, 0x00, 0xd1, 0xe9, 0xb6, 0x9d,
+ 0x24, 0x01, 0x00, 0x42, 0x24, 0x02, 0x00, 0x00,
+ 0x14, 0x00, 0x24, 0x00, 0x00, 0xc9, 0x5e, 0x06,
+ 0x00, 0x42, 0xf5, 0x01, 0x00, 0x00, 0x15, 0x00,
+ 0x5e, 0x09, 0x00, 0xc5, 0xef, 0x5e, 0x07, 0x00,
+ 0x9a, 0x24, 0x01, 0x00, 0xce, 0x38, 0xb4, 0x00,
+ 0x00, 0x00, 0x41, 0x35, 0x02, 0x00, 0x00, 0x16,
+ 0x00, 0xa3, 0x11, 0xeb, 0x10, 0x0e, 0xc6, 0x38,
+ 0xb4, 0x00, 0x00, 0x00, 0x41, 0x36, 0x02, 0x00,
+ 0x00, 0x17, 0x00, 0xa5, 0xea, 0x16, 0x65, 0x01,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x18, 0x00,
+ 0x04, 0x37, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x09, 0x28, 0xc6, 0x5f, 0x05, 0x00, 0x38,
+ 0xb4, 0x00, 0x00, 0x00, 0x41, 0x34, 0x02, 0x00,
+ 0x00, 0x19, 0x00, 0x5f, 0x08, 0x00, 0x09, 0x28,
+ 0x5e, 0x04, 0x00, 0xea, 0x76, 0xd1, 0x04, 0x3b,
+ 0x02, 0x00, 0x00, 0xab, 0xea, 0x6d, 0xd2, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x1a, 0x00, 0xd1, 0xe9,
+ 0xb6, 0x9d, 0x24, 0x01, 0x00, 0x42, 0x24, 0x02,
+ 0x00, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x00, 0xcd,
+ 0xc1, 0xab, 0xea, 0x20, 0x65, 0x01, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x3c,
+ 0x02, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0x9d, 0x04,
+ 0x1f, 0x01, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
+ 0x0e, 0xec, 0x2e, 0xc5, 0x04, 0xe2, 0x00, 0x00,
+ 0x00, 0xab, 0x11, 0xeb, 0x09, 0x0e, 0xc5, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xab, 0xea, 0x07, 0xc5,
+ 0x5f, 0x0a, 0x00, 0xec, 0x14, 0x65, 0x01, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x04,
+ 0x3d, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x09, 0x28, 0xd1, 0x04, 0x3e, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x16, 0x65, 0x01, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x1e, 0x00, 0x04, 0x3f, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x6e,
+ 0xd1, 0x04, 0x40, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x12, 0x65, 0x01, 0x00, 0x42, 0xa1, 0x01, 0x00,
+ 0x00, 0x1f, 0x00, 0xb5, 0x24, 0x01, 0x00, 0x0e,
+ 0xec, 0x54, 0x5e, 0x0b, 0x00, 0xea, 0x17, 0xd1,
+ 0x04, 0x57, 0x01, 0x00, 0x00, 0xab, 0xea, 0x0e,
+ 0x36, 0x41, 0x02, 0x00, 0x00, 0x0a, 0x3b, 0x41,
+ 0x02, 0x00, 0x00, 0xec, 0x39, 0x5e, 0x0b, 0x00,
+ 0xea, 0x17, 0xd1, 0x04, 0x07, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x0e, 0x36, 0x41, 0x02, 0x00, 0x00,
+ 0x09, 0x3b, 0x41, 0x02, 0x00, 0x00, 0xec, 0x1e,
+ 0x65, 0x01, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x20, 0x00, 0x04, 0x42, 0x02, 0x00, 0x00, 0xd1,
+ 0x9d, 0x04, 0x1f, 0x01, 0x00, 0x00, 0x9d, 0x24,
+ 0x01, 0x00, 0x0e, 0x09, 0x28, 0x0a, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0x00, 0x01, 0x00, 0x01, 0x03,
+ 0x01, 0x00, 0x46, 0x00, 0x00, 0x68, 0x01, 0xd1,
+ 0x11, 0x04, 0x43, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x05, 0x09, 0xe1, 0xec, 0x38, 0x11, 0x04, 0x44,
+ 0x02, 0x00, 0x00, 0xab, 0xea, 0x05, 0x0a, 0xe1,
+ 0xec, 0x2b, 0x11, 0x04, 0x45, 0x02, 0x00, 0x00,
+ 0xab, 0xea, 0x0e, 0x36, 0x41, 0x02, 0x00, 0x00,
+ 0x09, 0x3b, 0x41, 0x02, 0x00, 0x00, 0xec, 0x15,
+ 0x11, 0x04, 0x46, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x0c, 0x36, 0x41, 0x02, 0x00, 0x00, 0x0a, 0x3b,
+ 0x41, 0x02, 0x00, 0x00, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xb4, 0x07, 0x00, 0x01, 0x00, 0x05, 0x07,
+ 0x01, 0xd3, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00,
+ 0x68, 0x01, 0x00, 0x17, 0x01, 0x00, 0x08, 0x01,
+ 0x00, 0x09, 0x01, 0x00, 0x69, 0x01, 0x00, 0x07,
+ 0x01, 0xc0, 0x00, 0xc9, 0x65, 0x00, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x47,
+ 0x02, 0x00, 0x00, 0xc5, 0xde, 0xef, 0x9d, 0x04,
+ 0x48, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x49, 0x02,
+ 0x00, 0x00, 0x9d, 0xc5, 0xde, 0x96, 0xef, 0x9d,
+ 0x04, 0x4a, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4b,
+ 0x02, 0x00, 0x00, 0x9d, 0xc5, 0xdf, 0xef, 0x9d,
+ 0x04, 0x4c, 0x02, 0x00, 0x00, 0x9d, 0x04, 0x4d,
+ 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00, 0x0e,
+ 0xe0, 0xea, 0x37, 0x65, 0x00, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x4e, 0x02,
+ 0x00, 0x00, 0xc5, 0x38, 0x41, 0x02, 0x00, 0x00,
+ 0xef, 0x9d, 0x04, 0x4f, 0x02, 0x00, 0x00, 0x9d,
+ 0x04, 0x50, 0x02, 0x00, 0x00, 0x9d, 0xc5, 0x38,
+ 0x41, 0x02, 0x00, 0x00, 0x96, 0xef, 0x9d, 0x04,
+ 0x51, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01, 0x00,
+ 0x0e, 0x5e, 0x04, 0x00, 0xea, 0x35, 0x65, 0x00,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x02, 0x00,
+ 0x04, 0x52, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xe0, 0x96, 0xea, 0x1e, 0x65, 0x00, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x03, 0x00, 0x04,
+ 0x53, 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0x9d,
+ 0x04, 0x54, 0x02, 0x00, 0x00, 0x9d, 0x24, 0x01,
+ 0x00, 0x0e, 0x5e, 0x06, 0x00, 0x96, 0xea, 0x14,
+ 0x65, 0x00, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x04, 0x00, 0x04, 0x55, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xac, 0x09, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+ 0x0f, 0x00, 0xd1, 0xea, 0x07, 0x04, 0x7d, 0x00,
+ 0x00, 0x00, 0x28, 0x04, 0xf7, 0x01, 0x00, 0x00,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xb6, 0x07, 0x01,
+ 0x03, 0x01, 0x06, 0x08, 0x00, 0xc7, 0x02, 0x00,
+ 0x00, 0x69, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00,
+ 0x0c, 0x00, 0x19, 0x01, 0x00, 0x0a, 0x01, 0x00,
+ 0x0b, 0x01, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x03,
+ 0x6c, 0xa7, 0x00, 0x00, 0x00, 0xdd, 0x04, 0x01,
+ 0x02, 0x00, 0x00, 0xab, 0xea, 0x09, 0x04, 0x57,
+ 0x02, 0x00, 0x00, 0xd1, 0x9d, 0xd5, 0xde, 0x11,
+ 0x21, 0x00, 0x00, 0x42, 0x58, 0x02, 0x00, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xca, 0x65, 0x02,
+ 0x00, 0x42, 0x59, 0x02, 0x00, 0x00, 0x01, 0x00,
+ 0xd1, 0x0b, 0x0a, 0x4c, 0x5a, 0x02, 0x00, 0x00,
+ 0x24, 0x02, 0x00, 0xc9, 0xde, 0x11, 0x21, 0x00,
+ 0x00, 0x42, 0x58, 0x02, 0x00, 0x00, 0x02, 0x00,
+ 0x24, 0x00, 0x00, 0xc6, 0x9e, 0xe4, 0x65, 0x02,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x03, 0x00,
+ 0x5e, 0x04, 0x00, 0x5e, 0x05, 0x00, 0x41, 0x11,
+ 0x01, 0x00, 0x00, 0x04, 0x00, 0x47, 0x24, 0x01,
+ 0x00, 0x0e, 0x5e, 0x06, 0x00, 0xc5, 0xef, 0x0e,
+ 0x65, 0x02, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x05, 0x00, 0x04, 0x1f, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x65, 0x02, 0x00, 0x42, 0x66,
+ 0x01, 0x00, 0x00, 0x06, 0x00, 0x5e, 0x04, 0x00,
+ 0x41, 0xe9, 0x00, 0x00, 0x00, 0x07, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x5e, 0x07, 0x00, 0xc5, 0x43,
+ 0x5b, 0x01, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x29,
+ 0xcb, 0x6c, 0x9c, 0x00, 0x00, 0x00, 0x65, 0x02,
+ 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x09, 0x00,
+ 0x5e, 0x04, 0x00, 0x5e, 0x05, 0x00, 0x41, 0x12,
+ 0x01, 0x00, 0x00, 0x0a, 0x00, 0x47, 0x24, 0x01,
+ 0x00, 0x0e, 0xc7, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0xa7, 0xea, 0x36, 0x38, 0x5b, 0x02, 0x00, 0x00,
+ 0x42, 0x5c, 0x02, 0x00, 0x00, 0x0b, 0x00, 0xc7,
+ 0x24, 0x01, 0x00, 0x0e, 0xf6, 0x35, 0x00, 0x00,
+ 0x00, 0x0c, 0x00, 0x02, 0x00, 0xea, 0x3e, 0x65,
+ 0x02, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00, 0x0d,
+ 0x00, 0xf6, 0x35, 0x00, 0x00, 0x00, 0x0e, 0x00,
+ 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xec, 0x25,
+ 0x65, 0x02, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x0f, 0x00, 0x04, 0x5d, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0x38, 0x5b, 0x02, 0x00, 0x00,
+ 0x42, 0x5c, 0x02, 0x00, 0x00, 0x10, 0x00, 0xc7,
+ 0x24, 0x01, 0x00, 0x0e, 0x65, 0x02, 0x00, 0x42,
+ 0x66, 0x01, 0x00, 0x00, 0x11, 0x00, 0x5e, 0x04,
+ 0x00, 0x41, 0xe9, 0x00, 0x00, 0x00, 0x12, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x0e, 0x29, 0x2f, 0x0e,
+ 0x43, 0x02, 0x03, 0xb8, 0x07, 0x00, 0x00, 0x00,
+ 0x04, 0x0b, 0x00, 0x78, 0x00, 0xd8, 0x06, 0x07,
+ 0x01, 0xda, 0x06, 0x08, 0x01, 0xc4, 0x03, 0x00,
+ 0x0c, 0xdc, 0x06, 0x09, 0x01, 0xe6, 0x06, 0x10,
+ 0x01, 0xba, 0x02, 0x04, 0x01, 0xe2, 0x06, 0x0e,
+ 0x01, 0xe4, 0x06, 0x0f, 0x01, 0xa6, 0x07, 0x69,
+ 0x01, 0xd6, 0x06, 0x00, 0x03, 0xba, 0x07, 0x73,
+ 0x01, 0xdd, 0x96, 0xea, 0x2c, 0xde, 0xea, 0x16,
+ 0x65, 0x02, 0x00, 0x42, 0x66, 0x01, 0x00, 0x00,
+ 0x00, 0x00, 0x04, 0x5e, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xec, 0x14, 0x65, 0x02, 0x00,
+ 0x42, 0x66, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04,
+ 0x5f, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xe0, 0xea, 0x42, 0x5e, 0x05, 0x00, 0x42, 0x5c,
+ 0x02, 0x00, 0x00, 0x02, 0x00, 0xbd, 0x0a, 0x24,
+ 0x01, 0x00, 0x5e, 0x05, 0x00, 0x42, 0x5c, 0x02,
+ 0x00, 0x00, 0x03, 0x00, 0xb7, 0x24, 0x01, 0x00,
+ 0x9b, 0x5f, 0x04, 0x00, 0xbd, 0x71, 0x5f, 0x06,
+ 0x00, 0xbd, 0x0f, 0x5f, 0x07, 0x00, 0xde, 0xea,
+ 0x14, 0x04, 0x01, 0x02, 0x00, 0x00, 0x5f, 0x08,
+ 0x00, 0x5e, 0x09, 0x00, 0xdd, 0x43, 0x41, 0x02,
+ 0x00, 0x00, 0x04, 0x00, 0x5e, 0x0a, 0x00, 0xee,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xba, 0x07, 0x00,
+ 0x00, 0x00, 0x04, 0x04, 0x00, 0x0c, 0x00, 0x9e,
+ 0x07, 0x65, 0x01, 0x96, 0x07, 0x60, 0x01, 0xfc,
+ 0x06, 0x1b, 0x01, 0xbc, 0x07, 0x74, 0x01, 0xdd,
+ 0xde, 0x04, 0x60, 0x02, 0x00, 0x00, 0xdf, 0xf0,
+ 0xe0, 0xf0, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xbc,
+ 0x07, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x07,
+ 0x00, 0x00, 0x75, 0x01, 0x00, 0x73, 0x01, 0xdd,
+ 0xd1, 0xef, 0x0e, 0xde, 0xee, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xbe, 0x07, 0x01, 0x02, 0x01, 0x06,
+ 0x0c, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x70, 0x01,
+ 0x00, 0x6e, 0x01, 0x00, 0x6f, 0x01, 0x00, 0x1a,
+ 0x01, 0x00, 0x76, 0x01, 0x00, 0x11, 0x01, 0x00,
+ 0x1b, 0x01, 0x00, 0x09, 0x01, 0x00, 0x71, 0x01,
+ 0x00, 0x0e, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x00,
+ 0x0c, 0xd1, 0xf3, 0xea, 0x04, 0xc1, 0xd5, 0x29,
+ 0xd1, 0x04, 0x22, 0x02, 0x00, 0x00, 0xab, 0xea,
+ 0x04, 0xdd, 0xee, 0x29, 0xde, 0xd1, 0xef, 0xce,
+ 0xe9, 0xb5, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0xdf,
+ 0xc6, 0xd1, 0xf0, 0x96, 0xea, 0x02, 0x29, 0xd1,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc6,
+ 0xe9, 0xb6, 0x9d, 0x24, 0x01, 0x00, 0xd5, 0xd1,
+ 0xc1, 0xab, 0xea, 0x02, 0x29, 0xe0, 0xea, 0x0b,
+ 0xe0, 0x04, 0x1f, 0x01, 0x00, 0x00, 0x9d, 0xd1,
+ 0x9d, 0xd5, 0x5e, 0x04, 0x00, 0xd1, 0xef, 0xcd,
+ 0xb5, 0x47, 0x5f, 0x05, 0x00, 0xc5, 0xb6, 0x47,
+ 0x5f, 0x06, 0x00, 0x5e, 0x05, 0x00, 0xea, 0x04,
+ 0xd1, 0xe4, 0x29, 0xc1, 0xe4, 0x5e, 0x07, 0x00,
+ 0xea, 0x28, 0x38, 0xb4, 0x00, 0x00, 0x00, 0x42,
+ 0x61, 0x02, 0x00, 0x00, 0x01, 0x00, 0x5e, 0x08,
+ 0x00, 0x42, 0x62, 0x02, 0x00, 0x00, 0x02, 0x00,
+ 0x07, 0xd1, 0x24, 0x02, 0x00, 0x5e, 0x09, 0x00,
+ 0x5e, 0x0a, 0x00, 0x24, 0x03, 0x00, 0x0e, 0xec,
+ 0x07, 0x5e, 0x08, 0x00, 0xd1, 0xef, 0x0e, 0xb5,
+ 0x5f, 0x06, 0x00, 0x65, 0x0b, 0x00, 0x42, 0x63,
+ 0x02, 0x00, 0x00, 0x03, 0x00, 0x24, 0x00, 0x00,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x07, 0x01,
+ 0x17, 0x01, 0x04, 0x03, 0x0a, 0xe0, 0x03, 0x00,
+ 0x00, 0x30, 0x01, 0x00, 0x33, 0x01, 0x00, 0x2f,
+ 0x01, 0xc0, 0x00, 0xc3, 0x0a, 0xc0, 0x01, 0xc3,
+ 0x0b, 0xc0, 0x02, 0xc3, 0x0c, 0xc0, 0x03, 0xc3,
+ 0x0d, 0xc0, 0x04, 0xc3, 0x0e, 0xc0, 0x05, 0xc3,
+ 0x0f, 0xc0, 0x06, 0xc3, 0x10, 0xc0, 0x07, 0xc3,
+ 0x11, 0xc0, 0x08, 0xc3, 0x15, 0xc0, 0x09, 0xc3,
+ 0x16, 0xd1, 0xe9, 0xcc, 0xc1, 0xc3, 0x05, 0xb5,
+ 0xc3, 0x06, 0xb6, 0xc3, 0x08, 0x26, 0x00, 0x00,
+ 0xc3, 0x09, 0x04, 0x64, 0x02, 0x00, 0x00, 0xc3,
+ 0x12, 0x04, 0x65, 0x02, 0x00, 0x00, 0xc3, 0x13,
+ 0x04, 0x66, 0x02, 0x00, 0x00, 0xc3, 0x14, 0xb5,
+ 0xc9, 0xc5, 0xc8, 0xfa, 0x7d, 0x01, 0x00, 0x00,
+ 0x07, 0xc3, 0x04, 0xc5, 0xcb, 0xd1, 0xc5, 0x91,
+ 0xc9, 0x47, 0xce, 0x11, 0x04, 0xf7, 0x01, 0x00,
+ 0x00, 0xab, 0xeb, 0x1c, 0x11, 0x04, 0x1e, 0x01,
+ 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04, 0x21,
+ 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11, 0x04,
+ 0x1f, 0x01, 0x00, 0x00, 0xab, 0xea, 0x04, 0x0e,
+ 0xec, 0xc8, 0x11, 0x04, 0x67, 0x02, 0x00, 0x00,
+ 0xab, 0xeb, 0x0a, 0x11, 0x04, 0xff, 0x01, 0x00,
+ 0x00, 0xab, 0xea, 0x1a, 0xc5, 0xc8, 0xfa, 0x10,
+ 0x00, 0x00, 0x00, 0xd1, 0xc5, 0x47, 0xc6, 0xa9,
+ 0xea, 0x06, 0x93, 0x00, 0x0e, 0xec, 0xa3, 0xb6,
+ 0xc3, 0x08, 0x0e, 0xec, 0x9d, 0x11, 0x04, 0xe8,
+ 0x01, 0x00, 0x00, 0xab, 0xea, 0x48, 0xc5, 0xc8,
+ 0xfa, 0x16, 0x00, 0x00, 0x00, 0xd1, 0xc5, 0x47,
+ 0x04, 0x7d, 0x00, 0x00, 0x00, 0xa9, 0xea, 0x08,
+ 0xc2, 0x0d, 0xee, 0x0e, 0xed, 0xeb, 0x00, 0xc5,
+ 0xc8, 0xfa, 0x16, 0x00, 0x00, 0x00, 0xd1, 0xc5,
+ 0x47, 0x04, 0xe8, 0x01, 0x00, 0x00, 0xa9, 0xea,
+ 0x08, 0xc2, 0x0e, 0xee, 0x0e, 0xed, 0xd2, 0x00,
+ 0xc2, 0x08, 0xea, 0x0b, 0xc2, 0x10, 0xee, 0x0e,
+ 0xb5, 0xc3, 0x08, 0xed, 0xc4, 0x00, 0xb6, 0xc3,
+ 0x08, 0x0e, 0xed, 0x4e, 0xff, 0x11, 0x04, 0xe4,
+ 0x01, 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04,
+ 0xe5, 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11,
+ 0x04, 0x68, 0x02, 0x00, 0x00, 0xab, 0xea, 0x0c,
+ 0xc2, 0x0f, 0xc6, 0xef, 0x0e, 0xb5, 0xc3, 0x08,
+ 0xed, 0x97, 0x00, 0x11, 0x04, 0xf1, 0x01, 0x00,
+ 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04, 0xfb, 0x01,
+ 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11, 0x04, 0x69,
+ 0x02, 0x00, 0x00, 0xab, 0xea, 0x0f, 0xb6, 0xc3,
+ 0x08, 0x93, 0x06, 0xc2, 0x0a, 0xc6, 0xef, 0x0e,
+ 0x0e, 0xed, 0xff, 0xfe, 0x11, 0x04, 0xf2, 0x01,
+ 0x00, 0x00, 0xab, 0xeb, 0x13, 0x11, 0x04, 0xe6,
+ 0x01, 0x00, 0x00, 0xab, 0xeb, 0x0a, 0x11, 0x04,
+ 0xe7, 0x01, 0x00, 0x00, 0xab, 0xea, 0x27, 0xb5,
+ 0xc3, 0x08, 0xc2, 0x06, 0xb5, 0xfc, 0x16, 0x00,
+ 0x00, 0x00, 0xde, 0xc2, 0x0b, 0xee, 0xc6, 0xf0,
+ 0xea, 0x0b, 0x92, 0x06, 0xc2, 0x0c, 0xee, 0x0e,
+ 0x0e, 0xed, 0xc7, 0xfe, 0x04, 0x10, 0x01, 0x00,
+ 0x00, 0xc3, 0x04, 0xec, 0x2c, 0xdf, 0xc6, 0xef,
+ 0xea, 0x0a, 0xc2, 0x11, 0xee, 0x0e, 0xb5, 0xc3,
+ 0x08, 0xec, 0x1e, 0xdd, 0xc6, 0xef, 0x11, 0xeb,
+ 0x09, 0x0e, 0xc6, 0x04, 0x5c, 0x01, 0x00, 0x00,
+ 0xa9, 0xea, 0x07, 0xc2, 0x15, 0xee, 0x0e, 0xec,
+ 0x08, 0xb6, 0xc3, 0x08, 0x0e, 0xed, 0x93, 0xfe,
+ 0x0e, 0xc2, 0x04, 0x69, 0x8d, 0xfe, 0xff, 0xff,
+ 0xc2, 0x16, 0xc7, 0xc5, 0xf0, 0x0e, 0xed, 0x82,
+ 0xfe, 0xc2, 0x16, 0xc8, 0xc8, 0xf0, 0x0e, 0xc2,
+ 0x05, 0xc2, 0x06, 0xc2, 0x09, 0x26, 0x03, 0x00,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xd4, 0x09, 0x01,
+ 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00,
+ 0x05, 0x01, 0xdd, 0xd1, 0x9d, 0xe1, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xd6, 0x09, 0x01, 0x00, 0x01,
+ 0x04, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x05, 0x01,
+ 0xdd, 0x42, 0x67, 0x01, 0x00, 0x00, 0x00, 0x00,
+ 0xdd, 0xe9, 0xb6, 0x9e, 0x25, 0x01, 0x00, 0x0e,
+ 0x43, 0x02, 0x03, 0xd8, 0x09, 0x01, 0x00, 0x01,
+ 0x05, 0x02, 0x00, 0x16, 0x00, 0x00, 0x0b, 0x01,
+ 0x00, 0x05, 0x01, 0xdd, 0xee, 0xd5, 0xde, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xde,
+ 0xe9, 0xb6, 0x9e, 0x24, 0x02, 0x00, 0xe2, 0xd1,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xda, 0x09, 0x00,
+ 0x00, 0x00, 0x03, 0x06, 0x00, 0x4b, 0x00, 0xdc,
+ 0x09, 0x04, 0x01, 0xd4, 0x09, 0x0a, 0x01, 0xde,
+ 0x09, 0x00, 0x01, 0x8e, 0x08, 0x03, 0x01, 0xe0,
+ 0x09, 0x00, 0x03, 0xd8, 0x09, 0x0c, 0x01, 0x04,
+ 0x0b, 0x01, 0x00, 0x00, 0xe1, 0xde, 0x04, 0xe8,
+ 0x01, 0x00, 0x00, 0xef, 0x0e, 0xdf, 0x8f, 0xe3,
+ 0xdf, 0xe0, 0xb6, 0x9e, 0xfa, 0x34, 0x00, 0x00,
+ 0x00, 0x5e, 0x04, 0x00, 0xdf, 0x47, 0x04, 0x7d,
+ 0x00, 0x00, 0x00, 0xa9, 0xea, 0x1f, 0x5e, 0x04,
+ 0x00, 0xdf, 0xb6, 0x9d, 0x47, 0x04, 0xe8, 0x01,
+ 0x00, 0x00, 0xa9, 0xea, 0x10, 0xdf, 0xb7, 0x9d,
+ 0xe3, 0x5e, 0x05, 0x00, 0x04, 0xe8, 0x01, 0x00,
+ 0x00, 0xef, 0x0e, 0x29, 0xdf, 0x8f, 0xe3, 0xec,
+ 0xc8, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe2, 0x09,
+ 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x21, 0x00,
+ 0xdc, 0x09, 0x04, 0x01, 0xde, 0x09, 0x00, 0x01,
+ 0x8e, 0x08, 0x03, 0x01, 0xe0, 0x09, 0x00, 0x03,
+ 0x04, 0x0b, 0x01, 0x00, 0x00, 0xe1, 0xde, 0x8f,
+ 0xe2, 0xde, 0xdf, 0xfa, 0x14, 0x00, 0x00, 0x00,
+ 0xe0, 0xde, 0x47, 0x04, 0x1f, 0x01, 0x00, 0x00,
+ 0xa9, 0xeb, 0x06, 0xde, 0x8f, 0xe2, 0xec, 0xea,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe4, 0x09, 0x01,
+ 0x00, 0x01, 0x03, 0x07, 0x00, 0x4e, 0x00, 0x00,
+ 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+ 0x03, 0x00, 0x0c, 0x01, 0x04, 0x48, 0x00, 0x00,
+ 0x00, 0xe1, 0xde, 0xd1, 0xef, 0x0e, 0xdf, 0xe0,
+ 0xfa, 0x40, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00,
+ 0xdf, 0x91, 0xe3, 0x47, 0x60, 0x04, 0x00, 0x04,
+ 0x1f, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x09, 0x04,
+ 0x10, 0x01, 0x00, 0x00, 0xe1, 0xec, 0xe0, 0x5e,
+ 0x04, 0x00, 0x04, 0x20, 0x02, 0x00, 0x00, 0xa9,
+ 0xea, 0x0b, 0xdf, 0xe0, 0xa6, 0xeb, 0x13, 0xdf,
+ 0x8f, 0xe3, 0xec, 0xcb, 0x5e, 0x04, 0x00, 0xd1,
+ 0xa9, 0xea, 0xc4, 0x5e, 0x06, 0x00, 0xee, 0x0e,
+ 0x29, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe6, 0x09,
+ 0x00, 0x00, 0x00, 0x03, 0x09, 0x00, 0xc7, 0x01,
+ 0x00, 0xdc, 0x09, 0x04, 0x01, 0xd4, 0x09, 0x0a,
+ 0x01, 0xde, 0x09, 0x00, 0x01, 0x8e, 0x08, 0x03,
+ 0x01, 0xd4, 0x06, 0x01, 0x01, 0xe0, 0x09, 0x00,
+ 0x03, 0xd6, 0x09, 0x0b, 0x01, 0xd8, 0x09, 0x0c,
+ 0x01, 0xb4, 0x05, 0x00, 0x00, 0x04, 0x0c, 0x01,
+ 0x00, 0x00, 0xe1, 0xde, 0x04, 0xe8, 0x01, 0x00,
+ 0x00, 0xef, 0x0e, 0xdf, 0xe0, 0xfa, 0xb5, 0x00,
+ 0x00, 0x00, 0x5e, 0x05, 0x00, 0xdf, 0x91, 0xe3,
+ 0x47, 0x60, 0x04, 0x00, 0x04, 0x1f, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x09, 0x04, 0x10, 0x01, 0x00,
+ 0x00, 0xe1, 0xec, 0xe0, 0x5e, 0x04, 0x00, 0x04,
+ 0x20, 0x02, 0x00, 0x00, 0xa9, 0xea, 0x0d, 0xdf,
+ 0xe0, 0xfa, 0xd1, 0xff, 0xff, 0xff, 0xdf, 0x8f,
+ 0xe3, 0xec, 0xc9, 0x5e, 0x06, 0x00, 0xee, 0x04,
+ 0xfb, 0x01, 0x00, 0x00, 0xa9, 0xea, 0x13, 0x5e,
+ 0x04, 0x00, 0x04, 0xe6, 0x01, 0x00, 0x00, 0xa9,
+ 0xea, 0xb2, 0x5e, 0x07, 0x00, 0xee, 0x0e, 0xec,
+ 0xab, 0x5e, 0x04, 0x00, 0x04, 0xfb, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x2e, 0xde, 0x04, 0xfb, 0x01,
+ 0x00, 0x00, 0xef, 0x0e, 0x5e, 0x05, 0x00, 0xdf,
+ 0x47, 0x04, 0xfb, 0x01, 0x00, 0x00, 0xa9, 0x11,
+ 0xeb, 0x0d, 0x0e, 0x5e, 0x05, 0x00, 0xdf, 0x47,
+ 0x04, 0xe6, 0x01, 0x00, 0x00, 0xa9, 0x69, 0x7c,
+ 0xff, 0xff, 0xff, 0xdf, 0x8f, 0xe3, 0xed, 0x74,
+ 0xff, 0x5e, 0x04, 0x00, 0x04, 0xe8, 0x01, 0x00,
+ 0x00, 0xa9, 0x69, 0x68, 0xff, 0xff, 0xff, 0x5e,
+ 0x07, 0x00, 0xee, 0x0e, 0xdf, 0xe0, 0xfa, 0x14,
+ 0x00, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x5e, 0x05,
+ 0x00, 0xdf, 0x47, 0xef, 0xea, 0x06, 0xdf, 0x8f,
+ 0xe3, 0xec, 0xea, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xe8, 0x09, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00,
+ 0x43, 0x00, 0xdc, 0x09, 0x04, 0x01, 0xde, 0x09,
+ 0x00, 0x01, 0x8e, 0x08, 0x03, 0x01, 0xb4, 0x05,
+ 0x00, 0x00, 0xe0, 0x09, 0x00, 0x03, 0x04, 0x46,
+ 0x00, 0x00, 0x00, 0xe1, 0xde, 0xdf, 0xfa, 0x39,
+ 0x00, 0x00, 0x00, 0xe0, 0x5e, 0x04, 0x00, 0xde,
+ 0x47, 0xef, 0x11, 0xeb, 0x25, 0x0e, 0x5e, 0x04,
+ 0x00, 0xde, 0x47, 0x04, 0xe3, 0x01, 0x00, 0x00,
+ 0xa9, 0xea, 0x1e, 0xde, 0xdf, 0xb6, 0x9e, 0xa9,
+ 0x11, 0xeb, 0x0f, 0x0e, 0x5e, 0x04, 0x00, 0xde,
+ 0xb6, 0x9d, 0x47, 0x04, 0xe3, 0x01, 0x00, 0x00,
+ 0xaa, 0xea, 0x06, 0xde, 0x8f, 0xe2, 0xec, 0xc5,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xea, 0x09, 0x00,
+ 0x02, 0x00, 0x05, 0x0a, 0x00, 0xc7, 0x01, 0x00,
+ 0x00, 0x08, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+ 0x02, 0x01, 0x00, 0x12, 0x01, 0x00, 0x04, 0x01,
+ 0x00, 0x13, 0x01, 0x00, 0x14, 0x01, 0xb6, 0xe1,
+ 0xde, 0xdf, 0xfa, 0x12, 0x00, 0x00, 0x00, 0xe0,
+ 0x5e, 0x04, 0x00, 0xde, 0x47, 0xef, 0xea, 0x06,
+ 0xde, 0x8f, 0xe2, 0xec, 0xec, 0x04, 0x76, 0x02,
+ 0x00, 0x00, 0x5e, 0x04, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x00, 0x00, 0x5e, 0x05, 0x00, 0xde,
+ 0x24, 0x02, 0x00, 0x9d, 0x04, 0x76, 0x02, 0x00,
+ 0x00, 0x9d, 0xc9, 0x5e, 0x06, 0x00, 0x42, 0xe2,
+ 0x01, 0x00, 0x00, 0x01, 0x00, 0xc5, 0x24, 0x01,
+ 0x00, 0xb5, 0xfd, 0x23, 0x00, 0x00, 0x00, 0x04,
+ 0x0d, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x5e,
+ 0x08, 0x00, 0x42, 0xe2, 0x01, 0x00, 0x00, 0x02,
+ 0x00, 0xc5, 0x24, 0x01, 0x00, 0xb5, 0xfd, 0x06,
+ 0x00, 0x00, 0x00, 0xb5, 0xe1, 0x29, 0xde, 0xca,
+ 0xc6, 0xdf, 0xfa, 0x15, 0x00, 0x00, 0x00, 0x5e,
+ 0x04, 0x00, 0xc6, 0x47, 0x04, 0xf7, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x05, 0x93, 0x01, 0xec, 0xe9,
+ 0xc6, 0xdf, 0xfa, 0x1a, 0x00, 0x00, 0x00, 0x5e,
+ 0x04, 0x00, 0xc6, 0x47, 0x04, 0xf1, 0x01, 0x00,
+ 0x00, 0xa9, 0xea, 0x0a, 0x04, 0x1b, 0x00, 0x00,
+ 0x00, 0x5f, 0x07, 0x00, 0x29, 0x5e, 0x09, 0x00,
+ 0x42, 0xe2, 0x01, 0x00, 0x00, 0x03, 0x00, 0xc5,
+ 0x24, 0x01, 0x00, 0xb5, 0xfd, 0x0d, 0x00, 0x00,
+ 0x00, 0x04, 0x0e, 0x01, 0x00, 0x00, 0x5f, 0x07,
+ 0x00, 0x29, 0x04, 0x0f, 0x01, 0x00, 0x00, 0x5f,
+ 0x07, 0x00, 0xb5, 0xe1, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xee, 0x09, 0x02, 0x00, 0x02, 0x03, 0x02,
+ 0x00, 0x33, 0x00, 0x00, 0x09, 0x01, 0x00, 0x04,
+ 0x01, 0xdd, 0xe9, 0xd1, 0xfa, 0x17, 0x00, 0x00,
+ 0x00, 0xdd, 0x42, 0x85, 0x01, 0x00, 0x00, 0x00,
+ 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xec, 0xe6, 0xdd, 0xe9, 0xd2, 0xfa,
+ 0x13, 0x00, 0x00, 0x00, 0xdd, 0x42, 0x85, 0x01,
+ 0x00, 0x00, 0x01, 0x00, 0xde, 0x24, 0x01, 0x00,
+ 0x0e, 0xec, 0xea, 0x29,
+};
+
@@ -985,8 +985,8 @@ function main(argc, argv, g)
         math_min,
         string_build1,
         string_build2,
-        //string_build3,
-        //string_build4,
+        string_build3,
+        string_build4,
         sort_bench,
         int_to_string,
         float_to_string,
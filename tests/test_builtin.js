@@ -304,6 +304,51 @@ function test_string()
     assert("abc".padStart(Infinity, ""), "abc");
 }
 
+/* long concatenations are represented as ropes */
+function test_string_concat()
+{
+    var a, b, c, i, m, o;
+
+    a = "";
+    b = "";
+    for(i = 0; i < 2000; i++) {
+        a += "x" + i;
+        b = b + ("x" + i);
+    }
+    c = "";
+    for(i = 1999; i >= 0; i--)
+        c = "x" + i + c;
+    assert(a.length, b.length);
+    assert(a === b && a == c && b === c, true);
+    assert(typeof a, "string");
+    assert(a[1], "0");
+    assert(a.charAt(a.length - 1), "9");
+    assert(a.slice(-5), "x1999");
+    assert(a < a + "0" && a + "0" > c, true);
+    assert(Object.is(a, c), true);
+    assert([ b ].indexOf(a), 0);
+
+    m = new Map();
+    m.set(a, 1);
+    assert(m.get(c), 1);
+    o = {};
+    o[a] = 2;
+    assert(o[c], 2);
+    assert(JSON.parse(JSON.stringify(a)), c);
+    assert(new String(a).length, a.length);
+
+    a = "\u1234".repeat(300) + "a".repeat(300);
+    assert(a.charCodeAt(0), 0x1234);
+    assert(a.charCodeAt(599), 0x61);
+    assert(a === "\u1234".repeat(300) + "a".repeat(300), true);
+
+    a = "a".repeat(1000);
+    for(i = 0; i < 15; i++)
+        a = a + a;
+    assert(a.length, 1000 << 15);
+    assert_throws(InternalError, () => { for(;;) a = a + a; });
+}
+
 function test_math()
 {
     var a;
@@ -505,7 +550,7 @@ function test_date()
 
 function test_regexp()
 {
-    var a, str;
+    var a, str, i;
     str = "abbbbbc";
     a = /(b+)c/.exec(str);
     assert(a[0], "bbbbbc");
@@ -539,6 +584,91 @@ function test_regexp()
     assert(/{1a}/.toString(), "/{1a}/");
     a = /a{1+/.exec("a{11");
     assert(a, ["a{11"] );
+
+    /* search prefilters */
+    str = "x".repeat(100) + "ERROR 42 ERROR 7";
+    a = /ERROR (\d+)/.exec(str);
+    assert(a.index === 100 && a[1] === "42");
+    a = /ERROR (\d+)/.exec(str + "\u20ac");
+    assert(a.index === 100 && a[1] === "42");
+    assert(str.match(/ERROR \d+/g), ["ERROR 42", "ERROR 7"]);
+    assert(/ERROR\u20ac/.exec(str), null);
+    assert(/error/i.exec(str).index, 100);
+    assert(/\u212a/iu.exec("xk").index, 1);
+    assert(/(?:E|4)\d?/.exec(str).index, 100);
+    assert(/\uDE00/u.exec("\uD83D\uDE00\uDE00").index, 2);
+    assert(/[\uDE00a]/u.exec("\uD83D\uDE00\uDE00").index, 2);
+    a = /\uDE00/gu;
+    a.lastIndex = 1;
+    assert(a.exec("\uD83D\uDE00").index, 1);
+    assert(/\u{1F600}/u.exec("a\u{1F600}").index, 1);
+
+    /* exponential backtracking: lock step execution */
+    str = "a".repeat(10000);
+    assert(/(a|aa)*b/.exec(str), null);
+    assert(/(a+)+b/.test(str), false);
+    assert(/(a*)*b/.test(str), false);
+    a = /^(?:(a)|b){2,}(c|aa)+d/.exec(str + "d");
+    assert(a[0].length === 10001 && a[1] === "a" && a[2] === "aa");
+    a = /(x+x+)+y|(a{1,3})+$/.exec(str);
+    assert(a.index === 0 && a[1] === undefined && a[2] === "a");
+    a = /((?:a|)*)*b/.exec(str + "b");
+    assert(a.index === 0 && a[1] === "");
+    /* the search continues when no thread is left */
+    assert(/\b(?:a|aa)*c/.exec(str + "--ac").index, 10002);
+    assert(/^(?:a|aa)*c/m.exec(str + "\nac").index, 10001);
+    assert(/\B(?:a|aa)*c$/.exec(str + " aac").index, 10002);
+    assert(/(?:a|aa)*$/.exec(str + "b").index, 10001);
+
+    /* compiled regexp cache */
+    for(i = 0; i < 600; i++) {
+        a = new RegExp("k" + (i % 520) + "$", (i & 1) ? "i" : "");
+        assert(a.test("K" + (i % 520)), (i & 1) === 1);
+    }
+    assert(new RegExp("k1$", "y").sticky && !new RegExp("k1$").sticky);
+    assert("xab".match("a(b)")[1], "b");
+    assert("xab".match("a(b)").index, 1);
+    assert_throws(SyntaxError, () => new RegExp("a(", ""));
+    assert_throws(SyntaxError, () => new RegExp("a(", ""));
+    /* long patterns are not cached */
+    str = "a".repeat(5000) + "b";
+    for(i = 0; i < 2; i++)
+        assert(new RegExp(str).test("x" + str));
+
+    /* replace and split with an unmodified RegExp */
+    assert("a<b>&c".replace(/[<>&]/g, "[$&$1$`]"), "a[<$1a]b[>$1a<b][&$1a<b>]c");
+    assert("abcab".replace(/(a)(x)?/g, "$2$1$01$'"), "aabcabbcaabb");
+    assert("a\u{1F600}b".replace(/(?:)/gu, "-"), "-a-\u{1F600}-b-");
+    assert("a\u{1F600}b".replace(/(?:)/g, "-").length, 9);
+    a = /a/y;
+    a.lastIndex = 1;
+    assert("aaba".replace(a, "x"), "axba");
+    assert(a.lastIndex, 2);
+    assert("aaba".replace(a, "x"), "aaba");
+    assert(a.lastIndex, 0);
+    a = /(b)|(c)/g;
+    str = "abcd".replace(a, function(m, p1, p2, pos, s) {
+        assert(a.lastIndex, 0);
+        return "[" + p1 + "," + p2 + "," + pos + "," + s + "]";
+    });
+    assert(str, "a[b,undefined,1,abcd][undefined,c,2,abcd]d");
+    assert("a<x>b".replace(/<(?<n>\w)>/g, "$<n>"), "axb");
+    a = /b/g;
+    a.exec = function (s) { return null; };
+    assert("abc".replace(a, "x"), "abc");
+    a = /b/g;
+    Object.defineProperty(a, "lastIndex", { writable: false });
+    assert_throws(TypeError, () => "abc".replace(a, "x"));
+    assert("a,b, c".split(/,\s*/), ["a", "b", "c"]);
+    a = "a1b2c".split(/(\d)(x)?/);
+    assert(a.length === 7 && a[2] === undefined && a[4] === "2");
+    assert("a1b2c".split(/\d/y), ["a", "b", "c"]);
+    assert("a1b2c".split(/\d/, 2), ["a", "b"]);
+    assert("abc".split(/(?:)/), ["a", "b", "c"]);
+    assert("\u{1F600}\u{1F600}".split(/(?:)/u).length, 2);
+    assert("\u{1F600}\u{1F600}".split(/(?:)/).length, 4);
+    assert("".split(/x*/).length, 0);
+    assert("".split(/x/).length, 1);
 }
 
 function test_symbol()
@@ -667,11 +797,30 @@ function test_generator()
     assert(v.value === undefined && v.done === true);
 }
 
+function test_lazy_intrinsics()
+{
+    var d;
+
+    /* the typed array globals are created on first use */
+    d = Object.getOwnPropertyDescriptor(globalThis, "DataView");
+    assert(typeof d.value, "function");
+    assert(d.writable && !d.enumerable && d.configurable);
+
+    /* a deleted global stays deleted once its group is created */
+    assert(delete globalThis.SharedArrayBuffer);
+    assert(new Uint8Array([1, 2]).buffer instanceof ArrayBuffer);
+    assert(typeof SharedArrayBuffer, "undefined");
+    assert(Object.getPrototypeOf(Int16Array.prototype) ===
+           Object.getPrototypeOf(Uint8Array.prototype));
+}
+
+test_lazy_intrinsics();
 test();
 test_function();
 test_enum();
 test_array();
 test_string();
+test_string_concat();
 test_math();
 test_number();
 test_eval();
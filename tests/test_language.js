@@ -526,6 +526,178 @@ function test_function_expr_name()
     assert_throws(TypeError, f);
 }
 
+function test_inline_cache()
+{
+    var proto, o1, o2, o3, i, a;
+
+    function get_x(o) { return o.x; }
+    function set_x(o, v) { o.x = v; }
+
+    proto = { x: 1 };
+    o1 = Object.create(proto);
+    o2 = { x: 2 };
+    o3 = { y: 0, x: 3 };
+    /* polymorphic site */
+    for(i = 0; i < 3; i++) {
+        assert(get_x(o1), 1);
+        assert(get_x(o2), 2);
+        assert(get_x(o3), 3);
+    }
+    proto.x = 10;
+    assert(get_x(o1), 10);
+    o1.x = 5;
+    assert(get_x(o1), 5);
+    delete o1.x;
+    assert(get_x(o1), 10);
+    Object.defineProperty(proto, "x", { get: function() { return 42; } });
+    assert(get_x(o1), 42);
+    Object.setPrototypeOf(o1, { x: 7 });
+    assert(get_x(o1), 7);
+
+    for(i = 0; i < 3; i++)
+        set_x(o2, i);
+    assert(o2.x, 2);
+    Object.defineProperty(o2, "x", { writable: false });
+    set_x(o2, 100);
+    assert(o2.x, 2);
+    Object.freeze(o3);
+    assert_throws(TypeError, () => { "use strict"; o3.x = 4; });
+    assert(get_x(o3), 3);
+
+    a = [];
+    assert(a.push, Array.prototype.push);
+    a.push = 1;
+    assert(a.push, 1);
+}
+
+/* lexical global variables shadow the global object */
+let global_l = 2;
+const global_c = 3;
+
+function test_global_var_cache()
+{
+    var i, g = (0, eval)("this");
+
+    function get_v() { return global_v; }
+    function set_v(v) { global_v = v; }
+    function set_v_strict(v) { "use strict"; global_v = v; }
+
+    g.global_v = 1;
+    for(i = 0; i < 3; i++)
+        assert(get_v(), 1);
+    set_v(2);
+    assert(get_v(), 2);
+    set_v_strict(3);
+    assert(g.global_v, 3);
+    Object.defineProperty(g, "global_v", { writable: false });
+    set_v(4);
+    assert(get_v(), 3);
+    assert_throws(TypeError, () => set_v_strict(4));
+    Object.defineProperty(g, "global_v", { get: function() { return 5; },
+                                           configurable: true });
+    assert(get_v(), 5);
+    delete g.global_v;
+    assert_throws(ReferenceError, get_v);
+    assert_throws(ReferenceError, () => set_v_strict(6));
+    set_v(6);
+    assert(get_v(), 6);
+    delete g.global_v;
+
+    g.global_l = 1;
+    for(i = 0; i < 3; i++)
+        assert(global_l, 2);
+    global_l = 4;
+    assert(global_l, 4);
+    assert(g.global_l, 1);
+    assert_throws(TypeError, () => { global_c = 4; });
+    assert(global_c, 3);
+    delete g.global_l;
+
+    /* a global lexical variable is not initialized before its declaration */
+    assert_throws(ReferenceError, () => (0, eval)("global_t; let global_t = 1;"));
+}
+
+function test_constant_folding()
+{
+    var a = "b", e;
+
+    /* operators with constant operands are evaluated at compile time */
+    assert(1 + 2 * 3, 7);
+    assert(0x7fffffff + 1, 2147483648);
+    assert((-2147483648) - 1, -2147483649);
+    assert(1 / 0, Infinity);
+    assert(Object.is(-0, -0), true);
+    assert(Object.is(0 * -1, -0), true);
+    assert(Object.is(- (1 - 1), -0), true);
+    assert(isNaN(0 / 0), true);
+    assert(5 % -3, 2);
+    assert(2 ** -1, 0.5);
+    assert(-1 >>> 28, 15);
+    assert(~~3.7, 3);
+    assert(+"12", 12);
+    assert(!"", true);
+    assert(typeof 1, "number");
+    assert(typeof typeof null, "string");
+    assert("a" + "b" + 1 + 2, "ab12");
+    assert(1 + 2 + "a", "3a");
+    assert("1" * "2", 2);
+    assert(1 + null, 1);
+    assert("x" + undefined, "xundefined");
+    assert("1" == 1, true);
+    assert("1" === 1, false);
+    assert(null == undefined, true);
+    assert("a" < "b", true);
+    assert(1 + 2 + a, "3b");
+    assert(a + 1 + 2, "b12");
+
+    /* templates */
+    assert(`x${1 + 2}y${"z"}`, "x3yz");
+    assert(`${1}`, "1");
+    assert(`${-0}${null}${true}`, "0nulltrue");
+    assert(`${a}${1}${2}${a}`, "b12b");
+    assert(`${1}${a}${""}`, "1b");
+
+    /* line numbers are kept */
+    e = eval("(function() {\n return 1 +\n 2 +\n null.x; })");
+    try {
+        e();
+    } catch(err) {
+        e = err.stack;
+    }
+    assert(e.includes(":4)"), true);
+}
+
+function test_superinstructions()
+{
+    var i, n, o, a;
+
+    /* fused comparison and branch */
+    n = 0;
+    for(i = 0; i < 10; i++) {
+        if (i <= 2.5)
+            n++;
+        if ("b" > "a")
+            n += 10;
+    }
+    assert(n, 103);
+    o = { valueOf() { return 5; } };
+    n = 0;
+    for(i = 0; i < o; i++)
+        n++;
+    assert(n, 5);
+    assert_throws(TypeError, () => { if (1 < { valueOf() { throw new TypeError(); } }) n++; });
+
+    /* fused local variable read and property access */
+    function f(p) { var q = p; return q.x + q.s.length + q.toString(); }
+    assert(f({ x: 1, s: "ab" }), "3[object Object]");
+    assert_throws(ReferenceError, () => { a = l.x; let l = { x: 1 }; });
+    assert_throws(TypeError, () => { let l = null; return l.x; });
+    let l = [1, 2];
+    assert(l.length, 2);
+    l = { x: 3 };
+    assert(l.x, 3);
+}
+
 test_op1();
 test_cvt();
 test_eq();
@@ -545,3 +717,7 @@ test_spread();
 test_function_length();
 test_argument_scope();
 test_function_expr_name();
+test_inline_cache();
+test_global_var_cache();
+test_constant_folding();
+test_superinstructions();
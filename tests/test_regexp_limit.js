@@ -0,0 +1,71 @@
+/* must be run with --regexp-step-limit 100000 */
+
+function assert(actual, expected, message) {
+    if (arguments.length == 1)
+        expected = true;
+
+    if (actual === expected)
+        return;
+
+    if (actual !== null && expected !== null
+    &&  typeof actual == 'object' && typeof expected == 'object'
+    &&  actual.toString() === expected.toString())
+        return;
+
+    throw Error("assertion failed: got |" + actual + "|" +
+                ", expected |" + expected + "|" +
+                (message ? " (" + message + ")" : ""));
+}
+
+function assert_step_limit(func)
+{
+    var err = false;
+    try {
+        func();
+    } catch(e) {
+        err = true;
+        if (!(e instanceof InternalError) ||
+            e.message !== "regexp step limit exceeded") {
+            throw Error("unexpected exception: " + e);
+        }
+    }
+    if (!err) {
+        throw Error("expected exception");
+    }
+}
+
+// load more elaborate version of assert if available
+try { __loadScript("test_assert.js"); } catch(e) {}
+
+/*----------------*/
+
+function test_step_limit()
+{
+    var str, re;
+
+    /* exponential backtracking with a back reference: no lock step
+       execution is possible */
+    str = "a".repeat(30);
+    re = /(a*)*\1b/;
+    assert_step_limit(() => re.exec(str));
+    assert_step_limit(() => re.test(str));
+    assert_step_limit(() => str.match(re));
+    assert_step_limit(() => str.replace(re, "x"));
+    assert_step_limit(() => str.split(re));
+    assert_step_limit(() => str.search(re));
+    assert_step_limit(() => [...str.matchAll(/(a*)*\1b/g)]);
+    re = /(a*)*\1b/g;
+    assert_step_limit(() => str.replace(re, "x"));
+    assert_step_limit(() => str.replace(re, () => "x"));
+
+    /* the limit applies to each execution */
+    re = /(a|b)\1c/g;
+    str = "aac".repeat(1000);
+    assert(str.replace(re, "x"), "x".repeat(1000));
+
+    /* the lock step execution is also bounded */
+    assert_step_limit(() => /(a|aa)*b/.exec("a".repeat(100000)));
+    assert(/(a|aa)*b/.exec("a".repeat(1000)), null);
+}
+
+test_step_limit();
@@ -260,7 +260,7 @@ function test_os_exec()
 
 function test_timer()
 {
-    var th, i;
+    var th, i, log, n, t;
 
     /* just test that a timer can be inserted and removed */
     th = [];
@@ -268,6 +268,367 @@ function test_timer()
         th[i] = os.setTimeout(function () { }, 1000);
     for(i = 0; i < 3; i++)
         os.clearTimeout(th[i]);
+
+    /* the timers expire in timeout order, then in creation order */
+    log = [];
+    th = [];
+    for(i = 0; i < 300; i++) {
+        let j = i;
+        th[i] = os.setTimeout(function () { log.push(j); }, 40 - (i % 3) * 20);
+    }
+    for(i = 0; i < 300; i += 2)
+        os.clearTimeout(th[i]);
+    os.setTimeout(function () {
+        assert(log.length, 150);
+        for(i = 1; i < log.length; i++) {
+            t = log[i - 1];
+            assert((t % 3) > (log[i] % 3) ||
+                   ((t % 3) == (log[i] % 3) && t < log[i]), true);
+        }
+    }, 100);
+
+    n = 0;
+    th = os.setInterval(function () {
+        if (++n == 5)
+            os.clearInterval(th);
+        assert(n <= 5, true);
+    }, 1);
+}
+
+function test_rw_handlers()
+{
+    var n, fds, count, expected, i, timer, buf, fd, err;
+
+    function add_reader(fd, is_pipe)
+    {
+        os.setReadHandler(fd, function () {
+            if (is_pipe)
+                assert(os.read(fd, buf.buffer, 0, 1), 1);
+            os.setReadHandler(fd, null);
+            os.close(fd);
+            if (++count == expected)
+                os.clearTimeout(timer);
+        });
+    }
+
+    n = 100;
+    count = 0;
+    buf = new Uint8Array(1);
+    fds = [];
+    /* all the pipes are ready at the same time */
+    for(i = 0; i < n; i++) {
+        fds[i] = os.pipe();
+        assert(os.write(fds[i][1], buf.buffer, 0, 1), 1);
+        add_reader(fds[i][0], true);
+    }
+
+    /* write handler, then read handler on the same pipe */
+    fds[n] = os.pipe();
+    os.setWriteHandler(fds[n][1], function () {
+        os.setWriteHandler(fds[n][1], null);
+        os.setReadHandler(fds[n][0], function () {
+            os.setReadHandler(fds[n][0], null);
+            os.close(fds[n][0]);
+            if (++count == expected)
+                os.clearTimeout(timer);
+        });
+        os.write(fds[n][1], buf.buffer, 0, 1);
+        os.close(fds[n][1]);
+    });
+
+    /* not a pipe or socket: always ready */
+    fd = os.open("/dev/null", os.O_RDONLY);
+    assert(fd >= 0);
+    add_reader(fd, false);
+
+    /* the fd cannot be watched: the error is reported */
+    if (os.platform === "linux") {
+        fd = os.pipe();
+        os.close(fd[0]);
+        os.close(fd[1]);
+        err = null;
+        try {
+            os.setReadHandler(fd[0], function () {});
+        } catch(e) {
+            err = e;
+        }
+        assert(err instanceof TypeError, true);
+    }
+
+    for(i = 0; i < n; i++)
+        os.close(fds[i][1]);
+    expected = n + 2;
+    timer = os.setTimeout(function () {
+        print("missing read/write handler calls: " + (expected - count));
+        std.exit(1);
+    }, 5000);
+}
+
+function test_socket()
+{
+    var srv, cli, addr, err, port, buf, n, udp1, udp2, path, usrv, ucli, timer, done;
+
+    function check_done()
+    {
+        if (++done == 2)
+            os.clearTimeout(timer);
+    }
+
+    /* TCP on the loopback interface */
+    srv = os.socket(os.AF_INET, os.SOCK_STREAM);
+    assert(srv >= 0, true);
+    if (os.SO_REUSEPORT !== undefined)
+        assert(os.setsockopt(srv, os.SOL_SOCKET, os.SO_REUSEPORT, 1), 0);
+    assert(os.setsockopt(srv, os.SOL_SOCKET, os.SO_REUSEADDR, 1), 0);
+    assert(os.getsockopt(srv, os.SOL_SOCKET, os.SO_REUSEADDR)[0] != 0, true);
+    assert(os.bind(srv, { address: "127.0.0.1", port: 0 }), 0);
+    assert(os.listen(srv), 0);
+    [addr, err] = os.getsockname(srv);
+    assert(err, 0);
+    assert(addr.family, os.AF_INET);
+    assert(addr.address, "127.0.0.1");
+    port = addr.port;
+    assert(port > 0, true);
+
+    cli = os.socket(os.AF_INET, os.SOCK_STREAM);
+    n = os.connect(cli, { address: "127.0.0.1", port: port });
+    assert(n == 0 || n == -std.Error.EINPROGRESS, true);
+    done = 0;
+    os.setReadHandler(srv, function () {
+        var fd = os.accept(srv);
+        assert(fd >= 0, true);
+        os.setReadHandler(srv, null);
+        os.close(srv);
+        os.setReadHandler(fd, function () {
+            var buf = new Uint8Array(16);
+            n = os.recv(fd, buf.buffer, 0, buf.length);
+            if (n <= 0) {
+                /* end of stream */
+                os.setReadHandler(fd, null);
+                os.close(fd);
+                check_done();
+                return;
+            }
+            assert(n, 5);
+            assert(String.fromCharCode.apply(null, buf.subarray(0, n)), "hello");
+            assert(os.send(fd, buf.buffer, 0, n), n);
+        });
+    });
+    os.setWriteHandler(cli, function () {
+        var buf;
+        os.setWriteHandler(cli, null);
+        assert(os.getsockopt(cli, os.SOL_SOCKET, os.SO_ERROR)[0], 0);
+        assert(os.getpeername(cli)[0].port, port);
+        buf = new Uint8Array([104, 101, 108, 108, 111]);
+        assert(os.send(cli, buf.buffer, 0, buf.length), 5);
+        os.setReadHandler(cli, function () {
+            var buf = new Uint8Array(16);
+            assert(os.recv(cli, buf.buffer, 0, buf.length), 5);
+            assert(buf[0], 104);
+            os.setReadHandler(cli, null);
+            os.close(cli);
+        });
+    });
+
+    /* UDP */
+    udp1 = os.socket(os.AF_INET, os.SOCK_DGRAM);
+    udp2 = os.socket(os.AF_INET, os.SOCK_DGRAM);
+    assert(os.bind(udp1, { address: "127.0.0.1", port: 0 }), 0);
+    addr = os.getsockname(udp1)[0];
+    buf = new Uint8Array([1, 2, 3]);
+    assert(os.sendto(udp2, buf.buffer, 0, 3, addr), 3);
+    os.setReadHandler(udp1, function () {
+        var buf = new Uint8Array(8), from;
+        [n, from] = os.recvfrom(udp1, buf.buffer, 0, buf.length);
+        assert(n, 3);
+        assert(buf[2], 3);
+        assert(from.address, "127.0.0.1");
+        assert(from.port, os.getsockname(udp2)[0].port);
+        os.setReadHandler(udp1, null);
+        os.close(udp1);
+        os.close(udp2);
+        check_done();
+    });
+
+    /* Unix domain socket */
+    path = "/tmp/test_std_" + ((Math.random() * 1e9) | 0) + ".sock";
+    os.remove(path);
+    usrv = os.socket(os.AF_UNIX, os.SOCK_STREAM);
+    assert(os.bind(usrv, { path: path }), 0);
+    assert(os.listen(usrv, 1), 0);
+    assert(os.getsockname(usrv)[0].path, path);
+    ucli = os.socket(os.AF_UNIX, os.SOCK_STREAM);
+    assert(os.connect(ucli, { path: path }), 0);
+    n = os.accept(usrv);
+    assert(n >= 0, true);
+    /* non-blocking */
+    buf = new Uint8Array(4);
+    assert(os.recv(n, buf.buffer, 0, 4), -std.Error.EAGAIN);
+    assert(os.shutdown(ucli, os.SHUT_WR), 0);
+    assert(os.recv(n, buf.buffer, 0, 4), 0);
+    os.close(n);
+    os.close(ucli);
+    os.close(usrv);
+    os.remove(path);
+
+    timer = os.setTimeout(function () {
+        print("socket test timeout");
+        std.exit(1);
+    }, 5000);
+}
+
+function test_async_io()
+{
+    var fds, buf, fname, fd, timer, done, expected, err, srv, cli;
+
+    function check_done()
+    {
+        if (++done == expected)
+            os.clearTimeout(timer);
+    }
+
+    done = 0;
+    expected = 4;
+
+    /* pipe: the read completes when the data is written */
+    fds = os.pipe();
+    buf = new Uint8Array(8);
+    os.readAsync(fds[0], buf.buffer, 0, buf.length).then(function (n) {
+        assert(n, 3);
+        assert(buf[2], 3);
+        os.close(fds[0]);
+        check_done();
+    });
+    /* only one pending read per pollable file descriptor */
+    err = null;
+    try {
+        os.readAsync(fds[0], buf.buffer, 0, 1);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof TypeError, true);
+    os.writeAsync(fds[1], new Uint8Array([1, 2, 3]).buffer, 0, 3).then(function (n) {
+        assert(n, 3);
+        os.close(fds[1]);
+    });
+
+    /* regular file: the I/O is done by the thread pool */
+    fname = "/tmp/test_std_async.txt";
+    fd = os.open(fname, os.O_RDWR | os.O_CREAT | os.O_TRUNC);
+    assert(fd >= 0, true);
+    os.writeAsync(fd, new Uint8Array([104, 101, 108, 108, 111]).buffer, 0, 5).then(function (n) {
+        var buf2 = new Uint8Array(16);
+        assert(n, 5);
+        os.seek(fd, 0, std.SEEK_SET);
+        return os.readAsync(fd, buf2.buffer, 0, buf2.length).then(function (n) {
+            assert(n, 5);
+            assert(String.fromCharCode.apply(null, buf2.subarray(0, n)), "hello");
+            os.close(fd);
+            return std.loadFileAsync(fname);
+        });
+    }).then(function (str) {
+        assert(str, "hello");
+        os.remove(fname);
+        check_done();
+    });
+
+    /* accept */
+    srv = os.socket(os.AF_INET, os.SOCK_STREAM);
+    assert(os.bind(srv, { address: "127.0.0.1", port: 0 }), 0);
+    assert(os.listen(srv), 0);
+    os.acceptAsync(srv).then(function (fd) {
+        var buf = new Uint8Array(4);
+        assert(fd >= 0, true);
+        os.close(srv);
+        return os.readAsync(fd, buf.buffer, 0, buf.length).then(function (n) {
+            assert(n, 2);
+            os.close(fd);
+            check_done();
+        });
+    });
+    cli = os.socket(os.AF_INET, os.SOCK_STREAM);
+    os.connect(cli, os.getsockname(srv)[0]);
+    os.writeAsync(cli, new Uint8Array([1, 2]).buffer, 0, 2).then(function (n) {
+        assert(n, 2);
+        os.close(cli);
+    });
+
+    std.loadFileAsync("/tmp/test_std_async_nonexistent").then(function (str) {
+        assert(str, null);
+        check_done();
+    });
+
+    err = null;
+    try {
+        os.readAsync(0, new ArrayBuffer(1), 0, 2);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof RangeError, true);
+
+    timer = os.setTimeout(function () {
+        print("async I/O test timeout");
+        std.exit(1);
+    }, 5000);
+}
+
+function test_profile()
+{
+    var p, f, i;
+
+    function loop(n)
+    {
+        var i, s = 0;
+        for(i = 0; i < n; i++)
+            s += i;
+        return s;
+    }
+
+    os.getProfile(true);
+    os.setProfileSampling(true);
+    for(i = 0; i < 10; i++)
+        loop(10000);
+    os.setProfileSampling(false);
+    p = os.getProfile(true);
+    f = p.functions.find((f) => f.name === "loop");
+    assert(f.calls, 10);
+    assert(f.loops >= 100000, true);
+    assert(f.samples > 0, true);
+    assert(p.samples.length > 0, true);
+    assert(p.samples.some((s) => s.includes(";loop (")), true);
+
+    p = os.getProfile();
+    assert(p.functions.find((f) => f.name === "loop"), undefined);
+    assert(p.samples.length, 0);
+}
+
+function test_gc_stats()
+{
+    var s0, s1, i, a, b;
+
+    /* 'b' is moved to the old generation and then only referenced
+       by young cycles */
+    b = { v: [ 1, 2, 3 ] };
+    std.gc();
+    s0 = std.gcStats();
+    for(i = 0; i < 100000; i++) {
+        a = { b: b };
+        a.self = a;
+        b = null;
+    }
+    a = null;
+    s1 = std.gcStats();
+    assert(s1.youngCount - s0.youngCount >
+           s1.fullCount - s0.fullCount, true);
+    assert(s1.freed - s0.freed > 10000, true);
+    assert(s1.scanned > s0.scanned, true);
+    assert(s1.oldObjects > 0, true);
+
+    s0 = s1;
+    std.gc();
+    s1 = std.gcStats();
+    assert(s1.fullCount, s0.fullCount + 1);
+    assert(s1.youngObjects < s0.youngObjects, true);
 }
 
 test_printf();
@@ -278,4 +639,9 @@ test_popen();
 test_os();
 test_os_exec();
 test_timer();
+test_rw_handlers();
+test_socket();
+test_async_io();
+test_profile();
+test_gc_stats();
 test_ext_json();
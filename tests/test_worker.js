@@ -23,7 +23,7 @@ var worker;
 
 function test_worker()
 {
-    var counter;
+    var counter, burst_counter;
 
     worker = new os.Worker("./test_worker_module.js");
 
@@ -47,9 +47,60 @@ function test_worker()
                 let buf = ev.buf;
                 /* check that the SharedArrayBuffer was modified */
                 assert(buf[2], 10);
-                worker.postMessage({ type: "abort" });
+                /* an ArrayBuffer used by a pending I/O cannot be
+                   transferred */
+                let fname = "/tmp/test_worker_pin.txt";
+                let fd = os.open(fname, os.O_RDWR | os.O_CREAT | os.O_TRUNC, 0o644);
+                let ab = new ArrayBuffer(16), err = null;
+                os.readAsync(fd, ab, 0, 16).then(function (n) {
+                    assert(n, 0);
+                    os.close(fd);
+                    os.remove(fname);
+                });
+                try {
+                    worker.postMessage({ type: "transfer", buf: ab }, [ ab ]);
+                } catch(e) {
+                    err = e;
+                }
+                assert(err instanceof TypeError);
+                assert(ab.byteLength, 16);
+                /* test ArrayBuffer transfer */
+                ab = new ArrayBuffer(1 << 20);
+                buf = new Uint8Array(ab, 16);
+                buf[0] = 1;
+                worker.postMessage({ type: "transfer", buf: buf }, [ ab ]);
+                /* the ArrayBuffer is detached */
+                assert(ab.byteLength, 0);
+                assert(buf.length, 0);
             }
             break;
+        case "transfer_done":
+            {
+                let buf = ev.buf;
+                assert(buf.byteOffset, 16);
+                assert(buf.buffer.byteLength, 1 << 20);
+                assert(buf[0], 2);
+                /* more messages than the size of the message queue */
+                burst_counter = 0;
+                worker.postMessage({ type: "burst", count: 3000 });
+            }
+            break;
+        case "burst_num":
+            /* the order must be kept when the queue overflows */
+            assert(ev.num, burst_counter);
+            burst_counter++;
+            break;
+        case "burst_done":
+            assert(burst_counter, 3000);
+            /* the Date class is not yet created in the worker */
+            worker.postMessage({ type: "date", date: new Date(1234) });
+            break;
+        case "date_done":
+            assert(ev.ok, true);
+            assert(ev.date instanceof Date);
+            assert(ev.date.getTime(), 5678);
+            worker.postMessage({ type: "abort" });
+            break;
         case "done":
             /* terminate */
             worker.onmessage = null;
@@ -58,5 +109,62 @@ function test_worker()
     };
 }
 
+async function test_worker_pool()
+{
+    var pool, tab, res, i, p, err;
+
+    pool = new os.WorkerPool(4, "./test_worker_pool_module.js");
+    assert(pool.size, 4);
+
+    tab = [];
+    for(i = 0; i < 20; i++)
+        tab.push(pool.run("fib", i));
+    tab.push(pool.run("sum", [1, 2, 3, 4]));
+    tab.push(pool.run("sleep", 10, "slept"));
+    res = await Promise.all(tab);
+    for(i = 0; i < 20; i++)
+        assert(res[i], i <= 1 ? i : res[i - 1] + res[i - 2]);
+    assert(res[20], 10);
+    assert(res[21], "slept");
+
+    /* the exceptions are converted to Error objects */
+    err = null;
+    try {
+        await pool.run("fail", "bad task");
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof Error);
+    assert(err.name, "RangeError");
+    assert(err.message, "bad task");
+
+    err = null;
+    try {
+        await pool.run("unknown");
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof Error);
+
+    /* the pool threads are not the main thread */
+    res = await pool.run("main_thread_features");
+    assert(res, "");
+
+    /* the pending tasks are rejected */
+    p = pool.run("sleep", 1000);
+    pool.terminate();
+    assert(pool.size, 0);
+    err = null;
+    try {
+        await p;
+    } catch(e) {
+        err = e;
+    }
+    assert(err.message, "the worker pool was terminated");
+}
 
 test_worker();
+test_worker_pool().catch((e) => {
+    print(e);
+    std.exit(1);
+});
@@ -16,6 +16,24 @@ function handle_msg(e) {
         ev.buf[2] = 10;
         parent.postMessage({ type: "sab_done", buf: ev.buf });
         break;
+    case "transfer":
+        /* modify the transferred ArrayBuffer and send it back */
+        ev.buf[0]++;
+        parent.postMessage({ type: "transfer_done", buf: ev.buf },
+                           [ ev.buf.buffer ]);
+        break;
+    case "burst":
+        for(let i = 0; i < ev.count; i++) {
+            parent.postMessage({ type: "burst_num", num: i });
+        }
+        parent.postMessage({ type: "burst_done" });
+        break;
+    case "date":
+        parent.postMessage({ type: "date_done",
+                             ok: ev.date instanceof Date &&
+                                 ev.date.getTime() === 1234,
+                             date: new Date(5678) });
+        break;
     }
 }
 
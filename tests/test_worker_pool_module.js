@@ -0,0 +1,45 @@
+/* Worker pool code for test_worker.js */
+import * as os from "os";
+
+/* a module arming a timer must not prevent the tasks from running */
+os.setInterval(() => {}, 1000);
+
+export function fib(n) {
+    return n <= 1 ? n : fib(n - 1) + fib(n - 2);
+}
+
+export function sum(a) {
+    var i, s = 0;
+    for(i = 0; i < a.length; i++)
+        s += a[i];
+    return s;
+}
+
+export function sleep(ms, val) {
+    return new Promise((resolve) => os.setTimeout(() => resolve(val), ms));
+}
+
+export function fail(msg) {
+    throw new RangeError(msg);
+}
+
+/* return the names of the main thread features which are available */
+export function main_thread_features() {
+    var res = [];
+    try {
+        os.signal(os.SIGINT, null);
+        res.push("signal");
+    } catch(e) {
+    }
+    try {
+        new os.Worker("./test_worker_module.js");
+        res.push("Worker");
+    } catch(e) {
+    }
+    try {
+        new os.WorkerPool(1, "./test_worker_pool_module.js");
+        res.push("WorkerPool");
+    } catch(e) {
+    }
+    return res.join(",");
+}